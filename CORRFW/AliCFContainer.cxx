@@ -31,6 +31,8 @@
 //____________________________________________________________________
 ClassImp(AliCFContainer)
 
+Long64_t AliCFContainer::fgMaxDenseBins = 65536;
+
 //____________________________________________________________________
 AliCFContainer::AliCFContainer() : 
   AliCFFrame(),
@@ -57,6 +59,7 @@ AliCFContainer::AliCFContainer(const Char_t* name, const Char_t* title, const In
   for (Int_t istep=0; istep<fNStep; istep++) {
     fGrid[istep] = new AliCFGridSparse(Form("%s_SelStep%d",name,istep),Form("step%d",istep),nVarIn,nBinIn);
     fGrid[istep]->SumW2();
+    fGrid[istep]->UseDenseStorage(fgMaxDenseBins);
   }
   for (Int_t iVar=0; iVar<nVarIn; iVar++) SetVarTitle(iVar,Form("var%d",iVar));
   AliInfo(Form("Grids created for %d steps required  \n =>  Don't forget to set the bin limits !!",fNStep));
@@ -88,6 +88,11 @@ class AliCFContainer : public AliCFFrame
 
   virtual void  Scale(Double_t factor) const;
 
+  // grids of at most nBins bins per step (under/overflows included) are filled
+  // through dense arrays instead of the THnSparse, set before creating the container
+  static void     SetMaxDenseBins(Long64_t nBins) {fgMaxDenseBins=nBins;}
+  static Long64_t GetMaxDenseBins() {return fgMaxDenseBins;}
+
   /****   TO BE REMOVED SOON ******/
   virtual TH1D* ShowProjection( Int_t ivar,  Int_t istep)                          const {return (TH1D*)Project(istep,ivar);}
   virtual TH2D* ShowProjection( Int_t ivar1, Int_t ivar2, Int_t istep)             const {return (TH2D*)Project(istep,ivar1,ivar2);}
@@ -96,6 +101,7 @@ class AliCFContainer : public AliCFFrame
  private:
   Int_t    fNStep; //number of selection steps
   AliCFGridSparse **fGrid;//[fNStep]
+  static Long64_t fgMaxDenseBins; // max number of bins per step for the dense fill storage (<=0: disabled)
   
   ClassDef(AliCFContainer,5);
 };
@@ -33,6 +33,7 @@
 #include "TH2D.h"
 #include "TH3D.h"
 #include "TAxis.h"
+#include "TBuffer.h"
 #include "AliCFUnfolding.h"
 
 //____________________________________________________________________
@@ -42,7 +43,11 @@ ClassImp(AliCFGridSparse)
 AliCFGridSparse::AliCFGridSparse() : 
   AliCFFrame(),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseContent(0x0),
+  fDenseSumW2(0x0),
+  fDenseNCells(0),
+  fDenseNFills(0)
 {
   // default constructor
 }
@@ -50,7 +55,11 @@ AliCFGridSparse::AliCFGridSparse() :
 AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title) : 
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseContent(0x0),
+  fDenseSumW2(0x0),
+  fDenseNCells(0),
+  fDenseNFills(0)
 {
   // default constructor
 }
@@ -58,7 +67,11 @@ AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title) :
 AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title, Int_t nVarIn, const Int_t * nBinIn) :  
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseContent(0x0),
+  fDenseSumW2(0x0),
+  fDenseNCells(0),
+  fDenseNFills(0)
 {
   //
   // main constructor
@@ -74,13 +87,19 @@ AliCFGridSparse::~AliCFGridSparse()
   // destructor
   //
   if (fData) delete fData;
+  delete [] fDenseContent;
+  delete [] fDenseSumW2;
 }
 
 //____________________________________________________________________
 AliCFGridSparse::AliCFGridSparse(const AliCFGridSparse& c) :
   AliCFFrame(c),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseContent(0x0),
+  fDenseSumW2(0x0),
+  fDenseNCells(0),
+  fDenseNFills(0)
 {
   //
   // copy constructor
@@ -128,7 +147,111 @@ void AliCFGridSparse::Fill(const Double_t *var, Double_t weight)
   // given a set of values of the input variable, 
   // with weight (by default w=1)
   //
-  fData->Fill(var,weight);
+  if (!fDenseContent) {
+    fData->Fill(var,weight);
+    return;
+  }
+
+  // dense storage: same bin search as THnSparse::GetBin, under/overflows included
+  Long64_t cell = 0;
+  for (Int_t iVar=GetNVar()-1; iVar>=0; iVar--) {
+    TAxis* axis = fData->GetAxis(iVar);
+    cell = cell * (axis->GetNbins()+2) + axis->FindBin(var[iVar]);
+  }
+  if (!fDenseSumW2 && fData->GetCalculateErrors()) {
+    FlushDense();
+    fDenseSumW2 = new Double_t[fDenseNCells];
+    memset(fDenseSumW2, 0, sizeof(Double_t) * fDenseNCells);
+  }
+  fDenseContent[cell] += weight;
+  if (fDenseSumW2) fDenseSumW2[cell] += weight*weight;
+  fDenseNFills++;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::UseDenseStorage(Long64_t maxCells)
+{
+  //
+  // Fill a dense array of bin contents instead of the THnSparse if the grid
+  // has at most maxCells cells, under/overflows included (maxCells<=0: never).
+  // The contents are transferred to the THnSparse whenever it is accessed
+  // or streamed, the interface is unchanged.
+  //
+  ReleaseDense();
+  if (!fData || maxCells<=0) return;
+
+  Long64_t nCells = 1;
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) {
+    TAxis* axis = fData->GetAxis(iVar);
+    if (axis->CanExtend()) return; // the number of bins may change when filling
+    nCells *= axis->GetNbins()+2;
+    if (nCells > maxCells) return;
+  }
+  fDenseNCells = nCells;
+  fDenseContent = new Double_t[fDenseNCells];
+  memset(fDenseContent, 0, sizeof(Double_t) * fDenseNCells);
+  if (fData->GetCalculateErrors()) {
+    fDenseSumW2 = new Double_t[fDenseNCells];
+    memset(fDenseSumW2, 0, sizeof(Double_t) * fDenseNCells);
+  }
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::FlushDense() const
+{
+  //
+  // Transfer the contents of the dense storage to the THnSparse.
+  // Each filled cell is filled once at its bin center with the sum of its
+  // weights, the squared weights and the number of entries are then restored.
+  //
+  if (!fDenseContent || !fDenseNFills) return;
+
+  const Int_t nVar = GetNVar();
+  const Bool_t errors = fData->GetCalculateErrors();
+  const Double_t entries = fData->GetEntries();
+  Int_t* bin = new Int_t[nVar];
+  Double_t* x = new Double_t[nVar];
+  for (Long64_t cell=0; cell<fDenseNCells; cell++) {
+    const Double_t content = fDenseContent[cell];
+    const Double_t sumW2 = fDenseSumW2 ? fDenseSumW2[cell] : content*content;
+    if (content==0. && sumW2==0.) continue;
+
+    Long64_t rest = cell;
+    for (Int_t iVar=0; iVar<nVar; iVar++) {
+      TAxis* axis = fData->GetAxis(iVar);
+      const Int_t nCells = axis->GetNbins()+2;
+      bin[iVar] = rest % nCells;
+      rest /= nCells;
+      x[iVar] = axis->GetBinCenter(bin[iVar]);
+    }
+    Long64_t index = fData->GetBin(bin); // allocates the cell
+    Double_t error2 = errors ? fData->GetBinError2(index) : 0.;
+    // fill at the bin center to keep the axis statistics, unless rounding moves it
+    if (fData->GetBin(x,kFALSE) == index) fData->Fill(x,content);
+    else fData->FillBin(index,content);
+    if (errors) fData->SetBinError2(index, error2 + sumW2);
+
+    fDenseContent[cell] = 0.;
+    if (fDenseSumW2) fDenseSumW2[cell] = 0.;
+  }
+  fData->SetEntries(entries + fDenseNFills);
+  fDenseNFills = 0;
+  delete [] bin;
+  delete [] x;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::ReleaseDense()
+{
+  //
+  // Transfer the dense contents and go back to filling the THnSparse
+  //
+  FlushDense();
+  delete [] fDenseContent;
+  delete [] fDenseSumW2;
+  fDenseContent = 0x0;
+  fDenseSumW2 = 0x0;
+  fDenseNCells = 0;
 }
 
 //___________________________________________________________________
@@ -140,6 +263,7 @@ AliCFGridSparse* AliCFGridSparse::MakeSlice(Int_t nVars, const Int_t* vars, cons
   // If useBins=true, varMin and varMax are taken as bin numbers
   //
 
+  FlushDense();
   // binning for new grid
   Int_t* bins = new Int_t[nVars];
   for (Int_t iVar=0; iVar<nVars; iVar++) {
@@ -192,6 +316,7 @@ Float_t AliCFGridSparse::GetEntries() const
   // total entries (including overflows and underflows)
   //
 
+  FlushDense();
   return fData->GetEntries();
 }
 
@@ -202,6 +327,7 @@ Float_t AliCFGridSparse::GetElement(Long_t index) const
   // Returns content of grid element index 
   //
   
+  FlushDense();
   return fData->GetBinContent(index);
 }
 //____________________________________________________________________
@@ -210,6 +336,7 @@ Float_t AliCFGridSparse::GetElement(const Int_t *bin) const
   //
   // Get the content in a bin corresponding to a set of bin indexes
   //
+  FlushDense();
   return fData->GetBinContent(bin);
 
 }  
@@ -220,6 +347,7 @@ Float_t AliCFGridSparse::GetElement(const Double_t *var) const
   // Get the content in a bin corresponding to a set of input variables
   //
 
+  FlushDense();
   Long_t index = fData->GetBin(var,kFALSE);
   if (index<0) return 0.;
   return fData->GetBinContent(index);
@@ -232,6 +360,7 @@ Float_t AliCFGridSparse::GetElementError(Long_t index) const
   // Returns the error on the content 
   //
 
+  FlushDense();
   return fData->GetBinError(index);
 }
 //____________________________________________________________________
@@ -240,6 +369,7 @@ Float_t AliCFGridSparse::GetElementError(const Int_t *bin) const
  //
   // Get the error in a bin corresponding to a set of bin indexes
   //
+  FlushDense();
   return fData->GetBinError(bin);
 
 }  
@@ -250,6 +380,7 @@ Float_t AliCFGridSparse::GetElementError(const Double_t *var) const
   // Get the error in a bin corresponding to a set of input variables
   //
 
+  FlushDense();
   Long_t index=fData->GetBin(var,kFALSE); //this is the THnSparse index (do not allocate new cells if content is empy)
   if (index<0) return 0.;
   return fData->GetBinError(index);
@@ -261,6 +392,7 @@ void AliCFGridSparse::SetElement(Long_t index, Float_t val)
   //
   // Sets grid element value
   //
+  FlushDense();
   Int_t* bin = new Int_t[GetNVar()];
   fData->GetBinContent(index,bin); //affects the bin coordinates
   SetElement(bin,val);
@@ -273,6 +405,7 @@ void AliCFGridSparse::SetElement(const Int_t *bin, Float_t val)
   //
   // Sets grid element of bin indeces bin to val
   //
+  FlushDense();
   fData->SetBinContent(bin,val);
 }
 //____________________________________________________________________
@@ -281,6 +414,7 @@ void AliCFGridSparse::SetElement(const Double_t *var, Float_t val)
   //
   // Set the content in a bin to value val corresponding to a set of input variables
   //
+  FlushDense();
   Long_t index=fData->GetBin(var,kTRUE); //THnSparse index: allocate the cell
   Int_t *bin = new Int_t[GetNVar()];
   fData->GetBinContent(index,bin); //trick to access the array of bins
@@ -294,6 +428,7 @@ void AliCFGridSparse::SetElementError(Long_t index, Float_t val)
   //
   // Sets grid element iel error to val (linear indexing) in AliCFFrame
   //
+  FlushDense();
   Int_t *bin = new Int_t[GetNVar()];
   fData->GetBinContent(index,bin);
   SetElementError(bin,val);
@@ -306,6 +441,7 @@ void AliCFGridSparse::SetElementError(const Int_t *bin, Float_t val)
   //
   // Sets grid element error of bin indeces bin to val
   //
+  FlushDense();
   fData->SetBinError(bin,val);
 }
 //____________________________________________________________________
@@ -314,6 +450,7 @@ void AliCFGridSparse::SetElementError(const Double_t *var, Float_t val)
   //
   // Set the error in a bin to value val corresponding to a set of input variables
   //
+  FlushDense();
   Long_t index=fData->GetBin(var); //THnSparse index
   Int_t *bin = new Int_t[GetNVar()];
   fData->GetBinContent(index,bin); //trick to access the array of bins
@@ -327,6 +464,7 @@ void AliCFGridSparse::SumW2()
   //
   //set calculation of the squared sum of the weighted entries
   //
+  FlushDense();
   if(!fSumW2){
     fData->CalculateErrors(kTRUE); 
   }
@@ -340,6 +478,7 @@ void AliCFGridSparse::Add(const AliCFGridSparse* aGrid, Double_t c)
   //add aGrid to the current one
   //
 
+  FlushDense();
   if (aGrid->GetNVar() != GetNVar()){
     AliError("Different number of variables, cannot add the grids");
     return;
@@ -356,6 +495,7 @@ void AliCFGridSparse::Add(const AliCFGridSparse* aGrid1, const AliCFGridSparse*
   //Add aGrid1 and aGrid2 and deposit the result into the current one
   //
 
+  FlushDense();
   if (GetNVar() != aGrid1->GetNVar() || GetNVar() != aGrid2->GetNVar()) {
     AliInfo("Different number of variables, cannot add the grids");
     return;
@@ -375,6 +515,7 @@ void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid, Double_t c)
   // Multiply aGrid to the current one
   //
 
+  FlushDense();
   if (aGrid->GetNVar() != GetNVar()) {
     AliError("Different number of variables, cannot multiply the grids");
     return;
@@ -393,6 +534,7 @@ void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid1, const AliCFGridSpa
   //Multiply aGrid1 and aGrid2 and deposit the result into the current one
   //
 
+  FlushDense();
   if (GetNVar() != aGrid1->GetNVar() || GetNVar() != aGrid2->GetNVar()) {
     AliError("Different number of variables, cannot multiply the grids");
     return;
@@ -415,6 +557,7 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid, Double_t c)
   // Divide aGrid to the current one
   //
 
+  FlushDense();
   if (aGrid->GetNVar() != GetNVar()) {
     AliError("Different number of variables, cannot divide the grids");
     return;
@@ -436,6 +579,7 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid1, const AliCFGridSpars
   //binomial errors are supported
   //
 
+  FlushDense();
   if (GetNVar() != aGrid1->GetNVar() || GetNVar() != aGrid2->GetNVar()) {
     AliError("Different number of variables, cannot divide the grids");
     return;
@@ -456,7 +600,9 @@ void AliCFGridSparse::Rebin(const Int_t* group)
   // rebin the grid according to Rebin() as in THnSparse
   // Please notice that the original number of bins on
   // a given axis has to be divisible by the rebin group.
+  // The dense storage, if any, is not used for the rebinned grid.
   //
+  ReleaseDense();
 
   for(Int_t i=0;i<GetNVar();i++){
     if (group[i]!=1) AliInfo(Form(" merging bins along dimension %i in groups of %i bins", i,group[i]));
@@ -553,6 +699,7 @@ Double_t AliCFGridSparse::GetIntegral() const
   //
   // Get full Integral
   //
+  FlushDense();
   return fData->ComputeIntegral();  
 } 
 
@@ -605,6 +752,8 @@ void AliCFGridSparse::Copy(TObject& c) const
   //
   AliCFFrame::Copy(c);
   AliCFGridSparse& target = (AliCFGridSparse &) c;
+  FlushDense();
+  target.ReleaseDense();
   target.fSumW2 = fSumW2 ;
   if (fData) {
     target.fData = (THnSparse*)fData->Clone();
@@ -621,6 +770,7 @@ TH1* AliCFGridSparse::Slice(Int_t iVar1, Int_t iVar2, Int_t iVar3, const Double_
   // If useBins=true, varMin and varMax are taken as bin numbers
   // if varmin or varmax point to null, all the range is taken, including over- and underflows
 
+  FlushDense();
   THnSparse* clone = (THnSparse*)fData->Clone();
   if (varMin != 0x0 && varMax != 0x0) {
     for (Int_t iAxis=0; iAxis<GetNVar(); iAxis++) SetAxisRange(clone->GetAxis(iAxis),varMin[iAxis],varMax[iAxis],useBins);
@@ -746,6 +896,7 @@ Float_t AliCFGridSparse::GetOverFlows(Int_t ivar, Bool_t exclusive) const
   // Returns overflows in variable ivar
   // Set 'exclusive' to true for an exclusive check on variable ivar
   //
+  FlushDense();
   Int_t* bin = new Int_t[GetNVar()];
   memset(bin, 0, sizeof(Int_t) * GetNVar());
   Float_t ovfl=0.;
@@ -772,6 +923,7 @@ Float_t AliCFGridSparse::GetUnderFlows(Int_t ivar, Bool_t exclusive) const
   // Returns exclusive overflows in variable ivar
   // Set 'exclusive' to true for an exclusive check on variable ivar
   //
+  FlushDense();
   Int_t* bin = new Int_t[GetNVar()];
   memset(bin, 0, sizeof(Int_t) * GetNVar());
   Float_t unfl=0.;
@@ -798,8 +950,23 @@ void AliCFGridSparse::Smooth() {
   // smoothing function: TO USE WITH CARE
   //
 
+  FlushDense();
   AliInfo("Your GridSparse is going to be smoothed");
   AliInfo(Form("N TOTAL  BINS : %li",GetNBinsTotal()));
   AliInfo(Form("N FILLED BINS : %li",GetNFilledBins()));
   AliCFUnfolding::SmoothUsingNeighbours(fData);
 }
+
+//____________________________________________________________________
+void AliCFGridSparse::Streamer(TBuffer& buffer)
+{
+  //
+  // custom streamer: the dense contents are transferred to the THnSparse before writing
+  //
+  if (buffer.IsReading()) {
+    buffer.ReadClassBuffer(AliCFGridSparse::Class(), this);
+  } else {
+    FlushDense();
+    buffer.WriteClassBuffer(AliCFGridSparse::Class(), this);
+  }
+}
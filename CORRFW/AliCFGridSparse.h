@@ -37,7 +37,7 @@ class AliCFGridSparse : public AliCFFrame
   virtual void       GetBinLimits(Int_t ivar, Double_t * array) const ;
   virtual Double_t * GetBinLimits(Int_t ivar) const ;
   virtual Long_t     GetNBinsTotal() const ;
-  virtual Long_t     GetNFilledBins() const {return fData->GetNbins();}
+  virtual Long_t     GetNFilledBins() const {FlushDense(); return fData->GetNbins();}
   virtual Int_t      GetNBins(Int_t ivar) const {return fData->GetAxis(ivar)->GetNbins();}
   virtual Int_t *    GetNBins() const ;
   virtual Float_t    GetBinCenter(Int_t ivar,Int_t ibin) const ;
@@ -56,6 +56,8 @@ class AliCFGridSparse : public AliCFFrame
   //virtual Int_t      GetBinIndex(Int_t ivar, Int_t ind) const ;
 
   virtual void    Fill(const Double_t *var, Double_t weight=1.);
+  virtual void    UseDenseStorage(Long64_t maxCells); // fill dense arrays instead of the THnSparse for small grids
+  Bool_t          IsDenseStorage() const {return fDenseContent!=0x0;}
   virtual Float_t GetEntries()const;
   virtual Float_t GetElement(Long_t iel)               const; 
   virtual Float_t GetElement(const Int_t *bin)         const; 
@@ -99,8 +101,8 @@ class AliCFGridSparse : public AliCFFrame
   //virtual Double_t GetIntegral(const Double_t *varMin, const Double_t *varMax) const;
   virtual Long64_t Merge(TCollection* list);
 
-  virtual void     SetGrid(THnSparse* grid) {if (fData) delete fData ; fData=grid;}
-  THnSparse   *    GetGrid() const {return fData;}
+  virtual void     SetGrid(THnSparse* grid) {ReleaseDense(); if (fData) delete fData ; fData=grid;}
+  THnSparse   *    GetGrid() const {FlushDense(); return fData;}
 
   virtual Float_t GetOverFlows (Int_t var, Bool_t excl=kFALSE) const;
   virtual Float_t GetUnderFlows(Int_t var, Bool_t excl=kFALSE) const;
@@ -118,11 +120,19 @@ class AliCFGridSparse : public AliCFFrame
   void     SetAxisRange(TAxis* axis, Double_t min, Double_t max, Bool_t useBins) const;
   void     GetProjectionName (TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
   void     GetProjectionTitle(TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
+  void     FlushDense() const;
+  void     ReleaseDense();
 
   // data members:
   Bool_t      fSumW2    ; // Flag to check if calculation of squared weights enabled
   THnSparse  *fData     ; // The data Container: a THnSparse  
 
+  // dense fill storage, cells ordered as the bins with under/overflows, first variable fastest
+  mutable Double_t *fDenseContent; //! sum of weights per cell, not yet in fData
+  mutable Double_t *fDenseSumW2;   //! sum of squared weights per cell, not yet in fData
+  Long64_t          fDenseNCells;  //! number of cells of the dense storage
+  mutable Long64_t  fDenseNFills;  //! number of fills not yet in fData
+
   ClassDef(AliCFGridSparse,3);
 };
 
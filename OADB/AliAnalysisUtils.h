@@ -55,6 +55,10 @@ class AliAnalysisUtils : public TObject {
   void SetMaxPlpChi2MV(Float_t maxPlpChi2MV) { fMaxPlpChi2MV = maxPlpChi2MV;}
   void SetMinWDistMV(Float_t minWDistMV) { fMinWDistMV = minWDistMV;}
   void SetCheckPlpFromDifferentBCMV(Bool_t checkPlpFromDifferentBCMV) { fCheckPlpFromDifferentBCMV = checkPlpFromDifferentBCMV;}
+  Int_t   GetMinPlpContribMV() const { return fMinPlpContribMV; }
+  Float_t GetMaxPlpChi2MV() const { return fMaxPlpChi2MV; }
+  Float_t GetMinWDistMV() const { return fMinWDistMV; }
+  Bool_t  GetCheckPlpFromDifferentBCMV() const { return fCheckPlpFromDifferentBCMV; }
   //SPD Pileup slection
   void SetMinPlpContribSPD(Int_t minPlpContribSPD) { fMinPlpContribSPD = minPlpContribSPD;}
   void SetMinPlpZdistSPD(Float_t minPlpZdistSPD) { fMinPlpZdistSPD = minPlpZdistSPD;}
@@ -0,0 +1,253 @@
+/**************************************************************************
+ * Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//*****************************************************
+//   Class AliEPCalibrationCache
+//   Per-run event-plane calibration in flat arrays,
+//   the bin lookups reproduce the ones of the
+//   calibration histograms (see AliEPSelectionTask,
+//   AliFMDEventPlaneFinder)
+//*****************************************************
+
+#include "AliEPCalibrationCache.h"
+
+#include <algorithm>
+#include <TList.h>
+#include <TROOT.h>
+#include <TH1.h>
+#include <TH2.h>
+#include <TProfile.h>
+#include "AliVEvent.h"
+#include "AliAnalysisManager.h"
+
+ClassImp(AliEPCalibrationCache)
+ClassImp(AliEPQVectorContainer)
+
+//________________________________________________________________________
+AliEPCalibrationCache::AliEPCalibrationCache(const char *name):
+  TNamed(name,"event-plane calibration cache"),
+  fRunNumber(-1),
+  fNEtaBins2D(0),
+  fNPhiBins2D(0),
+  fPhiWeight2D(),
+  fNCentBins(0),
+  fCentMin(0.),
+  fCentMax(0.),
+  fCentEdges(),
+  fQMean(),
+  fQRms()
+{
+  // Constructor
+  for (Int_t i = 0; i < kNPhiWeights; i++) fNPhiBins[i] = 0;
+}
+
+//________________________________________________________________________
+AliEPCalibrationCache::~AliEPCalibrationCache()
+{
+  // Destructor
+}
+
+//________________________________________________________________________
+AliEPCalibrationCache* AliEPCalibrationCache::Get(const char *key)
+{
+  // shared instance for the calibration source "key", created on first use
+  // the instances are owned by a list in gROOT's specials, deleted with gROOT
+  const char *listName = "AliEPCalibrationCaches";
+  TList *caches = (TList*)gROOT->GetListOfSpecials()->FindObject(listName);
+  if (!caches) {
+    caches = new TList;
+    caches->SetName(listName);
+    caches->SetOwner(kTRUE);
+    gROOT->GetListOfSpecials()->Add(caches);
+  }
+  AliEPCalibrationCache *cache = (AliEPCalibrationCache*)caches->FindObject(key);
+  if (!cache) {
+    cache = new AliEPCalibrationCache(key);
+    caches->Add(cache);
+  }
+  return cache;
+}
+
+//________________________________________________________________________
+void AliEPCalibrationCache::SetRunNumber(Int_t run)
+{
+  // set the run of the tables, the tables of another run are cleared
+  if (fRunNumber == run) return;
+  fRunNumber = run;
+  for (Int_t i = 0; i < kNPhiWeights; i++) {
+    fNPhiBins[i] = 0;
+    fPhiWeight[i].clear();
+  }
+  fNEtaBins2D = fNPhiBins2D = 0;
+  fPhiWeight2D.clear();
+  fNCentBins = 0;
+  fCentEdges.clear();
+  fQMean.clear();
+  fQRms.clear();
+}
+
+//________________________________________________________________________
+void AliEPCalibrationCache::SetPhiWeights(Int_t index, const TH1 *phiDist)
+{
+  // phi weights of selection index from the phi distribution
+  if (index < 0 || index >= kNPhiWeights) return;
+  fNPhiBins[index] = 0;
+  fPhiWeight[index].clear();
+  if (!phiDist) return;
+
+  const Int_t n = phiDist->GetNbinsX();
+  const Double_t nParticles = phiDist->Integral();
+  fPhiWeight[index].assign(n+2,1.);
+  for (Int_t bin = 0; bin <= n+1; bin++) {
+    Double_t value = phiDist->GetBinContent(bin);
+    if (value > 0) fPhiWeight[index][bin] = nParticles/n/value;
+  }
+  fNPhiBins[index] = n;
+}
+
+//________________________________________________________________________
+void AliEPCalibrationCache::SetPhiWeights2D(const TH2 *phiDist)
+{
+  // phi weights per (eta bin, phi bin) from the 2D distribution
+  fNEtaBins2D = fNPhiBins2D = 0;
+  fPhiWeight2D.clear();
+  if (!phiDist) return;
+
+  const Int_t nEta = phiDist->GetNbinsX();
+  const Int_t nPhi = phiDist->GetNbinsY();
+  fPhiWeight2D.assign((nEta+2)*(nPhi+2),1.);
+  for (Int_t e = 0; e <= nEta+1; e++) {
+    Double_t nParticles = phiDist->GetBinContent(e,0);
+    for (Int_t p = 0; p <= nPhi+1; p++) {
+      Double_t value = phiDist->GetBinContent(e,p);
+      if (value > 0) fPhiWeight2D[e + (nEta+2)*p] = nParticles/nPhi/value;
+    }
+  }
+  fNEtaBins2D = nEta;
+  fNPhiBins2D = nPhi;
+}
+
+//________________________________________________________________________
+void AliEPCalibrationCache::SetRecentering(const TProfile *qx, const TProfile *qy)
+{
+  // mean (bin content) and rms (bin error, 1 if 0) of Qx and Qy per centrality bin
+  fNCentBins = 0;
+  fCentEdges.clear();
+  fQMean.clear();
+  fQRms.clear();
+  if (!qx || !qy) return;
+
+  const TAxis *axis = qx->GetXaxis();
+  const Int_t n = axis->GetNbins();
+  fCentMin = axis->GetXmin();
+  fCentMax = axis->GetXmax();
+  if (axis->GetXbins()->GetSize()) {
+    fCentEdges.resize(n+1);
+    for (Int_t bin = 1; bin <= n+1; bin++) fCentEdges[bin-1] = axis->GetBinLowEdge(bin);
+  }
+  fQMean.resize(2*(n+2));
+  fQRms.resize(2*(n+2));
+  for (Int_t bin = 0; bin <= n+1; bin++) {
+    fQMean[2*bin]   = qx->GetBinContent(bin);
+    fQMean[2*bin+1] = qy->GetBinContent(bin);
+    fQRms[2*bin]    = qx->GetBinError(bin);
+    fQRms[2*bin+1]  = qy->GetBinError(bin);
+    // protection against division by zero
+    if (fQRms[2*bin] == 0.0) fQRms[2*bin] = 1.0;
+    if (fQRms[2*bin+1] == 0.0) fQRms[2*bin+1] = 1.0;
+  }
+  fNCentBins = n;
+}
+
+//________________________________________________________________________
+void AliEPCalibrationCache::GetRecentering(Double_t centrality, Double_t mean[2], Double_t rms[2]) const
+{
+  // recentering values of the centrality bin (TAxis::FindBin())
+  if (!HasRecentering()) {
+    mean[0] = mean[1] = 0.;
+    rms[0] = rms[1] = 1.;
+    return;
+  }
+  Int_t bin;
+  if (centrality < fCentMin) bin = 0;
+  else if (!(centrality < fCentMax)) bin = fNCentBins+1;
+  else if (fCentEdges.empty()) bin = 1 + Int_t(fNCentBins*(centrality-fCentMin)/(fCentMax-fCentMin));
+  else bin = std::upper_bound(fCentEdges.begin(),fCentEdges.end(),centrality) - fCentEdges.begin();
+  mean[0] = fQMean[2*bin];
+  mean[1] = fQMean[2*bin+1];
+  rms[0]  = fQRms[2*bin];
+  rms[1]  = fQRms[2*bin+1];
+}
+
+//________________________________________________________________________
+AliEPQVectorContainer::AliEPQVectorContainer():
+  TNamed("AliEPQVectorContainer","event-plane Q vectors of the event"),
+  fEventId(0),
+  fEntry(-1),
+  fResults()
+{
+  // Constructor
+}
+
+//________________________________________________________________________
+AliEPQVectorContainer* AliEPQVectorContainer::Get(AliVEvent *event)
+{
+  // container attached to the event, shared by the event-plane tasks of the
+  // train; it is reset when the first task sees a new event (identified by
+  // the bunch crossing, the time stamp and the entry of the analysis manager)
+  if (!event) return 0;
+  ULong_t id = ((ULong_t)(event->GetBunchCrossNumber()) << 32) + event->GetTimeStamp();
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  AliEPQVectorContainer *cont = (AliEPQVectorContainer*)event->FindListObject("AliEPQVectorContainer");
+  if (!cont) {
+    cont = new AliEPQVectorContainer;
+    event->AddObject(cont);
+    cont->Reset(id, entry);
+  }
+  else if (cont->fEventId != id || cont->fEntry != entry) cont->Reset(id, entry);
+  return cont;
+}
+
+//________________________________________________________________________
+void AliEPQVectorContainer::Reset(ULong_t id, Long64_t entry)
+{
+  // new event, the results of the previous one are dropped
+  fEventId = id;
+  fEntry = entry;
+  fResults.clear();
+}
+
+//________________________________________________________________________
+const AliEPQVectorContainer::QResult* AliEPQVectorContainer::Find(const char *key) const
+{
+  // result of the configuration "key", 0 if not computed for this event
+  for (size_t i = 0; i < fResults.size(); i++)
+    if (fResults[i].fKey == key) return &fResults[i];
+  return 0;
+}
+
+//________________________________________________________________________
+AliEPQVectorContainer::QResult& AliEPQVectorContainer::Add(const char *key)
+{
+  // new result for the configuration "key"
+  fResults.push_back(QResult());
+  QResult &result = fResults.back();
+  result.fKey = key;
+  result.fQ[0] = result.fQ[1] = 0.;
+  result.fQsub1[0] = result.fQsub1[1] = 0.;
+  result.fQsub2[0] = result.fQsub2[1] = 0.;
+  return result;
+}
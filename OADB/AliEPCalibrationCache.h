@@ -0,0 +1,142 @@
+#ifndef ALIEPCALIBRATIONCACHE_H
+#define ALIEPCALIBRATIONCACHE_H
+
+/* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//*****************************************************
+//   Class AliEPCalibrationCache
+//   Per-run event-plane calibration in flat arrays:
+//   phi weights (1D per track selection, 2D eta x phi bins)
+//   and Q-vector recentering (mean, rms per centrality bin).
+//   Instances returned by Get() are shared by all users
+//   of the same calibration source in the process, the
+//   tables are filled once per run by the first user.
+//
+//   Class AliEPQVectorContainer
+//   Per-event Q-vector results attached to the event,
+//   computed by the first event-plane task of a given
+//   configuration and read by the following ones.
+//*****************************************************
+
+#include <string>
+#include <vector>
+#include <TNamed.h>
+#include <TMath.h>
+
+class TH1;
+class TH2;
+class TProfile;
+class AliVEvent;
+
+class AliEPCalibrationCache : public TNamed {
+
+ public:
+
+  enum { kNPhiWeights = 4 };
+
+  AliEPCalibrationCache(const char *name = "AliEPCalibrationCache");
+  virtual ~AliEPCalibrationCache();
+
+  // shared instance for the calibration source "key"
+  static AliEPCalibrationCache* Get(const char *key);
+
+  // tables are valid for one run, SetRunNumber() of a new run clears them
+  Bool_t IsValid(Int_t run) const            { return fRunNumber == run; }
+  Int_t  GetRunNumber() const                { return fRunNumber; }
+  void   SetRunNumber(Int_t run);
+
+  // phi weights nParticles/nPhiBins/content from the phi distribution
+  // (1 for empty bins), index - track selection (0..kNPhiWeights-1)
+  void     SetPhiWeights(Int_t index, const TH1 *phiDist);
+  Bool_t   HasPhiWeights(Int_t index) const  { return index >= 0 && index < kNPhiWeights && fNPhiBins[index] > 0; }
+  Double_t GetPhiWeight(Int_t index, Double_t phi) const;
+
+  // phi weights per (eta bin, phi bin) from a 2D distribution with
+  // nParticles per eta bin stored in the phi underflow bin
+  void     SetPhiWeights2D(const TH2 *phiDist);
+  Bool_t   HasPhiWeights2D() const           { return fNEtaBins2D > 0; }
+  Double_t GetPhiWeight2D(Int_t etaBin, Int_t phiBin) const;
+
+  // mean and rms of the Q-vector components per centrality bin
+  void   SetRecentering(const TProfile *qx, const TProfile *qy);
+  Bool_t HasRecentering() const              { return fNCentBins > 0; }
+  void   GetRecentering(Double_t centrality, Double_t mean[2], Double_t rms[2]) const;
+
+ private:
+
+  AliEPCalibrationCache(const AliEPCalibrationCache&);
+  AliEPCalibrationCache& operator= (const AliEPCalibrationCache&);
+
+  Int_t    fRunNumber;                          //! run of the tables
+  Int_t    fNPhiBins[kNPhiWeights];             //! number of phi bins of the 1D weights
+  std::vector<Double_t> fPhiWeight[kNPhiWeights]; //! 1D weights, bins 0..n+1
+  Int_t    fNEtaBins2D;                         //! number of eta bins of the 2D weights
+  Int_t    fNPhiBins2D;                         //! number of phi bins of the 2D weights
+  std::vector<Double_t> fPhiWeight2D;           //! 2D weights, (n+2)x(m+2) bins
+  Int_t    fNCentBins;                          //! number of centrality bins
+  Double_t fCentMin;                            //! lower edge of the centrality axis
+  Double_t fCentMax;                            //! upper edge of the centrality axis
+  std::vector<Double_t> fCentEdges;             //! centrality bin edges (variable binning)
+  std::vector<Double_t> fQMean;                 //! mean Qx,Qy per centrality bin 0..n+1
+  std::vector<Double_t> fQRms;                  //! rms Qx,Qy per centrality bin 0..n+1
+
+  ClassDef(AliEPCalibrationCache,1);
+};
+
+class AliEPQVectorContainer : public TNamed {
+
+ public:
+
+  AliEPQVectorContainer();
+
+  /// Q vectors of the event for one task configuration
+  struct QResult {
+    std::string fKey;                   // configuration of the task
+    Double_t fQ[2];                     // full event Q vector
+    Double_t fQsub1[2];                 // Q vector of subevent 1
+    Double_t fQsub2[2];                 // Q vector of subevent 2
+    std::vector<Double_t> fPhiWeight;   // phi weights of the selected tracks
+  };
+
+  // container of the event, reset when a new event is seen
+  static AliEPQVectorContainer* Get(AliVEvent *event);
+
+  void           Reset(ULong_t id, Long64_t entry);
+  const QResult* Find(const char *key) const;
+  QResult&       Add(const char *key);
+
+ private:
+
+  ULong_t  fEventId;                    //! bunch crossing and time stamp of the event
+  Long64_t fEntry;                      //! entry of the analysis manager for the event
+  std::vector<QResult> fResults;        //! results of this event
+
+  ClassDef(AliEPQVectorContainer,1);
+};
+
+//________________________________________________________________________
+inline Double_t AliEPCalibrationCache::GetPhiWeight(Int_t index, Double_t phi) const
+{
+  // same bin as TH1::GetBinContent(1+FloorNint(phi*nPhiBins/TwoPi()))
+  if (!HasPhiWeights(index)) return 1.;
+  const Int_t n = fNPhiBins[index];
+  Int_t bin = 1 + TMath::FloorNint(phi*n/TMath::TwoPi());
+  if (bin < 0) bin = 0;
+  if (bin > n+1) bin = n+1;
+  return fPhiWeight[index][bin];
+}
+
+//________________________________________________________________________
+inline Double_t AliEPCalibrationCache::GetPhiWeight2D(Int_t etaBin, Int_t phiBin) const
+{
+  // same bins as TH2::GetBinContent(etaBin,phiBin)
+  if (!HasPhiWeights2D()) return 1.;
+  if (etaBin < 0) etaBin = 0;
+  if (etaBin > fNEtaBins2D+1) etaBin = fNEtaBins2D+1;
+  if (phiBin < 0) phiBin = 0;
+  if (phiBin > fNPhiBins2D+1) phiBin = fNPhiBins2D+1;
+  return fPhiWeight2D[etaBin + (fNEtaBins2D+2)*phiBin];
+}
+
+#endif
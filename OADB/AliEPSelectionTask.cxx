@@ -60,6 +60,7 @@
 #include "AliVTrack.h"
 #include "AliMultSelection.h"
 #include "AliEventplane.h"
+#include "AliEPCalibrationCache.h"
 
 using std::cout;
 using std::endl;
@@ -89,6 +90,8 @@ AliAnalysisTaskSE(),
   fQyContainer(0),
   fSparseDist(0),
   fHruns(0),
+  fCalib(0),
+  fTrackPhiWeight(),
   fQVector(0),
   fQContributionX(0),
   fQContributionY(0),
@@ -140,6 +143,8 @@ AliEPSelectionTask::AliEPSelectionTask(const char *name):
   fQyContainer(0),
   fSparseDist(0),
   fHruns(0),
+  fCalib(0),
+  fTrackPhiWeight(),
   fQVector(0),
   fQContributionX(0),
   fQContributionY(0),
@@ -207,6 +212,10 @@ AliEPSelectionTask::~AliEPSelectionTask()
       }
     }
   }
+  if (fUserphidist && fCalib) {
+    delete fCalib;
+    fCalib = 0;
+  }
 }
 
 //________________________________________________________________________
@@ -262,9 +271,7 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
       if (!(fRunNumber == esd->GetRunNumber())) {
 	  fRunNumber = esd->GetRunNumber();
           AliInfo(Form("Changing Phi-distribution to run %d",fRunNumber));
-          SetOADBandPeriod();
-	  SetPhiDist();
-	  SetQvectorDist(); // recentring objects
+          SetCalibration(); // phi-distributions and recentring objects
       }
 
 
@@ -294,11 +301,11 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
 
       if (nt>4){
 
-	// qvector full event
-	fQVector = new TVector2(GetQ(esdEP,tracklist));
+	// qvector full event and subevents
+	TVector2 qq;
+	CalculateSharedQ(esd, esdEP, tracklist, qq, qq1, qq2);
+	fQVector = new TVector2(qq);
 	fEventplaneQ = fQVector->Phi()/2;
-	// q vector subevents
-	GetQsub(qq1, qq2, tracklist, esdEP);
 	fQsub1 = new TVector2(qq1);
 	fQsub2 = new TVector2(qq2);
 	fQsubRes = (fQsub1->Phi()/2 - fQsub2->Phi()/2);
@@ -322,7 +329,7 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
 	    while (delta > TMath::Pi()) delta -= TMath::Pi();
 	    fHOutPTPsi->Fill(track->Pt(),delta);
 	    fHOutPhi->Fill(track->Phi());
-	    fHOutPhiCorr->Fill(track->Phi(),GetPhiWeight(track));
+	    fHOutPhiCorr->Fill(track->Phi(),fTrackPhiWeight[iter]);
           }
 	}
 
@@ -358,9 +365,7 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
       if (!(fRunNumber == aod->GetRunNumber())) {
         fRunNumber = aod->GetRunNumber();
         AliInfo(Form("Changing Phi-distribution to run %d",fRunNumber));
-        SetOADBandPeriod();
-        SetPhiDist();
-        SetQvectorDist();
+        SetCalibration();
       }
 
       if (fUseMCRP) {
@@ -388,11 +393,11 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
 
       if (NT>4){
 
-	// qvector full event
-	fQVector = new TVector2(GetQ(esdEP,tracklist));
+	// qvector full event and subevents
+	TVector2 qq;
+	CalculateSharedQ(aod, esdEP, tracklist, qq, qq1, qq2);
+	fQVector = new TVector2(qq);
 	fEventplaneQ = fQVector->Phi()/2;
-	// q vector subevents
-	GetQsub(qq1, qq2, tracklist, esdEP);
 	fQsub1 = new TVector2(qq1);
 	fQsub2 = new TVector2(qq2);
 	fQsubRes = (fQsub1->Phi()/2 - fQsub2->Phi()/2);
@@ -416,7 +421,7 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
 	    while (delta > TMath::Pi()) delta -= TMath::Pi();
 	    fHOutPTPsi->Fill(track->Pt(),delta);
 	    fHOutPhi->Fill(track->Phi());
-	    fHOutPhiCorr->Fill(track->Phi(),GetPhiWeight(track));
+	    fHOutPhiCorr->Fill(track->Phi(),fTrackPhiWeight[iter]);
 	  }
 	}
 
@@ -454,33 +459,7 @@ TVector2 AliEPSelectionTask::GetQ(AliEventplane* EP, TObjArray* tracklist)
 {
   // Get the Q vector
   TVector2 mQ;
-  float mQx=0, mQy=0;
-  AliVTrack* track;
-  Double_t weight;
-  Int_t idtemp = -1;
-  // get recentering values
-  Double_t mean[2], rms[2];
-  Recenter(0, mean);
-  Recenter(1, rms);
-
-  int nt = tracklist->GetEntries();
-
-  for (int i=0; i<nt; i++){
-    weight = 1;
-    track = dynamic_cast<AliVTrack*> (tracklist->At(i));
-    if (track) {
-      weight = GetWeight(track);
-    if (fSaveTrackContribution){
-      idtemp = track->GetID();
-      if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
-      EP->GetQContributionXArray()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-      EP->GetQContributionYArray()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
-     }
-     mQx += (weight*cos(2*track->Phi())/rms[0]);
-     mQy += (weight*sin(2*track->Phi())/rms[1]);
-    }
-  }
-  mQ.Set(mQx-(mean[0]/rms[0]), mQy-(mean[1]/rms[1]));
+  CalculateQ(EP, tracklist, &mQ, 0, 0);
   return mQ;
 }
 
@@ -488,135 +467,142 @@ TVector2 AliEPSelectionTask::GetQ(AliEventplane* EP, TObjArray* tracklist)
 void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklist,AliEventplane* EP)
 {
   // Get Qsub
-  TVector2 mQ[2];
-  float mQx1=0, mQy1=0, mQx2=0, mQy2=0;
-  Double_t weight;
+  CalculateQ(EP, tracklist, 0, &Q1, &Q2);
+}
+
+//________________________________________________________________________
+void AliEPSelectionTask::CalculateQ(AliEventplane* EP, TObjArray* tracklist, TVector2* Q, TVector2* Q1, TVector2* Q2)
+{
+  // Q vector of the full event (Q) and of the subevents (Q1, Q2) in one pass
+  // over the tracks, the weight and the contribution of each track are
+  // evaluated once; Q or Q1,Q2 = 0 - not calculated
+  // the phi weights of the tracks are kept in fTrackPhiWeight
+  float mQx=0, mQy=0, mQx1=0, mQy1=0, mQx2=0, mQy2=0;
   // get recentering values
   Double_t mean[2], rms[2];
   Recenter(0, mean);
   Recenter(1, rms);
 
-  AliVTrack* track;
-  TRandom2 rn = 0;
+  Bool_t sub = (Q1 && Q2);
+  if (sub && fSplitMethod != AliEPSelectionTask::kRandom && fSplitMethod != AliEPSelectionTask::kEta && fSplitMethod != AliEPSelectionTask::kCharge) {
+    printf("plane resolution determination method not available!\n\n ");
+    sub = kFALSE;
+  }
 
+  TRandom2 rn = 0;
   int nt = tracklist->GetEntries();
   int trackcounter1=0, trackcounter2=0;
   int idtemp = 0;
+  fTrackPhiWeight.assign(nt, 1.);
+
+  for (Int_t i = 0; i < nt; i++) {
+    AliVTrack* track = dynamic_cast<AliVTrack*> (tracklist->At(i));
+    if (!track) continue;
+    Double_t ptweight = 1;
+    if (fUsePtWeight) {
+      if (track->Pt()<2) ptweight=track->Pt();
+      else ptweight=2;
+    }
+    fTrackPhiWeight[i] = GetPhiWeight(track);
+    Double_t weight = ptweight*fTrackPhiWeight[i];
+    Double_t qx = weight*cos(2*track->Phi())/rms[0];
+    Double_t qy = weight*sin(2*track->Phi())/rms[1];
+    idtemp = track->GetID();
+    if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
+
+    if (Q) {
+      if (fSaveTrackContribution){
+        EP->GetQContributionXArray()->AddAt(qx,idtemp);
+        EP->GetQContributionYArray()->AddAt(qy,idtemp);
+      }
+      mQx += qx;
+      mQy += qy;
+    }
+    if (!sub) continue;
 
-  if (fSplitMethod == AliEPSelectionTask::kRandom){
-
-    for (Int_t i = 0; i < nt; i++) {
-      weight = 1;
-      track = dynamic_cast<AliVTrack*> (tracklist->At(i));
-      if (!track) continue;
-      weight = GetWeight(track);
-      idtemp = track->GetID();
-      if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
-
-      // This loop splits the track set into 2 random subsets
+    // subevent of the track: 1, 2 or 0 (none)
+    Int_t subevent = 0;
+    if (fSplitMethod == AliEPSelectionTask::kRandom){
+      // splits the track set into 2 random subsets
       if( trackcounter1 < int(nt/2.) && trackcounter2 < int(nt/2.)){
         float random = rn.Rndm();
-        if(random < .5){
-          mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-          mQy1 += (weight*sin(2*track->Phi())/rms[1]);
-          if (fSaveTrackContribution){
-            EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-            EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
-          }
-          trackcounter1++;
-        }
-        else {
-          mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-          mQy2 += (weight*sin(2*track->Phi())/rms[1]);
-          if (fSaveTrackContribution){
-            EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-            EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
-          }
-          trackcounter2++;
-        }
-      }
-      else if( trackcounter1 >= int(nt/2.)){
-        mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy2 += (weight*sin(2*track->Phi())/rms[1]);
-        if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
-        }
-        trackcounter2++;
+        subevent = (random < .5) ? 1 : 2;
       }
-      else {
-        mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy1 += (weight*sin(2*track->Phi())/rms[1]);
-        if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
-        }
-        trackcounter1++;
-      }
-    }
-  } else if (fSplitMethod == AliEPSelectionTask::kEta) {
-
-    for (Int_t i = 0; i < nt; i++) {
-      weight = 1;
-      track = dynamic_cast<AliVTrack*> (tracklist->At(i));
-      if (!track) continue;
-      weight = GetWeight(track);
+      else if( trackcounter1 >= int(nt/2.)) subevent = 2;
+      else subevent = 1;
+      if (subevent == 1) trackcounter1++;
+      else trackcounter2++;
+    } else if (fSplitMethod == AliEPSelectionTask::kEta) {
       Double_t eta = track->Eta();
-      idtemp = track->GetID();
-      if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
-
-      if (eta > fEtaGap/2.) {
-        mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy1 += (weight*sin(2*track->Phi())/rms[1]);
-        if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
-        }
-      } else if (eta < -1.*fEtaGap/2.) {
-        mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy2 += (weight*sin(2*track->Phi())/rms[1]);
-        if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
-        }
-      }
+      if (eta > fEtaGap/2.) subevent = 1;
+      else if (eta < -1.*fEtaGap/2.) subevent = 2;
+    } else if (fSplitMethod == AliEPSelectionTask::kCharge) {
+      Short_t cha = track->Charge();
+      if (cha > 0) subevent = 1;
+      else if (cha < 0) subevent = 2;
     }
-  } else if (fSplitMethod == AliEPSelectionTask::kCharge) {
 
-    for (Int_t i = 0; i < nt; i++) {
-      weight = 1;
-      track = dynamic_cast<AliVTrack*> (tracklist->At(i));
-      if (!track) continue;
-      weight = GetWeight(track);
-      Short_t cha = track->Charge();
-      idtemp = track->GetID();
-      if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
-
-      if (cha > 0) {
-        mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy1 += (weight*sin(2*track->Phi())/rms[1]);
-        if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
-        }
-      } else if (cha < 0) {
-        mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy2 += (weight*sin(2*track->Phi())/rms[1]);
-        if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
-        }
+    if (subevent == 1) {
+      mQx1 += qx;
+      mQy1 += qy;
+      if (fSaveTrackContribution){
+        EP->GetQContributionXArraysub1()->AddAt(qx,idtemp);
+        EP->GetQContributionYArraysub1()->AddAt(qy,idtemp);
+      }
+    } else if (subevent == 2) {
+      mQx2 += qx;
+      mQy2 += qy;
+      if (fSaveTrackContribution){
+        EP->GetQContributionXArraysub2()->AddAt(qx,idtemp);
+        EP->GetQContributionYArraysub2()->AddAt(qy,idtemp);
       }
     }
-  } else {
-    printf("plane resolution determination method not available!\n\n ");
-    return;
   }
   // apply recenetering
-  mQ[0].Set(mQx1-(mean[0]/rms[0]), mQy1-(mean[1]/rms[1]));
-  mQ[1].Set(mQx2-(mean[0]/rms[0]), mQy2-(mean[1]/rms[1]));
-  Q1 = mQ[0];
-  Q2 = mQ[1];
+  if (Q) Q->Set(mQx-(mean[0]/rms[0]), mQy-(mean[1]/rms[1]));
+  if (sub) {
+    Q1->Set(mQx1-(mean[0]/rms[0]), mQy1-(mean[1]/rms[1]));
+    Q2->Set(mQx2-(mean[0]/rms[0]), mQy2-(mean[1]/rms[1]));
+  }
+}
+
+//________________________________________________________________________
+void AliEPSelectionTask::CalculateSharedQ(AliVEvent* event, AliEventplane* EP, TObjArray* tracklist, TVector2 &Q, TVector2 &Q1, TVector2 &Q2)
+{
+  // Q vectors of the full event and of the subevents, shared by the
+  // event-plane tasks of the train with the same configuration: the first
+  // task computes them (CalculateQ), the following ones read them from the
+  // container attached to the event (AliEPQVectorContainer)
+  TString key;
+  AliEPQVectorContainer *cont = GetSharedQKey(key) ? AliEPQVectorContainer::Get(event) : 0;
+  const AliEPQVectorContainer::QResult *shared = cont ? cont->Find(key) : 0;
+  if (shared && (Int_t)shared->fPhiWeight.size() == tracklist->GetEntries()) {
+    Q.Set(shared->fQ[0], shared->fQ[1]);
+    Q1.Set(shared->fQsub1[0], shared->fQsub1[1]);
+    Q2.Set(shared->fQsub2[0], shared->fQsub2[1]);
+    fTrackPhiWeight = shared->fPhiWeight;
+    return;
+  }
+  CalculateQ(EP, tracklist, &Q, &Q1, &Q2);
+  if (!cont) return;
+  AliEPQVectorContainer::QResult &result = cont->Add(key);
+  result.fQ[0] = Q.X();      result.fQ[1] = Q.Y();
+  result.fQsub1[0] = Q1.X(); result.fQsub1[1] = Q1.Y();
+  result.fQsub2[0] = Q2.X(); result.fQsub2[1] = Q2.Y();
+  result.fPhiWeight = fTrackPhiWeight;
+}
+
+//________________________________________________________________________
+Bool_t AliEPSelectionTask::GetSharedQKey(TString &key) const
+{
+  // configuration of the Q vectors, false if they can not be shared:
+  // personal cuts or phi distribution, or track contributions to be stored
+  // in the event plane of the event
+  if (fUsercuts || fUserphidist || fSaveTrackContribution) return kFALSE;
+  key = Form("%s.%s.%s.%u.phiw%d.ptw%d.rec%d.split%d.gap%g",
+             fAnalysisInput.Data(), fTrackType.Data(), fPeriod.Data(), fAODfilterbit,
+             fUsePhiWeight, fUsePtWeight, fUseRecentering, fSplitMethod, fEtaGap);
+  return kTRUE;
 }
 
 //________________________________________________________________________
@@ -693,21 +679,11 @@ Double_t AliEPSelectionTask::GetPhiWeight(TObject* track1)
   Double_t phiweight=1;
   AliVTrack* track = dynamic_cast<AliVTrack*>(track1);
 
-  TH1F *phiDist = 0x0;
-  if(track) phiDist = SelectPhiDist(track);
-
-  if (fUsePhiWeight && phiDist && track) {
-    Double_t nParticles = phiDist->Integral();
-    Double_t nPhibins = phiDist->GetNbinsX();
-
-    Double_t Phi = track->Phi();
-
-    while (Phi<0) Phi += TMath::TwoPi();
-    while (Phi>TMath::TwoPi()) Phi -= TMath::TwoPi();
-
-    Double_t PhiDistValue = phiDist->GetBinContent(1+TMath::FloorNint((track->Phi())*nPhibins/TMath::TwoPi()));
-
-    if (PhiDistValue > 0) phiweight = nParticles/nPhibins/PhiDistValue;
+  // nParticles/nPhibins/PhiDistValue of the phi distribution of the track
+  // from the flat tables of the run
+  if (fUsePhiWeight && track && fCalib) {
+    Int_t index = SelectPhiDist(track);
+    if (index >= 0) phiweight = fCalib->GetPhiWeight(index, track->Phi());
   }
   return phiweight;
 }
@@ -716,19 +692,17 @@ Double_t AliEPSelectionTask::GetPhiWeight(TObject* track1)
 void AliEPSelectionTask::Recenter(Int_t var, Double_t * values)
 {
 
-  if (fUseRecentering && fQDist[0] && fQDist[1] && fCentrality!=-1.) {
-    Int_t centbin = fQDist[0]->FindBin(fCentrality);
+  if (fUseRecentering && fCalib && fCalib->HasRecentering() && fCentrality!=-1.) {
+    Double_t mean[2], rms[2]; // rms protected against division by zero
+    fCalib->GetRecentering(fCentrality, mean, rms);
 
     if(var==0) { // fill mean
-      values[0] = fQDist[0]->GetBinContent(centbin);
-      values[1] = fQDist[1]->GetBinContent(centbin);
+      values[0] = mean[0];
+      values[1] = mean[1];
     }
     else if(var==1) { // fill rms
-      values[0] = fQDist[0]->GetBinError(centbin);
-      values[1] = fQDist[1]->GetBinError(centbin);
-      // protection against division by zero
-      if(values[0]==0.0) values[0]=1.0;
-      if(values[1]==0.0) values[1]=1.0;
+      values[0] = rms[0];
+      values[1] = rms[1];
     }
   }
   else { //default (no recentering)
@@ -903,13 +877,56 @@ TObjArray* AliEPSelectionTask::GetAODTracksAndMaxID(AliAODEvent* aod, Int_t& max
 
 }
 
+//_________________________________________________________________________
+Bool_t AliEPSelectionTask::SetPeriod()
+{
+  // period of the run, kFALSE (fPeriod unchanged) for runs without calibration
+  if (fRunNumber >= 136851 && fRunNumber <= 139515) { fPeriod = "LHC10h"; return kTRUE; }
+  if (fRunNumber >= 166529 && fRunNumber <= 170593) { fPeriod = "LHC11h"; return kTRUE; }
+  return kFALSE;
+}
+
+//_________________________________________________________________________
+void AliEPSelectionTask::SetCalibration()
+{
+  // phi weights and recentering of the run in flat tables
+  // the tables are shared by the tasks with the same input and recentering
+  // settings and loaded by the first of them, personal phi distributions
+  // are kept in a table of the task
+  if (fUserphidist) {
+    if (!fCalib) fCalib = new AliEPCalibrationCache(GetName());
+  }
+  else {
+    fCalib = AliEPCalibrationCache::Get(Form("AliEPSelectionTask.%s.%s",fAnalysisInput.Data(),fUseRecentering ? "recentering" : "norecentering"));
+  }
+
+  if (fCalib->IsValid(fRunNumber)) {
+    SetPeriod();
+    if (fPeriod.CompareTo("LHC10h") != 0 && fPeriod.CompareTo("LHC11h") != 0 && !fUserphidist){
+      AliInfo("No Phi-weights available. All Phi weights set to 1");
+      SetUsePhiWeight(kFALSE);
+    }
+    return;
+  }
+
+  SetOADBandPeriod();
+  SetPhiDist();
+  SetQvectorDist(); // recentring objects
+
+  fCalib->SetRunNumber(fRunNumber);
+  for (Int_t i = 0; i < 4; i++) fCalib->SetPhiWeights(i, fPhiDist[i]);
+  if (fUseRecentering) fCalib->SetRecentering(fQDist[0], fQDist[1]);
+}
+
 //_________________________________________________________________________
 void AliEPSelectionTask::SetOADBandPeriod()
 {
   TString oadbfilename;
 
-  if (fRunNumber >= 136851 && fRunNumber <= 139515) // LHC10h
-    {fPeriod = "LHC10h";
+  if (!SetPeriod()) return;
+
+  if (fPeriod.CompareTo("LHC10h")==0) // LHC10h
+    {
      if (!fUserphidist) { // if it's already set and custom class is required, we use the one provided by the user
 
         if (fAnalysisInput.CompareTo("AOD")==0){
@@ -928,8 +945,8 @@ void AliEPSelectionTask::SetOADBandPeriod()
        }
      }
 
-  if (fRunNumber >= 166529 && fRunNumber <= 170593) // LHC11h
-     {fPeriod = "LHC11h";
+  if (fPeriod.CompareTo("LHC11h")==0) // LHC11h
+     {
       if (!fUserphidist) {
       // if it's already set and custom class is required, we use the one provided by the user
 
@@ -963,24 +980,25 @@ void AliEPSelectionTask::SetOADBandPeriod()
 }
 
 //_________________________________________________________________________
-TH1F* AliEPSelectionTask::SelectPhiDist(AliVTrack *track)
+Int_t AliEPSelectionTask::SelectPhiDist(AliVTrack *track) const
 {
-  if (fPeriod.CompareTo("LHC10h")==0  || fUserphidist) return fPhiDist[0];
+  // index of the phi distribution of the track, -1 if none
+  if (fPeriod.CompareTo("LHC10h")==0  || fUserphidist) return 0;
   else if(fPeriod.CompareTo("LHC11h")==0)
     {
      if (track->Charge() < 0)
        {
-        if(track->Eta() < 0.)       return fPhiDist[0];
-        else if (track->Eta() > 0.) return fPhiDist[2];
+        if(track->Eta() < 0.)       return 0;
+        else if (track->Eta() > 0.) return 2;
        }
       else if (track->Charge() > 0)
        {
-        if(track->Eta() < 0.)       return fPhiDist[1];
-        else if (track->Eta() > 0.) return fPhiDist[3];
+        if(track->Eta() < 0.)       return 1;
+        else if (track->Eta() > 0.) return 3;
        }
 
     }
-  return 0;
+  return -1;
 }
 
 TObjArray* AliEPSelectionTask::GetTracksForLHC11h(AliESDEvent* esd)
@@ -9,6 +9,7 @@
 //   author: Alberica Toia, Johanna Gramling
 //*****************************************************
 
+#include <vector>
 #include "AliAnalysisTaskSE.h"
 
 class TFile;
@@ -23,6 +24,8 @@ class AliESDtrackCuts;
 class AliESDtrack;
 class AliEventplane;
 class AliOADBContainer;
+class AliEPCalibrationCache;
+class AliVEvent;
 class AliVTrack;
 class THnSparse;
 class TProfile;
@@ -70,8 +73,13 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   AliEPSelectionTask& operator= (const AliEPSelectionTask& ep); 
 
   TObjArray* GetAODTracksAndMaxID(AliAODEvent* aod, Int_t& maxid);
+  Bool_t SetPeriod();
   void SetOADBandPeriod();
-  TH1F* SelectPhiDist(AliVTrack *track);
+  void SetCalibration();
+  Int_t SelectPhiDist(AliVTrack *track) const;
+  void CalculateQ(AliEventplane* EP, TObjArray* tracklist, TVector2* Q, TVector2* Q1, TVector2* Q2);
+  void CalculateSharedQ(AliVEvent* event, AliEventplane* EP, TObjArray* tracklist, TVector2 &Q, TVector2 &Q1, TVector2 &Q2);
+  Bool_t GetSharedQKey(TString &key) const;
   TObjArray* GetTracksForLHC11h(AliESDEvent* esd);
 
   TString  fAnalysisInput; 		// "ESD", "AOD"
@@ -100,6 +108,8 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   THnSparse *fSparseDist;               //! THn for eta-charge phi-weighting
   TProfile* fQDist[2];			// array of TProfiles with mean+rms for recentering
   TH1F *fHruns;                         // information about runwise statistics of phi-weights
+  AliEPCalibrationCache *fCalib;        //! phi weights and recentering of the run (shared unless personal phi distribution)
+  std::vector<Double_t> fTrackPhiWeight; //! phi weights of the tracks of the event
 
   TVector2* fQVector;			//! Q-Vector of the event  
   Double_t* fQContributionX;		//! array of the tracks' contributions to X component of Q-Vector - index = track ID
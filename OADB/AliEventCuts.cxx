@@ -155,6 +155,9 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
     AddQAplotsToList();
   }
 
+  /// Per-event observables already computed by other instances are taken from the event container
+  AliEventCutsContainer* cont = GetEventContainer(ev);
+
   /// Event selection flag, as soon as the event does not pass one cut this becomes false.
   fFlag = BIT(kNoCuts);
 
@@ -235,9 +238,24 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
     else if (ntrkl < 50) fSPDpileupMinContributors = 4;
     else fSPDpileupMinContributors = 5;
   }
-  if ((!usePileUpSPD || !ev->IsPileupFromSPD(fSPDpileupMinContributors,fSPDpileupMinZdist,fSPDpileupNsigmaZdist,fSPDpileupNsigmaDiamXY,fSPDpileupNsigmaDiamZ)) &&
+  double pileUpSPD = 0., pileUpMV = 0.;
+  if (usePileUpSPD) {
+    const double pars[5] = {double(fSPDpileupMinContributors),fSPDpileupMinZdist,fSPDpileupNsigmaZdist,fSPDpileupNsigmaDiamXY,fSPDpileupNsigmaDiamZ};
+    if (!cont->FindObservable(AliEventCutsContainer::kPileUpSPD,pars,5,"",pileUpSPD)) {
+      pileUpSPD = ev->IsPileupFromSPD(fSPDpileupMinContributors,fSPDpileupMinZdist,fSPDpileupNsigmaZdist,fSPDpileupNsigmaDiamXY,fSPDpileupNsigmaDiamZ);
+      cont->AddObservable(AliEventCutsContainer::kPileUpSPD,pars,5,"",pileUpSPD);
+    }
+  }
+  if (usePileUpMV) {
+    const double pars[4] = {double(fUtils.GetMinPlpContribMV()),fUtils.GetMaxPlpChi2MV(),fUtils.GetMinWDistMV(),double(fUtils.GetCheckPlpFromDifferentBCMV())};
+    if (!cont->FindObservable(AliEventCutsContainer::kPileUpMV,pars,4,"",pileUpMV)) {
+      pileUpMV = fUtils.IsPileUpMV(ev);
+      cont->AddObservable(AliEventCutsContainer::kPileUpMV,pars,4,"",pileUpMV);
+    }
+  }
+  if ((!usePileUpSPD || pileUpSPD == 0.) &&
       (!fTrackletBGcut || !fUtils.IsSPDClusterVsTrackletBG(ev)) &&
-      (!usePileUpMV || !fUtils.IsPileUpMV(ev)))
+      (!usePileUpMV || pileUpMV == 0.))
     fFlag |= BIT(kPileUp);
 
 
@@ -248,7 +266,7 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   if (dynamic_cast<AliAODEvent*>(ev)) nCluTPC=dynamic_cast<AliAODEvent*>(ev)->GetNumberOfTPCClusters();
   else if (dynamic_cast<AliESDEvent*>(ev)) nCluTPC=dynamic_cast<AliESDEvent*>(ev)->GetNumberOfTPCClusters();
   if(fUseVariablesCorrelationCuts || fTOFvsFB32[0] || fUseStrongVarCorrelationCut ||
-     fUseTPCTracklCorrelationCut) ComputeTrackMultiplicity(ev);
+     fUseTPCTracklCorrelationCut) ComputeTrackMultiplicity(ev,cont);
   const double its_tpcclus_limit = PolN(double(nCluTPC),fITSvsTPCcluPolCut,2);
   const double vzero_tpcout_limit = PolN(double(fContainer.fMultTrkTPCout),fVZEROvsTPCoutPolCut,4);
   const double fb128 = fContainer.fMultTrkTPC;
@@ -261,7 +279,12 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   /// Centrality cuts:
   /// * Check for min and max centrality
   /// * Cross check correlation between two centrality estimators
-  if (AliMultSelectionTask::IsINELgtZERO(ev) || !fSelectInelGt0) {
+  double inelGt0 = 0.;
+  if (fSelectInelGt0 && !cont->FindObservable(AliEventCutsContainer::kINELgt0,0x0,0,"",inelGt0)) {
+    inelGt0 = AliMultSelectionTask::IsINELgtZERO(ev);
+    cont->AddObservable(AliEventCutsContainer::kINELgt0,0x0,0,"",inelGt0);
+  }
+  if (inelGt0 != 0. || !fSelectInelGt0) {
     fFlag |= BIT(kINELgt0);
     fCentPercentiles[0] = -0.5;
     fCentPercentiles[1] = -0.5;
@@ -276,13 +299,21 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
       fCentPercentiles[0] = cent->GetCentralityPercentile(fCentEstimators[0].data());
       fCentPercentiles[1] = cent->GetCentralityPercentile(fCentEstimators[1].data());
     } else {
-      AliMultSelection* cent = (AliMultSelection*)ev->FindListObject("MultSelection");
-      if (!cent) {
-        AliFatal("The multiplicity selection framework has been request but no AliMultSelection object was found attached to the Event."
-                 " Did you run the AliMultSelectionTask?");
+      const double pars[1] = {double(fMultSelectionEvCuts)};
+      AliMultSelection* cent = nullptr;
+      for (int iEst = 0; iEst < 2; ++iEst) {
+        double percentile = 0.;
+        if (!cont->FindObservable(AliEventCutsContainer::kCentrality,pars,1,fCentEstimators[iEst],percentile)) {
+          if (!cent) cent = (AliMultSelection*)ev->FindListObject("MultSelection");
+          if (!cent) {
+            AliFatal("The multiplicity selection framework has been request but no AliMultSelection object was found attached to the Event."
+                     " Did you run the AliMultSelectionTask?");
+          }
+          percentile = cent->GetMultiplicityPercentile(fCentEstimators[iEst].data(), fMultSelectionEvCuts);
+          cont->AddObservable(AliEventCutsContainer::kCentrality,pars,1,fCentEstimators[iEst],percentile);
+        }
+        fCentPercentiles[iEst] = percentile;
       }
-      fCentPercentiles[0] = cent->GetMultiplicityPercentile(fCentEstimators[0].data(), fMultSelectionEvCuts);
-      fCentPercentiles[1] = cent->GetMultiplicityPercentile(fCentEstimators[1].data(), fMultSelectionEvCuts);
     }
     const auto& x = fCentPercentiles[1];
     const double center = x * fEstimatorsCorrelationCoef[1] + fEstimatorsCorrelationCoef[0];
@@ -587,20 +618,57 @@ string AliEventCuts::GetCentralityEstimator (unsigned int estimator) const {
 }
 
 
-void AliEventCuts::ComputeTrackMultiplicity(AliVEvent *ev) {
+void AliEventCutsContainer::ResetCache(unsigned long id, long long entry) {
+  fEventId = id;
+  fEntry = entry;
+  fMultComputed = false;
+  fCache.clear();
+}
+
+bool AliEventCutsContainer::FindObservable(int obs, const double *pars, int nPars, const std::string &label, double &value) const {
+  for (const CachedObservable& cached : fCache) {
+    if (cached.fObservable != obs || cached.fNPars != nPars || cached.fLabel != label) continue;
+    if (!std::equal(pars, pars + nPars, cached.fPars)) continue;
+    value = cached.fValue;
+    return true;
+  }
+  return false;
+}
+
+void AliEventCutsContainer::AddObservable(int obs, const double *pars, int nPars, const std::string &label, double value) {
+  if (nPars > kNCachePars) ::Fatal("AliEventCutsContainer::AddObservable","Too many parameters (%i) for a cached observable.",nPars);
+  CachedObservable cached;
+  cached.fObservable = obs;
+  cached.fNPars = nPars;
+  std::copy(pars, pars + nPars, cached.fPars);
+  cached.fLabel = label;
+  cached.fValue = value;
+  fCache.push_back(cached);
+}
+
+/// The container attached to the event is shared by all the AliEventCuts instances of the train:
+/// it is reset when the first instance sees a new event (identified by the bunch crossing, the
+/// time stamp and the entry of the analysis manager).
+AliEventCutsContainer* AliEventCuts::GetEventContainer(AliVEvent *ev) {
+  unsigned long evid = ((unsigned long)(ev->GetBunchCrossNumber()) << 32) + ev->GetTimeStamp();
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  long long entry = mgr ? mgr->GetCurrentEntry() : -1;
   AliEventCutsContainer* tmp_cont = static_cast<AliEventCutsContainer*>(ev->FindListObject("AliEventCutsContainer"));
   if (tmp_cont) {
-    unsigned long evid = ((unsigned long)(ev->GetBunchCrossNumber()) << 32) + ev->GetTimeStamp();
-    fNewEvent = (tmp_cont->fEventId != evid);
-    tmp_cont->fEventId = evid;
-
-    if (!fNewEvent) {
-      fContainer = *tmp_cont;
-      return;
-    }
+    fNewEvent = (tmp_cont->fEventId != evid || tmp_cont->fEntry != entry);
   } else {
     tmp_cont = new AliEventCutsContainer;
     ev->AddObject(tmp_cont);
+    fNewEvent = true;
+  }
+  if (fNewEvent) tmp_cont->ResetCache(evid, entry);
+  return tmp_cont;
+}
+
+void AliEventCuts::ComputeTrackMultiplicity(AliVEvent *ev, AliEventCutsContainer *tmp_cont) {
+  if (tmp_cont->fMultComputed) {
+    fContainer = *tmp_cont;
+    return;
   }
 
   bool isAOD = false;
@@ -670,6 +738,7 @@ void AliEventCuts::ComputeTrackMultiplicity(AliVEvent *ev) {
     for(int ich=0; ich < 64; ich++)
       tmp_cont->fMultVZERO += vzero->GetMultiplicity(ich);
   }
+  tmp_cont->fMultComputed = true;
   fContainer = *tmp_cont;
 }
 
@@ -33,7 +33,23 @@ class AliEventCutsContainer : public TNamed {
     fMultTrkFB32TOF(-1),
     fMultTrkTPC(-1),
     fMultTrkTPCout(-1),
-    fMultVZERO(-1.) {}
+    fMultVZERO(-1.),
+    fEntry(-1),
+    fMultComputed(false),
+    fCache() {}
+
+    /// Observables memoized per event, shared by all the AliEventCuts instances
+    enum Observable {
+      kINELgt0,
+      kPileUpSPD,
+      kPileUpMV,
+      kCentrality
+    };
+    enum { kNCachePars = 5 };
+
+    void ResetCache(unsigned long id, long long entry);
+    bool FindObservable(int obs, const double *pars, int nPars, const std::string &label, double &value) const;
+    void AddObservable(int obs, const double *pars, int nPars, const std::string &label, double value);
 
     unsigned long fEventId;
     int fMultESD;
@@ -43,6 +59,18 @@ class AliEventCutsContainer : public TNamed {
     int fMultTrkTPC;
     int fMultTrkTPCout;
     double fMultVZERO;
+
+    /// An observable is looked up together with the instance parameters used to compute it
+    struct CachedObservable {
+      int fObservable;
+      int fNPars;
+      double fPars[kNCachePars];
+      std::string fLabel;
+      double fValue;
+    };
+    long long fEntry;                      //!<! Entry of the analysis manager for the cached event
+    bool fMultComputed;                    //!<! True if the track multiplicities of the event are filled
+    std::vector<CachedObservable> fCache;  //!<! Observables already computed for this event
   ClassDef(AliEventCutsContainer,2)
 };
 
@@ -196,7 +224,8 @@ class AliEventCuts : public TList {
     AliEventCuts(const AliEventCuts& copy);
     AliEventCuts operator=(const AliEventCuts& copy);
     void          AutomaticSetup (AliVEvent *ev);
-    void          ComputeTrackMultiplicity(AliVEvent *ev);
+    void          ComputeTrackMultiplicity(AliVEvent *ev, AliEventCutsContainer *cont);
+    AliEventCutsContainer* GetEventContainer(AliVEvent *ev);
     template<typename F> F PolN(F x, F* coef, int n);
 
     bool          fManualMode;                    ///< if true the cuts are not loaded automatically looking at the run number
@@ -77,12 +77,9 @@
 #include <TPRegexp.h>
 #include <TParameter.h>
 #include <TInterpreter.h>
-
-#if ROOT_VERSION_CODE >= ROOT_VERSION(6,3,0)
-#include <v5/TFormula.h>
-#else
-#include <TFormula.h>
-#endif
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 
 #include "AliPhysicsSelection.h"
 
@@ -111,6 +108,169 @@
 
 class StringToRegexp : public std::map<std::string, TPRegexp> {};
 
+/// Trigger logic string compiled into the program of a small stack machine.
+/// Trigger tokens push the value of the corresponding AliTriggerAnalysis bit;
+/// && and || skip their right operand if the result is already known.
+class TriggerLogicProgram {
+public:
+  enum EOpCode { kPushTrigger, kPushConst, kNot, kNeg, kToBool, kMul, kDiv, kAdd, kSub,
+                 kLess, kLessEq, kGreater, kGreaterEq, kEqual, kNotEqual, kAndJump, kOrJump };
+  enum { kMaxStack = 64 };
+  struct Instruction {
+    EOpCode  fOp;
+    Int_t    fArg;   // trigger bit or jump target
+    Double_t fConst; // constant for kPushConst
+  };
+  std::vector<Instruction> fCode;
+};
+
+class StringToTriggerLogic : public std::map<std::string, TriggerLogicProgram> {};
+
+/// Values of the trigger bits (online and offline) already evaluated in the current event
+class TriggerBitCache {
+public:
+  TriggerBitCache() { Reset(); }
+  void Reset() { memset(fEvaluated, 0, sizeof(fEvaluated)); }
+  Int_t Evaluate(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, UInt_t trigger) {
+    UInt_t index = trigger % AliTriggerAnalysis::kStartOfFlags;
+    if (trigger & AliTriggerAnalysis::kOfflineFlag) index += AliTriggerAnalysis::kStartOfFlags;
+    ULong64_t mask = 1ULL << (index % 64);
+    if (!(fEvaluated[index / 64] & mask)) {
+      fValue[index] = triggerAnalysis->EvaluateTrigger(event, static_cast<AliTriggerAnalysis::Trigger>(trigger));
+      fEvaluated[index / 64] |= mask;
+    }
+    return fValue[index];
+  }
+private:
+  enum { kNBits = 2 * AliTriggerAnalysis::kStartOfFlags };
+  ULong64_t fEvaluated[kNBits / 64];
+  Int_t fValue[kNBits];
+};
+
+namespace {
+  /// Recursive descent compiler for the trigger logic strings, with C operator precedence
+  class TriggerLogicCompiler {
+  public:
+    TriggerLogicCompiler(const char* logic, TriggerLogicProgram& program) :
+      fLogic(logic), fPos(0), fDepth(0), fError(kFALSE), fProgram(program) {}
+    Bool_t Compile() {
+      ParseOr();
+      SkipSpaces();
+      return !fError && fPos == fLogic.size();
+    }
+  private:
+    typedef TriggerLogicProgram P;
+    void SkipSpaces() { while (fPos < fLogic.size() && isspace(fLogic[fPos])) ++fPos; }
+    Bool_t Accept(const char* op) {
+      SkipSpaces();
+      size_t n = strlen(op);
+      if (fLogic.compare(fPos, n, op) != 0) return kFALSE;
+      fPos += n;
+      return kTRUE;
+    }
+    size_t Emit(P::EOpCode op, Int_t arg = 0, Double_t cnst = 0) {
+      P::Instruction instr = {op, arg, cnst};
+      fProgram.fCode.push_back(instr);
+      if (op == P::kPushTrigger || op == P::kPushConst) {
+        if (++fDepth > P::kMaxStack) fError = kTRUE;
+      } else if (op >= P::kMul) {
+        --fDepth; // binary operators; && and || drop their left operand when the right one is evaluated
+      }
+      return fProgram.fCode.size() - 1;
+    }
+    void PatchJump(size_t jump) { fProgram.fCode[jump].fArg = fProgram.fCode.size(); }
+    void ParseOr() {
+      ParseAnd();
+      while (Accept("||")) {
+        size_t jump = Emit(P::kOrJump);
+        ParseAnd();
+        Emit(P::kToBool);
+        PatchJump(jump);
+      }
+    }
+    void ParseAnd() {
+      ParseEquality();
+      while (Accept("&&")) {
+        size_t jump = Emit(P::kAndJump);
+        ParseEquality();
+        Emit(P::kToBool);
+        PatchJump(jump);
+      }
+    }
+    void ParseEquality() {
+      ParseRelational();
+      while (!fError) {
+        if (Accept("==")) { ParseRelational(); Emit(P::kEqual); }
+        else if (Accept("!=")) { ParseRelational(); Emit(P::kNotEqual); }
+        else break;
+      }
+    }
+    void ParseRelational() {
+      ParseAdditive();
+      while (!fError) {
+        if (Accept("<=")) { ParseAdditive(); Emit(P::kLessEq); }
+        else if (Accept(">=")) { ParseAdditive(); Emit(P::kGreaterEq); }
+        else if (Accept("<")) { ParseAdditive(); Emit(P::kLess); }
+        else if (Accept(">")) { ParseAdditive(); Emit(P::kGreater); }
+        else break;
+      }
+    }
+    void ParseAdditive() {
+      ParseMultiplicative();
+      while (!fError) {
+        if (Accept("+")) { ParseMultiplicative(); Emit(P::kAdd); }
+        else if (Accept("-")) { ParseMultiplicative(); Emit(P::kSub); }
+        else break;
+      }
+    }
+    void ParseMultiplicative() {
+      ParseUnary();
+      while (!fError) {
+        if (Accept("*")) { ParseUnary(); Emit(P::kMul); }
+        else if (Accept("/")) { ParseUnary(); Emit(P::kDiv); }
+        else break;
+      }
+    }
+    void ParseUnary() {
+      if (Accept("!")) { ParseUnary(); Emit(P::kNot); }
+      else if (Accept("-")) { ParseUnary(); Emit(P::kNeg); }
+      else ParsePrimary();
+    }
+    void ParsePrimary() {
+      SkipSpaces();
+      if (fError || fPos >= fLogic.size()) { fError = kTRUE; return; }
+      char c = fLogic[fPos];
+      if (c == '(') {
+        ++fPos;
+        ParseOr();
+        if (!Accept(")")) fError = kTRUE;
+      } else if (isdigit(c) || c == '.') {
+        const char* start = fLogic.c_str() + fPos;
+        char* end = 0;
+        Double_t value = strtod(start, &end);
+        fPos += end - start;
+        Emit(P::kPushConst, 0, value);
+      } else if (isalpha(c)) {
+        size_t begin = fPos;
+        while (fPos < fLogic.size() && isalnum(fLogic[fPos])) ++fPos;
+        std::string token = fLogic.substr(begin, fPos - begin);
+        TInterpreter::EErrorCode error;
+        Int_t bit = gInterpreter->ProcessLine(Form("AliTriggerAnalysis::k%s;", token.c_str()), &error);
+        if (error > 0) AliFatalGeneral("AliPhysicsSelection", Form("Trigger token %s unknown", token.c_str()));
+        Emit(P::kPushTrigger, bit);
+      } else {
+        fError = kTRUE;
+      }
+    }
+
+    std::string fLogic;
+    size_t fPos;
+    Int_t fDepth;
+    Bool_t fError;
+    TriggerLogicProgram& fProgram;
+  };
+}
+
 ClassImp(AliPhysicsSelection)
 
 AliPhysicsSelection::AliPhysicsSelection() :
@@ -131,7 +291,8 @@ fHistStat(0),
 fPSOADB(0),
 fFillOADB(0),
 fTriggerOADB(0),
-fTriggerToFormula(new StringToFormula()),
+fTriggerToLogic(new StringToTriggerLogic()),
+fTriggerBitCache(new TriggerBitCache()),
 fTriggerToRegexp(new StringToRegexp())
 {
   // constructor
@@ -161,7 +322,8 @@ AliPhysicsSelection::AliPhysicsSelection(const char *name) :
  fPSOADB(0),
  fFillOADB(0),
  fTriggerOADB(0),
- fTriggerToFormula(new StringToFormula()),
+ fTriggerToLogic(new StringToTriggerLogic()),
+ fTriggerBitCache(new TriggerBitCache()),
  fTriggerToRegexp(new StringToRegexp())
  {
    // constructor
@@ -177,7 +339,8 @@ AliPhysicsSelection::~AliPhysicsSelection(){
   if (fPSOADB)       delete fPSOADB;
   if (fFillOADB)     delete fFillOADB;
   if (fTriggerOADB)  delete fTriggerOADB;
-  delete fTriggerToFormula;
+  delete fTriggerToLogic;
+  delete fTriggerBitCache;
   delete fTriggerToRegexp;
 }
 
@@ -261,6 +424,9 @@ UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char
 
 /// Evaluate if the given event fulfills a given trigger logic
 ///
+/// The trigger bits are evaluated only when needed by the logic and
+/// their values are shared by all trigger classes of the same event
+///
 /// \param event Pointer to the current event
 /// \param triggerAnalysis Pointer to the TriggerAnlysis class
 /// \param triggerLogic Describing trigger logic; e.g. "V0A && V0C && ZDCTime && !TPCHVdip"
@@ -270,20 +436,43 @@ UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char
 Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event,
 						 AliTriggerAnalysis* triggerAnalysis,
 						 const char* triggerLogic, Bool_t offline){
-  auto& formula_and_bits = FindForumla(triggerLogic);
-  auto& trg_formula = formula_and_bits.first;
-  auto& bits = formula_and_bits.second;
-  // Get the values for each individual trigger in the trigger logic string;
-  // These values are the parameters of the TFormula
-  std::vector<Double_t> paras(bits.size());
-  auto offline_flag = offline ? AliTriggerAnalysis::kOfflineFlag : 0;
-  for (size_t i = 0; i < bits.size(); ++i) {
-    typedef AliTriggerAnalysis::Trigger Trigger;
-    Trigger bit = static_cast<Trigger>(bits[i] | offline_flag);
-    paras[i] = triggerAnalysis->EvaluateTrigger(event, bit);
+  typedef TriggerLogicProgram P;
+  const P& program = FindTriggerLogic(triggerLogic);
+  UInt_t offline_flag = offline ? AliTriggerAnalysis::kOfflineFlag : 0;
+  Double_t stack[P::kMaxStack];
+  Int_t top = -1;
+  const size_t nInstr = program.fCode.size();
+  for (size_t i = 0; i < nInstr; ++i) {
+    const P::Instruction& instr = program.fCode[i];
+    switch (instr.fOp) {
+      case P::kPushTrigger: stack[++top] = fTriggerBitCache->Evaluate(event, triggerAnalysis, instr.fArg | offline_flag); break;
+      case P::kPushConst:   stack[++top] = instr.fConst; break;
+      case P::kNot:         stack[top] = (stack[top] == 0); break;
+      case P::kNeg:         stack[top] = -stack[top]; break;
+      case P::kToBool:      stack[top] = (stack[top] != 0); break;
+      case P::kMul:         --top; stack[top] = stack[top] *  stack[top+1]; break;
+      case P::kDiv:         --top; stack[top] = stack[top] /  stack[top+1]; break;
+      case P::kAdd:         --top; stack[top] = stack[top] +  stack[top+1]; break;
+      case P::kSub:         --top; stack[top] = stack[top] -  stack[top+1]; break;
+      case P::kLess:        --top; stack[top] = stack[top] <  stack[top+1]; break;
+      case P::kLessEq:      --top; stack[top] = stack[top] <= stack[top+1]; break;
+      case P::kGreater:     --top; stack[top] = stack[top] >  stack[top+1]; break;
+      case P::kGreaterEq:   --top; stack[top] = stack[top] >= stack[top+1]; break;
+      case P::kEqual:       --top; stack[top] = stack[top] == stack[top+1]; break;
+      case P::kNotEqual:    --top; stack[top] = stack[top] != stack[top+1]; break;
+      case P::kAndJump:
+        // false left operand: the result is 0, skip the right operand
+        if (stack[top] == 0) i = instr.fArg - 1;
+        else --top;
+        break;
+      case P::kOrJump:
+        // true left operand: the result is 1, skip the right operand
+        if (stack[top] != 0) { stack[top] = 1; i = instr.fArg - 1; }
+        else --top;
+        break;
+    }
   }
-  Double_t dummy_val[] = {0};
-  return trg_formula.EvalPar(dummy_val, paras.data());
+  return top >= 0 && stack[top] != 0;
 }
 
 //______________________________________________________________________________
@@ -302,6 +491,9 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     if (eventType != 7) return kFALSE;
   }
   
+  // new event: the trigger bits have to be evaluated again
+  fTriggerBitCache->Reset();
+
   UInt_t accept = 0;
   Int_t nColl = fCollTrigClasses.GetEntries();
   Int_t nBG   = fBGTrigClasses.GetEntries();
@@ -825,54 +1017,18 @@ void AliPhysicsSelection::DetectPassName(){
   fPassName = passName;
 }
 
-FormulaAndBits& AliPhysicsSelection::FindForumla(const char* triggerLogic) {
-  // Do we have this logic cached? If not, set it up
-  auto it = fTriggerToFormula->find(triggerLogic);
-  if (it == fTriggerToFormula->end()) {
-    std::string trg_logic_formated;
-    std::vector<AliTriggerAnalysis::Trigger> bits;
-
-    TString trigger(triggerLogic);
-    TArrayI pos;
-    Int_t b = 0;
-    Int_t e = 0;
-    TPRegexp trigger_regexp("[[:alpha:]][[:alnum:]]*");
-
-    // Go through the matches and construct a new string where each
-    // match is replaced by a TFormula parameter
-    while (trigger_regexp.Match(trigger, "", e, 1, &pos) != 0) {
-      b = e;
-      e = pos[0];
-      std::string unmatched(trigger.Data() + b, trigger.Data() + e);
-
-      trg_logic_formated.append(unmatched);
-      // Each param in the TFormula will be set as the value behind the trigger bit
-      trg_logic_formated.append(Form("int([%i])", (Int_t)bits.size()));
-
-      b = e;
-      e = pos[1];
-      std::string matched(trigger.Data() + b, trigger.Data() + e);
-
-      TInterpreter::EErrorCode error;
-      Int_t bit = gInterpreter->ProcessLine(Form("AliTriggerAnalysis::k%s;", matched.c_str()), &error);
-
-      if (error > 0)
-	AliFatal(Form("Trigger token %s unknown", matched.c_str()));
-
-      bits.push_back(static_cast<AliTriggerAnalysis::Trigger>(bit));
-    }
-    trg_logic_formated.append({trigger.Data() + e, trigger.Data() + trigger.Length()});
-
-    R5TFormula formula(Form("dummy_name_%zu", fTriggerToFormula->size()), trg_logic_formated.c_str());
-
-    if (formula.Compile() > 0) {
-      AliFatal(Form("Could not evaluate trigger logic %s (evaluated to %s)",
-		    triggerLogic, trg_logic_formated.c_str()));
+const TriggerLogicProgram& AliPhysicsSelection::FindTriggerLogic(const char* triggerLogic) {
+  // Do we have this logic compiled? If not, compile it
+  auto it = fTriggerToLogic->find(triggerLogic);
+  if (it == fTriggerToLogic->end()) {
+    TriggerLogicProgram program;
+    TriggerLogicCompiler compiler(triggerLogic, program);
+    if (!compiler.Compile()) {
+      AliFatal(Form("Could not evaluate trigger logic %s", triggerLogic));
     }
     // Have the iterator point at the newly inserted element so that
     // we don't have to look it up in the return statement
-    it = fTriggerToFormula->emplace(std::string(triggerLogic),
-				    std::make_pair(formula, std::move(bits))).first;
+    it = fTriggerToLogic->emplace(std::string(triggerLogic), std::move(program)).first;
   }
   return it->second;
 }
@@ -24,16 +24,6 @@
 #include "AliLog.h"
 #include "AliAnalysisManager.h"
 #include "AliTriggerAnalysis.h"
-// In case of ROOT6 it is necessary to stay for the moment with the v5
-// version of TFormula as the v6 version produces a large amount of
-// warnings at runtime.
-#if ROOT_VERSION_CODE >= ROOT_VERSION(6,3,0)
-#include <v5/TFormula.h>
-typedef ROOT::v5::TFormula R5TFormula;
-#else
-#include <TFormula.h>
-typedef TFormula R5TFormula;
-#endif
 
 class AliVEvent;
 class TH2F;
@@ -45,9 +35,9 @@ class AliOADBFillingScheme;
 class AliOADBTriggerAnalysis;
 class TPRegexp;
 class StringToRegexp;
-
-typedef std::pair<R5TFormula, std::vector<AliTriggerAnalysis::Trigger>> FormulaAndBits;
-typedef std::map<std::string, FormulaAndBits> StringToFormula;
+class TriggerLogicProgram;
+class StringToTriggerLogic;
+class TriggerBitCache;
 
 class AliPhysicsSelection : public AliAnalysisCuts{
 public:
@@ -122,8 +112,9 @@ protected:
   AliOADBFillingScheme*    fFillOADB;    // Filling scheme OADB object
   AliOADBTriggerAnalysis*  fTriggerOADB; // Trigger analysis OADB object
 
-  StringToFormula *fTriggerToFormula; //! Map trigger strings to TFormulas
-  FormulaAndBits& FindForumla(const char* triggerLogic); //! Returns pair of TFormula and trigger bits
+  StringToTriggerLogic *fTriggerToLogic; //! Map trigger strings to compiled trigger logic
+  const TriggerLogicProgram& FindTriggerLogic(const char* triggerLogic); //! Returns the compiled trigger logic
+  TriggerBitCache* fTriggerBitCache; //! Trigger bits evaluated in the current event
 
   StringToRegexp* fTriggerToRegexp; //!
   TPRegexp& FindRegexp(const std::string& triggers) const;
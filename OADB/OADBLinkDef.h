@@ -16,6 +16,8 @@
 #pragma link C++ class AliPPVsMultUtils+;
 #pragma link C++ class AliBackgroundSelection+;
 #pragma link C++ class AliCentralitySelectionTask+;
+#pragma link C++ class AliEPCalibrationCache+;
+#pragma link C++ class AliEPQVectorContainer+;
 #pragma link C++ class AliEPSelectionTask+;
 #pragma link C++ class AliPhysicsSelection+;
 #pragma link C++ class AliPhysicsSelectionTask+;
@@ -44,6 +44,8 @@
 #include "AliNanoAODTrack.h"
 #include "AliNanoFilterNormalisation.h"
 #include "AliMultSelectionTask.h"
+#include "TObjString.h"
+#include <vector>
 
 ClassImp(AliAnalysisTaskNanoAODFilter)
 
@@ -63,10 +65,19 @@ AliAnalysisTaskNanoAODFilter::AliAnalysisTaskNanoAODFilter() // All data members
   fNmultBins(100),
   fMinMult(0),
   fMaxMult(100),
-  fNormalisation(0x0)
+  fNormalisation(0x0),
+  fOutputReplicators(),
+  fOutputFileNames(),
+  fOutputEvtCuts(),
+  fOutputNormalisations(),
+  fOutputImplicitMT(kTRUE)
 
 {
   // Dummy constructor ALWAYS needed for I/O.
+  fOutputReplicators.SetOwner(kTRUE);
+  fOutputFileNames.SetOwner(kTRUE);
+  fOutputEvtCuts.SetOwner(kTRUE);
+  fOutputNormalisations.SetOwner(kTRUE);
 }
 
 //________________________________________________________________________
@@ -84,7 +95,12 @@ AliAnalysisTaskNanoAODFilter::AliAnalysisTaskNanoAODFilter(const char *name, Boo
    fNmultBins(100),
    fMinMult(0),
    fMaxMult(100),
-   fNormalisation(0x0)
+   fNormalisation(0x0),
+   fOutputReplicators(),
+   fOutputFileNames(),
+   fOutputEvtCuts(),
+   fOutputNormalisations(),
+   fOutputImplicitMT(kTRUE)
 
 {
   // Constructor
@@ -92,6 +108,10 @@ AliAnalysisTaskNanoAODFilter::AliAnalysisTaskNanoAODFilter(const char *name, Boo
   fReplicator = new AliNanoAODReplicator("NanoAODReplicator", "remove non interesting tracks, writes special tracks array tracks");
   fQAOutput = new TList();
   fQAOutput->SetOwner(kTRUE); 
+  fOutputReplicators.SetOwner(kTRUE);
+  fOutputFileNames.SetOwner(kTRUE);
+  fOutputEvtCuts.SetOwner(kTRUE);
+  fOutputNormalisations.SetOwner(kTRUE);
   
   DefineOutput(1, AliNanoFilterNormalisation::Class());
   DefineOutput(2, TList::Class());
@@ -118,18 +138,54 @@ void AliAnalysisTaskNanoAODFilter::UserCreateOutputObjects()
   if (fSaveCutsFlag) {
     for (std::list<AliAnalysisCuts*>::iterator it = fEvtCuts.begin(); it != fEvtCuts.end(); ++it)
       fQAOutput->Add(*it);
+    for (Int_t i = 0; i < fOutputEvtCuts.GetEntriesFast(); i++)
+      fQAOutput->AddAll((TList*) fOutputEvtCuts.At(i));
     PostData(2, fQAOutput);
   }
-  
+
   std::string normName = std::string(fName) + "_scaler";
   fNormalisation = new AliNanoFilterNormalisation(normName.data(), normName.data(),fNmultBins,fMinMult,fMaxMult);
   PostData(1, fNormalisation);
+
+  // the additional outputs have their own event cuts, hence their own normalisation,
+  // stored with the same name in the user info of their file
+  for (Int_t i = 1; i < GetNOutputs(); i++)
+    fOutputNormalisations.Add(new AliNanoFilterNormalisation(normName.data(), normName.data(),fNmultBins,fMinMult,fMaxMult));
 }
 
 void AliAnalysisTaskNanoAODFilter::AddFilteredAOD(const char* aodfilename, const char* title)
+{
+  AddFilteredAOD(aodfilename, title, fReplicator);
+}
+
+Int_t AliAnalysisTaskNanoAODFilter::AddOutput(const char* aodfilename)
+{
+  // Adds an additional NanoAOD output, returns its index to be used with GetReplicator and AddOutputEvtCuts.
+  // The new replicator starts with the track and header variable lists of the main one.
+
+  AliNanoAODReplicator* replicator = new AliNanoAODReplicator(Form("NanoAODReplicator%d", GetNOutputs()), "remove non interesting tracks, writes special tracks array tracks");
+  replicator->SetVarListTrack(fReplicator->GetVarListTrack());
+  replicator->SetVarListHeader(fReplicator->GetVarListHeader());
+  fOutputReplicators.Add(replicator);
+  fOutputFileNames.Add(new TObjString(aodfilename));
+  fOutputEvtCuts.Add(new TList);
+  return GetNOutputs() - 1;
+}
+
+void AliAnalysisTaskNanoAODFilter::AddOutputEvtCuts(Int_t output, AliAnalysisCuts* var)
+{
+  if (output < 1 || output >= GetNOutputs())
+    AliFatal(Form("Output %d does not exist, the event cuts of the main output are added with AddEvtCuts", output));
+  ((TList*) fOutputEvtCuts.At(output - 1))->Add(var);
+}
+
+void AliAnalysisTaskNanoAODFilter::AddFilteredAOD(const char* aodfilename, const char* title, AliNanoAODReplicator* replicator)
 {
   // The replicator is added to the extension
 
+  if (replicator != fReplicator && TString(replicator->GetVarListTrack()) != fReplicator->GetVarListTrack())
+    AliFatal(Form("The track variable list of %s differs from the main output: the track mapping is common to all the outputs", aodfilename));
+
   AliAODHandler *aodH = (AliAODHandler*)((AliAnalysisManager::GetAnalysisManager())->GetOutputEventHandler());
   if (!aodH) AliFatal("No AOD handler");
   AliAODExtension* ext = aodH->AddFilteredAOD(aodfilename,title);
@@ -138,16 +194,16 @@ void AliAnalysisTaskNanoAODFilter::AddFilteredAOD(const char* aodfilename, const
     AliFatal("Cannot get extension");
   }
   
-  fReplicator->SetMCMode(fMCMode);
+  replicator->SetMCMode(fMCMode);
      
-  if (!fInputArrayName.IsNull()) fReplicator->SetInputArrayName(fInputArrayName);
-  if (!fOutputArrayName.IsNull()) fReplicator->SetOutputArrayName(fOutputArrayName);
+  if (!fInputArrayName.IsNull()) replicator->SetInputArrayName(fInputArrayName);
+  if (!fOutputArrayName.IsNull()) replicator->SetOutputArrayName(fOutputArrayName);
 
   ext->DropUnspecifiedBranches(); // all branches not part of a FilterBranch call (below) will be dropped
       
-  ext->FilterBranch("tracks",fReplicator);
-  ext->FilterBranch("vertices",fReplicator);  
-  ext->FilterBranch("header",fReplicator);  
+  ext->FilterBranch("tracks",replicator);
+  ext->FilterBranch("vertices",replicator);  
+  ext->FilterBranch("header",replicator);  
             
   if ( fMCMode > 0 ) 
     {
@@ -156,8 +212,8 @@ void AliAnalysisTaskNanoAODFilter::AddFilteredAOD(const char* aodfilename, const
       // For events w/o muon, mcparticles array will be empty and mcheader will be dummy
       // (e.g. strlen(GetGeneratorName())==0)
       
-      ext->FilterBranch("mcparticles",fReplicator);
-      ext->FilterBranch("mcHeader",fReplicator);
+      ext->FilterBranch("mcparticles",replicator);
+      ext->FilterBranch("mcHeader",replicator);
     }
 }
 
@@ -165,6 +221,8 @@ void AliAnalysisTaskNanoAODFilter::Init()
 {
   // Initialization
   AddFilteredAOD("AliAOD.NanoAOD.root", "NanoAODTracksEvents");
+  for (Int_t i = 0; i < fOutputReplicators.GetEntriesFast(); i++)
+    AddFilteredAOD(fOutputFileNames.At(i)->GetName(), "NanoAODTracksEvents", (AliNanoAODReplicator*) fOutputReplicators.At(i));
 }
 
 void AliAnalysisTaskNanoAODFilter::UserExec(Option_t *) 
@@ -180,32 +238,67 @@ void AliAnalysisTaskNanoAODFilter::UserExec(Option_t *)
     AliFatal("No input event");
 
   fNormalisation->FillCandidate(kTRUE, kTRUE, kTRUE, kTRUE, 0);
+  for (Int_t i = 0; i < fOutputNormalisations.GetEntriesFast(); i++)
+    ((AliNanoFilterNormalisation*) fOutputNormalisations.At(i))->FillCandidate(kTRUE, kTRUE, kTRUE, kTRUE, 0);
   
   for (std::list<AliAnalysisCuts*>::iterator it = fEvtCuts.begin(); it != fEvtCuts.end(); ++it)
     if (!((*it)->IsSelected(lAODevent))) 
       return;
 
+  Bool_t isEventSelected_EventCuts = kTRUE;
+  if (fUseAliEventCuts)
+    isEventSelected_EventCuts = fEventCuts.AcceptEvent(lAODevent);
+
+  // event cuts of the additional outputs, on top of the common selection including AliEventCuts
+  std::vector<Bool_t> outputSelected(fOutputEvtCuts.GetEntriesFast(), isEventSelected_EventCuts);
+  for (Int_t i = 0; i < fOutputEvtCuts.GetEntriesFast(); i++) {
+    if (!outputSelected[i])
+      continue;
+    TIter next((TList*) fOutputEvtCuts.At(i));
+    while (AliAnalysisCuts* cuts = (AliAnalysisCuts*) next())
+      if (!cuts->IsSelected(lAODevent)) {
+        outputSelected[i] = kFALSE;
+        break;
+      }
+  }
+
   if (fUseAliEventCuts) {
-    auto isEventSelected_EventCuts = fEventCuts.AcceptEvent(lAODevent);
     double mult = AliMultSelectionTask::IsINELgtZERO(lAODevent) ? fEventCuts.GetCentrality() : -0.5;
-    fNormalisation->FillSelected(fEventCuts.CheckNormalisationMask(AliEventCuts::kTriggeredEvent),
-                                 fEventCuts.CheckNormalisationMask(AliEventCuts::kPassesNonVertexRelatedSelections),
-                                 fEventCuts.CheckNormalisationMask(AliEventCuts::kHasReconstructedVertex),
-                                 fEventCuts.CheckNormalisationMask(AliEventCuts::kPassesAllCuts),
-                                 mult);
+    bool triggered = fEventCuts.CheckNormalisationMask(AliEventCuts::kTriggeredEvent);
+    bool nonVertexRelatedSel = fEventCuts.CheckNormalisationMask(AliEventCuts::kPassesNonVertexRelatedSelections);
+    bool recoVertex = fEventCuts.CheckNormalisationMask(AliEventCuts::kHasReconstructedVertex);
+    bool allCuts = fEventCuts.CheckNormalisationMask(AliEventCuts::kPassesAllCuts);
+    fNormalisation->FillSelected(triggered, nonVertexRelatedSel, recoVertex, allCuts, mult);
+    for (Int_t i = 0; i < fOutputNormalisations.GetEntriesFast(); i++)
+      ((AliNanoFilterNormalisation*) fOutputNormalisations.At(i))->FillSelected(triggered, nonVertexRelatedSel, recoVertex, allCuts && outputSelected[i], mult);
     if(!isEventSelected_EventCuts)
       return;
-  } else
+  } else {
     fNormalisation->FillSelected(kTRUE, kTRUE, kTRUE, kTRUE, 0);
+    for (Int_t i = 0; i < fOutputNormalisations.GetEntriesFast(); i++)
+      ((AliNanoFilterNormalisation*) fOutputNormalisations.At(i))->FillSelected(kTRUE, kTRUE, kTRUE, outputSelected[i], 0);
+  }
 
+  // The common selection above is evaluated once for all the outputs
   AliAODHandler* handler = dynamic_cast<AliAODHandler*>(AliAnalysisManager::GetAnalysisManager()->GetOutputEventHandler());
   if ( handler ){
-    AliAODExtension *extNanoAOD = handler->GetFilteredAOD("AliAOD.NanoAOD.root");
-   if ( extNanoAOD ) {				
-     extNanoAOD->SetEvent(lAODevent);
-     extNanoAOD->SelectEvent();
-     extNanoAOD->FinishEvent();
-   }
+    for (Int_t iOutput = 0; iOutput < GetNOutputs(); iOutput++) {
+      const char* fileName = "AliAOD.NanoAOD.root";
+      if (iOutput > 0) {
+        if (!outputSelected[iOutput - 1])
+          continue;
+        fileName = fOutputFileNames.At(iOutput - 1)->GetName();
+      }
+      AliAODExtension *extNanoAOD = handler->GetFilteredAOD(fileName);
+      if ( extNanoAOD ) {				
+        // only the output trees of this task are affected, the implicit multi-threading itself is steered by the train
+        if (extNanoAOD->GetTree())
+          extNanoAOD->GetTree()->SetImplicitMT(fOutputImplicitMT);
+        extNanoAOD->SetEvent(lAODevent);
+        extNanoAOD->SelectEvent();
+        extNanoAOD->FinishEvent();
+      }
+    }
   }
 }
 
@@ -217,8 +310,16 @@ void AliAnalysisTaskNanoAODFilter::FinishTaskOutput() {
 
   // We save here the user info
 
+  for (Int_t iOutput = 0; iOutput < GetNOutputs(); iOutput++)
+    WriteOutputUserInfo(iOutput);
+}
+
+void AliAnalysisTaskNanoAODFilter::WriteOutputUserInfo(Int_t output) {
+
+  const Bool_t mainOutput = (output == 0);
+  const char* aodfilename = mainOutput ? "AliAOD.NanoAOD.root" : fOutputFileNames.At(output - 1)->GetName();
   AliAODHandler* handler = dynamic_cast<AliAODHandler*>(AliAnalysisManager::GetAnalysisManager()->GetOutputEventHandler());
-  AliAODExtension *extNanoAOD = handler->GetFilteredAOD("AliAOD.NanoAOD.root");
+  AliAODExtension *extNanoAOD = handler->GetFilteredAOD(aodfilename);
 
   // copy production version info
   AliVEventHandler* inputHandler = AliAnalysisManager::GetAnalysisManager()->GetInputEventHandler();
@@ -228,12 +329,21 @@ void AliAnalysisTaskNanoAODFilter::FinishTaskOutput() {
       extNanoAOD->GetTree()->GetUserInfo()->Add(prodInfo->Clone());
   }
   
-  Printf("****************************************************************");
-  extNanoAOD->GetTree()->GetUserInfo()->Add(AliNanoAODTrackMapping::GetInstance(fReplicator->GetVarListTrack()));
-  AliNanoAODTrackMapping::GetInstance()->Print();
-  Printf("****************************************************************");
+  // the mapping singleton is given to the main output, the additional outputs get a copy
+  AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance(fReplicator->GetVarListTrack());
+  if (mainOutput) {
+    Printf("****************************************************************");
+    extNanoAOD->GetTree()->GetUserInfo()->Add(mapping);
+    mapping->Print();
+    Printf("****************************************************************");
+  } else {
+    extNanoAOD->GetTree()->GetUserInfo()->Add(mapping->Clone());
+  }
   
-  extNanoAOD->GetTree()->GetUserInfo()->Add(fNormalisation->Clone());
+  if (mainOutput)
+    extNanoAOD->GetTree()->GetUserInfo()->Add(fNormalisation->Clone());
+  else
+    extNanoAOD->GetTree()->GetUserInfo()->Add(fOutputNormalisations.At(output - 1)->Clone());
 }
 
 void AliAnalysisTaskNanoAODFilter::AddPIDField(AliNanoAODTrack::ENanoPIDResponse response, AliPID::EParticleType particle)
@@ -241,5 +351,13 @@ void AliAnalysisTaskNanoAODFilter::AddPIDField(AliNanoAODTrack::ENanoPIDResponse
   TString list(fReplicator->GetVarListTrack());
   list += ",";
   list += AliNanoAODTrack::GetPIDVarName(response, particle);
-  fReplicator->SetVarListTrack(list);
+  SetVarListTrack(list);
+}
+
+void AliAnalysisTaskNanoAODFilter::SetVarListTrack(TString var)
+{
+  // the track variable list is common to all the outputs
+  fReplicator->SetVarListTrack(var);
+  for (Int_t i = 0; i < fOutputReplicators.GetEntriesFast(); i++)
+    ((AliNanoAODReplicator*) fOutputReplicators.At(i))->SetVarListTrack(var);
 }
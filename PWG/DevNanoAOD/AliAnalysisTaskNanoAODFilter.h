@@ -22,6 +22,7 @@ class AliNanoFilterNormalisation;
 #include "AliEventCuts.h"
 #include "AliNanoAODTrack.h"
 #include "AliPID.h"
+#include <TObjArray.h>
 #include <list>
 
 class AliAnalysisTaskNanoAODFilter : public AliAnalysisTaskSE {
@@ -41,11 +42,21 @@ public:
   void  SetMCMode (Int_t var) { fMCMode = var;}
   void  AddFilteredAOD(const char* aodfilename, const char* title);
 
+  // Additional outputs: the same pass produces several NanoAODs, each with its own replicator
+  // (track/V0/cascade cuts, custom setters) and event cuts, on top of the common event selection.
+  // The track variable list is common to all the outputs (the track mapping is a singleton).
+  Int_t AddOutput(const char* aodfilename);
+  void  AddOutputEvtCuts(Int_t output, AliAnalysisCuts* var);
+  Int_t GetNOutputs() const { return 1 + fOutputReplicators.GetEntriesFast(); }
+  // With kFALSE, the output trees do not use the implicit multi-threading enabled by the train steering
+  void  SetOutputImplicitMT(Bool_t enable) { fOutputImplicitMT = enable; }
+
   void  AddEvtCuts     (AliAnalysisCuts * var           ) { fEvtCuts.push_back(var);}
   void  SetTrkCuts     (AliAnalysisCuts * var           ) { fReplicator->SetTrackCuts(var); if (fSaveCutsFlag) fQAOutput->Add(var);}
   void  AddSetter      (AliNanoAODCustomSetter * var    ) { fReplicator->AddCustomSetter(var); }
 
-  void  SetVarListTrack(TString var                     ) { fReplicator->SetVarListTrack(var);}
+  void  SetVarListTrack(TString var);
+  void  SetTrackStorage(Int_t storage                   ) { fReplicator->SetTrackStorage(storage);}
   void  AddPIDField(AliNanoAODTrack::ENanoPIDResponse response, AliPID::EParticleType particle);
   void  SetVarListHeader(TString var                    ) { fReplicator->SetVarListHeader(var);}
   void  SetVarFiredTriggerClasses (TString var          ) { fReplicator->SetVarListHeaderTC(var);}
@@ -62,7 +73,7 @@ public:
     fMaxMult = max;
   }
   
-  AliNanoAODReplicator* GetReplicator() { return fReplicator; }
+  AliNanoAODReplicator* GetReplicator(Int_t output = 0) { return output == 0 ? fReplicator : (AliNanoAODReplicator*) fOutputReplicators.At(output - 1); }
 
   void SetInputArrayName(TString name) {fInputArrayName=name;}
   void SetOutputArrayName(TString name) {fOutputArrayName=name;}
@@ -89,10 +100,19 @@ protected:
   Float_t fMinMult;     // min value of the axis of normalisation historgram
   Float_t fMaxMult;     // min value of the axis of normalisation historgram
 
+  TObjArray fOutputReplicators;     // replicators of the additional outputs (owned)
+  TObjArray fOutputFileNames;       // file names of the additional outputs (TObjString, owned)
+  TObjArray fOutputEvtCuts;         // event cuts of the additional outputs, one TList per output
+  TObjArray fOutputNormalisations;  //!<! normalisation of the additional outputs, including their own event cuts
+  Bool_t fOutputImplicitMT;         // use implicit multi-threading for the output trees, if enabled by the steering
+
   AliAnalysisTaskNanoAODFilter(const AliAnalysisTaskNanoAODFilter&); // not implemented
   AliAnalysisTaskNanoAODFilter& operator=(const AliAnalysisTaskNanoAODFilter&); // not implemented
 
-  ClassDef(AliAnalysisTaskNanoAODFilter, 9); // Nano AOD Filter Task
+  void AddFilteredAOD(const char* aodfilename, const char* title, AliNanoAODReplicator* replicator);
+  void WriteOutputUserInfo(Int_t output);
+
+  ClassDef(AliAnalysisTaskNanoAODFilter, 10); // Nano AOD Filter Task
 };
 
 #endif
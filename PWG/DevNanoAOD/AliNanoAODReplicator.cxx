@@ -49,6 +49,7 @@ class AliAODRecoDecay;
 #include "TObjArray.h"
 #include "AliAnalysisFilter.h"
 #include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackColumns.h"
 
 #include <TFile.h>
 #include <TDatabasePDG.h>
@@ -85,6 +86,9 @@ AliAODBranchReplicator(),
   fConversionPhotonCuts(0),
   fMCParticleCuts(nullptr),
   fTracks(0x0), 
+  fOwnTracks(kFALSE),
+  fTrackColumns(0x0),
+  fTrackStorage(kTrackObjects),
   fHeader(0x0), 
   fVertices(0x0), 
   fList(0x0),
@@ -125,6 +129,9 @@ AliNanoAODReplicator::AliNanoAODReplicator(const char* name, const char* title)
   fConversionPhotonCuts(0),
   fMCParticleCuts(nullptr),
   fTracks(0x0), 
+  fOwnTracks(kFALSE),
+  fTrackColumns(0x0),
+  fTrackStorage(kTrackObjects),
   fHeader(0x0), 
   fVertices(0x0), 
   fList(0x0),
@@ -162,6 +169,8 @@ AliNanoAODReplicator::~AliNanoAODReplicator()
 {
   // dtor
   delete fTrackCuts;
+  if (fOwnTracks)
+    delete fTracks; // not owned by fList
   delete fList;
 }
 
@@ -572,9 +581,20 @@ TList* AliNanoAODReplicator::GetList() const
       fList = new TList;
       fList->SetOwner(kTRUE);
 
+      if (fTrackStorage == kTrackColumns && (fSaveV0s || fSaveCascades || fSaveConversionPhotons))
+        AliFatal("V0s, cascades and conversion photons refer to AliNanoAODTrack objects: they cannot be saved with the column-only track storage");
+
+      // the track objects are always built (custom setters, MC relabelling), but only written if requested
       fTracks = new TClonesArray("AliNanoAODTrack");
       fTracks->SetName(fOutputArrayName.Data());
-      fList->Add(fTracks);
+      fOwnTracks = (fTrackStorage == kTrackColumns);
+      if (!fOwnTracks)
+        fList->Add(fTracks);
+
+      if (fTrackStorage != kTrackObjects) {
+        fTrackColumns = new AliNanoAODTrackColumns(Form("%sColumns", fOutputArrayName.Data()));
+        fList->Add(fTrackColumns);
+      }
 
       Int_t numberOfHeaderParam = 0;
       Int_t numberOfHeaderParamInt = 0;
@@ -884,6 +904,16 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
   if ( fMCMode > 0 ) {
     FilterMC(source);      
   }
+
+  // Column-wise copy of the tracks, after the MC relabelling
+  if (fTrackColumns) {
+    AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance();
+    if (fTrackColumns->GetNVars() != mapping->GetSize() || fTrackColumns->GetNVarsInt() != mapping->GetSizeInt())
+      fTrackColumns->SetLayout(mapping->GetSize(), mapping->GetSizeInt());
+    fTrackColumns->Clear();
+    for (Int_t j=0; j<fTracks->GetEntriesFast(); j++)
+      fTrackColumns->AddTrack(static_cast<AliNanoAODTrack*>(fTracks->UncheckedAt(j)));
+  }
 }
 
 void AliNanoAODReplicator::Terminate()
@@ -49,6 +49,7 @@ class AliAODHeader;
 class AliNanoAODHeader;
 class AliAnalysisTaskSE;
 class AliNanoAODTrack;
+class AliNanoAODTrackColumns;
 class AliAODTrack;
 class AliNanoAODCustomSetter;
 class AliAODZDC;
@@ -57,6 +58,12 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
 {
  public:
   
+  enum ETrackStorage {
+    kTrackObjects = 0,        // TClonesArray of AliNanoAODTrack (default)
+    kTrackColumns,            // AliNanoAODTrackColumns only
+    kTrackObjectsAndColumns   // both
+  };
+
   AliNanoAODReplicator();
   AliNanoAODReplicator(const char* name, const char* title);
   
@@ -92,6 +99,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   }
   
   void SetMCMode(Int_t mode)  { fMCMode = mode; }
+  void SetTrackStorage(Int_t storage) { fTrackStorage = storage; }
   
   void SetInputArrayName(TString name) {fInputArrayName=name;}
   void SetOutputArrayName(TString name) {fOutputArrayName=name;}
@@ -117,6 +125,9 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
                                                       // matching of the V0s from here
   
   mutable TClonesArray* fTracks; //! internal array of arrays of NanoAOD tracks
+  mutable Bool_t fOwnTracks; //! fTracks is not in fList and is deleted by the replicator
+  mutable AliNanoAODTrackColumns* fTrackColumns; //! internal column-wise copy of the NanoAOD tracks
+  Int_t fTrackStorage; // how the tracks are written, see ETrackStorage
   mutable AliNanoAODHeader* fHeader; //! internal array of headers
  
   mutable TClonesArray* fVertices; //! internal array of vertices
@@ -159,7 +170,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   AliNanoAODReplicator(const AliNanoAODReplicator&);
   AliNanoAODReplicator& operator=(const AliNanoAODReplicator&);
 
-  ClassDef(AliNanoAODReplicator, 7) // Branch replicator for ESD to muon AOD.
+  ClassDef(AliNanoAODReplicator, 8) // Branch replicator for ESD to muon AOD.
 };
 
 #endif
@@ -43,9 +43,12 @@ AliNanoAODTrack::AliNanoAODTrack() :
   fProdVertex(0),
   fNanoFlags(0),
   fDetectorPID(0),
-  fAODEvent(NULL)
+  fAODEvent(NULL),
+  fCachedTheta(TMath::QuietNaN()),
+  fCachedEta(0)
 {
   // default constructor
+  ResetKinematicsCache();
 }
 
 //______________________________________________________________________________
@@ -56,9 +59,12 @@ AliNanoAODTrack::AliNanoAODTrack(AliAODTrack * aodTrack, const char * vars) :
   fProdVertex(0),
   fNanoFlags(0),
   fDetectorPID(0),
-  fAODEvent(NULL)
+  fAODEvent(NULL),
+  fCachedTheta(TMath::QuietNaN()),
+  fCachedEta(0)
 {
   // constructor
+  ResetKinematicsCache();
 
   Double_t position[3];
   aodTrack->GetXYZ(position); // GetXYZ() returns kTRUE, if it's DCA information
@@ -157,9 +163,12 @@ AliNanoAODTrack::AliNanoAODTrack(AliESDTrack * /*esdTrack*/, const char * /*vars
   fLabel(0),
   fProdVertex(0),
   fNanoFlags(0),
-  fAODEvent(NULL)
+  fAODEvent(NULL),
+  fCachedTheta(TMath::QuietNaN()),
+  fCachedEta(0)
 {
   // ctor: Creates a special track by copying the requested variables from an ESD track
+  ResetKinematicsCache();
   AliFatal("To be Implemented");
 }
 
@@ -170,9 +179,12 @@ AliNanoAODTrack::AliNanoAODTrack(const char * vars) :
   fLabel(0),
   fProdVertex(0),
   fNanoFlags(0),
-  fAODEvent(NULL)
+  fAODEvent(NULL),
+  fCachedTheta(TMath::QuietNaN()),
+  fCachedEta(0)
 {
    // ctor: Creates a special track simply allocating the required variables
+  ResetKinematicsCache();
   AliNanoAODTrackMapping::GetInstance(vars);
 
   // Create internal structure
@@ -193,9 +205,12 @@ AliNanoAODTrack::AliNanoAODTrack(const AliNanoAODTrack& trk) :
   fLabel(trk.fLabel),
   fProdVertex(trk.fProdVertex),
   fNanoFlags(trk.fNanoFlags),
-  fAODEvent(trk.fAODEvent)
+  fAODEvent(trk.fAODEvent),
+  fCachedTheta(TMath::QuietNaN()),
+  fCachedEta(0)
 {
   // Copy constructor
+  ResetKinematicsCache();
   // std::cout << "Copy Ctor" << std::endl;
   
   AllocateInternalStorage(AliNanoAODTrackMapping::GetInstance()->GetSize(), AliNanoAODTrackMapping::GetInstance()->GetSizeInt());
@@ -583,3 +598,43 @@ void AliNanoAODTrack::SetDetectorPID(const AliDetectorPID *pid)
   if (fDetectorPID) delete fDetectorPID;
   fDetectorPID=pid;
 }
+
+//______________________________________________________________________________
+void AliNanoAODTrack::ResetKinematicsCache()
+{
+  // invalidate the derived kinematics: NaN never compares equal to the stored variables
+  fCachedTheta = TMath::QuietNaN();
+  for (Int_t i = 0; i < 3; i++) {
+    fCachedPtPhiTheta[i] = TMath::QuietNaN();
+    fCachedP[i] = 0;
+  }
+}
+
+//______________________________________________________________________________
+Double_t AliNanoAODTrack::Eta() const
+{
+  // pseudorapidity, recomputed only if theta changed since the last call
+  const Double_t theta = Theta();
+  if (theta != fCachedTheta) {
+    fCachedEta = -TMath::Log(TMath::Tan(0.5 * theta));
+    fCachedTheta = theta;
+  }
+  return fCachedEta;
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrack::UpdateMomentumCache() const
+{
+  // compute px, py, pz if pt, phi or theta changed since the last call
+  const Double_t pt = Pt();
+  const Double_t phi = Phi();
+  const Double_t theta = Theta();
+  if (pt == fCachedPtPhiTheta[0] && phi == fCachedPtPhiTheta[1] && theta == fCachedPtPhiTheta[2])
+    return;
+  fCachedP[0] = pt * TMath::Cos(phi);
+  fCachedP[1] = pt * TMath::Sin(phi);
+  fCachedP[2] = pt / TMath::Tan(theta);
+  fCachedPtPhiTheta[0] = pt;
+  fCachedPtPhiTheta[1] = phi;
+  fCachedPtPhiTheta[2] = theta;
+}
@@ -85,9 +85,9 @@ public:
   virtual Double_t Phi()       const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi());   }
   virtual Double_t Theta()     const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()); }
   
-  virtual Double_t Px() const { return Pt() * TMath::Cos(Phi()); }
-  virtual Double_t Py() const { return Pt() * TMath::Sin(Phi()); }
-  virtual Double_t Pz() const { return Pt() / TMath::Tan(Theta()); }
+  virtual Double_t Px() const { UpdateMomentumCache(); return fCachedP[0]; }
+  virtual Double_t Py() const { UpdateMomentumCache(); return fCachedP[1]; }
+  virtual Double_t Pz() const { UpdateMomentumCache(); return fCachedP[2]; }
   virtual Double_t Pt() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()); }
   virtual Double_t P()  const { return TMath::Sqrt(Pt()*Pt()+Pz()*Pz()); }
   virtual Bool_t   PxPyPz(Double_t p[3]) const { p[0] = Px(); p[1] = Py(); p[2] = Pz(); return kTRUE; }
@@ -110,7 +110,7 @@ public:
   Double_t Y(AliAODTrack::AODTrkPID_t pid) const;
   Double_t Y(Double_t m) const;
   
-  virtual Double_t Eta() const { return -TMath::Log(TMath::Tan(0.5 * Theta())); }
+  virtual Double_t Eta() const;
   virtual Double_t GetSign() const {return Charge(); }
   virtual Bool_t   PropagateToDCA(const AliVVertex *vtx, 
 				  Double_t b, Double_t maxd, Double_t dz[2], Double_t covar[3]);
@@ -367,6 +367,9 @@ public:
 
 private :
 
+  void ResetKinematicsCache();
+  void UpdateMomentumCache() const;
+
 
 
   // Momentum & position
@@ -382,6 +385,13 @@ private :
   
   const AliAODEvent* fAODEvent;     //! 
 
+  // Derived kinematics, computed on first access. The cache is keyed on the
+  // stored variables, so that it stays valid after setters and I/O.
+  mutable Double_t fCachedTheta;      //!<! theta for which fCachedEta was computed
+  mutable Double_t fCachedEta;        //!<! pseudorapidity
+  mutable Double_t fCachedPtPhiTheta[3]; //!<! pt, phi, theta for which fCachedP was computed
+  mutable Double_t fCachedP[3];       //!<! px, py, pz
+
   ClassDef(AliNanoAODTrack, 1);
 };
 
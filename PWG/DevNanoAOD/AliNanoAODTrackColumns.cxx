@@ -0,0 +1,154 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//-------------------------------------------------------------------------
+//     Column-wise storage of the NanoAOD tracks of one event
+//-------------------------------------------------------------------------
+
+#include <TBuffer.h>
+#include <TMath.h>
+#include "AliLog.h"
+
+#include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackMapping.h"
+#include "AliNanoAODTrackColumns.h"
+
+ClassImp(AliNanoAODTrackColumns)
+
+//______________________________________________________________________________
+AliNanoAODTrackColumns::AliNanoAODTrackColumns() :
+  TNamed(),
+  fColumns(),
+  fColumnsInt(),
+  fLabels(),
+  fNanoFlags(),
+  fNDerived(-1),
+  fEta(),
+  fPx(),
+  fPy(),
+  fPz()
+{
+  // default constructor
+}
+
+//______________________________________________________________________________
+AliNanoAODTrackColumns::AliNanoAODTrackColumns(const char* name) :
+  TNamed(name, "NanoAOD track columns"),
+  fColumns(),
+  fColumnsInt(),
+  fLabels(),
+  fNanoFlags(),
+  fNDerived(-1),
+  fEta(),
+  fPx(),
+  fPy(),
+  fPz()
+{
+  // constructor
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumns::Clear(Option_t* /*opt*/)
+{
+  // empty the columns, keeping the layout and the allocated memory
+  for (UInt_t i = 0; i < fColumns.size(); i++)
+    fColumns[i].clear();
+  for (UInt_t i = 0; i < fColumnsInt.size(); i++)
+    fColumnsInt[i].clear();
+  fLabels.clear();
+  fNanoFlags.clear();
+  fNDerived = -1;
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumns::SetLayout(Int_t nVars, Int_t nVarsInt)
+{
+  // set the number of (int) variables, as given by the track mapping
+  fColumns.resize(nVars);
+  fColumnsInt.resize(nVarsInt);
+  Clear();
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumns::AddTrack(const AliNanoAODTrack* track)
+{
+  // append the variables of a track to the columns
+  for (UInt_t i = 0; i < fColumns.size(); i++)
+    fColumns[i].push_back(track->GetVar(i));
+  for (UInt_t i = 0; i < fColumnsInt.size(); i++)
+    fColumnsInt[i].push_back(track->GetVarInt(i));
+  fLabels.push_back(track->GetLabel());
+  fNanoFlags.push_back(track->GetNanoFlags());
+}
+
+//______________________________________________________________________________
+AliNanoAODTrackColumns::Span<Float_t> AliNanoAODTrackColumns::GetColumn(Int_t var) const
+{
+  if (var < 0 || var >= (Int_t) fColumns.size()) {
+    AliFatal(Form("Variable %d not stored", var));
+    return Span<Float_t>();
+  }
+  return Span<Float_t>(fColumns[var].data(), fColumns[var].size());
+}
+
+//______________________________________________________________________________
+AliNanoAODTrackColumns::Span<Int_t> AliNanoAODTrackColumns::GetColumnInt(Int_t var) const
+{
+  if (var < 0 || var >= (Int_t) fColumnsInt.size()) {
+    AliFatal(Form("Int variable %d not stored", var));
+    return Span<Int_t>();
+  }
+  return Span<Int_t>(fColumnsInt[var].data(), fColumnsInt[var].size());
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumns::FillDerived() const
+{
+  // compute eta, px, py, pz for the tracks of the event, once per event
+  const Int_t nTracks = GetNTracks();
+  if (fNDerived == nTracks)
+    return;
+
+  AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance();
+  Span<Float_t> pt = GetColumn(mapping->GetPt());
+  Span<Float_t> phi = GetColumn(mapping->GetPhi());
+  Span<Float_t> theta = GetColumn(mapping->GetTheta());
+
+  fEta.resize(nTracks);
+  fPx.resize(nTracks);
+  fPy.resize(nTracks);
+  fPz.resize(nTracks);
+  for (Int_t i = 0; i < nTracks; i++) {
+    const Double_t tanHalfTheta = TMath::Tan(0.5 * theta[i]);
+    fEta[i] = -TMath::Log(tanHalfTheta);
+    fPx[i] = pt[i] * TMath::Cos(phi[i]);
+    fPy[i] = pt[i] * TMath::Sin(phi[i]);
+    // 1/tan(theta) = (1 - tan^2(theta/2)) / (2 tan(theta/2))
+    fPz[i] = pt[i] * (1. - tanHalfTheta * tanHalfTheta) / (2. * tanHalfTheta);
+  }
+  fNDerived = nTracks;
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumns::Streamer(TBuffer& buffer)
+{
+  // custom streamer to invalidate the derived kinematics after reading an event
+  if (buffer.IsReading()) {
+    buffer.ReadClassBuffer(AliNanoAODTrackColumns::Class(), this);
+    fNDerived = -1;
+  } else {
+    buffer.WriteClassBuffer(AliNanoAODTrackColumns::Class(), this);
+  }
+}
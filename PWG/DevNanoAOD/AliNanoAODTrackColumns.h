@@ -0,0 +1,85 @@
+#ifndef ALINANOAODTRACKCOLUMNS_H
+#define ALINANOAODTRACKCOLUMNS_H
+/* Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-------------------------------------------------------------------------
+//     Column-wise storage of the NanoAOD tracks of one event
+//     Each variable of the track mapping is stored as a contiguous
+//     array over the tracks of the event, together with the track labels
+//     and the nano flags. Analyses looping over all tracks can use the
+//     span accessors instead of going through one AliNanoAODTrack per
+//     track. The derived kinematics (eta, px, py, pz) are computed on
+//     first access and kept until the next event.
+//     The variable indexes are the ones of AliNanoAODTrackMapping.
+//     Written by AliNanoAODReplicator with SetTrackStorage(kTrackColumns)
+//     as "<output array name>Columns", e.g.
+//       aod->FindListObject("tracksColumns")
+//-------------------------------------------------------------------------
+
+#include <TNamed.h>
+#include <vector>
+
+class AliNanoAODTrack;
+
+class AliNanoAODTrackColumns : public TNamed {
+
+public:
+  /// Read-only view on one column, for bulk loops over the tracks
+  template <typename T> class Span {
+  public:
+    Span(const T* data = 0x0, Int_t size = 0) : fData(data), fSize(size) {}
+    const T* begin() const { return fData; }
+    const T* end() const { return fData + fSize; }
+    const T* data() const { return fData; }
+    Int_t size() const { return fSize; }
+    const T& operator[](Int_t i) const { return fData[i]; }
+  private:
+    const T* fData;
+    Int_t fSize;
+  };
+
+  AliNanoAODTrackColumns();
+  AliNanoAODTrackColumns(const char* name);
+  virtual ~AliNanoAODTrackColumns() {}
+
+  virtual void Clear(Option_t* opt = "");
+
+  void  SetLayout(Int_t nVars, Int_t nVarsInt);
+  void  AddTrack(const AliNanoAODTrack* track);
+
+  Int_t GetNTracks() const { return fLabels.size(); }
+  Int_t GetNVars() const { return fColumns.size(); }
+  Int_t GetNVarsInt() const { return fColumnsInt.size(); }
+
+  Span<Float_t> GetColumn(Int_t var) const;
+  Span<Int_t>   GetColumnInt(Int_t var) const;
+  Span<Int_t>   GetLabels() const { return Span<Int_t>(fLabels.data(), fLabels.size()); }
+  Span<UInt_t>  GetNanoFlags() const { return Span<UInt_t>(fNanoFlags.data(), fNanoFlags.size()); }
+
+  Span<Float_t> GetEta() const { FillDerived(); return Span<Float_t>(fEta.data(), fEta.size()); }
+  Span<Float_t> GetPx() const  { FillDerived(); return Span<Float_t>(fPx.data(), fPx.size()); }
+  Span<Float_t> GetPy() const  { FillDerived(); return Span<Float_t>(fPy.data(), fPy.size()); }
+  Span<Float_t> GetPz() const  { FillDerived(); return Span<Float_t>(fPz.data(), fPz.size()); }
+
+private:
+  void FillDerived() const;
+
+  std::vector<std::vector<Float_t> > fColumns;    ///< one array per variable, over the tracks
+  std::vector<std::vector<Int_t> >   fColumnsInt; ///< one array per int variable, over the tracks
+  std::vector<Int_t>  fLabels;                    ///< track labels
+  std::vector<UInt_t> fNanoFlags;                 ///< nano flags of the tracks
+
+  mutable Int_t fNDerived;                        //!<! number of tracks for which the derived kinematics are filled, -1 if invalid
+  mutable std::vector<Float_t> fEta;              //!<! pseudorapidity
+  mutable std::vector<Float_t> fPx;               //!<! momentum x component
+  mutable std::vector<Float_t> fPy;               //!<! momentum y component
+  mutable std::vector<Float_t> fPz;               //!<! momentum z component
+
+  AliNanoAODTrackColumns(const AliNanoAODTrackColumns&);
+  AliNanoAODTrackColumns& operator=(const AliNanoAODTrackColumns&);
+
+  ClassDef(AliNanoAODTrackColumns, 1);
+};
+
+#endif
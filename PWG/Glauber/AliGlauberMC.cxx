@@ -32,6 +32,11 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TF1.h>
+#include <TRandom3.h>
+#include <RConfigure.h>
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
 
 #include "AliGlauberNucleon.h"
 #include "AliGlauberNucleus.h"
@@ -172,7 +177,13 @@ AliGlauberMC::AliGlauberMC(Option_t* NA, Option_t* NB, Double_t xsect) :
   fOmega(0),
   fSig0(0),
   fLambda(0),
-  fSigFluc(0)
+  fSigFluc(0),
+  fNThreads(1),
+  fSeed(0),
+  fRandom(0),
+  fSigFlucInvCDF(),
+  fGridOffset(),
+  fGridNucleon()
 {
   //ctor
   for (UInt_t i=0; i<(sizeof(fdNdEtaParam)/sizeof(fdNdEtaParam[0])); i++)
@@ -197,13 +208,13 @@ AliGlauberMC::AliGlauberMC(const AliGlauberMC& in):
   fANucleus(in.fANucleus),
   fBNucleus(in.fBNucleus),
   fXSect(in.fXSect),
-  fNucleonsA(in.fNucleonsA),
-  fNucleonsB(in.fNucleonsB),
+  fNucleonsA(fANucleus.GetNucleons()),
+  fNucleonsB(fBNucleus.GetNucleons()),
   fAN(in.fAN),
   fQAN(in.fQAN),
   fBN(in.fBN),
   fQBN(in.fQBN),
-  fnt(in.fnt),
+  fnt(0),
   fMeanX2(in.fMeanX2),
   fMeanY2(in.fMeanY2),
   fMeanXY(in.fMeanXY),
@@ -322,9 +333,15 @@ AliGlauberMC::AliGlauberMC(const AliGlauberMC& in):
   fOmega(in.fOmega),
   fSig0(in.fSig0),
   fLambda(in.fLambda),
-  fSigFluc(in.fSigFluc)
+  fSigFluc(in.fSigFluc),
+  fNThreads(in.fNThreads),
+  fSeed(in.fSeed),
+  fRandom(in.fRandom),
+  fSigFlucInvCDF(in.fSigFlucInvCDF),
+  fGridOffset(),
+  fGridNucleon()
 {
-  //copy ctor
+  //copy ctor, the ntuple is not shared with the copy
   memcpy(fdNdEtaParam,in.fdNdEtaParam,sizeof(fdNdEtaParam));
 }
 
@@ -336,13 +353,13 @@ AliGlauberMC& AliGlauberMC::operator=(const AliGlauberMC& in)
   fANucleus=in.fANucleus;
   fBNucleus=in.fBNucleus;
   fXSect=in.fXSect;
-  fNucleonsA=in.fNucleonsA;
-  fNucleonsB=in.fNucleonsB;
+  fNucleonsA=fANucleus.GetNucleons();
+  fNucleonsB=fBNucleus.GetNucleons();
   fAN=in.fAN;
   fQAN=in.fQAN;
   fBN=in.fBN;
   fQBN=in.fQBN;
-  fnt=in.fnt;
+  // the ntuple is owned and deleted by each object, it is not copied
   fMeanX2=in.fMeanX2;
   fMeanY2=in.fMeanY2;
   fMeanXY=in.fMeanXY;
@@ -453,90 +470,175 @@ AliGlauberMC& AliGlauberMC::operator=(const AliGlauberMC& in)
   fSxyCom=in.fSxyCom;
   fX=in.fX;
   fNpp=in.fNpp;
+  fNThreads=in.fNThreads;
+  fSeed=in.fSeed;
+  fRandom=in.fRandom;
+  fSigFlucInvCDF=in.fSigFlucInvCDF;
   return *this;
 }
 
 //______________________________________________________________________________
-Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
+TRandom *AliGlauberMC::GetRandomGenerator() const
 {
-  // prepare event
+  return fRandom ? fRandom : gRandom;
+}
 
+//______________________________________________________________________________
+void AliGlauberMC::InitSampling()
+{
+  // prepare the lookup tables used to sample the nucleon positions and
+  // the fluctuating cross section; needs to be called before the event
+  // generation is distributed to several threads
+  fANucleus.InitSampling();
+  fBNucleus.InitSampling();
   if (fDoFluc) {
     if (!fSigFluc) {
       fSigFluc = new TF1("fSigFluc","[0]*x/[3]/(x/[3]+[1])*exp(-((x/[1]/[3]-1)/[2])^2)",0,250);
       fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
       cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
     }
+    if (fSigFlucInvCDF.empty())
+      AliGlauberNucleus::MakeInverseCDF(fSigFluc,fSigFlucInvCDF);
   }
+}
+
+//______________________________________________________________________________
+Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
+{
+  // prepare event
+  InitSampling();
+  TRandom *rnd = GetRandomGenerator();
 
   fANucleus.ThrowNucleons(-bgen/2.);
   fNucleonsA = fANucleus.GetNucleons();
   fAN = fANucleus.GetN();
   fQAN = fAN * 3;
   //fAN = 3 * fANucleus.GetN(); // for Pb, Number of quark = 3*208;
+  std::vector<Double_t> &sigA = fANucleus.GetSigNN();
   for (Int_t i = 0; i<fAN; i++)
   {
     AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(i));
     nucleonA->SetInNucleusA();
-    nucleonA->SetSigNN(fXSect);
+    sigA[i] = fXSect;
     if (fDoFluc)
-      nucleonA->SetSigNN(fSigFluc->GetRandom());
+      sigA[i] = AliGlauberNucleus::SampleInverseCDF(fSigFlucInvCDF,rnd);
   }
   fBNucleus.ThrowNucleons(bgen/2.);
   fNucleonsB = fBNucleus.GetNucleons();
   //fBN = 3 * fBNucleus.GetN(); // Number of quark = number of nucleus*3;
   fBN = fBNucleus.GetN();
   fQBN = fBN * 3;
+  std::vector<Double_t> &sigB = fBNucleus.GetSigNN();
   for (Int_t i = 0; i<fBN; i++)
   {
     AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
     nucleonB->SetInNucleusB();
-    nucleonB->SetSigNN(fXSect);
+    sigB[i] = fXSect;
     if (fDoFluc)
-      nucleonB->SetSigNN(fSigFluc->GetRandom());
+      sigB[i] = AliGlauberNucleus::SampleInverseCDF(fSigFlucInvCDF,rnd);
   }
 
-  if (fDoFluc) {
-    if (!fSigFluc) {
-      fSigFluc = new TF1("fSigFluc","[0]*x/[3]/(x/[3]+[1])*exp(-((x/[1]/[3]-1)/[2])^2)",0,250);
-      fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
-      cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
-    }
-    fXSect = fSigFluc->GetRandom();
-  }
+  if (fDoFluc)
+    fXSect = AliGlauberNucleus::SampleInverseCDF(fSigFlucInvCDF,rnd);
+
+  CollideNucleons();
+  fANucleus.UpdateNucleons();
+  fBNucleus.UpdateNucleons();
+  return CalcResults(bgen);
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::CollideNucleons()
+{
+  // find the colliding pairs of nucleons: the nucleons of A are sorted
+  // into cells in the transverse plane as large as the largest interaction
+  // distance, so each nucleon of B is only tested against the nucleons of A
+  // in the 3x3 cells around it
+  const std::vector<Float_t> &xA = fANucleus.GetPosX();
+  const std::vector<Float_t> &yA = fANucleus.GetPosY();
+  const std::vector<Float_t> &xB = fBNucleus.GetPosX();
+  const std::vector<Float_t> &yB = fBNucleus.GetPosY();
+  const std::vector<Double_t> &sigA = fANucleus.GetSigNN();
+  const std::vector<Double_t> &sigB = fBNucleus.GetSigNN();
+  std::vector<Int_t> &ncollA = fANucleus.GetNColl();
+  std::vector<Int_t> &ncollB = fBNucleus.GetNColl();
+
   // "ball" diameter = distance at which two balls interact
   Double_t d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
+  Double_t d2Max = d2;
+  if (fDoFluc) {
+    Double_t sigMax = 0;
+    for (Int_t j = 0; j<fAN; j++) sigMax = TMath::Max(sigMax,sigA[j]);
+    for (Int_t i = 0; i<fBN; i++) sigMax = TMath::Max(sigMax,sigB[i]);
+    d2Max = sigMax/(TMath::Pi()*10);
+  }
 
   Double_t bNN   = 0;
   Double_t Nco   = 0;
   Double_t Ncohc = 0; // hard core
 
-  // for each of the A nucleons in nucleus B
-  for (Int_t i = 0; i<fBN; i++)
-  {
-    AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
-    for (Int_t j = 0 ; j < fAN ; j++)
+  if (fAN>0 && fBN>0 && d2Max>0) {
+    // cells of the nucleons of A
+    Float_t xmin = xA[0], xmax = xA[0], ymin = yA[0], ymax = yA[0];
+    for (Int_t j = 1; j<fAN; j++) {
+      xmin = TMath::Min(xmin,xA[j]); xmax = TMath::Max(xmax,xA[j]);
+      ymin = TMath::Min(ymin,yA[j]); ymax = TMath::Max(ymax,yA[j]);
+    }
+    Double_t cell = TMath::Sqrt(d2Max);
+    Int_t nx = TMath::Min((Int_t)((xmax-xmin)/cell)+1,256);
+    Int_t ny = TMath::Min((Int_t)((ymax-ymin)/cell)+1,256);
+    Double_t cellX = TMath::Max(cell,1.0001*(xmax-xmin)/nx);
+    Double_t cellY = TMath::Max(cell,1.0001*(ymax-ymin)/ny);
+    fGridOffset.assign(nx*ny+1,0);
+    fGridNucleon.resize(fAN);
+    std::vector<Int_t> cellA(fAN);
+    for (Int_t j = 0; j<fAN; j++) {
+      Int_t ix = TMath::Min((Int_t)((xA[j]-xmin)/cellX),nx-1);
+      Int_t iy = TMath::Min((Int_t)((yA[j]-ymin)/cellY),ny-1);
+      cellA[j] = ix*ny+iy;
+      fGridOffset[cellA[j]+1]++;
+    }
+    for (Int_t c = 0; c<nx*ny; c++) fGridOffset[c+1] += fGridOffset[c];
+    std::vector<Int_t> fill(fGridOffset.begin(),fGridOffset.end()-1);
+    for (Int_t j = 0; j<fAN; j++) fGridNucleon[fill[cellA[j]]++] = j;
+
+    // for each of the B nucleons the A nucleons nearby
+    for (Int_t i = 0; i<fBN; i++)
     {
-      AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
-      Double_t dx = nucleonB->GetX()-nucleonA->GetX();
-      Double_t dy = nucleonB->GetY()-nucleonA->GetY();
-      Double_t dij = dx*dx+dy*dy;
-      if (fDoFluc) {
-	//fXSect = nucleonA->GetSigNN();
-	//fXSect = (nucleonA->GetSigNN()+nucleonB->GetSigNN())/2.;
-	fXSect = TMath::Max(nucleonA->GetSigNN(),nucleonB->GetSigNN());
-	d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
-      }
-      if (dij < d2)
+      Int_t ix = (Int_t)TMath::Floor((xB[i]-xmin)/cellX);
+      Int_t iy = (Int_t)TMath::Floor((yB[i]-ymin)/cellY);
+      if (ix<-1 || ix>nx || iy<-1 || iy>ny) continue;
+      for (Int_t jx = TMath::Max(ix-1,0); jx<=TMath::Min(ix+1,nx-1); jx++)
       {
-	bNN += dij;
-	++Nco;
-        nucleonB->Collide();
-        nucleonA->Collide();
-	if (dij<d2/4)
-	  ++Ncohc;
+        for (Int_t jy = TMath::Max(iy-1,0); jy<=TMath::Min(iy+1,ny-1); jy++)
+        {
+          Int_t c = jx*ny+jy;
+          for (Int_t k = fGridOffset[c]; k<fGridOffset[c+1]; k++)
+          {
+            Int_t j = fGridNucleon[k];
+            Double_t dx = xB[i]-xA[j];
+            Double_t dy = yB[i]-yA[j];
+            Double_t dij = dx*dx+dy*dy;
+            if (fDoFluc) {
+              //fXSect = (nucleonA->GetSigNN()+nucleonB->GetSigNN())/2.;
+              d2 = TMath::Max(sigA[j],sigB[i])/(TMath::Pi()*10); // in fm^2
+            }
+            if (dij < d2)
+            {
+              bNN += dij;
+              ++Nco;
+              ++ncollB[i];
+              ++ncollA[j];
+              if (dij<d2/4)
+                ++Ncohc;
+            }
+          }
+        }
       }
     }
+    // as in the full double loop, the cross section of the last pair is kept
+    if (fDoFluc)
+      fXSect = TMath::Max(sigA[fAN-1],sigB[fBN-1]);
   }
 
   if (Nco>0) {
@@ -546,12 +648,6 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
     fNcollw = 0;
     fBNN    = 0.;
   }
-
-  if (Nco>0)
-    fBNN = bNN/Nco;
-  else
-    fBNN = 0.;
-  return CalcResults(bgen);
 }
 
 //______________________________________________________________________________
@@ -1267,7 +1363,7 @@ Int_t AliGlauberMC::NegativeBinomialRandom(Int_t k, Double_t nmean) const
   {
     array[i] = NegativeBinomialDistribution(i,k,nmean) + array[i-1];
   }
-  Double_t r = gRandom->Uniform(0,1);
+  Double_t r = GetRandomGenerator()->Uniform(0,1);
   return TMath::BinarySearch(fMaxPlot,array,r)+2;
 
 }
@@ -1278,7 +1374,7 @@ Int_t AliGlauberMC::NegativeBinomialRandomSV(Double_t k, Double_t nbar) const
   // negative binomial distribution generator, S. Voloshin, 09-May-2007
   Double_t sum=0.;
   Int_t i=0;
-  Double_t ran=gRandom->Rndm();
+  Double_t ran=GetRandomGenerator()->Rndm();
   Double_t trm=1./pow(1.+nbar/k,k);
   if (trm==0.)
   {
@@ -1308,7 +1404,7 @@ Int_t AliGlauberMC::DoubleNegativeBinomialRandom( Int_t k,
   {
     array[i] = alpha*NegativeBinomialDistribution(i,k,nmean)+(1-alpha)*NegativeBinomialDistribution(i,k2,nmean2) + array[i-1];
   }
-  Double_t r = gRandom->Uniform(0,1);
+  Double_t r = GetRandomGenerator()->Uniform(0,1);
   return TMath::BinarySearch(fMaxPlot,array,r)+2;
 }
 
@@ -1506,7 +1602,7 @@ Bool_t AliGlauberMC::NextEvent(Double_t bgen)
   {
     if(bgen<0||!succes) //get impactparameter
     {
-      bgen = TMath::Sqrt((fBMax*fBMax-fBMin*fBMin)*gRandom->Rndm()+fBMin*fBMin);
+      bgen = TMath::Sqrt((fBMax*fBMax-fBMin*fBMin)*GetRandomGenerator()->Rndm()+fBMin*fBMin);
     }
     if ( (succes=CalcEvent(bgen)) ) break; //ends if we have particparts
   }
@@ -1681,98 +1777,201 @@ Double_t AliGlauberMC::GetPsi4m2() const
   return (TMath::Cos(4*(((TMath::ATan2(fMeanr4Sin4Phi,fMeanr4Cos4Phi)+TMath::Pi())/4)-((TMath::ATan2(fMeanr2Sin2Phi,fMeanr2Cos2Phi)+TMath::Pi())/2))));
 }
 */
+//______________________________________________________________________________
+TNtuple *AliGlauberMC::MakeNtuple() const
+{
+  //ntuple of the event results, created in the current directory
+  TString name(Form("nt_%s_%s",fANucleus.GetName(),fBNucleus.GetName()));
+  TString title(Form("%s + %s (x-sect = %d mb)",fANucleus.GetName(),fBNucleus.GetName(),(Int_t) fXSect));
+  return new TNtuple(name,title,
+                     "Npart:Ncoll:B:MeanX:MeanY:MeanX2:MeanY2:MeanXY:VarX:VarY:VarXY:MeanXSystem:MeanYSystem:MeanXA:MeanYA:MeanXB:MeanYB:VarE:Stoa:VarEColl:VarECom:VarEPart:VarEPartColl:VarEPartCom:dNdEta:dNdEtaGBW:dNdEtaTwoNBD:xsect:tAA:Epsl2:Epsl3:Epsl4:Epsl5:E2Coll:E3Coll:E4Coll:E5Coll:E2Com:E3Com:E4Com:E5Com:Psi2:Psi3:Psi4:Psi5:BNN:signn:Ncollw");
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::GetNtupleRow(Float_t *v) const
+{
+  //ntuple variables of the current event
+  v[0]  = GetNpart();
+  v[1]  = GetNcoll();
+  v[2]  = fBMC;
+  v[3]  = fMeanXParts;
+  v[4]  = fMeanYParts;
+  v[5]  = fMeanX2Parts;
+  v[6]  = fMeanY2Parts;
+  v[7]  = fMeanXYParts;
+  v[8]  = fSx2Parts;
+  v[9]  = fSy2Parts;
+  v[10] = fSxyParts;
+  v[11] = fMeanXSystem;
+  v[12] = fMeanYSystem;
+  v[13] = fMeanXA;
+  v[14] = fMeanYA;
+  v[15] = fMeanXB;
+  v[16] = fMeanYB;
+  v[17] = GetEccentricity();
+  v[18] = GetStoa();
+  v[19] = GetEccentricityColl();
+  v[20] = GetEccentricityCom();
+  v[21] = GetEccentricityPart();
+  v[22] = GetEccentricityPartColl();
+  v[23] = GetEccentricityPartCom();
+  if (fDoPartProd)
+  {
+    v[24] = GetdNdEta();
+    v[25] = GetdNdEta();
+    v[26] = v[24]+v[25];
+  }
+  else
+  {
+    v[24] = 0;
+    v[25] = 0;
+    v[26] = 0;
+  }
+  v[27]=fXSect;
+
+  Float_t mytAA=-999;
+  if (GetNcoll()>0) mytAA=GetNcoll()/fXSect;
+  v[28]=mytAA;
+  //_____________epsilon2,3,4,4_______
+  v[29] = GetEpsilon2Part();
+  v[30] = GetEpsilon3Part();
+  v[31] = GetEpsilon4Part();
+  v[32] = GetEpsilon5Part();
+  v[33] = GetEpsilon2Coll();
+  v[34] = GetEpsilon3Coll();
+  v[35] = GetEpsilon4Coll();
+  v[36] = GetEpsilon5Coll();
+  v[37] = GetEpsilon2Com();
+  v[38] = GetEpsilon3Com();
+  v[39] = GetEpsilon4Com();
+  v[40] = GetEpsilon5Com();
+  v[41] = GetPsi2();
+  v[42] = GetPsi3();
+  v[43] = GetPsi4();
+  v[44] = GetPsi5();
+  v[45] = fBNN;
+  v[46] = fXSect;
+  v[47] = fNcollw;
+}
+
 //______________________________________________________________________________
 void AliGlauberMC::Run(Int_t nevents)
 {
   //example run
+  //events are generated in chunks of kChunkEvents, each with its own random
+  //stream; with several threads a round of chunks is generated in parallel
+  //and the rows are filled into the ntuple in the chunk order
+  const Int_t kNVars = 48;
+  const Int_t kChunkEvents = 10000;
   cout << "Generating " << nevents << " events..." << endl;
-  TString name(Form("nt_%s_%s",fANucleus.GetName(),fBNucleus.GetName()));
-  TString title(Form("%s + %s (x-sect = %d mb)",fANucleus.GetName(),fBNucleus.GetName(),(Int_t) fXSect));
   if (fnt == 0)
   {
-    fnt = new TNtuple(name,title,
-                      "Npart:Ncoll:B:MeanX:MeanY:MeanX2:MeanY2:MeanXY:VarX:VarY:VarXY:MeanXSystem:MeanYSystem:MeanXA:MeanYA:MeanXB:MeanYB:VarE:Stoa:VarEColl:VarECom:VarEPart:VarEPartColl:VarEPartCom:dNdEta:dNdEtaGBW:dNdEtaTwoNBD:xsect:tAA:Epsl2:Epsl3:Epsl4:Epsl5:E2Coll:E3Coll:E4Coll:E5Coll:E2Com:E3Com:E4Com:E5Com:Psi2:Psi3:Psi4:Psi5:BNN:signn:Ncollw");
+    fnt = MakeNtuple();
     fnt->SetDirectory(0);
   }
-  Int_t q = 0;
-  Int_t u = 0;
-  for (Int_t i = 0; i<nevents; i++)
+  InitSampling();
+
+  Int_t nThreads = TMath::Max(fNThreads,1);
+#ifdef R__USE_IMT
+  ROOT::TThreadExecutor *executor = 0;
+  if (nThreads>1) {
+    ROOT::EnableThreadSafety();
+    executor = new ROOT::TThreadExecutor(nThreads);
+  }
+#else
+  if (nThreads>1) cout << "ROOT was built without implicit multi-threading, events are generated serially" << endl;
+  nThreads = 1;
+#endif
+  UInt_t seed = fSeed ? fSeed : gRandom->Integer(kMaxUInt);
+
+  // thread 0 generates with this object, the other threads with copies
+  std::vector<AliGlauberMC*> workers(nThreads,this);
+  std::vector<TRandom3*> streams(nThreads);
+  for (Int_t t = 0; t<nThreads; t++)
   {
-
-    if(!NextEvent())
-    {
-      u++;
-      continue;
+    if (t>0) {
+      workers[t] = new AliGlauberMC(*this);
+      workers[t]->fEvents = 0;
+      workers[t]->fTotalEvents = 0;
+      workers[t]->fMaxNpartFound = 0;
     }
+    streams[t] = new TRandom3(1);
+  }
+  TRandom *oldRandom = fRandom;
 
-    q++;
-    Float_t v[48];
-    v[0]  = GetNpart();
-    v[1]  = GetNcoll();
-    v[2]  = fBMC;
-    v[3]  = fMeanXParts;
-    v[4]  = fMeanYParts;
-    v[5]  = fMeanX2Parts;
-    v[6]  = fMeanY2Parts;
-    v[7]  = fMeanXYParts;
-    v[8]  = fSx2Parts;
-    v[9]  = fSy2Parts;
-    v[10] = fSxyParts;
-    v[11] = fMeanXSystem;
-    v[12] = fMeanYSystem;
-    v[13] = fMeanXA;
-    v[14] = fMeanYA;
-    v[15] = fMeanXB;
-    v[16] = fMeanYB;
-    v[17] = GetEccentricity();
-    v[18] = GetStoa();
-    v[19] = GetEccentricityColl();
-    v[20] = GetEccentricityCom();
-    v[21] = GetEccentricityPart();
-    v[22] = GetEccentricityPartColl();
-    v[23] = GetEccentricityPartCom();
-    if (fDoPartProd)
+  Int_t nChunks = (nevents+kChunkEvents-1)/kChunkEvents;
+  Int_t nRoundChunks = (nThreads>1) ? 2*nThreads : 1;
+  std::vector<std::vector<Float_t> > rows(nRoundChunks);
+  std::vector<Int_t> discarded(nRoundChunks);
+  Int_t q = 0;
+  Int_t u = 0;
+  for (Int_t first = 0; first<nChunks; first += nRoundChunks)
+  {
+    Int_t nRound = TMath::Min(nRoundChunks,nChunks-first);
+    // thread t generates the chunks t, t+nThreads, ... of the round
+    auto generate = [&](Int_t t)
     {
-      v[24] = GetdNdEta();
-      v[25] = GetdNdEta();
-      v[26] = v[24]+v[25];
-    }
+      AliGlauberMC *mc = workers[t];
+      mc->SetRandomGenerator(streams[t]);
+      for (Int_t ic = t; ic<nRound; ic += nThreads)
+      {
+        Int_t chunk = first+ic;
+        // seed of the chunk, independent of the number of threads
+        ULong64_t z = ((ULong64_t)seed<<32) + chunk + 0x9e3779b97f4a7c15ULL;
+        z = (z^(z>>30))*0xbf58476d1ce4e5b9ULL;
+        z = (z^(z>>27))*0x94d049bb133111ebULL;
+        z ^= z>>31;
+        UInt_t chunkSeed = (UInt_t)(z&0xffffffff);
+        streams[t]->SetSeed(chunkSeed ? chunkSeed : 1);
+        Int_t nev = TMath::Min(kChunkEvents,nevents-chunk*kChunkEvents);
+        rows[ic].clear();
+        discarded[ic] = 0;
+        Float_t v[kNVars];
+        for (Int_t i = 0; i<nev; i++)
+        {
+          if (!mc->NextEvent())
+          {
+            discarded[ic]++;
+            continue;
+          }
+          mc->GetNtupleRow(v);
+          rows[ic].insert(rows[ic].end(),v,v+kNVars);
+        }
+      }
+    };
+#ifdef R__USE_IMT
+    if (executor && nRound>1)
+      executor->Foreach(generate,ROOT::TSeqI(nThreads));
     else
+#endif
     {
-      v[24] = 0;
-      v[25] = 0;
-      v[26] = 0;
+      for (Int_t t = 0; t<nThreads; t++) generate(t);
     }
-    v[27]=fXSect;
-
-    Float_t mytAA=-999;
-    if (GetNcoll()>0) mytAA=GetNcoll()/fXSect;
-    v[28]=mytAA;
-    //_____________epsilon2,3,4,4_______
-    v[29] = GetEpsilon2Part();
-    v[30] = GetEpsilon3Part();
-    v[31] = GetEpsilon4Part();
-    v[32] = GetEpsilon5Part();
-    v[33] = GetEpsilon2Coll();
-    v[34] = GetEpsilon3Coll();
-    v[35] = GetEpsilon4Coll();
-    v[36] = GetEpsilon5Coll();
-    v[37] = GetEpsilon2Com();
-    v[38] = GetEpsilon3Com();
-    v[39] = GetEpsilon4Com();
-    v[40] = GetEpsilon5Com();
-    v[41] = GetPsi2();
-    v[42] = GetPsi3();
-    v[43] = GetPsi4();
-    v[44] = GetPsi5();
-    v[45] = fBNN;
-    v[46] = fXSect;
-    v[47] = fNcollw;
 
     //always at the end
-    fnt->Fill(v);
+    for (Int_t ic = 0; ic<nRound; ic++)
+    {
+      Int_t nrows = rows[ic].size()/kNVars;
+      for (Int_t i = 0; i<nrows; i++) fnt->Fill(&rows[ic][i*kNVars]);
+      q += nrows;
+      u += discarded[ic];
+    }
+    std::cout << "Generating Event # " << TMath::Min((first+nRound)*kChunkEvents,nevents) << "... \r" << flush;
+  }
 
-    if ((i%100)==0) std::cout << "Generating Event # " << i << "... \r" << flush;
+#ifdef R__USE_IMT
+  delete executor;
+#endif
+  SetRandomGenerator(oldRandom);
+  for (Int_t t = 0; t<nThreads; t++)
+  {
+    if (t>0) {
+      fEvents += workers[t]->fEvents;
+      fTotalEvents += workers[t]->fTotalEvents;
+      fMaxNpartFound = TMath::Max(fMaxNpartFound,workers[t]->fMaxNpartFound);
+      delete workers[t];
+    }
+    delete streams[t];
   }
   std::cout << "Generating Event # " << nevents << "... \r" << endl << "Done! Succesfull events:  " << q << "  discarded events:  " << u <<"."<< endl;
 }
@@ -1785,17 +1984,23 @@ void AliGlauberMC::RunAndSaveNtuple( Int_t n,
                                      Double_t mind,
                                      Double_t r,
                                      Double_t a,
-                                     const char *fname)
+                                     const char *fname,
+                                     Int_t nthreads)
 {
   //example run
+  //the ntuple is created in the output file, so the merged chunks are
+  //written out while the events are generated
   AliGlauberMC mcg(sysA,sysB,signn);
   mcg.SetMinDistance(mind);
   mcg.Setr(r);
   mcg.Seta(a);
+  mcg.SetNumberOfThreads(nthreads);
+  TFile out(fname,"recreate",fname,9);
+  mcg.fnt = mcg.MakeNtuple();
   mcg.Run(n);
   TNtuple  *nt=mcg.GetNtuple();
-  TFile out(fname,"recreate",fname,9);
-  if(nt) nt->Write();
+  if(nt) nt->Write("",TObject::kOverwrite);
+  mcg.fnt = 0; // owned by the file
   printf("total cross section with a nucleon-nucleon cross section \t%f is \t%f",signn,mcg.GetTotXSect());
   out.Close();
 }
@@ -16,9 +16,11 @@
 #include "AliGlauberNucleus.h"
 #include <Riostream.h>
 #include <TNamed.h>
+#include <vector>
 
 class TObjArray;
 class TNtuple;
+class TRandom;
 
 using std::cout;
 using std::endl;
@@ -39,6 +41,7 @@ public:
    void         Draw(Option_t* option);
 
    void         Run(Int_t nevents);
+   void         InitSampling();
    Bool_t       NextEvent(Double_t bgen=-1);
    Bool_t       CalcEvent(Double_t bgen);
 
@@ -100,6 +103,12 @@ public:
    void   Seta(Double_t a)  {fANucleus.SetA(a); fBNucleus.SetA(a);}
    void   SetDoFluc(Double_t omega, Double_t sig0, Double_t lam, Bool_t on=kTRUE) 
             {fDoFluc=on;fOmega=omega;fSig0=sig0;fLambda=lam;}
+   // Run generates the events in chunks with independent random streams seeded
+   // from seed (0: taken from gRandom), the ntuple does not depend on the number of threads
+   void   SetNumberOfThreads(Int_t n) {fNThreads = n;}
+   void   SetSeed(UInt_t seed)        {fSeed = seed;}
+   void   SetRandomGenerator(TRandom *rnd) {fRandom=rnd; fANucleus.SetRandomGenerator(rnd); fBNucleus.SetRandomGenerator(rnd);}
+   TRandom *GetRandomGenerator() const;
    static void       PrintVersion()         {cout << "AliGlauberMC " << Version() << endl;}
    static const char *Version()             {return "v1.2";}
    static void       RunAndSaveNtuple( Int_t n,
@@ -109,7 +118,8 @@ public:
                                        Double_t mind=0.4,
 				       Double_t r=6.62,
 				       Double_t a=0.546,
-                                       const char *fname="glau_pbpb_ntuple.root");
+                                       const char *fname="glau_pbpb_ntuple.root",
+                                       Int_t nthreads=1);
    void RunAndSaveNucleons( Int_t n,
                             const Option_t *sysA,
                             const Option_t *sysB,
@@ -251,9 +261,18 @@ private:
    Double_t     fSig0;           //regularization parameter 
    Double_t     fLambda;         //lambda parameter
    TF1         *fSigFluc;        //!parameterization for fluctuating sigNN
+   Int_t        fNThreads;       //number of threads used by Run
+   UInt_t       fSeed;           //seed of the random streams of Run (0: from gRandom)
+   TRandom     *fRandom;         //!random generator, gRandom if not set
+   std::vector<Double_t> fSigFlucInvCDF; //!inverse cumulative distribution of fSigFluc
+   std::vector<Int_t>    fGridOffset;    //!first nucleon of A in each cell of the collision grid
+   std::vector<Int_t>    fGridNucleon;   //!nucleons of A sorted by cell
    Bool_t       CalcResults(Double_t bgen);
+   void         CollideNucleons();
+   void         GetNtupleRow(Float_t *v) const;
+   TNtuple     *MakeNtuple() const;
 
-   ClassDef(AliGlauberMC,4)
+   ClassDef(AliGlauberMC,5)
 };
 
 #endif
@@ -42,6 +42,7 @@ public:
    Bool_t     IsWounded()    const {return fNColl;}
    void       Reset()              {fNColl=0;}
    void       SetInNucleusA()      {fInNucleusA=1;}
+   void       SetNColl(Int_t n)    {fNColl=n;}
    void       SetInNucleusB()      {fInNucleusA=0;}
    void       SetSigNN(Double_t s) {fSigNN=s;}
    void       SetXYZ(Double_t x, Double_t y, Double_t z) {fX=x; fY=y; fZ=z;}
@@ -49,7 +49,14 @@ AliGlauberNucleus::AliGlauberNucleus(Option_t* iname, Int_t iN, Double_t iR, Dou
   fF(0),
   fTrials(0),
   fFunction(ifunc),
-  fNucleons(NULL)
+  fNucleons(NULL),
+  fPosX(),
+  fPosY(),
+  fPosZ(),
+  fSigNN(),
+  fNColl(),
+  fInvCDF(),
+  fRandom(NULL)
 {
    if (fN==0) {
       cout << "Setting up nucleus " << iname << endl;
@@ -76,12 +83,23 @@ AliGlauberNucleus::AliGlauberNucleus(const AliGlauberNucleus& in):
   fMinDist(in.fMinDist),
   fF(in.fF),
   fTrials(in.fTrials),
-  fFunction(in.fFunction),
-  fNucleons(NULL)
+  fFunction(NULL),
+  fNucleons(NULL),
+  fPosX(in.fPosX),
+  fPosY(in.fPosY),
+  fPosZ(in.fPosZ),
+  fSigNN(in.fSigNN),
+  fNColl(in.fNColl),
+  fInvCDF(in.fInvCDF),
+  fRandom(in.fRandom)
 {
   //copy ctor
-  if (in.fNucleons)
+  if (in.fFunction)
+    fFunction=static_cast<TF1*>((in.fFunction)->Clone());
+  if (in.fNucleons) {
     fNucleons=static_cast<TObjArray*>((in.fNucleons)->Clone());
+    fNucleons->SetOwner();
+  }
 }
 
 //______________________________________________________________________________
@@ -96,10 +114,23 @@ AliGlauberNucleus& AliGlauberNucleus::operator=(const AliGlauberNucleus& in)
   fMinDist=in.fMinDist;
   fF=in.fF;
   fTrials=in.fTrials;
-  fFunction=in.fFunction;
+  delete fFunction;
+  fFunction=0;
+  if (in.fFunction)
+    fFunction=static_cast<TF1*>((in.fFunction)->Clone());
   delete fNucleons;
-  fNucleons=static_cast<TObjArray*>((in.fNucleons)->Clone());
-  fNucleons->SetOwner();
+  fNucleons=0;
+  if (in.fNucleons) {
+    fNucleons=static_cast<TObjArray*>((in.fNucleons)->Clone());
+    fNucleons->SetOwner();
+  }
+  fPosX=in.fPosX;
+  fPosY=in.fPosY;
+  fPosZ=in.fPosZ;
+  fSigNN=in.fSigNN;
+  fNColl=in.fNColl;
+  fInvCDF=in.fInvCDF;
+  fRandom=in.fRandom;
   return *this;
 }
 
@@ -177,6 +208,7 @@ void AliGlauberNucleus::Lookup(Option_t* name)
 void AliGlauberNucleus::SetR(Double_t ir)
 {
    fR = ir;
+   fInvCDF.clear();
    switch (fF)
    {
       case 0: // Proton
@@ -195,6 +227,7 @@ void AliGlauberNucleus::SetR(Double_t ir)
 void AliGlauberNucleus::SetA(Double_t ia)
 {
    fA = ia;
+   fInvCDF.clear();
    switch (fF)
    {
       case 0: // Proton
@@ -212,6 +245,7 @@ void AliGlauberNucleus::SetA(Double_t ia)
 void AliGlauberNucleus::SetW(Double_t iw)
 {
    fW = iw;
+   fInvCDF.clear();
    switch (fF)
    {
       case 0: // Proton
@@ -226,8 +260,74 @@ void AliGlauberNucleus::SetW(Double_t iw)
 }
 
 //______________________________________________________________________________
-void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
+TRandom *AliGlauberNucleus::GetRandomGenerator() const
+{
+   return fRandom ? fRandom : gRandom;
+}
+
+//______________________________________________________________________________
+void AliGlauberNucleus::MakeInverseCDF(TF1 *func, std::vector<Double_t> &table)
+{
+   // tabulate r at kNQuantiles+1 equidistant values of the cumulative
+   // distribution of func, integrated with the trapezoidal rule on a fine grid
+   const Int_t kNQuantiles = 4096;
+   const Int_t kNSteps     = 16*kNQuantiles;
+   table.clear();
+   if (!func) return;
+   Double_t xmin = func->GetXmin();
+   Double_t xmax = func->GetXmax();
+   Double_t dx = (xmax-xmin)/kNSteps;
+   std::vector<Double_t> cdf(kNSteps+1,0.);
+   Double_t flast = TMath::Max(func->Eval(xmin),0.);
+   for (Int_t i = 1; i<=kNSteps; i++) {
+      Double_t f = TMath::Max(func->Eval(xmin+i*dx),0.);
+      cdf[i] = cdf[i-1] + 0.5*(f+flast)*dx;
+      flast = f;
+   }
+   if (cdf[kNSteps]<=0) {
+      cerr << "Function " << func->GetName() << " cannot be sampled" << endl;
+      return;
+   }
+   table.resize(kNQuantiles+1);
+   table[0] = xmin;
+   Int_t j = 0;
+   for (Int_t k = 1; k<kNQuantiles; k++) {
+      Double_t target = cdf[kNSteps]*k/kNQuantiles;
+      while (cdf[j+1]<target) j++;
+      Double_t frac = (target-cdf[j])/(cdf[j+1]-cdf[j]);
+      table[k] = xmin + (j+frac)*dx;
+   }
+   // end of the support
+   j = kNSteps;
+   while (j>0 && cdf[j-1]>=cdf[kNSteps]) j--;
+   table[kNQuantiles] = xmin + j*dx;
+}
+
+//______________________________________________________________________________
+Double_t AliGlauberNucleus::SampleInverseCDF(const std::vector<Double_t> &table, TRandom *rnd)
+{
+   // random number distributed as the tabulated function, linear
+   // interpolation between the quantiles
+   Int_t n = table.size()-1;
+   Double_t u = rnd->Rndm()*n;
+   Int_t k = (Int_t)u;
+   if (k>=n) k = n-1;
+   return table[k] + (u-k)*(table[k+1]-table[k]);
+}
+
+//______________________________________________________________________________
+void AliGlauberNucleus::InitSampling()
+{
+   // prepare the lookup table of rho(r); needs to be called before the
+   // nucleus is used from several threads
+   if (fInvCDF.empty())
+      MakeInverseCDF(fFunction,fInvCDF);
+}
+
+//______________________________________________________________________________
+void AliGlauberNucleus::UpdateNucleons()
 {
+   // copy positions, cross sections and collisions to the nucleon objects
    if (fNucleons==0) {
       fNucleons=new TObjArray(fN);
       fNucleons->SetOwner();
@@ -236,6 +336,24 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
 	 fNucleons->Add(nucleon); 
       }
    } 
+   for (Int_t i = 0; i<fN; i++) {
+      AliGlauberNucleon *nucleon=(AliGlauberNucleon*)(fNucleons->UncheckedAt(i));
+      nucleon->SetXYZ(fPosX[i],fPosY[i],fPosZ[i]);
+      nucleon->SetSigNN(fSigNN[i]);
+      nucleon->SetNColl(fNColl[i]);
+   }
+}
+
+//______________________________________________________________________________
+void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
+{
+   InitSampling();
+   TRandom *rnd = GetRandomGenerator();
+   fPosX.resize(fN);
+   fPosY.resize(fN);
+   fPosZ.resize(fN);
+   fSigNN.assign(fN,0.);
+   fNColl.assign(fN,0);
    
    fTrials = 0;
 
@@ -246,50 +364,43 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
    Bool_t hulthen = (TString(GetName())=="dh");
    if (fN==2 && hulthen) { //special treatmeant for Hulten
 
-      Double_t r = fFunction->GetRandom()/2;
-      Double_t phi = gRandom->Rndm() * 2 * TMath::Pi() ;
-      Double_t ctheta = 2*gRandom->Rndm() - 1 ;
+      Double_t r = SampleInverseCDF(fInvCDF,rnd)/2;
+      Double_t phi = rnd->Rndm() * 2 * TMath::Pi() ;
+      Double_t ctheta = 2*rnd->Rndm() - 1 ;
       Double_t stheta = sqrt(1-ctheta*ctheta);
      
-      AliGlauberNucleon *nucleon1=(AliGlauberNucleon*)(fNucleons->UncheckedAt(0));
-      AliGlauberNucleon *nucleon2=(AliGlauberNucleon*)(fNucleons->UncheckedAt(1));
-      nucleon1->Reset();
-      nucleon1->SetXYZ(r * stheta * cos(phi) + xshift,
-		       r * stheta * sin(phi),
-		       r * ctheta);
-      nucleon2->Reset();
-      nucleon2->SetXYZ(-nucleon1->GetX() + 2*xshift,
-		       -nucleon1->GetY(),
-		       -nucleon1->GetZ());
+      fPosX[0] = r * stheta * cos(phi) + xshift;
+      fPosY[0] = r * stheta * sin(phi);
+      fPosZ[0] = r * ctheta;
+      fPosX[1] = -fPosX[0] + 2*xshift;
+      fPosY[1] = -fPosY[0];
+      fPosZ[1] = -fPosZ[0];
       fTrials = 1;
+      UpdateNucleons();
       return;
    }
 
+   Double_t minDist2 = fMinDist*fMinDist;
    for (Int_t i = 0; i<fN; i++) {
-      AliGlauberNucleon *nucleon=(AliGlauberNucleon*)(fNucleons->UncheckedAt(i));
-      nucleon->Reset();
       while(1) {
          fTrials++;
-         Double_t r = fFunction->GetRandom();
-         Double_t phi = gRandom->Rndm() * 2 * TMath::Pi() ;
-         Double_t ctheta = 2*gRandom->Rndm() - 1 ;
+         Double_t r = SampleInverseCDF(fInvCDF,rnd);
+         Double_t phi = rnd->Rndm() * 2 * TMath::Pi() ;
+         Double_t ctheta = 2*rnd->Rndm() - 1 ;
          Double_t stheta = TMath::Sqrt(1-ctheta*ctheta);
-         Double_t x = r * stheta * cos(phi) + xshift;
-         Double_t y = r * stheta * sin(phi);      
-         Double_t z = r * ctheta;      
-         nucleon->SetXYZ(x,y,z);
+         fPosX[i] = r * stheta * cos(phi) + xshift;
+         fPosY[i] = r * stheta * sin(phi);      
+         fPosZ[i] = r * ctheta;      
          if(fMinDist<0) break;
+         Float_t x = fPosX[i];
+         Float_t y = fPosY[i];
+         Float_t z = fPosZ[i];
          Bool_t test=1;
          for (Int_t j = 0; j<i; j++) {
-            AliGlauberNucleon *other=(AliGlauberNucleon*)fNucleons->UncheckedAt(j);
-            Double_t xo=other->GetX();
-            Double_t yo=other->GetY();
-            Double_t zo=other->GetZ();
-            Double_t dist = TMath::Sqrt((x-xo)*(x-xo)+
-                                       (y-yo)*(y-yo)+
-                                       (z-zo)*(z-zo));
-	       
-            if(dist<fMinDist) {
+            Double_t dx = x-fPosX[j];
+            Double_t dy = y-fPosY[j];
+            Double_t dz = z-fPosZ[j];
+            if(dx*dx+dy*dy+dz*dz<minDist2) {
                test=0;
                break;
             }
@@ -297,9 +408,9 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
          if (test) break; //found nucleuon outside of mindist
       }
            
-      sumx += nucleon->GetX();
-      sumy += nucleon->GetY();
-      sumz += nucleon->GetZ();
+      sumx += fPosX[i];
+      sumy += fPosY[i];
+      sumz += fPosZ[i];
    }
       
    if(1) { // set the centre-of-mass to be at zero (+xshift)
@@ -307,11 +418,10 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
       sumy = sumy/fN;  
       sumz = sumz/fN;  
       for (Int_t i = 0; i<fN; i++) {
-         AliGlauberNucleon *nucleon=(AliGlauberNucleon*)(fNucleons->UncheckedAt(i));
-         nucleon->SetXYZ(nucleon->GetX()-sumx-xshift,
-                         nucleon->GetY()-sumy,
-                         nucleon->GetZ()-sumz);
+         fPosX[i] = fPosX[i]-sumx-xshift;
+         fPosY[i] = fPosY[i]-sumy;
+         fPosZ[i] = fPosZ[i]-sumz;
       }
    }
+   UpdateNucleons();
 }
-
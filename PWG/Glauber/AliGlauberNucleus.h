@@ -16,8 +16,10 @@
 
 //class TNamed;
 #include <TNamed.h>
+#include <vector>
 class TObjArray;
 class TF1;
+class TRandom;
 
 class AliGlauberNucleus : public TNamed {
 private:
@@ -30,6 +32,13 @@ private:
    Int_t      fTrials;     //Store trials needed to complete nucleus
    TF1*       fFunction;   //Probability density function rho(r)
    TObjArray* fNucleons;   //Array of nucleons
+   std::vector<Float_t>  fPosX;    //!x of the nucleons
+   std::vector<Float_t>  fPosY;    //!y of the nucleons
+   std::vector<Float_t>  fPosZ;    //!z of the nucleons
+   std::vector<Double_t> fSigNN;   //!cross section of the nucleons
+   std::vector<Int_t>    fNColl;   //!number of binary collisions of the nucleons
+   std::vector<Double_t> fInvCDF;  //!inverse cumulative distribution of rho(r)
+   TRandom*   fRandom;     //!random generator, gRandom if not set
 
    void       Lookup(Option_t* name);
 
@@ -53,6 +62,22 @@ public:
    void       SetW(Double_t iw);
    void       SetMinDist(Double_t min) {fMinDist=min;}
    void       ThrowNucleons(Double_t xshift=0.);
+   void       InitSampling();
+   void       UpdateNucleons();
+   void       SetRandomGenerator(TRandom *rnd) {fRandom=rnd;}
+   TRandom   *GetRandomGenerator() const;
+
+   // flat nucleon arrays, filled by ThrowNucleons; the nucleon objects
+   // are updated from them by UpdateNucleons
+   const std::vector<Float_t> &GetPosX() const {return fPosX;}
+   const std::vector<Float_t> &GetPosY() const {return fPosY;}
+   const std::vector<Float_t> &GetPosZ() const {return fPosZ;}
+   std::vector<Double_t>      &GetSigNN()      {return fSigNN;}
+   std::vector<Int_t>         &GetNColl()      {return fNColl;}
+
+   // sampling of a TF1 from a table of its inverse cumulative distribution
+   static void     MakeInverseCDF(TF1 *func, std::vector<Double_t> &table);
+   static Double_t SampleInverseCDF(const std::vector<Double_t> &table, TRandom *rnd);
 
    ClassDef(AliGlauberNucleus,1)
 };
@@ -342,11 +342,6 @@ void AliJCorrelations::FillAzimuthHistos(fillType fTyp, int CentBin, int ZBin, A
   // =====================  Fill Histograms  ===========================
   // ===================================================================
   
-  bool fill2DBackgroundQualityControlHistograms = false;  // Choose whether to fill the DeltaPhi DeltaEta histograms for jT background
-  
-  // If quality control level is high enough, fill 2D quality control histograms
-  if(fcard->Get("QualityControlLevel")>1) fill2DBackgroundQualityControlHistograms = true;
-  
   //if(fhistos->fhCosThetaStar.Dimension()>0) FillPairPtAndCosThetaStarHistograms(fTyp, ftk1, ftk2);  // Fill the pair pT and cos(theta*) histograms TODO: Does not work! Needs debugging
   if(fhistos->fhxEF.Dimension()>0) FillXeHistograms(fTyp);  // Fill the xE and xLong histograms
   FillDeltaEtaHistograms(fTyp, ZBin);  // Fill all the delta eta histograms
@@ -424,19 +419,19 @@ void AliJCorrelations::FillXeHistograms(fillType fTyp)
   double xe = -fpta*cos(fPhiTrigger-fPhiAssoc)/fptt;
   
   if( fTyp == kReal ) {
-    fhistos->fhxEPtBin[0][fpttBin][fptaBin]->Fill(fXlong, fGeometricAcceptanceCorrection * fTrackPairEfficiency);
+    fhistos->fhxEPtBin.At( fhistos->fhxEPtBin.Handle(0, fpttBin, fptaBin) )->Fill(fXlong, fGeometricAcceptanceCorrection * fTrackPairEfficiency);
     if( fNearSide ) {
-      fhistos->fhxEPtBin[1][fpttBin][fptaBin]->Fill(fXlong, fGeometricAcceptanceCorrection * fTrackPairEfficiency);
+      fhistos->fhxEPtBin.At( fhistos->fhxEPtBin.Handle(1, fpttBin, fptaBin) )->Fill(fXlong, fGeometricAcceptanceCorrection * fTrackPairEfficiency);
     } else {
-      fhistos->fhxEPtBin[2][fpttBin][fptaBin]->Fill(fXlong, fGeometricAcceptanceCorrection * fTrackPairEfficiency);
+      fhistos->fhxEPtBin.At( fhistos->fhxEPtBin.Handle(2, fpttBin, fptaBin) )->Fill(fXlong, fGeometricAcceptanceCorrection * fTrackPairEfficiency);
     }
   }
   
   if(fNearSide) {
-    fhistos->fhxEN [fTyp][fpttBin]->Fill(-xe, fGeometricAcceptanceCorrection * fTrackPairEfficiency);
+    fhistos->fhxEN.At( fhistos->fhxEN.Handle(fTyp, fpttBin) )->Fill(-xe, fGeometricAcceptanceCorrection * fTrackPairEfficiency);
   } else {
-    fhistos->fhxEF [fTyp][fpttBin]->Fill(xe, fGeometricAcceptanceCorrection * fTrackPairEfficiency);
-    if(fIsIsolatedTrigger) fhistos->fhxEFIsolTrigg[fTyp][fpttBin]->Fill(xe, fGeometricAcceptanceCorrection * fTrackPairEfficiency);
+    fhistos->fhxEF.At( fhistos->fhxEF.Handle(fTyp, fpttBin) )->Fill(xe, fGeometricAcceptanceCorrection * fTrackPairEfficiency);
+    if(fIsIsolatedTrigger) fhistos->fhxEFIsolTrigg.At( fhistos->fhxEFIsolTrigg.Handle(fTyp, fpttBin) )->Fill(xe, fGeometricAcceptanceCorrection * fTrackPairEfficiency);
   }
 }
 
@@ -446,23 +441,23 @@ void AliJCorrelations::FillDeltaEtaHistograms(fillType fTyp, int ZBin)
   
   if( fNearSide ){ //one could check the phiGapBin, but in the pi/2 <1.6 and thus phiGap is always>-1
     if( fTyp == 0 ) {
-      fhistos->fhDEtaNear[fCentralityBin][ZBin][fPhiGapBinNear][fpttBin][fptaBin]->Fill( fDeltaEta , fGeometricAcceptanceCorrection * fTrackPairEfficiency );
+      fhistos->fhDEtaNear.At( fhistos->fhDEtaNear.Handle(fCentralityBin, ZBin, fPhiGapBinNear, fpttBin, fptaBin) )->Fill( fDeltaEta , fGeometricAcceptanceCorrection * fTrackPairEfficiency );
     } else {
-      fhistos->fhDEtaNearM[fCentralityBin][ZBin][fPhiGapBinNear][fpttBin][fptaBin]->Fill( fDeltaEta , fGeometricAcceptanceCorrection * fTrackPairEfficiency );
-      fhistos->fhDetaNearMixAcceptance[fCentralityBin][fpttBin][fptaBin]->Fill( fDeltaEta, fTrackPairEfficiency);
+      fhistos->fhDEtaNearM.At( fhistos->fhDEtaNearM.Handle(fCentralityBin, ZBin, fPhiGapBinNear, fpttBin, fptaBin) )->Fill( fDeltaEta , fGeometricAcceptanceCorrection * fTrackPairEfficiency );
+      fhistos->fhDetaNearMixAcceptance.At( fhistos->fhDetaNearMixAcceptance.Handle(fCentralityBin, fpttBin, fptaBin) )->Fill( fDeltaEta, fTrackPairEfficiency);
     }
   } else {
-    if(fPhiGapBinAway<=3) fhistos->fhDEtaFar[fTyp][fCentralityBin][fpttBin]->Fill( fDeltaEta, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
+    if(fPhiGapBinAway<=3) fhistos->fhDEtaFar.At( fhistos->fhDEtaFar.Handle(fTyp, fCentralityBin, fpttBin) )->Fill( fDeltaEta, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
   }
   
   // Different near side definition for xlong bins
   if( fNearSide3D ){
     if( fTyp == 0 ) {
-      if(fPhiGapBinNear>=0 && fXlongBin >= 0) fhistos->fhDEtaNearXEbin[fCentralityBin][ZBin][fPhiGapBinNear][fpttBin][fXlongBin]->Fill( fDeltaEta , fGeometricAcceptanceCorrection3D * fTrackPairEfficiency );
+      if(fPhiGapBinNear>=0 && fXlongBin >= 0) fhistos->fhDEtaNearXEbin.At( fhistos->fhDEtaNearXEbin.Handle(fCentralityBin, ZBin, fPhiGapBinNear, fpttBin, fXlongBin) )->Fill( fDeltaEta , fGeometricAcceptanceCorrection3D * fTrackPairEfficiency );
     } else {
       if(fPhiGapBinNear>=0 && fXlongBin >= 0){
-        fhistos->fhDEtaNearMXEbin[fCentralityBin][ZBin][fPhiGapBinNear][fpttBin][fXlongBin]->Fill( fDeltaEta , fGeometricAcceptanceCorrection3D * fTrackPairEfficiency );
-        fhistos->fhDeta3DNearMixAcceptance[fCentralityBin][fpttBin][fXlongBin]->Fill( fDeltaEta, fTrackPairEfficiency);
+        fhistos->fhDEtaNearMXEbin.At( fhistos->fhDEtaNearMXEbin.Handle(fCentralityBin, ZBin, fPhiGapBinNear, fpttBin, fXlongBin) )->Fill( fDeltaEta , fGeometricAcceptanceCorrection3D * fTrackPairEfficiency );
+        fhistos->fhDeta3DNearMixAcceptance.At( fhistos->fhDeta3DNearMixAcceptance.Handle(fCentralityBin, fpttBin, fXlongBin) )->Fill( fDeltaEta, fTrackPairEfficiency);
       }
     }
   }
@@ -475,10 +470,10 @@ void AliJCorrelations::FillDeltaPhiHistograms(fillType fTyp)
   // When hists are filled for thresholds they are not properly normalized and need to be subtracted
   // This induced improper errors - subtraction of not-independent entries
   
-  fhistos->fhDphiAssoc[fTyp][fCentralityBin][fEtaGapBin][fpttBin][fptaBin]->Fill( fDeltaPhi/kJPi , fGeometricAcceptanceCorrection * fTrackPairEfficiency);
-  if(fXlongBin>=0 && fNearSide3D) fhistos->fhDphiAssocXEbin[fTyp][fCentralityBin][fEtaGapBin][fpttBin][fXlongBin]->Fill( fDeltaPhi/kJPi , fGeometricAcceptanceCorrection3D * fTrackPairEfficiency);
+  fhistos->fhDphiAssoc.At( fhistos->fhDphiAssoc.Handle(fTyp, fCentralityBin, fEtaGapBin, fpttBin, fptaBin) )->Fill( fDeltaPhi/kJPi , fGeometricAcceptanceCorrection * fTrackPairEfficiency);
+  if(fXlongBin>=0 && fNearSide3D) fhistos->fhDphiAssocXEbin.At( fhistos->fhDphiAssocXEbin.Handle(fTyp, fCentralityBin, fEtaGapBin, fpttBin, fXlongBin) )->Fill( fDeltaPhi/kJPi , fGeometricAcceptanceCorrection3D * fTrackPairEfficiency);
   
-  if(fIsIsolatedTrigger) fhistos->fhDphiAssocIsolTrigg[fTyp][fCentralityBin][fpttBin][fptaBin]->Fill( fDeltaPhi/kJPi , fGeometricAcceptanceCorrection * fTrackPairEfficiency); //FK//
+  if(fIsIsolatedTrigger) fhistos->fhDphiAssocIsolTrigg.At( fhistos->fhDphiAssocIsolTrigg.Handle(fTyp, fCentralityBin, fpttBin, fptaBin) )->Fill( fDeltaPhi/kJPi , fGeometricAcceptanceCorrection * fTrackPairEfficiency); //FK//
 }
 
 void AliJCorrelations::FillDeltaEtaDeltaPhiHistograms(fillType fTyp, int zBin)
@@ -488,12 +483,12 @@ void AliJCorrelations::FillDeltaEtaDeltaPhiHistograms(fillType fTyp, int zBin)
   
   // Fill the histogram in pTa bins
   if(fNearSide){
-    fhistos->fhDphiDetaPta[fTyp][fCentralityBin][zBin][fpttBin][fptaBin]->Fill(fDeltaEta, fDeltaPhiPiPi, fTrackPairEfficiency);
+    fhistos->fhDphiDetaPta.At( fhistos->fhDphiDetaPta.Handle(fTyp, fCentralityBin, zBin, fpttBin, fptaBin) )->Fill(fDeltaEta, fDeltaPhiPiPi, fTrackPairEfficiency);
   }
   
   // Fill the histogram in xlong bins
   if(fNearSide3D && fXlongBin >= 0){
-    fhistos->fhDphiDetaXlong[fTyp][fCentralityBin][zBin][fpttBin][fXlongBin]->Fill(fDeltaEta, fDeltaPhiPiPi, fTrackPairEfficiency);
+    fhistos->fhDphiDetaXlong.At( fhistos->fhDphiDetaXlong.Handle(fTyp, fCentralityBin, zBin, fpttBin, fXlongBin) )->Fill(fDeltaEta, fDeltaPhiPiPi, fTrackPairEfficiency);
   }
   
 }
@@ -504,27 +499,27 @@ void AliJCorrelations::FillPtaHistograms(fillType fTyp)
   
   if ( fTyp == kReal ) {
     //must be here, not in main, to avoid counting triggers
-    fhistos->fhAssocPtBin[fCentralityBin][fpttBin][fptaBin]->Fill(fpta ); //I think It should not be weighted by Eff
+    fhistos->fhAssocPtBin.At( fhistos->fhAssocPtBin.Handle(fCentralityBin, fpttBin, fptaBin) )->Fill(fpta ); //I think It should not be weighted by Eff
     
     //++++++++++++++++++++++++++++++++++++++++++++++++++
     // in order to get mean pTa in the jet peak one has
     // to fill fhMeanPtAssoc in |DeltaEta|<0.4
     // +++++++++++++++++++++++++++++++++++++++++++++++++
     if(fEtaGapBin>=0 && fEtaGapBin<2){
-      fhistos->fhMeanPtAssoc[fCentralityBin][fpttBin][fptaBin]->Fill( fDeltaPhi/kJPi , fpta );
-      fhistos->fhMeanZtAssoc[fCentralityBin][fpttBin][fptaBin]->Fill( fDeltaPhi/kJPi , fpta/fptt);
+      fhistos->fhMeanPtAssoc.At( fhistos->fhMeanPtAssoc.Handle(fCentralityBin, fpttBin, fptaBin) )->Fill( fDeltaPhi/kJPi , fpta );
+      fhistos->fhMeanZtAssoc.At( fhistos->fhMeanZtAssoc.Handle(fCentralityBin, fpttBin, fptaBin) )->Fill( fDeltaPhi/kJPi , fpta/fptt);
     }
     
     //UE distribution
     if(fabs(fDeltaPhiPiPi/kJPi)>fDPhiUERegion[0] && fabs(fDeltaPhiPiPi/kJPi)<fDPhiUERegion[1]){
       for(int iEtaGap=0; iEtaGap<=fEtaGapBin; iEtaGap++)  //FK// UE Pta spectrum for different eta gaps
-        fhistos->fhPtAssocUE[fCentralityBin][iEtaGap][fpttBin]->Fill(fpta, fTrackPairEfficiency);
+        fhistos->fhPtAssocUE.At( fhistos->fhPtAssocUE.Handle(fCentralityBin, iEtaGap, fpttBin) )->Fill(fpta, fTrackPairEfficiency);
       if(fIsIsolatedTrigger){ //FK// trigger is isolated hadron
-        fhistos->fhPtAssocUEIsolTrigg[fpttBin]->Fill(fpta, fTrackPairEfficiency); //FK//
+        fhistos->fhPtAssocUEIsolTrigg.At( fhistos->fhPtAssocUEIsolTrigg.Handle(fpttBin) )->Fill(fpta, fTrackPairEfficiency); //FK//
       }
     }
-    if(fabs(fDeltaPhi/kJPi)<0.15) fhistos->fhPtAssocN[fpttBin]->Fill(fpta, fTrackPairEfficiency);
-    if(fabs(fDeltaPhi/kJPi-1)<0.15) fhistos->fhPtAssocF[fpttBin]->Fill(fpta, fTrackPairEfficiency);
+    if(fabs(fDeltaPhi/kJPi)<0.15) fhistos->fhPtAssocN.At( fhistos->fhPtAssocN.Handle(fpttBin) )->Fill(fpta, fTrackPairEfficiency);
+    if(fabs(fDeltaPhi/kJPi-1)<0.15) fhistos->fhPtAssocF.At( fhistos->fhPtAssocF.Handle(fpttBin) )->Fill(fpta, fTrackPairEfficiency);
     
     fnReal++;
   } else { // only mix
@@ -536,12 +531,18 @@ void AliJCorrelations::FillIAAAndMoonHistograms(fillType fTyp, int ZBin)
 {
   // This method fills the I_AA and moon histograms
   
-  if(fhistos->Is2DHistosEnabled()) fhistos->fhDphiAssoc2DIAA[fTyp][fCentralityBin][ZBin][fpttBin][fptaBin]->Fill( fDeltaEta, fDeltaPhi/kJPi, fTrackPairEfficiency);
+  if(fhistos->Is2DHistosEnabled()) fhistos->fhDphiAssoc2DIAA.At( fhistos->fhDphiAssoc2DIAA.Handle(fTyp, fCentralityBin, ZBin, fpttBin, fptaBin) )->Fill( fDeltaEta, fDeltaPhi/kJPi, fTrackPairEfficiency);
   
   if(fRGapBinNear>=0){
-    if(fRGapBinNear <= fRSignalBin) fhistos->fhDRNearPt[fTyp][fCentralityBin][ZBin][fRGapBinNear][fpttBin]->Fill( fpta, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
+    if(fRGapBinNear <= fRSignalBin) fhistos->fhDRNearPt.At( fhistos->fhDRNearPt.Handle(fTyp, fCentralityBin, ZBin, fRGapBinNear, fpttBin) )->Fill( fpta, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
     // - moon -
     if(fRGapBinNear>0){
+      // the moon bins of this pair are collected and filled in one batch
+      AliJTH1D &moon = fTyp == 0 ? fhistos->fhDRNearPtMoon : fhistos->fhDRNearPtMoonM;
+      int    nMoon = 0;
+      int    moonHandles[kMaxMoonBins];
+      double moonX[kMaxMoonBins];
+      double moonW[kMaxMoonBins];
       for( int irs = 0; irs <= fRSignalBin;irs++ ){
         if( fRGapBinNear < irs ) continue;
         if( fPhiGapBinNear > irs ) continue;
@@ -560,21 +561,27 @@ void AliJCorrelations::FillIAAAndMoonHistograms(fillType fTyp, int ZBin)
             // xxx
             // fhistos->hDRNearPtMoon[fTyp][fCentralityBin][ZBin][ir1][irs][fpttBin]->Fill( fpta, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
             
-            if( fTyp == 0 )
-              fhistos->fhDRNearPtMoon[fCentralityBin][ZBin][ir1][irs][fpttBin]->Fill( fpta, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
-            else
-              fhistos->fhDRNearPtMoonM[fCentralityBin][ZBin][ir1][irs][fpttBin]->Fill( fpta, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
-            if(fTyp == kReal && fhistos->Is2DHistosEnabled())       fhistos->fhDphiAssoc2D[ir1][irs]->Fill( fDeltaEta, fDeltaPhi/kJPi, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
+            moonHandles[nMoon] = moon.Handle(fCentralityBin, ZBin, ir1, irs, fpttBin);
+            moonX[nMoon] = fpta;
+            moonW[nMoon] = fGeometricAcceptanceCorrection * fTrackPairEfficiency;
+            nMoon++;
+            if(fTyp == kReal && fhistos->Is2DHistosEnabled())       fhistos->fhDphiAssoc2D.At( fhistos->fhDphiAssoc2D.Handle(ir1, irs) )->Fill( fDeltaEta, fDeltaPhi/kJPi, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
           }
         }
       }
+      moon.FillN( nMoon, moonHandles, moonX, moonW );
     }
   }
   
   if(fRGapBinAway>=0){
-    if(fRGapBinAway <= fRSignalBin) fhistos->fhDRFarPt[fTyp][fCentralityBin][ZBin][fRGapBinAway][fpttBin]->Fill( fpta, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
+    if(fRGapBinAway <= fRSignalBin) fhistos->fhDRFarPt.At( fhistos->fhDRFarPt.Handle(fTyp, fCentralityBin, ZBin, fRGapBinAway, fpttBin) )->Fill( fpta, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
     // - moon -
     if(fRGapBinAway>0){
+      AliJTH1D &moon = fTyp == 0 ? fhistos->fhDRFarPtMoon : fhistos->fhDRFarPtMoonM;
+      int    nMoon = 0;
+      int    moonHandles[kMaxMoonBins];
+      double moonX[kMaxMoonBins];
+      double moonW[kMaxMoonBins];
       for( int irs = 0; irs <= fRSignalBin;irs++ ){
         if( fRGapBinAway < irs ) continue;
         if( fPhiGapBinAway > irs ) continue;
@@ -592,15 +599,16 @@ void AliJCorrelations::FillIAAAndMoonHistograms(fillType fTyp, int ZBin)
             //if( eta > dEtaMin && eta < dEtaMax && fDeltaEta <0 ){
             // xxx
             //                        fhistos->hDRFarPtMoon[fTyp][fCentralityBin][ZBin][ir1][irs][fpttBin]->Fill( fpta, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
-            if( fTyp == 0 )
-              fhistos->fhDRFarPtMoon[fCentralityBin][ZBin][ir1][irs][fpttBin]->Fill( fpta, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
-            else
-              fhistos->fhDRFarPtMoonM[fCentralityBin][ZBin][ir1][irs][fpttBin]->Fill( fpta, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
+            moonHandles[nMoon] = moon.Handle(fCentralityBin, ZBin, ir1, irs, fpttBin);
+            moonX[nMoon] = fpta;
+            moonW[nMoon] = fGeometricAcceptanceCorrection * fTrackPairEfficiency;
+            nMoon++;
             
-            if(fTyp == kReal)       fhistos->fhDphiAssoc2D[ir1][irs]->Fill( fDeltaEta, fDeltaPhi/kJPi, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
+            if(fTyp == kReal)       fhistos->fhDphiAssoc2D.At( fhistos->fhDphiAssoc2D.Handle(ir1, irs) )->Fill( fDeltaEta, fDeltaPhi/kJPi, fGeometricAcceptanceCorrection * fTrackPairEfficiency );
           }
         }
       }
+      moon.FillN( nMoon, moonHandles, moonX, moonW );
     }
   }
 }
@@ -61,6 +61,8 @@ public:
   
 protected:
   
+  enum { kMaxMoonBins = 30*30 }; // ir1 x irs moon bins, bounded by the size of fRGap
+
   AliJCard*   fcard; // card
   AliJHistos* fhistos;  // histos
   AliJAcceptanceCorrection *fAcceptanceCorrection;  // acceptance correction container
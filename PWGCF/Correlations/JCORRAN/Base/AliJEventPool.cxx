@@ -29,7 +29,9 @@ AliJEventPool::AliJEventPool(AliJCard *cardin, AliJHistogramInterface *histosin,
   //ftk1(NULL),
   //ftk2(NULL),
   fthisPoolType(particle),
-  fpoolList(NULL)
+  fpoolList(NULL),
+  fUseFlatPool( !(particle == kJPhoton || particle == kJDecayphoton ||
+                  particle == kJPizero || particle == kJEta || particle == kJHadronMC) )
 {       
   // constructor
   
@@ -45,8 +47,17 @@ AliJEventPool::AliJEventPool(AliJCard *cardin, AliJHistogramInterface *histosin,
     }
   } cout <<endl; 
 
+  for(int ic=0;ic<kMaxNoCentrBin;ic++){
+    for(int ie=0;ie<MAXNOEVENT;ie++){
+      fLists[ic][ie]   = NULL;
+      fnoTracks[ic][ie] = 0;
+    }
+    fstride[ic] = 0;
+  }
+
   for(int ic=0;ic<fcard->GetNoOfBins(kCentrType);ic++){
-    for(int ie=0;ie<fcard->GetEventPoolDepth(ic); ie++){ 
+    // AliJBaseTrack pools are stored in flat buffers (see StoreFlat)
+    for(int ie=0;ie<fcard->GetEventPoolDepth(ic) && !fUseFlatPool; ie++){ 
       fLists[ic][ie]  = new TClonesArray(kParticleProtoType[particle],1500);
     }
     flastAccepted[ic] = -1; //to start from 0
@@ -76,7 +87,8 @@ AliJEventPool::AliJEventPool(const AliJEventPool& obj) :
   //ftk1(obj.ftk1),
   //ftk2(obj.ftk2),
   fthisPoolType(obj.fthisPoolType),
-  fpoolList(obj.fpoolList)
+  fpoolList(obj.fpoolList),
+  fUseFlatPool(obj.fUseFlatPool)
 {
   // copy constructor
   JUNUSED(obj);
@@ -105,8 +117,12 @@ void AliJEventPool::Mix( TClonesArray *triggList,
 
 
     for(int backCounter=0; backCounter <= flastAccepted[cBin]; backCounter++){
-        fpoolList = fLists [cBin] [backCounter];
-        noAssoc = fpoolList->GetEntries();
+        if( fUseFlatPool ){
+            noAssoc = fnoTracks[cBin][backCounter];
+        } else {
+            fpoolList = fLists [cBin] [backCounter];
+            noAssoc = fpoolList->GetEntries();
+        }
 
         if(noAssoc<=0) continue;
 
@@ -123,6 +139,20 @@ void AliJEventPool::Mix( TClonesArray *triggList,
             //=================================================
             // try to use only one track from each fevent
             //=================================================
+            if( fUseFlatPool ){
+                // pool tracks and their pt are contiguous in the flat buffers
+                AliJBaseTrack *assoc   = &fTrackBuffer[cBin][backCounter*fstride[cBin]];
+                const double  *assocPt = &fPtBuffer[cBin][backCounter*fstride[cBin]];
+                for(int ii=0;ii<noTrigg;ii++){
+                    AliJBaseTrack *ftk1 = (AliJBaseTrack*)triggList->At(ii);
+                    double ptt = ftk1->Pt();
+                    for(int jj=0;jj<noAssoc ;jj++){
+                        if(leadingParticle && ptt < assocPt[jj]) continue; // leading particle correlations: only lower pT associated
+                        fcorrelations->FillHisto(cFTyp,kMixed, cBin, zBin, ftk1, assoc+jj);
+                    }
+                }
+                continue;
+            }
             for(int ii=0;ii<noTrigg;ii++){
                 AliJBaseTrack *ftk1 = (AliJBaseTrack*)triggList->At(ii);        
                 //fhistos->fhTriggPtBin[kMixed][cBin][iptt]->Fill(ptt); //who needs that?
@@ -153,6 +183,11 @@ void AliJEventPool::AcceptList(TClonesArray *inList, float cent, float Z, float
     fcentrality[cBin][fwhereToStore[cBin]] = cent;
     fmult      [cBin][fwhereToStore[cBin]] = inMult;
 
+    if( fUseFlatPool ){
+        StoreFlat(inList, cBin, fwhereToStore[cBin]);
+        return;
+    }
+
     fLists[cBin][fwhereToStore[cBin]]->Clear();
     for(int i=0;i<inList->GetEntriesFast();i++){
 				if( fthisPoolType == kJPhoton || fthisPoolType == kJDecayphoton ){
@@ -179,6 +214,49 @@ void AliJEventPool::AcceptList(TClonesArray *inList, float cent, float Z, float
 
 
 
+//______________________________________________________________________________
+void AliJEventPool::StoreFlat(TClonesArray *inList, int cBin, int slot){
+    //////////////////////////////////////////////////////////////
+    // Copy the tracks of inList into event slot of the flat buffers.
+    // The buffers are reused, no track objects are constructed once
+    // the slot capacity covers the largest event seen.
+    //////////////////////////////////////////////////////////////
+    int ntracks = inList->GetEntriesFast();
+    if( ntracks > fstride[cBin] ) GrowFlat(cBin, ntracks);
+    fnoTracks[cBin][slot] = ntracks;
+    if( ntracks<=0 ) return;
+
+    AliJBaseTrack *tracks = &fTrackBuffer[cBin][slot*fstride[cBin]];
+    double        *pt     = &fPtBuffer[cBin][slot*fstride[cBin]];
+    for(int i=0;i<ntracks;i++){
+        AliJBaseTrack *tk = (AliJBaseTrack*)inList->At(i);
+        tracks[i] = *tk;
+        pt[i]     = tk->Pt();
+    }
+}
+
+//______________________________________________________________________________
+void AliJEventPool::GrowFlat(int cBin, int ntracks){
+    // Enlarge the slot capacity of the flat buffers of cBin to hold at least ntracks,
+    // keeping the stored events
+    int depth     = fcard->GetEventPoolDepth(cBin);
+    int oldStride = fstride[cBin];
+    int newStride = oldStride + oldStride/2;
+    if( newStride < ntracks ) newStride = ntracks;
+
+    vector<AliJBaseTrack> tracks(depth*newStride);
+    vector<double>        pt(depth*newStride, 0.);
+    for(int ie=0;ie<depth && oldStride>0;ie++){
+        for(int i=0;i<fnoTracks[cBin][ie] && i<oldStride;i++){
+            tracks[ie*newStride+i] = fTrackBuffer[cBin][ie*oldStride+i];
+            pt[ie*newStride+i]     = fPtBuffer[cBin][ie*oldStride+i];
+        }
+    }
+    fTrackBuffer[cBin].swap(tracks);
+    fPtBuffer[cBin].swap(pt);
+    fstride[cBin] = newStride;
+}
+
 //==================== Sampling ===========================
 void AliJEventPool::Mysample(TH1D *fromh, TH1D *toh )
 {
@@ -10,13 +10,14 @@
 #include <fstream>
 #include <stdlib.h>
 #include <stdio.h>
+#include <vector>
 
 using namespace std;
 
 #include "AliJConst.h"
+#include "AliJBaseTrack.h"
 
 class TClonesArray;
-class AliJBaseTrack;
 class AliJPhoton;
 class AliJTrack;
 class AliJMCTrack;
@@ -45,11 +46,15 @@ class AliJEventPool {
 
         void AcceptList(TClonesArray *inList, float cent, float Z, float inMult, int iev);
 
+        bool IsFlatPool() const { return fUseFlatPool; } // tracks stored in flat buffers
+
         void Mysample(TH1D *fromh, TH1D *toh );
         void PrintOut(){for(int i=0;i<kMaxNoCentrBin;i++)
             cout<<"c: "<<i<<" mixed "<<fnoMix[i]<<" accepted "<<fnoMixCut[i]<<" "<<(fnoMix[i]>0?fnoMixCut[i]*1.0/fnoMix[i]:0)<< endl;}
 
     protected:
+        void StoreFlat(TClonesArray *inList, int cBin, int slot);
+        void GrowFlat(int cBin, int ntracks);
 
         int   fevent[kMaxNoCentrBin][MAXNOEVENT];  // comment me
         float fZVertex[kMaxNoCentrBin][MAXNOEVENT];  // comment me
@@ -71,6 +76,12 @@ class AliJEventPool {
 
         TClonesArray  *fpoolList;  // pool list
 
+        bool fUseFlatPool; // AliJBaseTrack pools are kept in flat buffers, other types in fLists
+        int  fnoTracks[kMaxNoCentrBin][MAXNOEVENT]; // number of tracks in each stored event
+        int  fstride[kMaxNoCentrBin]; // track capacity of one event slot in the flat buffers
+        vector<AliJBaseTrack> fTrackBuffer[kMaxNoCentrBin]; // [slot*stride+track] pool tracks
+        vector<double>        fPtBuffer[kMaxNoCentrBin];    // [slot*stride+track] pt of the pool tracks
+
         //int   trials[MAXNOEVENT];
 
 };
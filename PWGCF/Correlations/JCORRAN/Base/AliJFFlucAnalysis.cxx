@@ -5,6 +5,8 @@
 #include <TMath.h>
 #include <TComplex.h>
 #include <TClonesArray.h>
+#include <vector>
+#include <cstring>
 #include "AliJBaseTrack.h"
 #include "AliJFFlucAnalysis.h"
 #include "AliJEfficiency.h"
@@ -127,6 +129,7 @@ UInt_t AliJFFlucAnalysis::NBin[3] = {
 //UInt_t AliJFFlucAnalysis::CentralityTranslationMap[CENTN_NAT] = {0,0,0,1,2,3,4,5,6};
 Double_t AliJFFlucAnalysis::pttJacek[74] = {0, 0.05, 0.1, 0.15, 0.2, 0.25, 0.3, 0.35, 0.4, 0.45, 0.5, 0.55, 0.6, 0.65, 0.7, 0.75, 0.8, 0.85, 0.9, 0.95,1, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, 2, 2.2, 2.4, 2.6, 2.8, 3, 3.2, 3.4, 3.6, 3.8, 4, 4.5, 5, 5.5, 6, 6.5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 40, 45, 50, 60, 70, 80, 90, 100};
 UInt_t AliJFFlucAnalysis::NpttJacek = sizeof(AliJFFlucAnalysis::pttJacek)/sizeof(AliJFFlucAnalysis::pttJacek[0])-1;
+Double_t AliJFFlucAnalysis::SCptBorders[N_ptbins+1] = {0.2, 0.4, 0.6, 0.8, 1.0, 1.25, 1.5, 2.0, 5.0};
 
 //________________________________________________________________________
 AliJFFlucAnalysis::AliJFFlucAnalysis(const AliJFFlucAnalysis& a):
@@ -394,28 +397,108 @@ AliJFFlucAnalysis::~AliJFFlucAnalysis() {
 	delete fEfficiency;
 }
 
+namespace {
+	// Evaluation plans of the m-particle correlators (generic framework):
+	// a sum over the set partitions of the m particles, where each block b
+	// contributes Q(sum of its harmonics, |b|) and a factor (-1)^(|b|-1) (|b|-1)!
+	// The plans depend only on m and are built once.
+	enum{kMaxCorrelatorOrder = 4};
+	struct CorrelatorTerm{
+		Double_t coeff;
+		int nblocks;
+		UInt_t mask[kMaxCorrelatorOrder]; // particles in each block
+		int power[kMaxCorrelatorOrder]; // size of each block
+	};
+
+	void AddCorrelatorTerms(int m, int j, CorrelatorTerm &t, std::vector<CorrelatorTerm> &plan){
+		if(j == m){
+			t.coeff = 1.0;
+			for(int b = 0; b < t.nblocks; b++){
+				t.power[b] = 0;
+				for(int k = 0; k < m; k++)
+					t.power[b] += (t.mask[b]>>k)&1;
+				for(int k = 1; k < t.power[b]; k++)
+					t.coeff *= -(Double_t)k;
+			}
+			plan.push_back(t);
+			return;
+		}
+		for(int b = 0; b < t.nblocks; b++){ // add particle j to an existing block
+			t.mask[b] |= 1u<<j;
+			AddCorrelatorTerms(m,j+1,t,plan);
+			t.mask[b] &= ~(1u<<j);
+		}
+		t.mask[t.nblocks++] = 1u<<j; // or open a new one
+		AddCorrelatorTerms(m,j+1,t,plan);
+		t.nblocks--;
+	}
+
+	const std::vector<CorrelatorTerm> &GetCorrelatorPlan(int m){
+		static std::vector<CorrelatorTerm> plans[kMaxCorrelatorOrder+1];
+		static bool built = false;
+		if(!built){
+			for(int im = 1; im <= kMaxCorrelatorOrder; im++){
+				CorrelatorTerm t;
+				t.nblocks = 0;
+				AddCorrelatorTerms(im,0,t,plans[im]);
+			}
+			built = true;
+		}
+		return plans[m];
+	}
+}
+
+//________________________________________________________________________
+TComplex AliJFFlucAnalysis::Correlator(const TComplex (*pQ)[nKL], const int *harmonics, int m){
+	// Q{-n, p} = Q{n, p}*
+	const std::vector<CorrelatorTerm> &plan = GetCorrelatorPlan(m);
+	TComplex corr(0,0);
+	for(UInt_t it = 0; it < plan.size(); it++){
+		const CorrelatorTerm &t = plan[it];
+		TComplex term(t.coeff,0);
+		for(int b = 0; b < t.nblocks; b++){
+			int n = 0;
+			for(int k = 0; k < m; k++)
+				if((t.mask[b]>>k)&1)
+					n += harmonics[k];
+			term *= n >= 0?pQ[n][t.power[b]]:TComplex::Conjugate(pQ[-n][t.power[b]]);
+		}
+		corr += term;
+	}
+	return corr;
+}
+
 #define A i
 #define B (1-i)
 #define C(u) TComplex::Conjugate(u)
-//TODO: conjugate macro
-inline TComplex TwoGap(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b){
-	return pQq[A][a][1]*C(pQq[B][b][1]);
+// correlators with an eta gap: particles with harmonics na from subevent A, nb from B (conjugated)
+inline TComplex GapCorrelator(const TComplex (*pQq)[AliJFFlucAnalysis::kNQH][AliJFFlucAnalysis::nKL], uint i, const int *na, int ma, const int *nb, int mb){
+	return AliJFFlucAnalysis::Correlator(pQq[A],na,ma)*C(AliJFFlucAnalysis::Correlator(pQq[B],nb,mb));
+}
+
+inline TComplex TwoGap(const TComplex (*pQq)[AliJFFlucAnalysis::kNQH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b){
+	const int na[] = {(int)a}, nb[] = {(int)b};
+	return GapCorrelator(pQq,i,na,1,nb,1);
 }
 
-inline TComplex ThreeGap(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c){
-	return pQq[A][a][1]*C(pQq[B][b][1]*pQq[B][c][1]-pQq[B][b+c][2]);
+inline TComplex ThreeGap(const TComplex (*pQq)[AliJFFlucAnalysis::kNQH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c){
+	const int na[] = {(int)a}, nb[] = {(int)b,(int)c};
+	return GapCorrelator(pQq,i,na,1,nb,2);
 }
 
-inline TComplex FourGap22(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c, uint d){
-	return pQq[A][a][1]*pQq[A][b][1]*C(pQq[B][c][1]*pQq[B][d][1])-pQq[A][a+b][2]*C(pQq[B][c][1]*pQq[B][d][1])-pQq[A][a][1]*pQq[A][b][1]*C(pQq[B][c+d][2])+pQq[A][a+b][2]*C(pQq[B][c+d][2]);
+inline TComplex FourGap22(const TComplex (*pQq)[AliJFFlucAnalysis::kNQH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c, uint d){
+	const int na[] = {(int)a,(int)b}, nb[] = {(int)c,(int)d};
+	return GapCorrelator(pQq,i,na,2,nb,2);
 }
 
-inline TComplex FourGap13(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c, uint d){
-	return pQq[A][a][1]*C(pQq[B][b][1]*pQq[B][c][1]*pQq[B][d][1]-pQq[B][b+c][2]*pQq[B][d][1]-pQq[B][b+d][2]*pQq[B][c][1]-pQq[B][c+d][2]*pQq[B][b][1]+2.0*pQq[B][b+c+d][3]);
+inline TComplex FourGap13(const TComplex (*pQq)[AliJFFlucAnalysis::kNQH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c, uint d){
+	const int na[] = {(int)a}, nb[] = {(int)b,(int)c,(int)d};
+	return GapCorrelator(pQq,i,na,1,nb,3);
 }
 
-inline TComplex SixGap33(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint n1, uint n2, uint n3, uint n4, uint n5, uint n6){
-	return pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])+2.0*pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n5+n6][3])+2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])+4.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n5+n6][3]);
+inline TComplex SixGap33(const TComplex (*pQq)[AliJFFlucAnalysis::kNQH][AliJFFlucAnalysis::nKL], uint i, uint n1, uint n2, uint n3, uint n4, uint n5, uint n6){
+	const int na[] = {(int)n1,(int)n2,(int)n3}, nb[] = {(int)n4,(int)n5,(int)n6};
+	return GapCorrelator(pQq,i,na,3,nb,3);
 }
 #undef C
 
@@ -481,7 +564,7 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 	TComplex ncorr[kNH][nKL];
 	TComplex ncorr2[kNH][nKL][kcNH][nKL];
 
-	const TComplex (*pQq)[kNH][nKL] = QvectorQCeta10;
+	const TComplex (*pQq)[kNQH][nKL] = QvectorQCeta10;
 
 	for(int i = 0; i < 2; ++i){
 		if((subeventMask & (1<<i)) == 0)
@@ -703,30 +786,22 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 #endif
 
 	if(flags & FLUC_SCPT){
-		const int SCNH = 9; // 0, 1, 2(v2), 3(v3), 4(v4), 5(v5)
-		Double_t ptbin_borders[N_ptbins+1] = {0.2, 0.4, 0.6, 0.8, 1.0, 1.25, 1.5, 2.0, 5.0};
+		const int SCNH = kSCNH; // 0, 1, 2(v2), 3(v3), 4(v4), 5(v5)
 		//init
 		TComplex QnA_pt[SCNH][N_ptbins];
 		TComplex QnB_pt[SCNH][N_ptbins];
 		TComplex QnB_pt_star[SCNH][N_ptbins];
-		for(int ih=2; ih<SCNH; ih++){
-			for(int ipt=0; ipt<N_ptbins; ipt++){
-				QnA_pt[ih][ipt] = TComplex(0,0);
-				QnB_pt[ih][ipt] = TComplex(0,0);
-				QnB_pt_star[ih][ipt] = TComplex(0,0);
-			}
-		}
 
-		// calculate Qn for each pt bin
-		for(int ih=2; ih<SCNH; ih++){
-			for(int ipt=0; ipt<N_ptbins; ipt++){
-				Double_t pt_bin_min = ptbin_borders[ipt];
-				Double_t pt_bin_max = ptbin_borders[ipt+1];
-				QnA_pt[ih][ipt] = Get_Qn_pt(Eta_config[kSubA][0], Eta_config[kSubA][1], ih, ipt, pt_bin_min, pt_bin_max);
-				QnB_pt[ih][ipt] = Get_Qn_pt(Eta_config[kSubB][0], Eta_config[kSubB][1], ih, ipt, pt_bin_min, pt_bin_max);
+		// Qn for each pt bin, accumulated in CalculateQvectorsQC (same as Get_Qn_pt)
+		for(int ipt=0; ipt<N_ptbins; ipt++){
+			for(int ih=2; ih<SCNH; ih++){
+				QnA_pt[ih][ipt] = TComplex(fQptRe[kSubA][ih][ipt],fQptIm[kSubA][ih][ipt])/fQptW[kSubA][ipt];
+				QnB_pt[ih][ipt] = TComplex(fQptRe[kSubB][ih][ipt],fQptIm[kSubB][ih][ipt])/fQptW[kSubB][ipt];
 
 				QnB_pt_star[ih][ipt] = TComplex::Conjugate( QnB_pt[ih][ipt] ) ;
 			}
+			NSubTracks_pt[(int)(Eta_config[kSubA][0] > 0.0)][ipt] = fQptW[kSubA][ipt];
+			NSubTracks_pt[(int)(Eta_config[kSubB][0] > 0.0)][ipt] = fQptW[kSubB][ipt];
 		}
 
 		for(int ipt=0; ipt<N_ptbins; ipt++){
@@ -877,15 +952,20 @@ TComplex AliJFFlucAnalysis::Get_Qn_pt(Double_t eta1, Double_t eta2, int harmonic
 //________________________________________________________________________
 void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 	// calcualte Q-vector for QC method ( no subgroup )
+	// Single pass over the tracks: all harmonics from the recurrence
+	// exp(i(n+1)phi) = exp(i n phi)*exp(i phi), all weight powers, the
+	// eta-gap subevents and (with FLUC_SCPT) the pt-binned subevents
+	// A=[etamin,etamax], B=[-etamax,-etamin] used for SC(m,n) vs pt.
 	//init
-	for(int ih=0; ih<kNH; ih++){
-		for(int ik=0; ik<nKL; ++ik){
-			QvectorQC[ih][ik] = TComplex(0,0);
-			for(int isub=0; isub<2; isub++){
-				QvectorQCeta10[isub][ih][ik] = TComplex(0,0);
-			}
-		}
-	} // for max harmonics
+	memset(fQre,0,sizeof(fQre));
+	memset(fQim,0,sizeof(fQim));
+	memset(fQptRe,0,sizeof(fQptRe));
+	memset(fQptIm,0,sizeof(fQptIm));
+	memset(fQptW,0,sizeof(fQptW));
+	Bool_t doPt = (flags & FLUC_SCPT) != 0;
+
+	Double_t cn[kNQH], sn[kNQH]; // cos(n*phi), sin(n*phi)
+	Double_t tf[nKL]; // weight powers
 	//Calculate Q-vector with particle loop
 	Long64_t ntracks = fInputList->GetEntriesFast(); // all tracks from Task input
 	for( Long64_t it=0; it<ntracks; it++){
@@ -923,21 +1003,62 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 		}
 		Double_t effCorr = fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);
 
-		for(int ih=0; ih<kNH; ih++){
-			Double_t tf = 1.0;
-			TComplex q[nKL];
-			for(int ik=0; ik<nKL; ik++){
-				q[ik] = TComplex(tf*TMath::Cos(ih*phi),tf*TMath::Sin(ih*phi));
-				QvectorQC[ih][ik] += q[ik];
+		Double_t weight = 1.0/(phi_module_corr*effCorr);
+		tf[0] = 1.0;
+		for(int ik=1; ik<nKL; ik++)
+			tf[ik] = tf[ik-1]*weight;
+
+		cn[0] = 1.0;
+		sn[0] = 0.0;
+		cn[1] = TMath::Cos(phi);
+		sn[1] = TMath::Sin(phi);
+		for(int ih=2; ih<kNQH; ih++){
+			cn[ih] = cn[ih-1]*cn[1]-sn[ih-1]*sn[1];
+			sn[ih] = sn[ih-1]*cn[1]+cn[ih-1]*sn[1];
+		}
 
-				//this is for normalized SC ( denominator needs an eta gap )
-				if(TMath::Abs(eta) > etamin)//fQC_eta_gap_half)
-					QvectorQCeta10[isub][ih][ik] += q[ik];
+		//this is for normalized SC ( denominator needs an eta gap )
+		Bool_t gap = TMath::Abs(eta) > etamin;//fQC_eta_gap_half
+		for(int ih=0; ih<kNQH; ih++){
+			for(int ik=0; ik<nKL; ik++){
+				fQre[0][ih][ik] += tf[ik]*cn[ih];
+				fQim[0][ih][ik] += tf[ik]*sn[ih];
+			}
+			if(!gap)
+				continue;
+			for(int ik=0; ik<nKL; ik++){
+				fQre[1+isub][ih][ik] += tf[ik]*cn[ih];
+				fQim[1+isub][ih][ik] += tf[ik]*sn[ih];
+			}
+		}
 
-				tf *= 1.0/(phi_module_corr*effCorr);
+		if(!doPt)
+			continue;
+		for(int iside=0; iside<2; iside++){
+			// subevent A (iside=0) or B (iside=1), as in Get_Qn_pt
+			Double_t eta1 = iside == 0?etamin:-etamax;
+			Double_t eta2 = iside == 0?etamax:-etamin;
+			if(eta < eta1 || eta > eta2)
+				continue;
+			for(int ipt=0; ipt<N_ptbins; ipt++){
+				if(pt < SCptBorders[ipt] || pt > SCptBorders[ipt+1])
+					continue;
+				for(int ih=0; ih<kSCNH; ih++){
+					fQptRe[iside][ih][ipt] += weight*cn[ih];
+					fQptIm[iside][ih][ipt] += weight*sn[ih];
+				}
+				fQptW[iside][ipt] += weight;
 			}
 		}
 	} // track loop done.
+
+	for(int ih=0; ih<kNQH; ih++){
+		for(int ik=0; ik<nKL; ik++){
+			QvectorQC[ih][ik] = TComplex(fQre[0][ih][ik],fQim[0][ih][ik]);
+			for(int isub=0; isub<2; isub++)
+				QvectorQCeta10[isub][ih][ik] = TComplex(fQre[1+isub][ih][ik],fQim[1+isub][ih][ik]);
+		}
+	}
 }
 //________________________________________________________________________
 TComplex AliJFFlucAnalysis::Q(int n, int p){
@@ -950,19 +1071,15 @@ TComplex AliJFFlucAnalysis::Q(int n, int p){
 //________________________________________________________________________
 TComplex AliJFFlucAnalysis::Two(int n1, int n2 ){
 	// two-particle correlation <exp[i(n1*phi1 + n2*phi2)]>
-	//	cout << "TWO FUNCTION " << Q(n1,1) << "*" << Q(n2,1) << " - " << Q(n1+n2 , 2) << endl;
-	TComplex two = Q(n1, 1) * Q(n2, 1) - Q( n1+n2, 2);
-	return two;
+	// Q(n1,1)*Q(n2,1) - Q(n1+n2,2)
+	const int n[] = {n1,n2};
+	return Correlator(QvectorQC,n,2);
 }
 //________________________________________________________________________
 TComplex AliJFFlucAnalysis::Four( int n1, int n2, int n3, int n4){
-	TComplex four =
-		Q(n1,1)*Q(n2,1)*Q(n3,1)*Q(n4,1)-Q(n1+n2,2)*Q(n3,1)*Q(n4,1)-Q(n2,1)*Q(n1+n3,2)*Q(n4,1)
-		- Q(n1,1)*Q(n2+n3,2)*Q(n4,1)+2.*Q(n1+n2+n3,3)*Q(n4,1)-Q(n2,1)*Q(n3,1)*Q(n1+n4,2)
-		+ Q(n2+n3,2)*Q(n1+n4,2)-Q(n1,1)*Q(n3,1)*Q(n2+n4,2)+Q(n1+n3,2)*Q(n2+n4,2)
-		+ 2.*Q(n3,1)*Q(n1+n2+n4,3)-Q(n1,1)*Q(n2,1)*Q(n3+n4,2)+Q(n1+n2,2)*Q(n3+n4,2)
-		+ 2.*Q(n2,1)*Q(n1+n3+n4,3)+2.*Q(n1,1)*Q(n2+n3+n4,3)-6.*Q(n1+n2+n3+n4,4);
-	return four;
+	// four-particle correlation <exp[i(n1*phi1 + n2*phi2 + n3*phi3 + n4*phi4)]>, 15 terms
+	const int n[] = {n1,n2,n3,n4};
+	return Correlator(QvectorQC,n,4);
 }
 //__________________________________________________________________________
 /*void AliJFFlucAnalysis::SetPhiModuleHistos( int cent, int sub, TH1D *hModuledPhi){
@@ -111,6 +111,9 @@ public:
 
 	enum{kH0, kH1, kH2, kH3, kH4, kH5, kH6, kH7, kH8, kH9, kH10, kH11, kH12, kNH}; //harmonics
 	enum{kK0, kK1, kK2, kK3, kK4, nKL}; // order
+	enum{kNQH = 3*kH12+1}; // Q-vector harmonics, up to the highest harmonic sum used in the correlators
+	// m-particle correlator <exp[i(n1*phi1+...+nm*phi_m)]> (m<=4) from Q-vectors pQ[harmonic][power]
+	static TComplex Correlator(const TComplex (*pQ)[nKL], const int *harmonics, int m);
 #define kcNH kH6 //max second dimension + 1
 private:
 
@@ -141,8 +144,10 @@ private:
 	Double_t fQC_eta_cut_max;
 	Double_t fQC_eta_gap_half;
 
-	TComplex QvectorQC[kNH][nKL];
-	TComplex QvectorQCeta10[2][kNH][nKL]; // ksub
+	TComplex QvectorQC[kNQH][nKL];
+	TComplex QvectorQCeta10[2][kNQH][nKL]; // ksub
+	Double_t fQre[3][kNQH][nKL]; // flat Q-vector accumulators: all tracks, eta-gap subevents 0 and 1
+	Double_t fQim[3][kNQH][nKL];
 
 	AliJHistManager * fHMG;//!
 
@@ -189,6 +194,11 @@ private:
 	// additional variables for ptbins(Standard Candles only)
 	enum{kPt0, kPt1, kPt2, kPt3, kPt4, kPt5, kPt6, kPt7, N_ptbins};
 	double NSubTracks_pt[2][N_ptbins];
+	enum{kSCNH = 9}; // harmonics of the pt-dependent SC Q-vectors
+	static Double_t SCptBorders[N_ptbins+1];
+	Double_t fQptRe[2][kSCNH][N_ptbins]; // pt-binned Q-vector accumulators of subevents A and B
+	Double_t fQptIm[2][kSCNH][N_ptbins];
+	Double_t fQptW[2][N_ptbins]; // sum of weights
 	AliJBin fBin_Nptbins;//!
 	AliJTH1D fh_SC_ptdep_4corr;//! // for < vn^2 vm^2 >
 	AliJTH1D fh_SC_ptdep_2corr;//!  // for < vn^2 >
@@ -221,6 +221,7 @@ AliJArrayBase::AliJArrayBase():
     //AliJNamed("AliJArayBase","","&Dir=default&LessLazy",0),
     fDim(0),
     fIndex(0),
+    fStride(0),
     fArraySize(0),
     fNGenerated(0),
     fIsBinFixed(false),
@@ -240,6 +241,7 @@ AliJArrayBase::AliJArrayBase(const AliJArrayBase& obj) :
     AliJNamed(obj.fName,obj.fTitle,obj.fOption,obj.fMode),
     fDim(obj.fDim),
     fIndex(obj.fIndex),
+    fStride(obj.fStride),
     fArraySize(obj.fArraySize),
     fNGenerated(obj.fNGenerated),
     fIsBinFixed(obj.fIsBinFixed),
@@ -284,6 +286,31 @@ void AliJArrayBase::FixBin(){
     ClearIndex();
     fAlg = new AliJArrayAlgorithmSimple(this);
     fArraySize = fAlg->BuildArray();
+    fStride.assign( Dimension()>kMaxHandleDim?Dimension():kMaxHandleDim, 0 );
+    for( int i=0;i<Dimension();i++ ) fStride[i] = fAlg->DimFactor(i);
+}
+//_____________________________________________________
+int AliJArrayBase::GetHandle(){
+    // handle of the element at the current Index()
+    return fAlg->GlobalIndex();
+}
+//_____________________________________________________
+void AliJArrayBase::HandleError( int d, int i ) const {
+    // out of range index given to Handle()
+    if( d<0 ) JERROR( "Handle() before the binning is fixed in "+fName );
+    if( d>=(int)fDim.size() ) JERROR( Form("Index %d given for dimension %d beyond the %d dimensions of ",i,d,(int)fDim.size())+fName );
+    JERROR( Form("wrong Index %d of %dth in ",i,d)+fName );
+}
+//_____________________________________________________
+void* AliJArrayBase::GetItemAt(int handle){
+    // element for a handle, built on first use like GetItem()
+    if( handle<0 || handle>=fArraySize ) JERROR( Form("Wrong handle %d of ",handle)+fName );
+    void ** rawItem = fAlg->GetRawItemAt( handle );
+    if( !*rawItem ){
+        fAlg->ReverseIndex( handle );
+        BuildItem();
+    }
+    return *rawItem;
 }
 //_____________________________________________________
 int AliJArrayBase::Index(int d){
@@ -633,6 +660,24 @@ void * AliJTH1::BuildItem(){
     return (void*)item;
 }
 //_____________________________________________________
+void AliJTH1::FillN( int handle, int n, const double *x, const double *w ){
+    static_cast<TH1*>(GetItemAt(handle))->FillN( n, x, w );
+}
+//_____________________________________________________
+void AliJTH1::FillN( int handle, int n, const double *x, const double *y, const double *w ){
+    static_cast<TH1*>(GetItemAt(handle))->FillN( n, x, y, w );
+}
+//_____________________________________________________
+void AliJTH1::FillN( int n, const int *handles, const double *x, const double *w ){
+    // fill n entries, each into its own element, of one dimensional histograms
+    if( n<=0 ) return;
+    if( fTemplate && fTemplate->GetDimension() != 1 ) JERROR( "FillN with handles is for 1D histograms only : "+fName );
+    for( int i=0;i<n;i++ ){
+        TH1 * h = static_cast<TH1*>(GetItemAt(handles[i]));
+        h->Fill( x[i], w?w[i]:1. );
+    }
+}
+//_____________________________________________________
 bool AliJTH1::IsLoadMode(){
     return fHMG->IsLoadMode();
 }
@@ -159,6 +159,25 @@ class AliJArrayBase : public AliJNamed{
         void * GetItem();
         void * GetSingleItem();
 
+        // Handles : global index of an element, resolved once and then used
+        // for direct access without walking the index levels at every fill.
+        // Each index is checked against its dimension like operator[] does,
+        // indices beyond Dimension() must be 0.
+        enum { kMaxHandleDim = 6 };
+        int  GetHandle();
+        int  Handle( int i0, int i1=0, int i2=0, int i3=0, int i4=0, int i5=0 ) const {
+            if( fStride.empty() ) HandleError( -1, 0 );
+            const int idx[kMaxHandleDim] = { i0, i1, i2, i3, i4, i5 };
+            int handle = 0;
+            for( int d=0;d<kMaxHandleDim;d++ ){
+                if( d<(int)fDim.size() ? ( idx[d]<0 || idx[d]>=fDim[d] ) : idx[d]!=0 ) HandleError( d, idx[d] );
+                handle += idx[d]*fStride[d];
+            }
+            return handle;
+        }
+        int  Stride( int d ){ return fStride.at(d); }
+        void * GetItemAt( int handle );
+
         ///void LockBin(bool is=true){}//TODO
         //bool IsBinLocked(){ return fIsBinLocked; }
 
@@ -183,9 +202,11 @@ class AliJArrayBase : public AliJNamed{
     protected:
         AliJArrayBase(); // Prevent direct creation of AliJArrayBase
         AliJArrayBase(const AliJArrayBase& obj);
+        void HandleError( int d, int i ) const;
 
         ArrayInt        fDim;           // Comment test
         ArrayInt        fIndex;         /// Comment test
+        ArrayInt        fStride;        // handle stride of each dimension, fixed in FixBin
         int         fArraySize;         /// Comment test3
         int         fNGenerated;
         bool        fIsBinFixed;
@@ -212,6 +233,10 @@ class AliJArrayAlgorithm {
         virtual void InitIterator()=0;
         virtual bool Next(void *& item) = 0;
         virtual void ** GetRawItem()=0;
+        virtual void ** GetRawItemAt(int iG)=0;
+        virtual int  GlobalIndex()=0;
+        virtual void ReverseIndex(int iG)=0;
+        virtual int  DimFactor(int i)=0;
         virtual void * GetPosition()=0;
         virtual bool IsCurrentPosition(void * pos)=0;
         virtual void SetPosition(void * pos )=0;
@@ -228,12 +253,14 @@ class AliJArrayAlgorithmSimple : public AliJArrayAlgorithm {
         AliJArrayAlgorithmSimple& operator=(const AliJArrayAlgorithmSimple& obj);
         virtual ~AliJArrayAlgorithmSimple();
         virtual int BuildArray();
-        int  GlobalIndex();
-        void ReverseIndex(int iG );
+        virtual int  GlobalIndex();
+        virtual void ReverseIndex(int iG );
+        virtual int  DimFactor(int i){ return fDimFactor[i]; }
         virtual void * GetItem();
         virtual void SetItem(void * item);
         virtual void InitIterator(){ fPos = 0; }
         virtual void ** GetRawItem(){ return &fArray[GlobalIndex()]; }
+        virtual void ** GetRawItemAt(int iG){ return &fArray[iG]; }
         virtual bool Next(void *& item){
             item = fPos<GetEntries()?(void*)fArray[fPos]:NULL;
             if( fPos<GetEntries() ) ReverseIndex(fPos);
@@ -289,6 +316,10 @@ class AliJTH1 : public AliJArrayBase{
         void    SetTemplate(TH1* h);
         TH1*    GetTemplatePtr(){ return fTemplate; }
 
+        // Batch fill through handles
+        void    FillN( int handle, int n, const double *x, const double *w=NULL );
+        void    FillN( int handle, int n, const double *x, const double *y, const double *w );
+        void    FillN( int n, const int *handles, const double *x, const double *w=NULL ); // 1D only
 
 
     protected:
@@ -317,6 +348,7 @@ class AliJTH1Derived : public AliJTH1 {
 
         AliJTH1DerivedPlayer<T> & operator[](int i){ fPlayer.Init();fPlayer[i];return fPlayer; }
         T * operator->(){ return static_cast<T*>(GetSingleItem()); }
+        T * At( int handle ){ return static_cast<T*>(GetItemAt(handle)); }
         operator T*(){ return static_cast<T*>(GetSingleItem()); }
         // Virtual from AliJArrayBase
 
@@ -361,6 +393,7 @@ class AliJTH1DerivedPlayer {
             return *this;
         }
         void Init(){ fLevel=0;fCMD->ClearIndex(); }
+        int  Handle(){ return fCMD->GetHandle(); }
         T* operator->(){ return static_cast<T*>(fCMD->GetItem()); } 
         operator T*(){ return static_cast<T*>(fCMD->GetItem()); } 
         operator TObject*(){ return static_cast<TObject*>(fCMD->GetItem()); } 
@@ -471,7 +471,11 @@ AliAnalysisTaskGammaConvCalo::AliAnalysisTaskGammaConvCalo(): AliAnalysisTaskSE(
   fFileNameBroken(NULL),
   fAllowOverlapHeaders(kTRUE),
   fTrackMatcherRunningMode(0),
-  fDoHBTHistoOutput(kFALSE)
+  fDoHBTHistoOutput(kFALSE),
+  fSharePhotonSelection(kFALSE),
+  fPhotonCutGroup(),
+  fNPhotonCutGroups(0),
+  fPhotonSelection()
 {
 
 }
@@ -885,7 +889,11 @@ AliAnalysisTaskGammaConvCalo::AliAnalysisTaskGammaConvCalo(const char *name):
   fFileNameBroken(NULL),
   fAllowOverlapHeaders(kTRUE),
   fTrackMatcherRunningMode(0),
-  fDoHBTHistoOutput(kFALSE)
+  fDoHBTHistoOutput(kFALSE),
+  fSharePhotonSelection(kFALSE),
+  fPhotonCutGroup(),
+  fNPhotonCutGroups(0),
+  fPhotonSelection()
 {
   // Define output slots here
   DefineOutput(1, TList::Class());
@@ -1057,6 +1065,22 @@ void AliAnalysisTaskGammaConvCalo::UserCreateOutputObjects(){
   fV0Reader = (AliV0ReaderV1*)AliAnalysisManager::GetAnalysisManager()->GetTask(fV0ReaderName.Data());
   if(!fV0Reader){printf("Error: No V0 Reader");return;}// GetV0Reader
 
+  // cut sets with identical photon cut string form a group sharing the result of PhotonIsSelected
+  fPhotonCutGroup.assign(fnCuts,-1);
+  fNPhotonCutGroups = 0;
+  if(fSharePhotonSelection){
+    for(Int_t iCut = 0; iCut<fnCuts;iCut++){
+      TString cutstringPhoton = ((AliConversionPhotonCuts*)fCutArray->At(iCut))->GetCutNumber();
+      for(Int_t jCut = 0; jCut<iCut;jCut++){
+        if(cutstringPhoton.CompareTo(((AliConversionPhotonCuts*)fCutArray->At(jCut))->GetCutNumber()) == 0){
+          fPhotonCutGroup[iCut] = fPhotonCutGroup[jCut];
+          break;
+        }
+      }
+      if(fPhotonCutGroup[iCut] < 0) fPhotonCutGroup[iCut] = fNPhotonCutGroups++;
+    }
+  }
+
   if(fDoMesonAnalysis){ //Same Jet Finder MUST be used within same trainconfig
     if( ((AliConversionMesonCuts*)fMesonCutArray->At(0))->DoJetAnalysis())  fDoJetAnalysis = kTRUE;
     if( ((AliConversionMesonCuts*)fMesonCutArray->At(0))->DoJetQA())        fDoJetQA       = kTRUE;
@@ -3368,6 +3392,7 @@ void AliAnalysisTaskGammaConvCalo::UserExec(Option_t *)
 //   }
 
   fReaderGammas = fV0Reader->GetReconstructedGammas(); // Gammas from default Cut
+  if(fSharePhotonSelection) fPhotonSelection.assign(fNPhotonCutGroups*fReaderGammas->GetEntriesFast(),0);
 
   // ------------------- BeginEvent ----------------------------
   AliEventplane *EventPlane = fInputEvent->GetEventplane();
@@ -4102,6 +4127,10 @@ void AliAnalysisTaskGammaConvCalo::ProcessPhotonCandidates()
   Int_t nV0 = 0;
   TList *GammaCandidatesStepOne = new TList();
   TList *GammaCandidatesStepTwo = new TList();
+  // decisions of the photon cut group of this cut set (0: not evaluated, 1: selected, 2: rejected).
+  // Cut sets with photon cut QA histograms evaluate every photon themselves to fill them
+  UChar_t *lGroupSelection = fSharePhotonSelection ? fPhotonSelection.data()+fPhotonCutGroup[fiCut]*fReaderGammas->GetEntriesFast() : NULL;
+  Bool_t lReuseSelection = fSharePhotonSelection && !((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetCutHistograms();
   // Loop over Photon Candidates allocated by ReaderV1
   for(Int_t i = 0; i < fReaderGammas->GetEntriesFast(); i++){
     AliAODConversionPhoton* PhotonCandidate = (AliAODConversionPhoton*) fReaderGammas->At(i);
@@ -4122,7 +4151,12 @@ void AliAnalysisTaskGammaConvCalo::ProcessPhotonCandidates()
       if( (isNegFromMBHeader+isPosFromMBHeader) != 4) fIsFromDesiredHeader = kFALSE;
     }
 
-    if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent)) continue;
+    if(lGroupSelection){
+      // reuse the decision of a previous cut set with the same photon cut string
+      if(!lGroupSelection[i] || !lReuseSelection)
+        lGroupSelection[i] = ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent) ? 1 : 2;
+      if(lGroupSelection[i] != 1) continue;
+    } else if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->InPlaneOutOfPlaneCut(PhotonCandidate->GetPhotonPhi(),fEventPlaneAngle)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseElecSharingCut() &&
     !((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseToCloseV0sCut()){
@@ -85,6 +85,9 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     void SetAllowOverlapHeaders         ( Bool_t allowOverlapHeader )                       { fAllowOverlapHeaders = allowOverlapHeader   ;}
     void SetDoMaterialBudgetWeightingOfGammasForTrueMesons(Bool_t flag)                     { fDoMaterialBudgetWeightingOfGammasForTrueMesons = flag;}
     void SetDoHBTHistoOutput            ( Bool_t flag )                                     { fDoHBTHistoOutput = flag                    ;}
+    // evaluate the photon selection only once per photon for cut sets with identical photon cut string.
+    // Cut sets with photon cut QA histograms (light output < 2) still evaluate it to fill them
+    void SetSharePhotonSelection        ( Bool_t flag )                                     { fSharePhotonSelection = flag                ;}
 
     // Setting the cut lists for the conversion photons
     void SetEventCutList                ( Int_t nCuts,
@@ -598,12 +601,16 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     Bool_t                  fAllowOverlapHeaders;                               // enable overlapping headers for cluster selection
     Int_t                   fTrackMatcherRunningMode;                           // CaloTrackMatcher running mode
     Bool_t                  fDoHBTHistoOutput;                                  // switch for additional HBT output
+    Bool_t                  fSharePhotonSelection;                              // share the photon selection among cut sets with the same photon cut string
+    std::vector<Int_t>      fPhotonCutGroup;                                    //! per cut set: group of cut sets with the same photon cut string
+    Int_t                   fNPhotonCutGroups;                                  //! number of photon cut groups
+    std::vector<UChar_t>    fPhotonSelection;                                   //! per group and reconstructed photon: 0 not evaluated, 1 selected, 2 rejected
 
   private:
     AliAnalysisTaskGammaConvCalo(const AliAnalysisTaskGammaConvCalo&); // Prevent copy-construction
     AliAnalysisTaskGammaConvCalo &operator=(const AliAnalysisTaskGammaConvCalo&); // Prevent assignment
 
-    ClassDef(AliAnalysisTaskGammaConvCalo, 67);
+    ClassDef(AliAnalysisTaskGammaConvCalo, 68);
 };
 
 #endif
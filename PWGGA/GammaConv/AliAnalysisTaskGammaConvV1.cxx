@@ -357,7 +357,11 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(): AliAnalysisTaskSE(),
   fFileNameBroken(NULL),
   fFileWasAlreadyReported(kFALSE),
   fAODMCTrackArray(NULL),
-  fMapPhotonHeaders()
+  fMapPhotonHeaders(),
+  fSharePhotonSelection(kFALSE),
+  fPhotonCutGroup(),
+  fNPhotonCutGroups(0),
+  fPhotonSelection()
 {
 
 }
@@ -660,7 +664,11 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(const char *name):
   fFileNameBroken(NULL),
   fFileWasAlreadyReported(kFALSE),
   fAODMCTrackArray(NULL),
-  fMapPhotonHeaders()
+  fMapPhotonHeaders(),
+  fSharePhotonSelection(kFALSE),
+  fPhotonCutGroup(),
+  fNPhotonCutGroups(0),
+  fPhotonSelection()
 {
   // Define output slots here
   DefineOutput(1, TList::Class());
@@ -787,6 +795,22 @@ void AliAnalysisTaskGammaConvV1::UserCreateOutputObjects(){
   fV0Reader=(AliV0ReaderV1*)AliAnalysisManager::GetAnalysisManager()->GetTask(fV0ReaderName.Data());
   if(!fV0Reader){printf("Error: No V0 Reader");return;} // GetV0Reader
 
+  // cut sets with identical photon cut string form a group sharing the result of PhotonIsSelected
+  fPhotonCutGroup.assign(fnCuts,-1);
+  fNPhotonCutGroups = 0;
+  if(fSharePhotonSelection){
+    for(Int_t iCut = 0; iCut<fnCuts;iCut++){
+      TString cutstringPhoton = ((AliConversionPhotonCuts*)fCutArray->At(iCut))->GetCutNumber();
+      for(Int_t jCut = 0; jCut<iCut;jCut++){
+        if(cutstringPhoton.CompareTo(((AliConversionPhotonCuts*)fCutArray->At(jCut))->GetCutNumber()) == 0){
+          fPhotonCutGroup[iCut] = fPhotonCutGroup[jCut];
+          break;
+        }
+      }
+      if(fPhotonCutGroup[iCut] < 0) fPhotonCutGroup[iCut] = fNPhotonCutGroups++;
+    }
+  }
+
 
   if( ((AliConversionPhotonCuts*)fCutArray->At(0))->GetUseBDTPhotonCuts()){
       fEnableBDT  = kTRUE;
@@ -2343,6 +2367,7 @@ void AliAnalysisTaskGammaConvV1::UserExec(Option_t *)
   }
 
   fReaderGammas = fV0Reader->GetReconstructedGammas(); // Gammas from default Cut
+  if(fSharePhotonSelection) fPhotonSelection.assign(fNPhotonCutGroups*fReaderGammas->GetEntriesFast(),0);
 
   // ------------------- BeginEvent ----------------------------
 
@@ -2625,9 +2650,16 @@ void AliAnalysisTaskGammaConvV1::ProcessPhotonCandidates()
   Bool_t lUseElecShareCut = fiPhotonCut->UseElecSharingCut();
   Bool_t lUseTooCloseCut  = fiPhotonCut->UseToCloseV0sCut();
 
+  // decisions of the photon cut group of this cut set (0: not evaluated, 1: selected, 2: rejected).
+  // Cut sets with photon cut QA histograms evaluate every photon themselves to fill them
+  UChar_t *lGroupSelection = fSharePhotonSelection ? fPhotonSelection.data()+fPhotonCutGroup[fiCut]*fReaderGammas->GetEntriesFast() : NULL;
+  Bool_t lReuseSelection = fSharePhotonSelection && !fiPhotonCut->GetCutHistograms();
+
   // Loop over Photon Candidates allocated by ReaderV1
-  for (TObject *iObj : *fReaderGammas){
+  for (Int_t iGamma = 0; iGamma < fReaderGammas->GetEntriesFast(); iGamma++){
 
+    TObject *iObj = fReaderGammas->At(iGamma);
+    if (!iObj) continue;
     AliAODConversionPhoton *iCandidate = dynamic_cast<AliAODConversionPhoton*>(iObj);
     if (!iCandidate) { AliWarning("Non AliAODConversionPhoton type object in fReaderGammas.\n"); continue; }
 
@@ -2636,7 +2668,12 @@ void AliAnalysisTaskGammaConvV1::ProcessPhotonCandidates()
       if (!fiEventCut->PhotonPassesAddedParticlesCriterion(fMCEvent, fInputEvent, *iCandidate, lIsFromSelectedHeader)) continue;
     }
 
-    if(!fiPhotonCut->PhotonIsSelected(iCandidate,fInputEvent)) continue;
+    if(lGroupSelection){
+      // reuse the decision of a previous cut set with the same photon cut string
+      if(!lGroupSelection[iGamma] || !lReuseSelection)
+        lGroupSelection[iGamma] = fiPhotonCut->PhotonIsSelected(iCandidate,fInputEvent) ? 1 : 2;
+      if(lGroupSelection[iGamma] != 1) continue;
+    } else if(!fiPhotonCut->PhotonIsSelected(iCandidate,fInputEvent)) continue;
     if(!fiPhotonCut->InPlaneOutOfPlaneCut(iCandidate->GetPhotonPhi(),fEventPlaneAngle)) continue;
 
     // if no further cuts, add to fGammaCandidates and we are done. If header criterion is fullfilled, also fill histos and tree
@@ -77,6 +77,9 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
                                                                   fClusterCutArray              = CutArray  ;}
 
     void SetDoMaterialBudgetWeightingOfGammasForTrueMesons(Bool_t flag) {fDoMaterialBudgetWeightingOfGammasForTrueMesons = flag;}
+    // evaluate the photon selection only once per photon for cut sets with identical photon cut string.
+    // Cut sets with photon cut QA histograms (light output < 2) still evaluate it to fill them
+    void SetSharePhotonSelection(Bool_t flag)                     { fSharePhotonSelection       = flag    ;}
 
     // BG HandlerSettings
     void SetMoveParticleAccordingToVertex(Bool_t flag)            {fMoveParticleAccordingToVertex = flag;}
@@ -409,12 +412,16 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     TClonesArray*                     fAODMCTrackArray;                           //! pointer to track array
 
     AliConversionPhotonCuts::TMapPhotonBool fMapPhotonHeaders;                   // map to remember if the photon tracks are from selected headers
+    Bool_t                            fSharePhotonSelection;                      // share the photon selection among cut sets with the same photon cut string
+    std::vector<Int_t>                fPhotonCutGroup;                            //! per cut set: group of cut sets with the same photon cut string
+    Int_t                             fNPhotonCutGroups;                          //! number of photon cut groups
+    std::vector<UChar_t>              fPhotonSelection;                           //! per group and reconstructed photon: 0 not evaluated, 1 selected, 2 rejected
 
   private:
 
     AliAnalysisTaskGammaConvV1(const AliAnalysisTaskGammaConvV1&); // Prevent copy-construction
     AliAnalysisTaskGammaConvV1 &operator=(const AliAnalysisTaskGammaConvV1&); // Prevent assignment
-    ClassDef(AliAnalysisTaskGammaConvV1, 53);
+    ClassDef(AliAnalysisTaskGammaConvV1, 54);
 };
 
 #endif
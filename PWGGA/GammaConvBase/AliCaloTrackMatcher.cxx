@@ -35,7 +35,9 @@
 #include "TChain.h"
 #include "TH1F.h"
 #include "TF1.h"
+#include "TVector2.h"
 
+#include <algorithm>
 #include <vector>
 #include <map>
 #include <utility>
@@ -60,22 +62,50 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, In
   fGeomEMCAL(NULL),
   fGeomPHOS(NULL),
   fArrClusters(NULL),
-  fMapTrackToCluster(),
-  fMapClusterToTrack(),
-  fNEntries(1),
-  fVectorDeltaEtaDeltaPhi(0),
-  fMap_TrID_ClID_ToIndex(),
-  fSecMapTrackToCluster(),
-  fSecMapClusterToTrack(),
-  fSecNEntries(1),
-  fSecVectorDeltaEtaDeltaPhi(0),
-  fSecMap_TrID_ClID_ToIndex(),
-  fSecMap_TrID_ClID_AlreadyTried(),
+  fMatchTrackPos(),
+  fMatchTrackID(),
+  fMatchClusterID(),
+  fMatchDEta(),
+  fMatchDPhi(),
+  fClusterHead(),
+  fClusterTail(),
+  fClusterNext(),
+  fTrackHead(),
+  fTrackTail(),
+  fTrackNext(),
+  fGridCluster(),
+  fGridEta(),
+  fGridPhi(),
+  fGridCellOffset(),
+  fGridCellCluster(),
+  fGridCandidates(),
+  fGridNEta(0),
+  fGridNPhi(0),
+  fGridCellSize(0),
+  fSecMatchTrackPos(),
+  fSecMatchTrackID(),
+  fSecMatchClusterID(),
+  fSecMatchDEta(),
+  fSecMatchDPhi(),
+  fSecMatchStatus(),
+  fSecClusterHead(),
+  fSecClusterTail(),
+  fSecClusterNext(),
+  fSecTrackHead(),
+  fSecTrackTail(),
+  fSecTrackNext(),
+  fSecNClusterSlots(0),
+  fSecTrackSlot(),
+  fSecPairIndex(),
+  fSecSurfaceStatus(),
+  fSecSurfaceEtaPhi(),
+  fSecSurfaceParam(),
   fListHistos(NULL),
   fHistControlMatches(NULL),
   fSecHistControlMatches(NULL),
   fDoLightOutput(kFALSE),
-  fMassHypothesis(0.139)
+  fMassHypothesis(0.139),
+  fEtaPhiPreselectionMargin(0.1)
 {
     // Default constructor
     DefineInput(0, TChain::Class());
@@ -87,16 +117,7 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, In
 //________________________________________________________________________
 AliCaloTrackMatcher::~AliCaloTrackMatcher(){
     // default deconstructor
-    fMapTrackToCluster.clear();
-    fMapClusterToTrack.clear();
-    fVectorDeltaEtaDeltaPhi.clear();
-    fMap_TrID_ClID_ToIndex.clear();
-
-    fSecMapTrackToCluster.clear();
-    fSecMapClusterToTrack.clear();
-    fSecVectorDeltaEtaDeltaPhi.clear();
-    fSecMap_TrID_ClID_ToIndex.clear();
-    fSecMap_TrID_ClID_AlreadyTried.clear();
+    ResetMatches();
 
     if(fHistControlMatches) delete fHistControlMatches;
     if(fSecHistControlMatches) delete fSecHistControlMatches;
@@ -109,16 +130,7 @@ AliCaloTrackMatcher::~AliCaloTrackMatcher(){
 
 //________________________________________________________________________
 void AliCaloTrackMatcher::Terminate(Option_t *){
-  fMapTrackToCluster.clear();
-  fMapClusterToTrack.clear();
-  fVectorDeltaEtaDeltaPhi.clear();
-  fMap_TrID_ClID_ToIndex.clear();
-
-  fSecMapTrackToCluster.clear();
-  fSecMapClusterToTrack.clear();
-  fSecVectorDeltaEtaDeltaPhi.clear();
-  fSecMap_TrID_ClID_ToIndex.clear();
-  fSecMap_TrID_ClID_AlreadyTried.clear();
+  ResetMatches();
 }
 
 //________________________________________________________________________
@@ -168,18 +180,7 @@ void AliCaloTrackMatcher::UserCreateOutputObjects(){
 //________________________________________________________________________
 void AliCaloTrackMatcher::Initialize(Int_t runNumber){
   // Initialize function to be called once before analysis
-  fMapTrackToCluster.clear();
-  fMapClusterToTrack.clear();
-  fNEntries = 1;
-  fVectorDeltaEtaDeltaPhi.clear();
-  fMap_TrID_ClID_ToIndex.clear();
-
-  fSecMapTrackToCluster.clear();
-  fSecMapClusterToTrack.clear();
-  fSecNEntries = 1;
-  fSecVectorDeltaEtaDeltaPhi.clear();
-  fSecMap_TrID_ClID_ToIndex.clear();
-  fSecMap_TrID_ClID_AlreadyTried.clear();
+  ResetMatches();
 
   if(fRunNumber == -1 || fRunNumber != runNumber){
     if(fClusterType == 1 || fClusterType == 3 || fClusterType == 4){
@@ -193,6 +194,195 @@ void AliCaloTrackMatcher::Initialize(Int_t runNumber){
   }
 }
 
+//________________________________________________________________________
+void AliCaloTrackMatcher::ResetMatches(){
+  // clear the match store of the previous event, the vectors keep their memory
+  fMatchTrackPos.clear();
+  fMatchTrackID.clear();
+  fMatchClusterID.clear();
+  fMatchDEta.clear();
+  fMatchDPhi.clear();
+  fClusterHead.clear();
+  fClusterTail.clear();
+  fClusterNext.clear();
+  fTrackHead.clear();
+  fTrackTail.clear();
+  fTrackNext.clear();
+
+  fSecMatchTrackPos.clear();
+  fSecMatchTrackID.clear();
+  fSecMatchClusterID.clear();
+  fSecMatchDEta.clear();
+  fSecMatchDPhi.clear();
+  fSecMatchStatus.clear();
+  fSecClusterHead.clear();
+  fSecClusterTail.clear();
+  fSecClusterNext.clear();
+  fSecTrackHead.clear();
+  fSecTrackTail.clear();
+  fSecTrackNext.clear();
+  fSecNClusterSlots = 0;
+  fSecTrackSlot.clear();
+  fSecPairIndex.clear();
+  fSecSurfaceStatus.clear();
+  fSecSurfaceEtaPhi.clear();
+  fSecSurfaceParam.clear();
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::LinkEntry(vector<Int_t> &head, vector<Int_t> &tail, vector<Int_t> &next, Int_t key, Int_t entry){
+  // append entry to the list of key, lists are kept in insertion order
+  if(key < 0) return;
+  if(key >= (Int_t)head.size()){
+    head.resize(key+1,-1);
+    tail.resize(key+1,-1);
+  }
+  if(head[key] < 0) head[key] = entry;
+  else next[tail[key]] = entry;
+  tail[key] = entry;
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::AddMatch(Int_t trackPos, Int_t trackID, Int_t clusterID, Float_t dEta, Float_t dPhi){
+  Int_t entry = fMatchTrackPos.size();
+  fMatchTrackPos.push_back(trackPos);
+  fMatchTrackID.push_back(trackID);
+  fMatchClusterID.push_back(clusterID);
+  fMatchDEta.push_back(dEta);
+  fMatchDPhi.push_back(dPhi);
+  fClusterNext.push_back(-1);
+  fTrackNext.push_back(-1);
+  LinkEntry(fClusterHead,fClusterTail,fClusterNext,clusterID,entry);
+  LinkEntry(fTrackHead,fTrackTail,fTrackNext,trackPos,entry);
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetSecTrackSlot(Int_t trackID, Bool_t create){
+  // slot of a V0-track in the per-track tables, -1 if not available
+  if(trackID < 0) return -1;
+  if(trackID < (Int_t)fSecTrackSlot.size() && fSecTrackSlot[trackID] >= 0) return fSecTrackSlot[trackID];
+  if(!create) return -1;
+  if(trackID >= (Int_t)fSecTrackSlot.size()) fSecTrackSlot.resize(trackID+1,-1);
+  Int_t slot = fSecSurfaceStatus.size();
+  fSecTrackSlot[trackID] = slot;
+  fSecSurfaceStatus.push_back(-1);
+  fSecSurfaceEtaPhi.resize(2*(slot+1),0.);
+  fSecSurfaceParam.resize(22*(slot+1),0.);
+  fSecPairIndex.resize((slot+1)*fSecNClusterSlots,-1);
+  return slot;
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::FindSecEntry(Int_t trackID, Int_t clusterID){
+  // entry of a V0-track/cluster pair which was already tried, -1 if none
+  if(trackID >= 0 && clusterID >= 0 && clusterID < fSecNClusterSlots){
+    Int_t slot = GetSecTrackSlot(trackID,kFALSE);
+    return slot < 0 ? -1 : fSecPairIndex[slot*fSecNClusterSlots+clusterID];
+  }
+  for(Int_t i = (Int_t)fSecMatchTrackID.size()-1; i >= 0; i--)
+    if(fSecMatchTrackID[i] == trackID && fSecMatchClusterID[i] == clusterID) return i;
+  return -1;
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::AddSecEntry(Int_t trackPos, Int_t trackID, Int_t clusterID, Float_t dEta, Float_t dPhi, Bool_t matched){
+  Int_t entry = fSecMatchTrackID.size();
+  fSecMatchTrackPos.push_back(trackPos);
+  fSecMatchTrackID.push_back(trackID);
+  fSecMatchClusterID.push_back(clusterID);
+  fSecMatchDEta.push_back(dEta);
+  fSecMatchDPhi.push_back(dPhi);
+  fSecMatchStatus.push_back(matched ? 1 : 0);
+  fSecClusterNext.push_back(-1);
+  fSecTrackNext.push_back(-1);
+  if(matched){
+    LinkEntry(fSecClusterHead,fSecClusterTail,fSecClusterNext,clusterID,entry);
+    LinkEntry(fSecTrackHead,fSecTrackTail,fSecTrackNext,trackPos,entry);
+  }
+  if(trackID >= 0 && clusterID >= 0 && clusterID < fSecNClusterSlots){
+    Int_t slot = GetSecTrackSlot(trackID,kTRUE);
+    fSecPairIndex[slot*fSecNClusterSlots+clusterID] = entry;
+  }
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::FillClusterGrid(AliVEvent *event, Int_t nClus){
+  // collect the clusters of the event once and sort them into eta-phi cells
+  // at least as large as the preselection window, so that only the clusters
+  // in the 3x3 cells around a track need to be considered
+  const Float_t kGridEtaMax = 1.;
+  fGridCluster.clear();
+  fGridEta.clear();
+  fGridPhi.clear();
+  for(Int_t iclus=0;iclus < nClus;iclus++){
+    AliVCluster* cluster = NULL;
+    if(fArrClusters) cluster = (AliVCluster*)fArrClusters->At(iclus);
+    else cluster = event->GetCaloCluster(iclus);
+    if(!cluster) continue;
+    if((fClusterType == 1 || fClusterType == 3 || fClusterType == 4) && !cluster->IsEMCAL()) continue;
+    if(fClusterType == 2 && !cluster->IsPHOS()) continue;
+    Float_t clsPos[3] = {0.,0.,0.};
+    cluster->GetPosition(clsPos);
+    TVector3 clsPosVec(clsPos);
+    Float_t phi = clsPosVec.Phi();
+    if(phi < 0) phi += TMath::TwoPi();
+    fGridCluster.push_back(cluster);
+    fGridEta.push_back(clsPosVec.Eta());
+    fGridPhi.push_back(phi);
+  }
+
+  fGridCellSize = fEtaPhiPreselectionMargin >= 0 ? TMath::Sqrt(fMatchingResidual)+fEtaPhiPreselectionMargin : 0.;
+  if(fGridCellSize <= 0){
+    fGridNEta = 0;
+    fGridNPhi = 0;
+    return;
+  }
+  fGridNEta = TMath::Max(1,(Int_t)(2*kGridEtaMax/fGridCellSize));
+  fGridNPhi = (Int_t)(TMath::TwoPi()/fGridCellSize);
+  if(fGridNPhi < 3) fGridNPhi = 1; // no wrap-around of the neighbouring cells
+
+  Int_t nCells = fGridNEta*fGridNPhi;
+  Int_t nGrid = fGridCluster.size();
+  vector<Int_t> cell(nGrid);
+  fGridCellOffset.assign(nCells+1,0);
+  for(Int_t i=0;i<nGrid;i++){
+    Int_t ieta = TMath::Min(TMath::Max((Int_t)((fGridEta[i]+kGridEtaMax)/(2*kGridEtaMax)*fGridNEta),0),fGridNEta-1);
+    Int_t iphi = TMath::Min((Int_t)(fGridPhi[i]/TMath::TwoPi()*fGridNPhi),fGridNPhi-1);
+    cell[i] = ieta*fGridNPhi+iphi;
+    fGridCellOffset[cell[i]+1]++;
+  }
+  for(Int_t ic=0;ic<nCells;ic++) fGridCellOffset[ic+1] += fGridCellOffset[ic];
+  fGridCellCluster.resize(nGrid);
+  vector<Int_t> fill(fGridCellOffset.begin(),fGridCellOffset.end()-1);
+  for(Int_t i=0;i<nGrid;i++) fGridCellCluster[fill[cell[i]]++] = i;
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::FillCandidateClusters(Bool_t usePosition, Float_t eta, Float_t phi){
+  // clusters of the 3x3 cells around the track position on the calorimeter surface,
+  // in the original cluster order; all clusters if no position or no grid
+  const Float_t kGridEtaMax = 1.;
+  fGridCandidates.clear();
+  Int_t nGrid = fGridCluster.size();
+  if(!usePosition || fGridNEta == 0){
+    for(Int_t i=0;i<nGrid;i++) fGridCandidates.push_back(i);
+    return nGrid;
+  }
+  if(phi < 0) phi += TMath::TwoPi();
+  Int_t ieta = TMath::Min(TMath::Max((Int_t)((eta+kGridEtaMax)/(2*kGridEtaMax)*fGridNEta),0),fGridNEta-1);
+  Int_t iphi = TMath::Min((Int_t)(phi/TMath::TwoPi()*fGridNPhi),fGridNPhi-1);
+  for(Int_t je=TMath::Max(ieta-1,0);je<=TMath::Min(ieta+1,fGridNEta-1);je++){
+    for(Int_t dp=-1;dp<=1;dp++){
+      if(fGridNPhi == 1 && dp != 0) continue;
+      Int_t jp = (iphi+dp+fGridNPhi)%fGridNPhi;
+      Int_t ic = je*fGridNPhi+jp;
+      for(Int_t k=fGridCellOffset[ic];k<fGridCellOffset[ic+1];k++) fGridCandidates.push_back(fGridCellCluster[k]);
+    }
+  }
+  sort(fGridCandidates.begin(),fGridCandidates.end());
+  return fGridCandidates.size();
+}
+
 //________________________________________________________________________
 void AliCaloTrackMatcher::UserExec(Option_t *){
 
@@ -239,6 +429,10 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
       return;
     }
   }
+  // clusters of the event in eta-phi cells, V0-track tables sized to the clusters
+  FillClusterGrid(event,nClus);
+  fSecNClusterSlots = nClus;
+
   static AliESDtrackCuts *EsdTrackCuts = 0x0;
   static int prevRun = -1;
   // Using standard function for setting Cuts
@@ -362,7 +556,8 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
 
     if (!trackParam) {AliError("Could not get TrackParameters, continue"); FillfHistControlMatches(1.,inTrack->Pt()); continue;}
     AliExternalTrackParam emcParam(*trackParam);
-    Float_t eta, phi, pt;
+    Float_t eta = 0, phi = 0, pt = 0;
+    Bool_t hasSurfacePos = kFALSE;
 
     //propagate tracks to emc surfaces
     if(fClusterType == 1 || fClusterType == 3 || fClusterType == 4){
@@ -371,6 +566,7 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
         FillfHistControlMatches(2.,inTrack->Pt());
         continue;
       }
+      hasSurfacePos = kTRUE;
       if( TMath::Abs(eta) > 0.75 ) {
         delete trackParam;
         FillfHistControlMatches(3.,inTrack->Pt());
@@ -420,6 +616,9 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
           FillfHistControlMatches(3.,inTrack->Pt());
           continue;
         }
+        hasSurfacePos = kTRUE;
+        eta = trkPosVec.Eta();
+        phi = trkPosVec.Phi();
       }
     }
 
@@ -435,52 +634,31 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
     // cout << inTrack->GetID() << " - " << trackParam << endl;
     // cout << "eta/phi: " << eta << ", " << phi << endl;
     // cout << "nClus: " << nClus << endl;
+    // only clusters close in eta-phi to the track on the calorimeter surface are propagated to
+    Int_t nCandidates = FillCandidateClusters(hasSurfacePos,eta,phi);
     Int_t nClusterMatchesToTrack = 0;
-    for(Int_t iclus=0;iclus < nClus;iclus++){
-      AliVCluster* cluster = NULL;
-      if(fArrClusters){
-        if(esdev){
-          if(fArrClusters)
-            cluster = new AliESDCaloCluster(*(AliESDCaloCluster*)fArrClusters->At(iclus));
-        } else if(aodev){
-          if(fArrClusters)
-            cluster = new AliAODCaloCluster(*(AliAODCaloCluster*)fArrClusters->At(iclus));
-        }
-      }
-      else
-        cluster = event->GetCaloCluster(iclus);
-      if (!cluster){
-        if(fArrClusters) delete cluster;
-        continue;
+    for(Int_t icand=0;icand < nCandidates;icand++){
+      Int_t igrid = fGridCandidates[icand];
+      if(hasSurfacePos && fGridNEta > 0){
+        if(TMath::Abs(fGridEta[igrid]-eta) > fGridCellSize) continue;
+        if(TMath::Abs(TVector2::Phi_mpi_pi(fGridPhi[igrid]-phi)) > fGridCellSize) continue;
       }
-      // cout << "-------------------------LOOPING: " << iclus << ", " << cluster->GetID() << endl;
+      AliVCluster* cluster = fGridCluster[igrid];
+      // cout << "-------------------------LOOPING: " << igrid << ", " << cluster->GetID() << endl;
       cluster->GetPosition(clsPos);
       Double_t dR = TMath::Sqrt(TMath::Power(exPos[0]-clsPos[0],2)+TMath::Power(exPos[1]-clsPos[1],2)+TMath::Power(exPos[2]-clsPos[2],2));
       //cout << "dR: " << dR << endl;
-      if (dR > fMatchingWindow){
-        if(fArrClusters) delete cluster;
-        continue;
-      }
+      if (dR > fMatchingWindow) continue;
       Double_t clusterR = TMath::Sqrt( clsPos[0]*clsPos[0] + clsPos[1]*clsPos[1] );
       AliExternalTrackParam trackParamTmp(emcParam);//Retrieve the starting point every time before the extrapolation
       if(fClusterType == 1 || fClusterType == 3 || fClusterType == 4){
-        if (!cluster->IsEMCAL()){
-          if(fArrClusters) delete cluster;
-          continue;
-        }
         if(!AliEMCALRecoUtils::ExtrapolateTrackToCluster(&trackParamTmp, cluster, fMassHypothesis, 5., dEta, dPhi)){
           FillfHistControlMatches(4.,inTrack->Pt());
-          if(fArrClusters) delete cluster;
           continue;
         }
       }else if(fClusterType == 2){
-        if (!cluster->IsPHOS()){
-          if(fArrClusters) delete cluster;
-          continue;
-        }
         if(!AliTrackerBase::PropagateTrackToBxByBz(&trackParamTmp, clusterR, fMassHypothesis, 5., kTRUE, 0.8, -1)){
           FillfHistControlMatches(4.,inTrack->Pt());
-          if(fArrClusters) delete cluster;
           continue;
         }
         Double_t trkPos[3] = {0,0,0};
@@ -494,22 +672,10 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
       Float_t dR2 = dPhi*dPhi + dEta*dEta;
 
       //cout << dEta << " - " << dPhi << " - " << dR2 << endl;
-      if(dR2 > fMatchingResidual){
-        if(fArrClusters) delete cluster;
-        continue;
-      }
+      if(dR2 > fMatchingResidual) continue;
       nClusterMatchesToTrack++;
-      if(aodev){
-        fMapTrackToCluster.insert(make_pair(itr,cluster->GetID()));
-        fMapClusterToTrack.insert(make_pair(cluster->GetID(),itr));
-      }else{
-        fMapTrackToCluster.insert(make_pair(inTrack->GetID(),cluster->GetID()));
-        fMapClusterToTrack.insert(make_pair(cluster->GetID(),inTrack->GetID()));
-      }
-      fVectorDeltaEtaDeltaPhi.push_back(make_pair(dEta,dPhi));
-      fMap_TrID_ClID_ToIndex[make_pair(inTrack->GetID(),cluster->GetID())] = fNEntries++;
-      if( (Int_t)fVectorDeltaEtaDeltaPhi.size() != (fNEntries-1)) AliFatal("Fatal error in AliCaloTrackMatcher, vector and map are not in sync!");
-      if(fArrClusters) delete cluster;
+      if(aodev) AddMatch(itr,inTrack->GetID(),cluster->GetID(),dEta,dPhi);
+      else AddMatch(inTrack->GetID(),inTrack->GetID(),cluster->GetID(),dEta,dPhi);
     }
     if(nClusterMatchesToTrack == 0) FillfHistControlMatches(5.,inTrack->Pt());
     else FillfHistControlMatches(6.,inTrack->Pt());
@@ -561,7 +727,7 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
 
   if (inSecTrack->Pt() < 0.3 ) {
     FillfSecHistControlMatches(1.,inSecTrack->Pt());
-    fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+    AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
     return kFALSE;
   }
 
@@ -571,7 +737,7 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
     aodt = dynamic_cast<AliAODTrack*>(inSecTrack);
     if (!aodt){
       AliError("Track is neither ESD nor AOD, continue");
-      fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+      AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
       return kFALSE;
     }
   }
@@ -582,7 +748,7 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
     if (!in){
       AliDebug(2, "Could not get InnerParam of Track, continue");
       FillfSecHistControlMatches(1.,inSecTrack->Pt());
-      fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+      AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
       return kFALSE;
     }
     trackParam = new AliExternalTrackParam(*in);
@@ -591,42 +757,42 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
     if (fClusterType == 1 || fClusterType == 3 || fClusterType == 4){
       if (TMath::Abs(aodt->GetTrackEtaOnEMCal()) > 0.8){
         FillfSecHistControlMatches(1.,inSecTrack->Pt());
-        fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+        AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
         return kFALSE;
       }
       if( nModules < 13 ){
         if (( aodt->GetTrackPhiOnEMCal() < 60*TMath::DegToRad() || aodt->GetTrackPhiOnEMCal() > 200*TMath::DegToRad())){
           FillfSecHistControlMatches(1.,inSecTrack->Pt());
-          fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+          AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
           return kFALSE;
         }
       } else if( nModules > 12 ){
         if (fClusterType == 3 && ( aodt->GetTrackPhiOnEMCal() < 250*TMath::DegToRad() || aodt->GetTrackPhiOnEMCal() > 340*TMath::DegToRad())){
           FillfSecHistControlMatches(1.,inSecTrack->Pt());
-          fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+          AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
           return kFALSE;
         }
         if( fClusterType == 1 && ( aodt->GetTrackPhiOnEMCal() < 60*TMath::DegToRad() || aodt->GetTrackPhiOnEMCal() > 200*TMath::DegToRad())){
           FillfSecHistControlMatches(1.,inSecTrack->Pt());
-          fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+          AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
           return kFALSE;
         }
         if( fClusterType == 4 && ( aodt->GetTrackPhiOnEMCal() < 60*TMath::DegToRad() || aodt->GetTrackPhiOnEMCal() > 200*TMath::DegToRad())
                               && ( aodt->GetTrackPhiOnEMCal() < 250*TMath::DegToRad() || aodt->GetTrackPhiOnEMCal() > 340*TMath::DegToRad()) ){
           FillfSecHistControlMatches(1.,inSecTrack->Pt());
-          fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+          AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
           return kFALSE;
         }
       }
     } else {
       if ( aodt->Phi() < 230*TMath::DegToRad() || aodt->Phi() > 350*TMath::DegToRad()){
         FillfSecHistControlMatches(1.,inSecTrack->Pt());
-        fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+        AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
         return kFALSE;
       }
       if (TMath::Abs(aodt->Eta()) > 0.3 ){
         FillfSecHistControlMatches(1.,inSecTrack->Pt());
-        fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+        AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
         return kFALSE;
       }
     }
@@ -640,7 +806,7 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
   if(!trackParam){
     AliError("Could not get TrackParameters, continue");
     FillfSecHistControlMatches(1.,inSecTrack->Pt());
-    fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+    AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
     return kFALSE;
   }
 
@@ -650,34 +816,58 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
   Float_t dEtaTemp = 0;
 
   if(cluster->IsEMCAL()){
-    Float_t eta = 0;Float_t phi = 0;Float_t pt = 0;
-    propagated = AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(&emcParam, 430, 0.000510999, 20, eta, phi, pt);
-    if(propagated){
-      if( TMath::Abs(eta) > 0.8 ) {
-        delete trackParam;
-        FillfSecHistControlMatches(3.,inSecTrack->Pt());
-        fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
-        return kFALSE;
-      }
+    // the propagation to the EMCal surface does not depend on the cluster: it is done
+    // once per V0-track and event, later calls start from the stored surface parameters
+    Int_t slot = GetSecTrackSlot(inSecTrack->GetID(),kTRUE);
+    Int_t status = slot >= 0 ? fSecSurfaceStatus[slot] : -1;
+    Float_t eta = 0;Float_t phi = 0;
+    if(status < 0){
+      Float_t pt = 0;
+      status = 0;
+      if(!AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(&emcParam, 430, 0.000510999, 20, eta, phi, pt)) status = 2;
+      else if( TMath::Abs(eta) > 0.8 ) status = 3;
       // Save some time and memory in case of no DCal present
-      if( nModules < 13 && ( phi < 60*TMath::DegToRad() || phi > 200*TMath::DegToRad())){
-        delete trackParam;
-        FillfSecHistControlMatches(3.,inSecTrack->Pt());
-        fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
-        return kFALSE;
+      else if( nModules < 13 && ( phi < 60*TMath::DegToRad() || phi > 200*TMath::DegToRad())) status = 3;
+      if(slot >= 0){
+        fSecSurfaceStatus[slot] = status;
+        fSecSurfaceEtaPhi[2*slot] = eta;
+        fSecSurfaceEtaPhi[2*slot+1] = phi;
+        Double_t *surface = &fSecSurfaceParam[22*slot];
+        surface[0] = emcParam.GetX();
+        surface[1] = emcParam.GetAlpha();
+        for(Int_t i=0;i<5;i++) surface[2+i] = emcParam.GetParameter()[i];
+        for(Int_t i=0;i<15;i++) surface[7+i] = emcParam.GetCovariance()[i];
       }
+    }else{
+      eta = fSecSurfaceEtaPhi[2*slot];
+      phi = fSecSurfaceEtaPhi[2*slot+1];
+      const Double_t *surface = &fSecSurfaceParam[22*slot];
+      emcParam.Set(surface[0],surface[1],surface+2,surface+7);
+    }
+    if(status > 0){
+      delete trackParam;
+      FillfSecHistControlMatches(status,inSecTrack->Pt());
+      AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
+      return kFALSE;
+    }
 
-      propagated = AliEMCALRecoUtils::ExtrapolateTrackToCluster(&emcParam, cluster, 0.000510999, 5, dEtaTemp, dPhiTemp);
-      if(!propagated){
+    // clusters far away in eta-phi from the track on the surface cannot match
+    if(fEtaPhiPreselectionMargin >= 0){
+      Float_t window = TMath::Sqrt(fMatchingResidual)+fEtaPhiPreselectionMargin;
+      TVector3 clsPosVec(clusterPosition);
+      if( TMath::Abs(clsPosVec.Eta()-eta) > window || TMath::Abs(TVector2::Phi_mpi_pi(clsPosVec.Phi()-phi)) > window ){
         delete trackParam;
-        FillfSecHistControlMatches(4.,inSecTrack->Pt());
-        fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+        FillfSecHistControlMatches(5.,inSecTrack->Pt());
+        AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
         return kFALSE;
       }
-    }else{
+    }
+
+    propagated = AliEMCALRecoUtils::ExtrapolateTrackToCluster(&emcParam, cluster, 0.000510999, 5, dEtaTemp, dPhiTemp);
+    if(!propagated){
       delete trackParam;
-      FillfSecHistControlMatches(2.,inSecTrack->Pt());
-      fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+      FillfSecHistControlMatches(4.,inSecTrack->Pt());
+      AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
       return kFALSE;
     }
 
@@ -693,7 +883,7 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
     }else{
       delete trackParam;
       FillfSecHistControlMatches(2.,inSecTrack->Pt());
-      fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+      AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
       return kFALSE;}
   }
 
@@ -702,7 +892,7 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
     //cout << dEtaTemp << " - " << dPhiTemp << " - " << dR2 << endl;
     if(dR2 > fMatchingResidual){
       FillfSecHistControlMatches(5.,inSecTrack->Pt());
-      fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+      AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
       //cout << "NO MATCH! - " << inSecTrack->GetID() << "/" << cluster->GetID() << endl;
       delete trackParam;
       return kFALSE;
@@ -720,15 +910,10 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
         }
       }
       if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: PropagateV0TrackToClusterAndGetMatchingResidual - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",inSecTrack->GetID()));
-      fSecMapTrackToCluster.insert(make_pair(TrackPos,cluster->GetID()));
-      fSecMapClusterToTrack.insert(make_pair(cluster->GetID(),TrackPos));
+      AddSecEntry(TrackPos,inSecTrack->GetID(),cluster->GetID(),dEtaTemp,dPhiTemp,kTRUE);
     }else{
-      fSecMapTrackToCluster.insert(make_pair(inSecTrack->GetID(),cluster->GetID()));
-      fSecMapClusterToTrack.insert(make_pair(cluster->GetID(),inSecTrack->GetID()));
+      AddSecEntry(inSecTrack->GetID(),inSecTrack->GetID(),cluster->GetID(),dEtaTemp,dPhiTemp,kTRUE);
     }
-    fSecVectorDeltaEtaDeltaPhi.push_back(make_pair(dEtaTemp,dPhiTemp));
-    fSecMap_TrID_ClID_ToIndex[make_pair(inSecTrack->GetID(),cluster->GetID())] = fSecNEntries++;
-    if( (Int_t)fSecVectorDeltaEtaDeltaPhi.size() != (fSecNEntries-1)) AliFatal("Fatal error in AliCaloTrackMatcher, vector and map are not in sync!");
 
     FillfSecHistControlMatches(6.,inSecTrack->Pt());
     dEta = dEtaTemp;
@@ -737,7 +922,7 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
     return kTRUE;
   }else AliFatal("Fatal error in AliCaloTrackMatcher, track is labeled as sucessfully propagated although this should be impossible!");
 
-  fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+  AddSecEntry(-1,inSecTrack->GetID(),cluster->GetID(),0.,0.,kFALSE);
   delete trackParam;
   return kFALSE;
 }
@@ -748,31 +933,30 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
 //________________________________________________________________________
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::GetTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi){
-  Int_t position = fMap_TrID_ClID_ToIndex[make_pair(trackID,clusterID)];
-  if(position == 0) return kFALSE;
-
-  pairFloat tempEtaPhi = fVectorDeltaEtaDeltaPhi.at(position-1);
-  dEta = tempEtaPhi.first;
-  dPhi = tempEtaPhi.second;
+  // only a few tracks are matched to a cluster: walk the entries of the cluster, latest match wins
+  Int_t position = -1;
+  for(Int_t iEntry = GetFirstEntry(fClusterHead,clusterID); iEntry >= 0; iEntry = fClusterNext[iEntry])
+    if(fMatchTrackID[iEntry] == trackID) position = iEntry;
+  if(position < 0) return kFALSE;
+
+  dEta = fMatchDEta[position];
+  dPhi = fMatchDPhi[position];
   return kTRUE;
 }
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
+  for (Int_t iEntry = GetFirstEntry(fClusterHead,clusterID); iEntry >= 0; iEntry = fClusterNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fMatchTrackPos[iEntry]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
       }
     }
   }
@@ -783,23 +967,20 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )matched++;
-      }
+  for (Int_t iEntry = GetFirstEntry(fClusterHead,clusterID); iEntry >= 0; iEntry = fClusterNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fMatchTrackPos[iEntry]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )matched++;
     }
   }
   return matched;
@@ -808,15 +989,12 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  for (Int_t iEntry = GetFirstEntry(fClusterHead,clusterID); iEntry >= 0; iEntry = fClusterNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fMatchTrackPos[iEntry]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
     }
   }
   return matched;
@@ -838,20 +1016,17 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
   }else TrackPos = trackID; // for ESD just take trackID
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
+  for (Int_t iEntry = GetFirstEntry(fTrackHead,TrackPos); iEntry >= 0; iEntry = fTrackNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),fMatchClusterID[iEntry],tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
       }
     }
   }
@@ -873,24 +1048,21 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
   }else TrackPos = trackID; // for ESD just take trackID
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
+  for (Int_t iEntry = GetFirstEntry(fTrackHead,TrackPos); iEntry >= 0; iEntry = fTrackNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),fMatchClusterID[iEntry],tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
 
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
 
-        if (match_dPhi && match_dEta )matched++;
+      if (match_dPhi && match_dEta )matched++;
 
-      }
     }
   }
   return matched;
@@ -911,15 +1083,12 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
   }else TrackPos = trackID; // for ESD just take trackID
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  for (Int_t iEntry = GetFirstEntry(fTrackHead,TrackPos); iEntry >= 0; iEntry = fTrackNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),fMatchClusterID[iEntry],tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
     }
   }
   return matched;
@@ -928,20 +1097,17 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }
+  for (Int_t iEntry = GetFirstEntry(fClusterHead,clusterID); iEntry >= 0; iEntry = fClusterNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fMatchTrackPos[iEntry]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(fMatchTrackPos[iEntry]);
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedTracks.push_back(fMatchTrackPos[iEntry]);
       }
     }
   }
@@ -951,24 +1117,21 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedTracks.push_back(it->second);
+  for (Int_t iEntry = GetFirstEntry(fClusterHead,clusterID); iEntry >= 0; iEntry = fClusterNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fMatchTrackPos[iEntry]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )tempMatchedTracks.push_back(fMatchTrackPos[iEntry]);
 
-      }
     }
   }
   return tempMatchedTracks;
@@ -977,15 +1140,12 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  Float_t dR){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(it->second);
-      }
+  for (Int_t iEntry = GetFirstEntry(fClusterHead,clusterID); iEntry >= 0; iEntry = fClusterNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fMatchTrackPos[iEntry]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(fMatchTrackPos[iEntry]);
     }
   }
   return tempMatchedTracks;
@@ -1006,20 +1166,17 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
   }else TrackPos = trackID; // for ESD just take trackID
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }
+  for (Int_t iEntry = GetFirstEntry(fTrackHead,TrackPos); iEntry >= 0; iEntry = fTrackNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),fMatchClusterID[iEntry],tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(fMatchClusterID[iEntry]);
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedClusters.push_back(fMatchClusterID[iEntry]);
       }
     }
   }
@@ -1042,23 +1199,20 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
   }else TrackPos = trackID; // for ESD just take trackID
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedClusters.push_back(it->second);
-      }
+  for (Int_t iEntry = GetFirstEntry(fTrackHead,TrackPos); iEntry >= 0; iEntry = fTrackNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),fMatchClusterID[iEntry],tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )tempMatchedClusters.push_back(fMatchClusterID[iEntry]);
     }
   }
   return tempMatchedClusters;
@@ -1079,15 +1233,12 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
   }else TrackPos = trackID; // for ESD just take trackID
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(it->second);
-      }
+  for (Int_t iEntry = GetFirstEntry(fTrackHead,TrackPos); iEntry >= 0; iEntry = fTrackNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),fMatchClusterID[iEntry],tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(fMatchClusterID[iEntry]);
     }
   }
   return tempMatchedClusters;
@@ -1099,37 +1250,33 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
 //________________________________________________________________________
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::GetSecTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi){
-  Int_t position = fSecMap_TrID_ClID_ToIndex[make_pair(trackID,clusterID)];
-  if(position == 0) return kFALSE;
+  Int_t position = FindSecEntry(trackID,clusterID);
+  if(position < 0 || !fSecMatchStatus[position]) return kFALSE;
 
-  pairFloat tempEtaPhi = fSecVectorDeltaEtaDeltaPhi.at(position-1);
-  dEta = tempEtaPhi.first;
-  dPhi = tempEtaPhi.second;
+  dEta = fSecMatchDEta[position];
+  dPhi = fSecMatchDPhi[position];
   return kTRUE;
 }
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::IsSecTrackClusterAlreadyTried(Int_t trackID, Int_t clusterID){
-  Int_t position = fSecMap_TrID_ClID_AlreadyTried[make_pair(trackID,clusterID)];
-  if(position == 0) return kFALSE;
-  else return kTRUE;
+  Int_t position = FindSecEntry(trackID,clusterID);
+  if(position < 0) return kFALSE;
+  else return !fSecMatchStatus[position];
 }
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
+  for (Int_t iEntry = GetFirstEntry(fSecClusterHead,clusterID); iEntry >= 0; iEntry = fSecClusterNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fSecMatchTrackPos[iEntry]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
       }
     }
   }
@@ -1140,23 +1287,20 @@ Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, In
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )matched++;
-      }
+  for (Int_t iEntry = GetFirstEntry(fSecClusterHead,clusterID); iEntry >= 0; iEntry = fSecClusterNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fSecMatchTrackPos[iEntry]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )matched++;
     }
   }
 
@@ -1166,15 +1310,12 @@ Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, In
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  for (Int_t iEntry = GetFirstEntry(fSecClusterHead,clusterID); iEntry >= 0; iEntry = fSecClusterNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fSecMatchTrackPos[iEntry]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
     }
   }
 
@@ -1196,20 +1337,17 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
   }else TrackPos = trackID; // for ESD just take trackID
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
+  for (Int_t iEntry = GetFirstEntry(fSecTrackHead,TrackPos); iEntry >= 0; iEntry = fSecTrackNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),fSecMatchClusterID[iEntry],tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
       }
     }
   }
@@ -1232,24 +1370,21 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
   }else TrackPos = trackID; // for ESD just take trackID
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
+  for (Int_t iEntry = GetFirstEntry(fSecTrackHead,TrackPos); iEntry >= 0; iEntry = fSecTrackNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),fSecMatchClusterID[iEntry],tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
 
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
 
-        if (match_dPhi && match_dEta )matched++;
+      if (match_dPhi && match_dEta )matched++;
 
-      }
     }
   }
 
@@ -1271,15 +1406,12 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
   }else TrackPos = trackID; // for ESD just take trackID
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  for (Int_t iEntry = GetFirstEntry(fSecTrackHead,TrackPos); iEntry >= 0; iEntry = fSecTrackNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),fSecMatchClusterID[iEntry],tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
     }
   }
 
@@ -1289,20 +1421,17 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }
+  for (Int_t iEntry = GetFirstEntry(fSecClusterHead,clusterID); iEntry >= 0; iEntry = fSecClusterNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fSecMatchTrackPos[iEntry]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(fSecMatchTrackPos[iEntry]);
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedTracks.push_back(fSecMatchTrackPos[iEntry]);
       }
     }
   }
@@ -1313,23 +1442,20 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *ev
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedTracks.push_back(it->second);
-      }
+  for (Int_t iEntry = GetFirstEntry(fSecClusterHead,clusterID); iEntry >= 0; iEntry = fSecClusterNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fSecMatchTrackPos[iEntry]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )tempMatchedTracks.push_back(fSecMatchTrackPos[iEntry]);
     }
   }
 
@@ -1339,15 +1465,12 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *ev
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(it->second);
-      }
+  for (Int_t iEntry = GetFirstEntry(fSecClusterHead,clusterID); iEntry >= 0; iEntry = fSecClusterNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fSecMatchTrackPos[iEntry]));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),clusterID,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(fSecMatchTrackPos[iEntry]);
     }
   }
 
@@ -1369,20 +1492,17 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
   }else TrackPos = trackID; // for ESD just take trackID
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }
+  for (Int_t iEntry = GetFirstEntry(fSecTrackHead,TrackPos); iEntry >= 0; iEntry = fSecTrackNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),fSecMatchClusterID[iEntry],tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(fSecMatchClusterID[iEntry]);
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedClusters.push_back(fSecMatchClusterID[iEntry]);
       }
     }
   }
@@ -1405,23 +1525,20 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
   }else TrackPos = trackID; // for ESD just take trackID
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedClusters.push_back(it->second);
-      }
+  for (Int_t iEntry = GetFirstEntry(fSecTrackHead,TrackPos); iEntry >= 0; iEntry = fSecTrackNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),fSecMatchClusterID[iEntry],tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )tempMatchedClusters.push_back(fSecMatchClusterID[iEntry]);
     }
   }
 
@@ -1443,15 +1560,12 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
   }else TrackPos = trackID; // for ESD just take trackID
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(it->second);
-      }
+  for (Int_t iEntry = GetFirstEntry(fSecTrackHead,TrackPos); iEntry >= 0; iEntry = fSecTrackNext[iEntry]){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),fSecMatchClusterID[iEntry],tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(fSecMatchClusterID[iEntry]);
     }
   }
 
@@ -1492,18 +1606,18 @@ void AliCaloTrackMatcher::SetLogBinningYTH2(TH2* histoRebin){
 
 //________________________________________________________________________
 void AliCaloTrackMatcher::DebugV0Matching(){
-  if(fSecVectorDeltaEtaDeltaPhi.size()>0){
+  if(fSecMatchTrackID.size()>0){
     cout << "******************************" << endl;
     cout << "******************************" << endl;
     cout << "NEW EVENT !" << endl;
     cout << "vector etaphi:" << endl;
-    cout << fSecVectorDeltaEtaDeltaPhi.size() << endl;
+    cout << fSecMatchTrackID.size() << endl;
     cout << "multimap" << endl;
-    mapT::iterator iter = fSecMap_TrID_ClID_ToIndex.begin();
-    for (iter = fSecMap_TrID_ClID_ToIndex.begin(); iter != fSecMap_TrID_ClID_ToIndex.end(); ++iter){
+    for (UInt_t iEntry=0; iEntry<fSecMatchTrackID.size(); iEntry++){
+      if(!fSecMatchStatus[iEntry]) continue;
       Float_t dEta, dPhi = 0;
-      if(!GetSecTrackClusterMatchingResidual(iter->first.first,iter->first.second,dEta,dPhi)) continue;
-      cout << "  [" << iter->first.first << "/" << iter->first.second << ", " << iter->second << "] - (" << dEta << "/" << dPhi << ")" << endl;
+      if(!GetSecTrackClusterMatchingResidual(fSecMatchTrackID[iEntry],fSecMatchClusterID[iEntry],dEta,dPhi)) continue;
+      cout << "  [" << fSecMatchTrackID[iEntry] << "/" << fSecMatchClusterID[iEntry] << ", " << iEntry << "] - (" << dEta << "/" << dPhi << ")" << endl;
     }
     cout << "mapTrackToCluster" << endl;
     AliESDEvent *esdev = dynamic_cast<AliESDEvent*>(fInputEvent);
@@ -1516,11 +1630,17 @@ void AliCaloTrackMatcher::DebugV0Matching(){
       cout << itr << " (" << tCharge << ") - " << GetNMatchedClusterIDsForSecTrack(fInputEvent,inTrack->GetID(),5,-5,0.2,-0.4) << "\t\t";
     }
     cout << endl;
-    multimap<Int_t,Int_t>::iterator it;
-    for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it) cout << it->first << " => " << it->second << '\n';
+    Int_t tempClus = -1;
+    for (UInt_t iTrack=0; iTrack<fSecTrackHead.size(); iTrack++){
+      for (Int_t iEntry = fSecTrackHead[iTrack]; iEntry >= 0; iEntry = fSecTrackNext[iEntry]){
+        cout << iTrack << " => " << fSecMatchClusterID[iEntry] << '\n';
+        tempClus = fSecMatchClusterID[iEntry];
+      }
+    }
     cout << "mapClusterToTrack" << endl;
-    Int_t tempClus = it->second;
-    for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it) cout << it->first << " => " << it->second << '\n';
+    for (UInt_t iClus=0; iClus<fSecClusterHead.size(); iClus++){
+      for (Int_t iEntry = fSecClusterHead[iClus]; iEntry >= 0; iEntry = fSecClusterNext[iEntry]) cout << iClus << " => " << fSecMatchTrackPos[iEntry] << '\n';
+    }
     vector<Int_t> tempTracks = GetMatchedSecTrackIDsForCluster(fInputEvent,tempClus, 5, -5, 0.2, -0.4);
     for(UInt_t iJ=0; iJ<tempTracks.size();iJ++){
       cout << tempClus << " - " << tempTracks.at(iJ) << endl;
@@ -1531,18 +1651,17 @@ void AliCaloTrackMatcher::DebugV0Matching(){
 
 //________________________________________________________________________
 void AliCaloTrackMatcher::DebugMatching(){
-  if(fVectorDeltaEtaDeltaPhi.size()>0){
+  if(fMatchTrackID.size()>0){
     cout << "******************************" << endl;
     cout << "******************************" << endl;
     cout << "NEW EVENT !" << endl;
     cout << "vector etaphi:" << endl;
-    cout << fVectorDeltaEtaDeltaPhi.size() << endl;
+    cout << fMatchTrackID.size() << endl;
     cout << "multimap" << endl;
-    mapT::iterator iter = fMap_TrID_ClID_ToIndex.begin();
-    for (iter = fMap_TrID_ClID_ToIndex.begin(); iter != fMap_TrID_ClID_ToIndex.end(); ++iter){
+    for (UInt_t iEntry=0; iEntry<fMatchTrackID.size(); iEntry++){
       Float_t dEta, dPhi = 0;
-      if(!GetTrackClusterMatchingResidual(iter->first.first,iter->first.second,dEta,dPhi)) continue;
-      cout << "  [" << iter->first.first << "/" << iter->first.second << ", " << iter->second << "] - (" << dEta << "/" << dPhi << ")" << endl;
+      if(!GetTrackClusterMatchingResidual(fMatchTrackID[iEntry],fMatchClusterID[iEntry],dEta,dPhi)) continue;
+      cout << "  [" << fMatchTrackID[iEntry] << "/" << fMatchClusterID[iEntry] << ", " << iEntry << "] - (" << dEta << "/" << dPhi << ")" << endl;
     }
     cout << "mapTrackToCluster" << endl;
     AliESDEvent *esdev = dynamic_cast<AliESDEvent*>(fInputEvent);
@@ -1555,11 +1674,17 @@ void AliCaloTrackMatcher::DebugMatching(){
       cout << itr << " (" << tCharge << ") - " << GetNMatchedClusterIDsForTrack(fInputEvent,inTrack->GetID(),5,-5,0.2,-0.4) << "\t\t";
     }
     cout << endl;
-    multimap<Int_t,Int_t>::iterator it;
-    for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it) cout << it->first << " => " << it->second << '\n';
+    Int_t tempClus = -1;
+    for (UInt_t iTrack=0; iTrack<fTrackHead.size(); iTrack++){
+      for (Int_t iEntry = fTrackHead[iTrack]; iEntry >= 0; iEntry = fTrackNext[iEntry]){
+        cout << iTrack << " => " << fMatchClusterID[iEntry] << '\n';
+        tempClus = fMatchClusterID[iEntry];
+      }
+    }
     cout << "mapClusterToTrack" << endl;
-    Int_t tempClus = it->second;
-    for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it) cout << it->first << " => " << it->second << '\n';
+    for (UInt_t iClus=0; iClus<fClusterHead.size(); iClus++){
+      for (Int_t iEntry = fClusterHead[iClus]; iEntry >= 0; iEntry = fClusterNext[iEntry]) cout << iClus << " => " << fMatchTrackPos[iEntry] << '\n';
+    }
     vector<Int_t> tempTracks = GetMatchedTrackIDsForCluster(fInputEvent,tempClus, 5, -5, 0.2, -0.4);
     for(UInt_t iJ=0; iJ<tempTracks.size();iJ++){
       cout << tempClus << " - " << tempTracks.at(iJ) << endl;
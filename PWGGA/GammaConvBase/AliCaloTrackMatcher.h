@@ -9,6 +9,7 @@
 #include <utility>
 
 class TF1;
+class AliVCluster;
 
 using namespace std;
 
@@ -77,13 +78,11 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
 
     void               SetLightOutput( Bool_t flag )                    { fDoLightOutput = flag                       ;}
     void               SetMassHypothesis( Double_t mass)                {fMassHypothesis = mass;}
+    // clusters farther than sqrt(fMatchingResidual)+margin in eta or phi from the track
+    // on the calorimeter surface are not propagated to; negative margin: try all clusters
+    void               SetEtaPhiPreselectionMargin( Float_t margin)     {fEtaPhiPreselectionMargin = margin;}
 
   private:
-    //typedefs
-    typedef pair<Int_t, Int_t> pairInt;
-    typedef pair<Float_t, Float_t> pairFloat;
-    typedef map<pairInt, Int_t> mapT;
-
     AliCaloTrackMatcher (const AliCaloTrackMatcher&); // not implemented
     AliCaloTrackMatcher & operator=(const AliCaloTrackMatcher&); // not implemented
 
@@ -92,6 +91,17 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     void ProcessEvent(AliVEvent *event);
     void SetLogBinningYTH2(TH2* histoRebin);
 
+    // flat match store: entries in insertion order, linked per cluster and per track
+    static void LinkEntry(vector<Int_t> &head, vector<Int_t> &tail, vector<Int_t> &next, Int_t key, Int_t entry);
+    static Int_t GetFirstEntry(const vector<Int_t> &head, Int_t key) {return (key >= 0 && key < (Int_t)head.size()) ? head[key] : -1;}
+    void AddMatch(Int_t trackPos, Int_t trackID, Int_t clusterID, Float_t dEta, Float_t dPhi);
+    Int_t GetSecTrackSlot(Int_t trackID, Bool_t create);
+    Int_t FindSecEntry(Int_t trackID, Int_t clusterID);
+    void AddSecEntry(Int_t trackPos, Int_t trackID, Int_t clusterID, Float_t dEta, Float_t dPhi, Bool_t matched);
+    void ResetMatches();
+    void FillClusterGrid(AliVEvent *event, Int_t nClus);
+    Int_t FillCandidateClusters(Bool_t usePosition, Float_t eta, Float_t phi);
+
     // debug methods
     void DebugMatching();
     void DebugV0Matching();
@@ -118,21 +128,49 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
 
     TClonesArray*         fArrClusters;            //! array with clusters
 
-    multimap<Int_t,Int_t> fMapTrackToCluster;      //! connects a given track ID with all associated cluster IDs
-    multimap<Int_t,Int_t> fMapClusterToTrack;      //! connects a given cluster ID with all associated track IDs
-
-    Int_t                 fNEntries;               //! number of current TrackID/ClusterID -> Eta/Phi connections
-    vector<pairFloat>     fVectorDeltaEtaDeltaPhi; //! vector of all matching residuals for a specific TrackID/ClusterID
-    mapT                  fMap_TrID_ClID_ToIndex;  //! map tuple of (trackID,clusterID) to index in vector fVectorDeltaEtaDeltaPhi
-
-    // for cluster <-> V0-track matching (running with different mass hypthesis)
-    multimap<Int_t,Int_t> fSecMapTrackToCluster;      //! connects a given secondary track ID with all associated cluster IDs
-    multimap<Int_t,Int_t> fSecMapClusterToTrack;      //! connects a given cluster ID with all associated secondary track IDs
-
-    Int_t                 fSecNEntries;               //! number of current V0-trackIDs/clusterID -> Eta/Phi connections
-    vector<pairFloat>     fSecVectorDeltaEtaDeltaPhi; //! vector of all matching residuals for a specific V0-trackIDs/clusterID
-    mapT                  fSecMap_TrID_ClID_ToIndex;  //! map tuple of (V0-trackID,clusterID) to index in vector fSecVectorDeltaEtaDeltaPhi
-    mapT                  fSecMap_TrID_ClID_AlreadyTried; //! map tuple of (V0-trackID,clusterID) to matching outcome, successful or not
+    // primary matches, one entry per track <-> cluster association
+    vector<Int_t>         fMatchTrackPos;          //! track position in the event (ESD: track ID)
+    vector<Int_t>         fMatchTrackID;           //! track ID
+    vector<Int_t>         fMatchClusterID;         //! cluster ID
+    vector<Float_t>       fMatchDEta;              //! matching residual in eta
+    vector<Float_t>       fMatchDPhi;              //! matching residual in phi
+    vector<Int_t>         fClusterHead;            //! first entry of each cluster ID
+    vector<Int_t>         fClusterTail;            //! last entry of each cluster ID
+    vector<Int_t>         fClusterNext;            //! next entry of the same cluster
+    vector<Int_t>         fTrackHead;              //! first entry of each track position
+    vector<Int_t>         fTrackTail;              //! last entry of each track position
+    vector<Int_t>         fTrackNext;              //! next entry of the same track
+
+    // clusters of the current event in eta-phi cells, for the primary matching
+    vector<AliVCluster*>  fGridCluster;            //! clusters accepted for matching
+    vector<Float_t>       fGridEta;                //! cluster eta
+    vector<Float_t>       fGridPhi;                //! cluster phi in [0,2pi)
+    vector<Int_t>         fGridCellOffset;         //! first cluster of each cell in fGridCellCluster
+    vector<Int_t>         fGridCellCluster;        //! cluster indices sorted by cell
+    vector<Int_t>         fGridCandidates;         //! candidate clusters of the current track
+    Int_t                 fGridNEta;               //! number of eta cells
+    Int_t                 fGridNPhi;               //! number of phi cells
+    Float_t               fGridCellSize;           //! cell size in eta and phi
+
+    // cluster <-> V0-track matching (running with different mass hypthesis), including failed attempts
+    vector<Int_t>         fSecMatchTrackPos;       //! track position in the event (ESD: track ID), -1 for failed attempts
+    vector<Int_t>         fSecMatchTrackID;        //! V0-track ID
+    vector<Int_t>         fSecMatchClusterID;      //! cluster ID
+    vector<Float_t>       fSecMatchDEta;           //! matching residual in eta
+    vector<Float_t>       fSecMatchDPhi;           //! matching residual in phi
+    vector<Char_t>        fSecMatchStatus;         //! 1: matched, 0: tried and failed
+    vector<Int_t>         fSecClusterHead;         //! first matched entry of each cluster ID
+    vector<Int_t>         fSecClusterTail;         //! last matched entry of each cluster ID
+    vector<Int_t>         fSecClusterNext;         //! next matched entry of the same cluster
+    vector<Int_t>         fSecTrackHead;           //! first matched entry of each track position
+    vector<Int_t>         fSecTrackTail;           //! last matched entry of each track position
+    vector<Int_t>         fSecTrackNext;           //! next matched entry of the same track
+    Int_t                 fSecNClusterSlots;       //! row length of fSecPairIndex
+    vector<Int_t>         fSecTrackSlot;           //! slot of each V0-track ID
+    vector<Int_t>         fSecPairIndex;           //! entry of each (slot, cluster ID), -1 if not tried yet
+    vector<Int_t>         fSecSurfaceStatus;       //! per slot: -1 not propagated, 0 ok, >0 failure (control histo bin)
+    vector<Float_t>       fSecSurfaceEtaPhi;       //! per slot: eta, phi on the EMCal surface
+    vector<Double_t>      fSecSurfaceParam;        //! per slot: x, alpha, 5 parameters, 15 covariances on the EMCal surface
 
     //histos
     TList*                fListHistos;             //! list with histogram(s)
@@ -142,7 +180,8 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     Bool_t                fDoLightOutput;          // switch for running light output, kFALSE -> normal mode, kTRUE -> light mode
 
     Double_t              fMassHypothesis;          // mass used for track propagation to calorimeter surface
-    ClassDef(AliCaloTrackMatcher,9)
+    Float_t               fEtaPhiPreselectionMargin; // margin of the eta-phi preselection of clusters
+    ClassDef(AliCaloTrackMatcher,10)
 };
 
 #endif
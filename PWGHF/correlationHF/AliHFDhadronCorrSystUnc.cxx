@@ -35,11 +35,22 @@
 #include <TCanvas.h>
 #include <TGraphAsymmErrors.h>
 #include <TNamed.h>
+#include <TFile.h>
+#include <TKey.h>
+#include <THashList.h>
+#include <TObjArray.h>
+#include <TParameter.h>
 #include "AliHFCorrelationUtils.h"
+#include <mutex>
 
 using std::cout;
 using std::endl;
 
+namespace {
+  // guards the table cache, which is shared by all instances
+  std::mutex gTableCacheMutex;
+}
+
 ClassImp(AliHFDhadronCorrSystUnc)
 
 AliHFDhadronCorrSystUnc::AliHFDhadronCorrSystUnc() : TNamed(), 
@@ -89,7 +100,9 @@ AliHFDhadronCorrSystUnc::AliHFDhadronCorrSystUnc() : TNamed(),
   fgrTotalNonFlatDPhi(),
   fgrTotalNonFlatDPhiRel(),
   fgrTotalFlatDPhi(),
-  fgrTotalFlatDPhiRel()
+  fgrTotalFlatDPhiRel(),
+  fTableFile(),
+  fUpdateTableFile(kFALSE)
         
 {
   // default constructor
@@ -144,7 +157,9 @@ AliHFDhadronCorrSystUnc::AliHFDhadronCorrSystUnc(const char* name) :
   fgrTotalNonFlatDPhi(),
   fgrTotalNonFlatDPhiRel(),
   fgrTotalFlatDPhi(),
-  fgrTotalFlatDPhiRel()
+  fgrTotalFlatDPhiRel(),
+  fTableFile(),
+  fUpdateTableFile(kFALSE)
 {
   // default constructor
 }
@@ -1046,6 +1061,162 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DstarMidPtAss03(){
 
 
 
+void AliHFDhadronCorrSystUnc::SetTableFile(TString fileName,Bool_t update){
+  // file with the tabulated uncertainties. With update=kTRUE, the configurations
+  // missing in the file are initialized with the hardcoded values and added to it
+  fTableFile=fileName;
+  fUpdateTableFile=update;
+}
+
+void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesFromTable(const char* name,InitFunc_t initFunc){
+  // set the uncertainties of configuration "name" from the table file if available,
+  // otherwise with the hardcoded values of initFunc
+  if(!fTableFile.IsNull()){
+    if(LoadUncertaintiesFromTable(name)) return;
+    (this->*initFunc)();
+    if(fUpdateTableFile) WriteUncertaintiesToTable(name);
+    return;
+  }
+  (this->*initFunc)();
+}
+
+Bool_t AliHFDhadronCorrSystUnc::LoadUncertaintiesFromTable(const char* name){
+  // read the histograms of configuration "name" from the table file.
+  // Each configuration is read from the file only once and kept in a cache
+  std::lock_guard<std::mutex> lock(gTableCacheMutex);
+  THashList *tableCache=GetTableCache();
+
+  TString cacheName=Form("%s:%s",fTableFile.Data(),name);
+  TObjArray *table=(TObjArray*)tableCache->FindObject(cacheName.Data());
+  if(!table){
+    table=new TObjArray();
+    table->SetName(cacheName.Data());
+    table->SetOwner();
+    TFile *f=TFile::Open(fTableFile.Data());
+    if(f && !f->IsZombie()){
+      TDirectory *dir=f->GetDirectory(name);
+      if(dir){
+	TIter next(dir->GetListOfKeys());
+	TKey *k=0;
+	while((k=(TKey*)next())){
+	  TObject *obj=k->ReadObj();
+	  TH1D *h=dynamic_cast<TH1D*>(obj);
+	  if(h) h->SetDirectory(0);
+	  table->Add(obj);
+	}
+      }
+      f->Close();
+    }
+    delete f;
+    tableCache->Add(table);
+  }
+  if(table->GetEntriesFast()==0){
+    Printf("Syst unc %s not found in %s, using the hardcoded values",name,fTableFile.Data());
+    return kFALSE;
+  }
+
+  // a user-defined template with a different binning cannot be used with the tabulated values
+  TH1D *hTemplate=(TH1D*)table->FindObject("fhDeltaPhiTemplate");
+  if(!hTemplate) return kFALSE;
+  if(fhDeltaPhiTemplate){
+    if(fhDeltaPhiTemplate->GetNbinsX()!=hTemplate->GetNbinsX()
+       || TMath::Abs(fhDeltaPhiTemplate->GetXaxis()->GetXmin()-hTemplate->GetXaxis()->GetXmin())>1.e-6
+       || TMath::Abs(fhDeltaPhiTemplate->GetXaxis()->GetXmax()-hTemplate->GetXaxis()->GetXmax())>1.e-6){
+      Printf("Template binning different from the one of %s, using the hardcoded values",name);
+      return kFALSE;
+    }
+  }
+  else fhDeltaPhiTemplate=GetHistoFromTable(table,"fhDeltaPhiTemplate");
+
+  Printf("Loading syst unc %s from %s",name,fTableFile.Data());
+  TParameter<Int_t> *meson=(TParameter<Int_t>*)table->FindObject("fmeson");
+  if(meson) fmeson=meson->GetVal();
+  TNamed *str=(TNamed*)table->FindObject("fstrmeson");
+  if(str) fstrmeson=str->GetTitle();
+  str=(TNamed*)table->FindObject("fstrptAss");
+  if(str) fstrptAss=str->GetTitle();
+  str=(TNamed*)table->FindObject("fstrptD");
+  if(str) fstrptD=str->GetTitle();
+
+  // the histograms set before (e.g. by a previous configuration) are replaced
+  TH1D **histos[13]={&fhYieldExtraction,&fhBackSubtractionMin,&fhBackSubtractionMax,
+		     &fhBeautyFDmin,&fhBeautyFDmax,&fhMCclosureTestMin,&fhMCclosureTestMax,
+		     &fhMCcorrectionsMin,&fhMCcorrectionsMax,&fhMCDefficiencyMin,&fhMCDefficiencyMax,
+		     &fhSecContaminationMin,&fhSecContaminationMax};
+  const Char_t *names[13]={"fhYieldExtraction","fhBackSubtractionMin","fhBackSubtractionMax",
+			   "fhBeautyFDmin","fhBeautyFDmax","fhMCclosureTestMin","fhMCclosureTestMax",
+			   "fhMCcorrectionsMin","fhMCcorrectionsMax","fhMCDefficiencyMin","fhMCDefficiencyMax",
+			   "fhSecContaminationMin","fhSecContaminationMax"};
+  for(Int_t i=0;i<13;i++){
+    delete *histos[i];
+    *histos[i]=GetHistoFromTable(table,names[i]);
+  }
+  return kTRUE;
+}
+
+THashList* AliHFDhadronCorrSystUnc::GetTableCache(){
+  // configurations read from the table files, shared by all instances.
+  // To be used with gTableCacheMutex locked
+  static THashList *tableCache=0;
+  if(!tableCache){
+    tableCache=new THashList();
+    tableCache->SetOwner();
+  }
+  return tableCache;
+}
+
+TH1D* AliHFDhadronCorrSystUnc::GetHistoFromTable(const TObjArray *table,const char* name){
+  // copy of the cached histogram
+  TH1D *h=(TH1D*)table->FindObject(name);
+  if(!h) return 0x0;
+  TH1D *hcopy=(TH1D*)h->Clone(name);
+  hcopy->SetDirectory(0);
+  return hcopy;
+}
+
+Bool_t AliHFDhadronCorrSystUnc::WriteUncertaintiesToTable(const char* name) const {
+  // store the current histograms as configuration "name" in the table file
+  if(!fhDeltaPhiTemplate) return kFALSE;
+  TFile *f=TFile::Open(fTableFile.Data(),"UPDATE");
+  if(!f || f->IsZombie()){
+    Printf("Cannot open table file %s",fTableFile.Data());
+    delete f;
+    return kFALSE;
+  }
+  TDirectory *dir=f->GetDirectory(name);
+  if(!dir) dir=f->mkdir(name);
+  dir->cd();
+  TParameter<Int_t> meson("fmeson",fmeson);
+  meson.Write("fmeson",TObject::kOverwrite);
+  TNamed strmeson("fstrmeson",fstrmeson.Data());
+  strmeson.Write("fstrmeson",TObject::kOverwrite);
+  TNamed strptAss("fstrptAss",fstrptAss.Data());
+  strptAss.Write("fstrptAss",TObject::kOverwrite);
+  TNamed strptD("fstrptD",fstrptD.Data());
+  strptD.Write("fstrptD",TObject::kOverwrite);
+
+  TH1D *histos[14]={fhDeltaPhiTemplate,fhYieldExtraction,fhBackSubtractionMin,fhBackSubtractionMax,
+		    fhBeautyFDmin,fhBeautyFDmax,fhMCclosureTestMin,fhMCclosureTestMax,
+		    fhMCcorrectionsMin,fhMCcorrectionsMax,fhMCDefficiencyMin,fhMCDefficiencyMax,
+		    fhSecContaminationMin,fhSecContaminationMax};
+  const Char_t *names[14]={"fhDeltaPhiTemplate","fhYieldExtraction","fhBackSubtractionMin","fhBackSubtractionMax",
+			   "fhBeautyFDmin","fhBeautyFDmax","fhMCclosureTestMin","fhMCclosureTestMax",
+			   "fhMCcorrectionsMin","fhMCcorrectionsMax","fhMCDefficiencyMin","fhMCDefficiencyMax",
+			   "fhSecContaminationMin","fhSecContaminationMax"};
+  for(Int_t i=0;i<14;i++) if(histos[i]) histos[i]->Write(names[i],TObject::kOverwrite);
+  f->Close();
+  delete f;
+
+  // the cached copy of this configuration, if any, is outdated now
+  std::lock_guard<std::mutex> lock(gTableCacheMutex);
+  TObject *cached=GetTableCache()->FindObject(Form("%s:%s",fTableFile.Data(),name));
+  if(cached){
+    GetTableCache()->Remove(cached);
+    delete cached;
+  }
+  return kTRUE;
+}
+
 void AliHFDhadronCorrSystUnc::InitEmptyHistosFromTemplate(){
   if(!fhDeltaPhiTemplate){
     Printf("Template histo not set, using standard binning");
@@ -1584,13 +1755,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010(Int_t meson,Double
     // 0.3 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>2&&ptD<5){
-	InitStandardUncertaintiesPP2010DzeroLowPtAss03();
+	InitStandardUncertaintiesFromTable("PP2010DzeroLowPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DzeroLowPtAss03);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPP2010DzeroMidPtAss03();        
+	InitStandardUncertaintiesFromTable("PP2010DzeroMidPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DzeroMidPtAss03);        
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPP2010DzeroHighPtAss03();
+	InitStandardUncertaintiesFromTable("PP2010DzeroHighPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DzeroHighPtAss03);
       }
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1599,13 +1770,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010(Int_t meson,Double
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPP2010DzeroLowPtAss03to1();
+	InitStandardUncertaintiesFromTable("PP2010DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPP2010DzeroMidPtAss03to1();               
+	InitStandardUncertaintiesFromTable("PP2010DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DzeroMidPtAss03to1);               
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPP2010DzeroHighPtAss03to1();
+	InitStandardUncertaintiesFromTable("PP2010DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DzeroHighPtAss03to1);
       }      
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1614,13 +1785,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010(Int_t meson,Double
     // 1 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPP2010DzeroLowPtAss1();
+	InitStandardUncertaintiesFromTable("PP2010DzeroLowPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DzeroLowPtAss1);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPP2010DzeroMidPtAss1();
+	InitStandardUncertaintiesFromTable("PP2010DzeroMidPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DzeroMidPtAss1);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPP2010DzeroHighPtAss1();
+	InitStandardUncertaintiesFromTable("PP2010DzeroHighPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DzeroHighPtAss1);
       }
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1634,13 +1805,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010(Int_t meson,Double
     // 0.3 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPP2010DstarLowPtAss03();	
+	InitStandardUncertaintiesFromTable("PP2010DstarLowPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DstarLowPtAss03);	
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPP2010DstarMidPtAss03();
+	InitStandardUncertaintiesFromTable("PP2010DstarMidPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DstarMidPtAss03);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPP2010DstarHighPtAss03();
+	InitStandardUncertaintiesFromTable("PP2010DstarHighPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DstarHighPtAss03);
       }
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1649,13 +1820,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010(Int_t meson,Double
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPP2010DstarLowPtAss03to1();
+	InitStandardUncertaintiesFromTable("PP2010DstarLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DstarLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPP2010DstarMidPtAss03to1();
+	InitStandardUncertaintiesFromTable("PP2010DstarMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DstarMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPP2010DstarHighPtAss03to1();
+	InitStandardUncertaintiesFromTable("PP2010DstarHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DstarHighPtAss03to1);
       }
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1665,13 +1836,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010(Int_t meson,Double
     // 1 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPP2010DstarLowPtAss1();
+	InitStandardUncertaintiesFromTable("PP2010DstarLowPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DstarLowPtAss1);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPP2010DstarMidPtAss1();
+	InitStandardUncertaintiesFromTable("PP2010DstarMidPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DstarMidPtAss1);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPP2010DstarHighPtAss1();
+	InitStandardUncertaintiesFromTable("PP2010DstarHighPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DstarHighPtAss1);
       }
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1685,13 +1856,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010(Int_t meson,Double
     // 0.3 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPP2010DplusLowPtAss03();
+	InitStandardUncertaintiesFromTable("PP2010DplusLowPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DplusLowPtAss03);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPP2010DplusMidPtAss03();
+	InitStandardUncertaintiesFromTable("PP2010DplusMidPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DplusMidPtAss03);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPP2010DplusHighPtAss03();
+	InitStandardUncertaintiesFromTable("PP2010DplusHighPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DplusHighPtAss03);
       }
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1700,13 +1871,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010(Int_t meson,Double
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPP2010DplusLowPtAss03to1();
+	InitStandardUncertaintiesFromTable("PP2010DplusLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DplusLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPP2010DplusMidPtAss03to1();
+	InitStandardUncertaintiesFromTable("PP2010DplusMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DplusMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPP2010DplusHighPtAss03to1();
+	InitStandardUncertaintiesFromTable("PP2010DplusHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DplusHighPtAss03to1);
       }
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1715,13 +1886,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010(Int_t meson,Double
     // 1 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPP2010DplusLowPtAss1();
+	InitStandardUncertaintiesFromTable("PP2010DplusLowPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DplusLowPtAss1);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPP2010DplusMidPtAss1();
+	InitStandardUncertaintiesFromTable("PP2010DplusMidPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DplusMidPtAss1);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPP2010DplusHighPtAss1();
+	InitStandardUncertaintiesFromTable("PP2010DplusHighPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2010DplusHighPtAss1);
       }
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1742,13 +1913,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013(Int_t meson,Doubl
     // 0.3 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPPb2013DzeroLowPtAss03();
+	InitStandardUncertaintiesFromTable("PPb2013DzeroLowPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DzeroLowPtAss03);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPPb2013DzeroMidPtAss03();
+	InitStandardUncertaintiesFromTable("PPb2013DzeroMidPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DzeroMidPtAss03);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPPb2013DzeroHighPtAss03();
+	InitStandardUncertaintiesFromTable("PPb2013DzeroHighPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DzeroHighPtAss03);
       }
       
       else {
@@ -1758,13 +1929,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013(Int_t meson,Doubl
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPPb2013DzeroLowPtAss03to1();
+	InitStandardUncertaintiesFromTable("PPb2013DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPPb2013DzeroMidPtAss03to1();
+	InitStandardUncertaintiesFromTable("PPb2013DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPPb2013DzeroHighPtAss03to1();
+	InitStandardUncertaintiesFromTable("PPb2013DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DzeroHighPtAss03to1);
       }
       
       else {
@@ -1775,13 +1946,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013(Int_t meson,Doubl
     // 1 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPPb2013DzeroLowPtAss1();
+	InitStandardUncertaintiesFromTable("PPb2013DzeroLowPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DzeroLowPtAss1);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPPb2013DzeroMidPtAss1();
+	InitStandardUncertaintiesFromTable("PPb2013DzeroMidPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DzeroMidPtAss1);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPPb2013DzeroHighPtAss1();
+	InitStandardUncertaintiesFromTable("PPb2013DzeroHighPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DzeroHighPtAss1);
       } 
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1795,13 +1966,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013(Int_t meson,Doubl
     // 0.3 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPPb2013DstarLowPtAss03();
+	InitStandardUncertaintiesFromTable("PPb2013DstarLowPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DstarLowPtAss03);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPPb2013DstarMidPtAss03();
+	InitStandardUncertaintiesFromTable("PPb2013DstarMidPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DstarMidPtAss03);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPPb2013DstarHighPtAss03();
+	InitStandardUncertaintiesFromTable("PPb2013DstarHighPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DstarHighPtAss03);
       }
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1810,13 +1981,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013(Int_t meson,Doubl
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPPb2013DstarLowPtAss03to1();
+	InitStandardUncertaintiesFromTable("PPb2013DstarLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DstarLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPPb2013DstarMidPtAss03to1();
+	InitStandardUncertaintiesFromTable("PPb2013DstarMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DstarMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPPb2013DstarHighPtAss03to1();
+	InitStandardUncertaintiesFromTable("PPb2013DstarHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DstarHighPtAss03to1);
       }
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1825,13 +1996,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013(Int_t meson,Doubl
     // 1 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPPb2013DstarLowPtAss1();
+	InitStandardUncertaintiesFromTable("PPb2013DstarLowPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DstarLowPtAss1);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPPb2013DstarMidPtAss1();
+	InitStandardUncertaintiesFromTable("PPb2013DstarMidPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DstarMidPtAss1);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPPb2013DstarHighPtAss1();
+	InitStandardUncertaintiesFromTable("PPb2013DstarHighPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DstarHighPtAss1);
       }
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1845,13 +2016,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013(Int_t meson,Doubl
     // 0.3 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPPb2013DplusLowPtAss03();
+	InitStandardUncertaintiesFromTable("PPb2013DplusLowPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DplusLowPtAss03);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPPb2013DplusMidPtAss03();
+	InitStandardUncertaintiesFromTable("PPb2013DplusMidPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DplusMidPtAss03);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPPb2013DplusHighPtAss03();
+	InitStandardUncertaintiesFromTable("PPb2013DplusHighPtAss03",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DplusHighPtAss03);
       }
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1860,13 +2031,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013(Int_t meson,Doubl
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPPb2013DplusLowPtAss03to1();
+	InitStandardUncertaintiesFromTable("PPb2013DplusLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DplusLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPPb2013DplusMidPtAss03to1();
+	InitStandardUncertaintiesFromTable("PPb2013DplusMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DplusMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPPb2013DplusHighPtAss03to1();
+	InitStandardUncertaintiesFromTable("PPb2013DplusHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DplusHighPtAss03to1);
       }      
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1875,13 +2046,13 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013(Int_t meson,Doubl
     // 1 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001){
       if(ptD>3&&ptD<5){
-	InitStandardUncertaintiesPPb2013DplusLowPtAss1();      
+	InitStandardUncertaintiesFromTable("PPb2013DplusLowPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DplusLowPtAss1);      
       }
       else if(ptD>5&&ptD<8){
-	InitStandardUncertaintiesPPb2013DplusMidPtAss1();
+	InitStandardUncertaintiesFromTable("PPb2013DplusMidPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DplusMidPtAss1);
       }
       else if(ptD>8&&ptD<16){
-	InitStandardUncertaintiesPPb2013DplusHighPtAss1();
+	InitStandardUncertaintiesFromTable("PPb2013DplusHighPtAss1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2013DplusHighPtAss1);
       }
       else {
 	printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
@@ -1902,16 +2073,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to99);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -1920,16 +2091,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to1);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -1938,16 +2109,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss1to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss1to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss1to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss1to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss1to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss1to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss1to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss1to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -1956,16 +2127,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 2-99 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss2to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss2to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss2to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss2to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss2to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss2to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss2to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss2to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -1974,16 +2145,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss3to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss3to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -1992,16 +2163,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss1to2);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss1to2);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2010,16 +2181,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss2to3);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss2to3);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2033,16 +2204,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to99);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2051,16 +2222,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to1);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2069,16 +2240,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss1to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss1to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss1to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss1to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss1to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss1to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss1to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss1to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2087,16 +2258,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 2-99 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss2to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss2to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss2to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss2to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss2to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss2to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss2to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss2to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2105,16 +2276,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss3to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss3to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2123,16 +2294,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss1to2);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss1to2);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2141,16 +2312,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss2to3);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss2to3);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2164,16 +2335,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to99);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2182,16 +2353,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to1);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2200,16 +2371,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss1to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss1to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss1to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss1to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss1to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss1to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss1to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss1to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2218,16 +2389,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 2-99 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss2to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss2to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss2to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss2to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss2to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss2to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss2to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss2to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2236,16 +2407,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss3to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss3to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2254,16 +2425,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss1to2);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss1to2);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2272,16 +2443,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016(Int_t meson,Doubl
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss2to3);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss2to3);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2301,16 +2472,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in020(Int_t meson,
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss03to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss03to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss03to99in020);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss03to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss03to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss03to99in020);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss03to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss03to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss03to99in020);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss03to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to99in020);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2319,16 +2490,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in020(Int_t meson,
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss03to1in020();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss03to1in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss03to1in020);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss03to1in020();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss03to1in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss03to1in020);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss03to1in020();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss03to1in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss03to1in020);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to1in020();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss03to1in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to1in020);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2337,16 +2508,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in020(Int_t meson,
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss1to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss1to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss1to99in020);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss1to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss1to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss1to99in020);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss1to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss1to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss1to99in020);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss1to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss1to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss1to99in020);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2355,23 +2526,23 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in020(Int_t meson,
     else {
       printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
       printf("Using dummy values...\n");
-      InitStandardUncertaintiesPPb2016DummyValues();
+      InitStandardUncertaintiesFromTable("PPb2016DummyValues",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DummyValues);
     }
   }
   else if(meson==AliHFCorrelationUtils::kDstar) {
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss03to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss03to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss03to99in020);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss03to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss03to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss03to99in020);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss03to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss03to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss03to99in020);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss03to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to99in020);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2380,16 +2551,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in020(Int_t meson,
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss03to1in020();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss03to1in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss03to1in020);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss03to1in020();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss03to1in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss03to1in020);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss03to1in020();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss03to1in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss03to1in020);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to1in020();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss03to1in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to1in020);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2398,16 +2569,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in020(Int_t meson,
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss1to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss1to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss1to99in020);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss1to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss1to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss1to99in020);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss1to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss1to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss1to99in020);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss1to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss1to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss1to99in020);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2416,23 +2587,23 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in020(Int_t meson,
     else {
       printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
       printf("Using dummy values...\n");
-      InitStandardUncertaintiesPPb2016DummyValues();
+      InitStandardUncertaintiesFromTable("PPb2016DummyValues",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DummyValues);
     }
   }
   else if(meson==AliHFCorrelationUtils::kDplus) {
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss03to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss03to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss03to99in020);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss03to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss03to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss03to99in020);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss03to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss03to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss03to99in020);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss03to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to99in020);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2441,16 +2612,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in020(Int_t meson,
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss03to1in020();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss03to1in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss03to1in020);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss03to1in020();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss03to1in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss03to1in020);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss03to1in020();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss03to1in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss03to1in020);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to1in020();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss03to1in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to1in020);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2459,16 +2630,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in020(Int_t meson,
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss1to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss1to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss1to99in020);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss1to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss1to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss1to99in020);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss1to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss1to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss1to99in020);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss1to99in020();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss1to99in020",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss1to99in020);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2477,7 +2648,7 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in020(Int_t meson,
     else {
       printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
       printf("Using dummy values...\n");
-      InitStandardUncertaintiesPPb2016DummyValues();
+      InitStandardUncertaintiesFromTable("PPb2016DummyValues",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DummyValues);
     }
   }
 
@@ -2489,16 +2660,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in2060(Int_t meson
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss03to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss03to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss03to99in2060);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss03to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss03to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss03to99in2060);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss03to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss03to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss03to99in2060);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss03to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to99in2060);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2507,16 +2678,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in2060(Int_t meson
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss03to1in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss03to1in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss03to1in2060);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss03to1in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss03to1in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss03to1in2060);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss03to1in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss03to1in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss03to1in2060);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to1in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss03to1in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to1in2060);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2525,16 +2696,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in2060(Int_t meson
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss1to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss1to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss1to99in2060);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss1to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss1to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss1to99in2060);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss1to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss1to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss1to99in2060);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss1to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss1to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss1to99in2060);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2543,23 +2714,23 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in2060(Int_t meson
     else {
       printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
       printf("Using dummy values...\n");
-      InitStandardUncertaintiesPPb2016DummyValues();
+      InitStandardUncertaintiesFromTable("PPb2016DummyValues",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DummyValues);
     }
   }
   else if(meson==AliHFCorrelationUtils::kDstar) {
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss03to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss03to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss03to99in2060);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss03to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss03to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss03to99in2060);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss03to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss03to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss03to99in2060);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss03to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to99in2060);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2568,16 +2739,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in2060(Int_t meson
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss03to1in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss03to1in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss03to1in2060);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss03to1in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss03to1in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss03to1in2060);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss03to1in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss03to1in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss03to1in2060);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to1in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss03to1in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to1in2060);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2586,16 +2757,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in2060(Int_t meson
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss1to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss1to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss1to99in2060);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss1to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss1to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss1to99in2060);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss1to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss1to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss1to99in2060);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss1to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss1to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss1to99in2060);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2604,23 +2775,23 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in2060(Int_t meson
     else {
       printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
       printf("Using dummy values...\n");
-      InitStandardUncertaintiesPPb2016DummyValues();
+      InitStandardUncertaintiesFromTable("PPb2016DummyValues",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DummyValues);
     }
   }
   else if(meson==AliHFCorrelationUtils::kDplus) {
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss03to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss03to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss03to99in2060);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss03to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss03to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss03to99in2060);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss03to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss03to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss03to99in2060);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss03to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to99in2060);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2629,16 +2800,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in2060(Int_t meson
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss03to1in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss03to1in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss03to1in2060);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss03to1in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss03to1in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss03to1in2060);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss03to1in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss03to1in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss03to1in2060);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to1in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss03to1in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to1in2060);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2647,16 +2818,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in2060(Int_t meson
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss1to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss1to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss1to99in2060);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss1to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss1to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss1to99in2060);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss1to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss1to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss1to99in2060);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss1to99in2060();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss1to99in2060",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss1to99in2060);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2665,7 +2836,7 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in2060(Int_t meson
     else {
       printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
       printf("Using dummy values...\n");
-      InitStandardUncertaintiesPPb2016DummyValues();
+      InitStandardUncertaintiesFromTable("PPb2016DummyValues",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DummyValues);
     }
   }
 
@@ -2677,16 +2848,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in60100(Int_t meso
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss03to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss03to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss03to99in60100);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss03to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss03to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss03to99in60100);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss03to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss03to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss03to99in60100);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss03to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to99in60100);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2695,16 +2866,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in60100(Int_t meso
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss03to1in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss03to1in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss03to1in60100);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss03to1in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss03to1in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss03to1in60100);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss03to1in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss03to1in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss03to1in60100);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to1in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss03to1in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss03to1in60100);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2713,16 +2884,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in60100(Int_t meso
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DzeroLowPtAss1to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroLowPtAss1to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroLowPtAss1to99in60100);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DzeroMidPtAss1to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroMidPtAss1to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroMidPtAss1to99in60100);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DzeroHighPtAss1to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroHighPtAss1to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroHighPtAss1to99in60100);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss1to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DzeroVeryHighPtAss1to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DzeroVeryHighPtAss1to99in60100);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2731,23 +2902,23 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in60100(Int_t meso
     else {
       printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
       printf("Using dummy values...\n");
-      InitStandardUncertaintiesPPb2016DummyValues();
+      InitStandardUncertaintiesFromTable("PPb2016DummyValues",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DummyValues);
     }
   }
   else if(meson==AliHFCorrelationUtils::kDstar) {
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss03to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss03to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss03to99in60100);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss03to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss03to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss03to99in60100);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss03to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss03to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss03to99in60100);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss03to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to99in60100);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2756,16 +2927,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in60100(Int_t meso
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss03to1in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss03to1in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss03to1in60100);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss03to1in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss03to1in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss03to1in60100);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss03to1in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss03to1in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss03to1in60100);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to1in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss03to1in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss03to1in60100);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2774,16 +2945,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in60100(Int_t meso
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DstarLowPtAss1to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DstarLowPtAss1to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarLowPtAss1to99in60100);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DstarMidPtAss1to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DstarMidPtAss1to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarMidPtAss1to99in60100);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DstarHighPtAss1to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DstarHighPtAss1to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarHighPtAss1to99in60100);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DstarVeryHighPtAss1to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DstarVeryHighPtAss1to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DstarVeryHighPtAss1to99in60100);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2792,23 +2963,23 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in60100(Int_t meso
     else {
       printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
       printf("Using dummy values...\n");
-      InitStandardUncertaintiesPPb2016DummyValues();
+      InitStandardUncertaintiesFromTable("PPb2016DummyValues",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DummyValues);
     }
   }
   else if(meson==AliHFCorrelationUtils::kDplus) {
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss03to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss03to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss03to99in60100);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss03to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss03to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss03to99in60100);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss03to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss03to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss03to99in60100);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss03to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to99in60100);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2817,16 +2988,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in60100(Int_t meso
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss03to1in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss03to1in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss03to1in60100);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss03to1in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss03to1in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss03to1in60100);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss03to1in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss03to1in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss03to1in60100);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to1in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss03to1in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss03to1in60100);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2835,16 +3006,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in60100(Int_t meso
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPPb2016DplusLowPtAss1to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DplusLowPtAss1to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusLowPtAss1to99in60100);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPPb2016DplusMidPtAss1to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DplusMidPtAss1to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusMidPtAss1to99in60100);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPPb2016DplusHighPtAss1to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DplusHighPtAss1to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusHighPtAss1to99in60100);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPPb2016DplusVeryHighPtAss1to99in60100();
+        InitStandardUncertaintiesFromTable("PPb2016DplusVeryHighPtAss1to99in60100",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DplusVeryHighPtAss1to99in60100);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2853,7 +3024,7 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016in60100(Int_t meso
     else {
       printf("Methods for syst unc not ready yet for this pt(ass) bin  \n");
       printf("Using dummy values...\n");
-      InitStandardUncertaintiesPPb2016DummyValues();
+      InitStandardUncertaintiesFromTable("PPb2016DummyValues",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPPb2016DummyValues);
     }
   }
 
@@ -2866,19 +3037,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DzeroVeryLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryLowPtAss03to99);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryHighPtAss03to99);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2887,19 +3058,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DzeroVeryLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryLowPtAss03to1);
       }        
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryHighPtAss03to1);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2908,19 +3079,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DzeroVeryLowPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryLowPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryLowPtAss1to99);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DzeroLowPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroLowPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroLowPtAss1to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DzeroMidPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroMidPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroMidPtAss1to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DzeroHighPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroHighPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroHighPtAss1to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DzeroVeryHighPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryHighPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryHighPtAss1to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2929,19 +3100,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 2-99 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss>90.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DzeroVeryLowPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryLowPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryLowPtAss2to99);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DzeroLowPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroLowPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroLowPtAss2to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DzeroMidPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroMidPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroMidPtAss2to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DzeroHighPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroHighPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroHighPtAss2to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DzeroVeryHighPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryHighPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryHighPtAss2to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2950,19 +3121,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DzeroVeryLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryLowPtAss3to99);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroHighPtAss3to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryHighPtAss3to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2971,19 +3142,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DzeroVeryLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryLowPtAss1to2);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroHighPtAss1to2);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryHighPtAss1to2);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -2992,19 +3163,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DzeroVeryLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryLowPtAss2to3);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroHighPtAss2to3);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DzeroVeryHighPtAss2to3);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3018,19 +3189,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DstarVeryLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryLowPtAss03to99);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DstarLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DstarMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DstarHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DstarVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryHighPtAss03to99);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3039,19 +3210,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DstarVeryLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryLowPtAss03to1);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DstarLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DstarLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DstarMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DstarMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DstarHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DstarHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DstarVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryHighPtAss03to1);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3060,19 +3231,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DstarVeryLowPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryLowPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryLowPtAss1to99);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DstarLowPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarLowPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarLowPtAss1to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DstarMidPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarMidPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarMidPtAss1to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DstarHighPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarHighPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarHighPtAss1to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DstarVeryHighPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryHighPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryHighPtAss1to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3081,19 +3252,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 2-99 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss>90.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DstarVeryLowPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryLowPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryLowPtAss2to99);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DstarLowPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarLowPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarLowPtAss2to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DstarMidPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarMidPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarMidPtAss2to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DstarHighPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarHighPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarHighPtAss2to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DstarVeryHighPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryHighPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryHighPtAss2to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3102,19 +3273,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DstarVeryLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryLowPtAss3to99);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DstarLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DstarMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DstarHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarHighPtAss3to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DstarVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryHighPtAss3to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3123,19 +3294,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DstarVeryLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryLowPtAss1to2);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DstarLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DstarLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DstarMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DstarMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DstarHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DstarHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarHighPtAss1to2);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DstarVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryHighPtAss1to2);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3144,19 +3315,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DstarVeryLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryLowPtAss2to3);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DstarLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DstarLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DstarMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DstarMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DstarHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DstarHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarHighPtAss2to3);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DstarVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DstarVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DstarVeryHighPtAss2to3);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3170,19 +3341,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DplusVeryLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryLowPtAss03to99);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DplusLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DplusMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DplusHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DplusVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryHighPtAss03to99);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3191,19 +3362,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DplusVeryLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryLowPtAss03to1);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DplusLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DplusLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DplusMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DplusMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DplusHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DplusHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DplusVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryHighPtAss03to1);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3212,19 +3383,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 1-99 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss>90.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DplusVeryLowPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryLowPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryLowPtAss1to99);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DplusLowPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusLowPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusLowPtAss1to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DplusMidPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusMidPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusMidPtAss1to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DplusHighPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusHighPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusHighPtAss1to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DplusVeryHighPtAss1to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryHighPtAss1to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryHighPtAss1to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3233,19 +3404,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 2-99 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss>90.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DplusVeryLowPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryLowPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryLowPtAss2to99);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DplusLowPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusLowPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusLowPtAss2to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DplusMidPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusMidPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusMidPtAss2to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DplusHighPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusHighPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusHighPtAss2to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DplusVeryHighPtAss2to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryHighPtAss2to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryHighPtAss2to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3254,19 +3425,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DplusVeryLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryLowPtAss3to99);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DplusLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DplusMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DplusHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusHighPtAss3to99);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DplusVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryHighPtAss3to99);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3275,19 +3446,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DplusVeryLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryLowPtAss1to2);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DplusLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DplusLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DplusMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DplusMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DplusHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DplusHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusHighPtAss1to2);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DplusVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryHighPtAss1to2);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3296,19 +3467,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017(Int_t meson,Double
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>2&&ptD<3){
-        InitStandardUncertaintiesPP2017DplusVeryLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryLowPtAss2to3);
       }
       else if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP2017DplusLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DplusLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP2017DplusMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DplusMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP2017DplusHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DplusHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusHighPtAss2to3);
       } 
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP2017DplusVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP2017DplusVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP2017DplusVeryHighPtAss2to3);
       }          
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3331,19 +3502,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss03to99);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss03to99);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3352,19 +3523,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss03to1);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss03to1);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3374,19 +3545,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss1to2);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss1to2);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3395,19 +3566,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss2to3);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss2to3);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3416,19 +3587,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss3to99);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss3to99);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3442,19 +3613,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss03to99);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss03to99);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3463,19 +3634,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss03to1);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss03to1);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3485,19 +3656,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss1to2);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss1to2);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3506,19 +3677,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss2to3);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss2to3);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3527,19 +3698,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss3to99);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss3to99);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3553,19 +3724,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss03to99);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss03to99);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3574,19 +3745,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss03to1);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss03to1);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3596,19 +3767,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss1to2);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss1to2);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3617,19 +3788,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss2to3);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss2to3);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3638,19 +3809,19 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeV(Int_t meson,Doubl
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVDzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVDzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVDzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroVeryHighPtAss3to99);
       }
       else if(ptD>24&&ptD<36){
-        InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVDzeroExtremelyHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVDzeroExtremelyHighPtAss3to99);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3673,16 +3844,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss03to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3691,16 +3862,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss03to1);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3710,16 +3881,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss1to2);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3728,16 +3899,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss2to3);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3746,16 +3917,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss3to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3769,16 +3940,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss03to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3787,16 +3958,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss03to1);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3806,16 +3977,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss1to2);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3824,16 +3995,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss2to3);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3842,16 +4013,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss3to99);
       }   
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3865,16 +4036,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss03to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3883,16 +4054,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss03to1);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3902,16 +4073,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss1to2);
       }   
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3920,16 +4091,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss2to3);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3938,16 +4109,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001(Int_t meson,
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin001DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin001DzeroVeryHighPtAss3to99);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3970,16 +4141,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss03to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -3988,16 +4159,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss03to1);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4007,16 +4178,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss1to2);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4025,16 +4196,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss2to3);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4043,16 +4214,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss3to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4066,16 +4237,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss03to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4084,16 +4255,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss03to1);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4103,16 +4274,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss1to2);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4121,16 +4292,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss2to3);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4139,16 +4310,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss3to99);
       }   
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4162,16 +4333,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss03to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4180,16 +4351,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss03to1);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4199,16 +4370,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss1to2);
       }   
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4217,16 +4388,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss2to3);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4235,16 +4406,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110(Int_t meson
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin0110DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin0110DzeroVeryHighPtAss3to99);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4267,16 +4438,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss03to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4285,16 +4456,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss03to1);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4304,16 +4475,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss1to2);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4322,16 +4493,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss2to3);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4340,16 +4511,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss3to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4363,16 +4534,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss03to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4381,16 +4552,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss03to1);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4400,16 +4571,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss1to2);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4418,16 +4589,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss2to3);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4436,16 +4607,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss3to99);
       }   
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4459,16 +4630,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss03to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4477,16 +4648,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss03to1);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4496,16 +4667,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss1to2);
       }   
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4514,16 +4685,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss2to3);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4532,16 +4703,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030(Int_t meson
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin1030DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin1030DzeroVeryHighPtAss3to99);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4564,16 +4735,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss03to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4582,16 +4753,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss03to1);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4601,16 +4772,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss1to2);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4619,16 +4790,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss2to3);
       }      
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4637,16 +4808,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss3to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4660,16 +4831,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss03to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4678,16 +4849,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss03to1);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4697,16 +4868,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss1to2);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4715,16 +4886,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss2to3);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4733,16 +4904,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss3to99);
       }   
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4756,16 +4927,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 0.3-99 GeV/c
     if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss03to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss03to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss03to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss03to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss03to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss03to99);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4774,16 +4945,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 0.3-1 GeV/c
     else if(TMath::Abs(minptAss-0.3)<0.0001 && maxptAss==1.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss03to1);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss03to1);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss03to1);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss03to1();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss03to1",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss03to1);
       }     
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4793,16 +4964,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 1-2 GeV/c
     else if(TMath::Abs(minptAss-1.)<0.0001 && maxptAss==2.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss1to2);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss1to2);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss1to2);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss1to2();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss1to2",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss1to2);
       }   
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4811,16 +4982,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 2-3 GeV/c
     else if(TMath::Abs(minptAss-2.)<0.0001 && maxptAss==3){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss2to3);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss2to3);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss2to3);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss2to3();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss2to3",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss2to3);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
@@ -4829,16 +5000,16 @@ void AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100(Int_t meso
     // 3-99 GeV/c
     else if(TMath::Abs(minptAss-3.)<0.0001 && maxptAss>90.){
       if(ptD>3&&ptD<5){
-        InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroLowPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroLowPtAss3to99);
       }
       else if(ptD>5&&ptD<8){
-        InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroMidPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroMidPtAss3to99);
       }
       else if(ptD>8&&ptD<16){
-        InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroHighPtAss3to99);
       }
       else if(ptD>16&&ptD<24){
-        InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss3to99();
+        InitStandardUncertaintiesFromTable("PP13TeVin30100DzeroVeryHighPtAss3to99",&AliHFDhadronCorrSystUnc::InitStandardUncertaintiesPP13TeVin30100DzeroVeryHighPtAss3to99);
       }    
       else {
         printf("Methods for syst unc not ready yet for this pt(D) bin  \n");
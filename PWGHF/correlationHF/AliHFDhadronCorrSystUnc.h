@@ -21,6 +21,8 @@
 #include <TCanvas.h>
 #include <TGraphAsymmErrors.h>
 #include <TString.h>
+class TObjArray;
+class THashList;
 class AliHFDhadronCorrSystUnc : public TNamed{
   
  public:
@@ -28,6 +30,13 @@ class AliHFDhadronCorrSystUnc : public TNamed{
   AliHFDhadronCorrSystUnc(const char* name);
   ~AliHFDhadronCorrSystUnc();
   void InitEmptyHistosFromTemplate();
+
+  // Tabulated uncertainties: if a table file is set, the standard uncertainties
+  // are read from it (only the requested configuration, cached for later calls)
+  // instead of being built from the hardcoded values
+  void SetTableFile(TString fileName,Bool_t update=kFALSE);
+  TString GetTableFile() const {return fTableFile;}
+
   void InitStandardUncertaintiesPP2010(Int_t meson,Double_t ptD,Double_t minptAss,Double_t maxptAss);
   void InitStandardUncertaintiesPPb2013(Int_t meson,Double_t ptD,Double_t minptAss,Double_t maxptAss);
   void InitStandardUncertaintiesPPb2016(Int_t meson,Double_t ptD,Double_t minptAss,Double_t maxptAss);
@@ -714,6 +723,13 @@ class AliHFDhadronCorrSystUnc : public TNamed{
   TGraphAsymmErrors* GetTotFlatUncGraph(){return fgrTotalFlatDPhi;}
   
  private:
+  typedef void (AliHFDhadronCorrSystUnc::*InitFunc_t)();
+  void InitStandardUncertaintiesFromTable(const char* name,InitFunc_t initFunc);
+  Bool_t LoadUncertaintiesFromTable(const char* name);
+  Bool_t WriteUncertaintiesToTable(const char* name) const;
+  static TH1D* GetHistoFromTable(const TObjArray *table,const char* name);
+  static THashList* GetTableCache();
+
   Int_t fmeson;                       // 0=D0, 1=D*, 2=D+
   TString fstrmeson;                  // meson name
   TString fstrptAss;                  // string with pt range associated tracks
@@ -761,9 +777,11 @@ class AliHFDhadronCorrSystUnc : public TNamed{
   TGraphAsymmErrors  *fgrTotalNonFlatDPhiRel;         //
   TGraphAsymmErrors  *fgrTotalFlatDPhi;         //
   TGraphAsymmErrors  *fgrTotalFlatDPhiRel;         //
+  TString fTableFile;                   // file with the tabulated uncertainties (empty: hardcoded values)
+  Bool_t fUpdateTableFile;              // add the configurations missing in the table file
 
 
-  ClassDef(AliHFDhadronCorrSystUnc,1);
+  ClassDef(AliHFDhadronCorrSystUnc,2);
 };
 
 
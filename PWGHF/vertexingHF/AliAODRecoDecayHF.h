@@ -123,6 +123,7 @@ class AliAODRecoDecayHF : public AliAODRecoDecay {
   void    SetSelectionBit(Int_t i) {SETBIT(fSelectionMap,i); return;}
   Bool_t  HasSelectionBit(Int_t i) const {return TESTBIT(fSelectionMap,i);}
   ULong_t GetSelectionMap() const {return fSelectionMap;}
+  void    ResetSelectionMap() {fSelectionMap=0; return;}
 
   Int_t   NumberOfFakeDaughters() const;
 
@@ -59,6 +59,7 @@
 #include "AliAnalysisTaskSED0BDT.h"
 #include "AliNormalizationCounter.h"
 #include "AliEventCuts.h"
+#include "AliHFBDTForest.h"
 
 using std::cout;
 using std::endl;
@@ -141,7 +142,14 @@ fListProfiles(0),
 fmultiana(0),
 fCounterC(0),
 fDoVZER0ParamVertexCorr(1),
-fYearNumber(16)
+fYearNumber(16),
+fBDTForestDir(""),
+fBDTForestExt(".xml"),
+fBDTForests(),
+fBDTCandPtBin(),
+fBDTCandMass(),
+fBDTCandMult(),
+fBDTCandVars()
 {
   /// Default constructor
     for(Int_t i=0; i<14; i++) fMultEstimatorAvg[i]=0;
@@ -230,7 +238,14 @@ fMCPrimariesEstimator(kEta10),
 fListProfiles(0),
 fCounterC(0),
 fDoVZER0ParamVertexCorr(1),
-fYearNumber(16)
+fYearNumber(16),
+fBDTForestDir(""),
+fBDTForestExt(".xml"),
+fBDTForests(),
+fBDTCandPtBin(),
+fBDTCandMass(),
+fBDTCandMult(),
+fBDTCandVars()
 {
   /// Default constructor
     for(Int_t i=0; i<14; i++) fMultEstimatorAvg[i]=0;
@@ -310,6 +325,7 @@ AliAnalysisTaskSED0BDT::~AliAnalysisTaskSED0BDT()
     for(Int_t i=0; i<5; i++){
       if(h3Invmass[i]) delete h3Invmass[i];
     }
+  for(size_t i=0; i<fBDTForests.size(); i++) delete fBDTForests[i];
     for(Int_t i=0; i<5; i++){
       if(h3Invmass_19[i]) delete h3Invmass_19[i];
     }
@@ -1300,7 +1316,9 @@ void AliAnalysisTaskSED0BDT::UserCreateOutputObjects()
 		fListBDTNtuple->Add(NtupleSB);
 	}
 	else{
-		fListRDHFBDT->SetOwner(); fListBDTNtuple->SetName("BDTList");
+		if(fListRDHFBDT) fListRDHFBDT->SetOwner();
+		fListBDTNtuple->SetName("BDTList");
+		if(!fBDTForestDir.IsNull() && !LoadBDTForests()) AliFatal(Form("Cannot load the BDT weight files from %s",fBDTForestDir.Data()));
 		for(Int_t ii=0;ii<fCut4BDTptbin->GetNPtBins();ii++){
             const Int_t NBDT = fListBDTNames->GetEntries() - 1;
             for(Int_t jj=0;jj<NBDT;jj++){
@@ -1708,6 +1726,7 @@ void AliAnalysisTaskSED0BDT::UserExec(Option_t */*option*/)
     fDaughterTracks.Clear();
     //if(unsetvtx) d->UnsetOwnPrimaryVtx();
   } //end for prongs
+  FlushBDTCandidates();
   fCounter->StoreCandidates(aod,nSelectedloose,kTRUE);
   fCounter->StoreCandidates(aod,nSelectedtight,kFALSE);
   delete vHF;
@@ -3514,30 +3533,7 @@ void AliAnalysisTaskSED0BDT::ProcessBDT(AliAODEvent *aod, AliAODRecoDecayHF2Pron
 			else{ // Data application
 				Int_t thisptbin = fCut4BDTptbin->PtBin(tmp[0]);
 				if(thisptbin<0) return;
-				Float_t *ptbin = fCut4BDTptbin->GetPtBinLimits();
-				TString ptstring = Form("_%.0f_%.0f",ptbin[thisptbin],ptbin[thisptbin+1]);
-				Int_t NBDT = fListBDTNames->GetEntries();
-				TString BDT1Name = fListBDTNames->At(0)->GetName();
-				AliRDHFBDT *thisbdt1   = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("pT_%d_%s",thisptbin,BDT1Name.Data()));
-				Float_t bdt1resp = thisbdt1->GetResponse(BDTClsVar);
-						
-				for(Int_t ii=1;ii<NBDT;ii++){
-					TString BDT2Name = fListBDTNames->At(ii)->GetName();
-					AliRDHFBDT *thisbdt2   = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("pT_%d_%s",thisptbin,BDT2Name.Data()));
-					Float_t bdt2resp = thisbdt2->GetResponse(BDTClsVar);
-                    TH3F *thish3 = (TH3F*)fListBDTResp->FindObject(Form("h3MassRespPt%d_%s_%s",thisptbin,BDT1Name.Data(),BDT2Name.Data()));
-                    TH3F *thish3_19 = (TH3F*)fListBDTResp->FindObject(Form("h3MassRespPt%d_%s_%s_19",thisptbin,BDT1Name.Data(),BDT2Name.Data()));
-                    TH3F *thish3_1029 = (TH3F*)fListBDTResp->FindObject(Form("h3MassRespPt%d_%s_%s_1029",thisptbin,BDT1Name.Data(),BDT2Name.Data()));
-                    TH3F *thish3_3059 = (TH3F*)fListBDTResp->FindObject(Form("h3MassRespPt%d_%s_%s_3059",thisptbin,BDT1Name.Data(),BDT2Name.Data()));
-                    thish3->Fill(tmp[8],bdt1resp,bdt2resp);
-                    if(tmp[22]>=1&&tmp[22]<10) thish3_19->Fill(tmp[8],bdt1resp,bdt2resp);
-                    if(tmp[22]>=10&&tmp[22]<30) thish3_1029->Fill(tmp[8],bdt1resp,bdt2resp);
-                    if(tmp[22]>=30&&tmp[22]<60) thish3_3059->Fill(tmp[8],bdt1resp,bdt2resp);
-					// Test output info
-					//~ cout<<"INFO: "<<BDT1Name.Data()<<" = "<<bdt1resp<<", "<<BDT2Name.Data()<<" = "<<bdt2resp<<endl;
-					//~ cout<<"INFO: Filling TH3F "<<thish3->GetName()<<endl;
-					//~ printf("INFO: %s = %.3f, %s = %.3f\n",BDT1Name.Data(),bdt1resp,BDT2Name.Data(),bdt2resp);
-				}
+				FillBDTResponse(thisptbin,tmp[8],tmp[22],BDTClsVar);
 			}
         }
         if (fIsSelectedCandidate>1 && (fFillOnlyD0D0bar==0 || fFillOnlyD0D0bar==2)){
@@ -3557,36 +3553,119 @@ void AliAnalysisTaskSED0BDT::ProcessBDT(AliAODEvent *aod, AliAODRecoDecayHF2Pron
 			else{ // Data application
 				Int_t thisptbin = fCut4BDTptbin->PtBin(tmp[0]);
 				if(thisptbin<0) return;
-				Float_t *ptbin = fCut4BDTptbin->GetPtBinLimits();
-				TString ptstring = Form("_%.0f_%.0f",ptbin[thisptbin],ptbin[thisptbin+1]);
-				Int_t NBDT = fListBDTNames->GetEntries();
-				TString BDT1Name = fListBDTNames->At(0)->GetName();
-				AliRDHFBDT *thisbdt1   = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("pT_%d_%s",thisptbin,BDT1Name.Data()));
-				Float_t bdt1resp = thisbdt1->GetResponse(BDTClsVar);
-						
-				for(Int_t ii=1;ii<NBDT;ii++){
-					TString BDT2Name = fListBDTNames->At(ii)->GetName();
-					AliRDHFBDT *thisbdt2   = (AliRDHFBDT*)fListRDHFBDT->FindObject(Form("pT_%d_%s",thisptbin,BDT2Name.Data()));
-					Float_t bdt2resp = thisbdt2->GetResponse(BDTClsVar);
-                    TH3F *thish3 = (TH3F*)fListBDTResp->FindObject(Form("h3MassRespPt%d_%s_%s",thisptbin,BDT1Name.Data(),BDT2Name.Data()));
-                    TH3F *thish3_19 = (TH3F*)fListBDTResp->FindObject(Form("h3MassRespPt%d_%s_%s_19",thisptbin,BDT1Name.Data(),BDT2Name.Data()));
-                    TH3F *thish3_1029 = (TH3F*)fListBDTResp->FindObject(Form("h3MassRespPt%d_%s_%s_1029",thisptbin,BDT1Name.Data(),BDT2Name.Data()));
-                    TH3F *thish3_3059 = (TH3F*)fListBDTResp->FindObject(Form("h3MassRespPt%d_%s_%s_3059",thisptbin,BDT1Name.Data(),BDT2Name.Data()));
-                    thish3->Fill(tmp[8],bdt1resp,bdt2resp);
-                    if(tmp[22]>=1&&tmp[22]<10) thish3_19->Fill(tmp[8],bdt1resp,bdt2resp);
-                    if(tmp[22]>=10&&tmp[22]<30) thish3_1029->Fill(tmp[8],bdt1resp,bdt2resp);
-                    if(tmp[22]>=30&&tmp[22]<60) thish3_3059->Fill(tmp[8],bdt1resp,bdt2resp);
-
-					// Test output info
-					//~ cout<<"INFO: "<<BDT1Name.Data()<<" = "<<bdt1resp<<", "<<BDT2Name.Data()<<" = "<<bdt2resp<<endl;
-					//~ cout<<"INFO: Filling TH3F "<<thish3->GetName()<<endl;
-					//~ printf("INFO: %s = %.3f, %s = %.3f\n",BDT1Name.Data(),bdt1resp,BDT2Name.Data(),bdt2resp);
-				}
+				FillBDTResponse(thisptbin,tmp[8],tmp[22],BDTClsVar);
 			}
         }
     }
     
 }
+//_________________________________________________________________________
+Bool_t AliAnalysisTaskSED0BDT::LoadBDTForests(){
+  /// load one AliHFBDTForest per pt bin and BDT name
+  const Int_t nPtBins=fCut4BDTptbin->GetNPtBins();
+  const Int_t nBDT=fListBDTNames->GetEntries();
+  fBDTForests.assign(nPtBins*nBDT,0x0);
+  for(Int_t ipt=0; ipt<nPtBins; ipt++){
+    for(Int_t ibdt=0; ibdt<nBDT; ibdt++){
+      AliHFBDTForest *forest=new AliHFBDTForest();
+      fBDTForests[ipt*nBDT+ibdt]=forest;
+      if(!forest->Load(Form("%s/pT_%d_%s%s",fBDTForestDir.Data(),ipt,fListBDTNames->At(ibdt)->GetName(),fBDTForestExt.Data()))) return kFALSE;
+    }
+  }
+  return kTRUE;
+}
+
+//_________________________________________________________________________
+void AliAnalysisTaskSED0BDT::FillBDTResponse(Int_t ptbin, Float_t mass, Float_t mult, const std::vector<Double_t>& vars){
+  /// fill the BDT response histograms of a candidate. With AliHFBDTForest the
+  /// candidate is queued and the responses of all the candidates of the event
+  /// are evaluated in batches in FlushBDTCandidates()
+  if(!fBDTForests.empty()){
+    fBDTCandPtBin.push_back(ptbin);
+    fBDTCandMass.push_back(mass);
+    fBDTCandMult.push_back(mult);
+    fBDTCandVars.insert(fBDTCandVars.end(),vars.begin(),vars.end());
+    return;
+  }
+  const Int_t nBDT=fListBDTNames->GetEntries();
+  std::vector<Float_t> resp(nBDT);
+  for(Int_t ibdt=0; ibdt<nBDT; ibdt++) resp[ibdt]=GetBDTResponse(ptbin,ibdt,vars);
+  FillBDTResponseHistos(ptbin,mass,mult,resp.data(),1);
+}
+
+//_________________________________________________________________________
+void AliAnalysisTaskSED0BDT::FillBDTResponseHistos(Int_t ptbin, Float_t mass, Float_t mult, const Float_t* resp, Int_t stride){
+  /// fill the (mass, BDT1 response, BDTi response) histograms of the pt bin,
+  /// resp[ibdt*stride] is the response of the BDT ibdt of the names list
+  const Int_t nBDT=fListBDTNames->GetEntries();
+  TString BDT1Name = fListBDTNames->At(0)->GetName();
+  Float_t bdt1resp = resp[0];
+  for(Int_t ii=1;ii<nBDT;ii++){
+    TString BDT2Name = fListBDTNames->At(ii)->GetName();
+    Float_t bdt2resp = resp[ii*stride];
+    TH3F *thish3 = (TH3F*)fListBDTResp->FindObject(Form("h3MassRespPt%d_%s_%s",ptbin,BDT1Name.Data(),BDT2Name.Data()));
+    TH3F *thish3_19 = (TH3F*)fListBDTResp->FindObject(Form("h3MassRespPt%d_%s_%s_19",ptbin,BDT1Name.Data(),BDT2Name.Data()));
+    TH3F *thish3_1029 = (TH3F*)fListBDTResp->FindObject(Form("h3MassRespPt%d_%s_%s_1029",ptbin,BDT1Name.Data(),BDT2Name.Data()));
+    TH3F *thish3_3059 = (TH3F*)fListBDTResp->FindObject(Form("h3MassRespPt%d_%s_%s_3059",ptbin,BDT1Name.Data(),BDT2Name.Data()));
+    thish3->Fill(mass,bdt1resp,bdt2resp);
+    if(mult>=1&&mult<10) thish3_19->Fill(mass,bdt1resp,bdt2resp);
+    if(mult>=10&&mult<30) thish3_1029->Fill(mass,bdt1resp,bdt2resp);
+    if(mult>=30&&mult<60) thish3_3059->Fill(mass,bdt1resp,bdt2resp);
+  }
+}
+
+//_________________________________________________________________________
+void AliAnalysisTaskSED0BDT::FlushBDTCandidates(){
+  /// evaluate the queued candidates of the event with AliHFBDTForest::GetMvaValues,
+  /// one batch per pt bin and BDT, and fill the response histograms
+  const Int_t nCand=fBDTCandPtBin.size();
+  if(!nCand) return;
+  const Int_t nBDT=fListBDTNames->GetEntries();
+  const Int_t nVars=fBDTCandVars.size()/nCand;
+  std::vector<Double_t> inputs;
+  std::vector<Double_t> response;
+  std::vector<Float_t> resp;
+  std::vector<Int_t> cands;
+  for(Int_t ipt=0; ipt<fCut4BDTptbin->GetNPtBins(); ipt++){
+    cands.clear();
+    inputs.clear();
+    for(Int_t icand=0; icand<nCand; icand++){
+      if(fBDTCandPtBin[icand]!=ipt) continue;
+      cands.push_back(icand);
+      inputs.insert(inputs.end(),fBDTCandVars.begin()+icand*nVars,fBDTCandVars.begin()+(icand+1)*nVars);
+    }
+    const Int_t nPtCand=cands.size();
+    if(!nPtCand) continue;
+    response.resize(nPtCand);
+    resp.resize(nBDT*nPtCand);
+    for(Int_t ibdt=0; ibdt<nBDT; ibdt++){
+      AliHFBDTForest *forest=fBDTForests[ipt*nBDT+ibdt];
+      if(forest->GetNVars()!=nVars){
+        AliError(Form("BDT %s of pt bin %d: %d input variables given, %d needed",fListBDTNames->At(ibdt)->GetName(),ipt,nVars,forest->GetNVars()));
+        for(Int_t i=0; i<nPtCand; i++) response[i]=0.;
+      }
+      else forest->GetMvaValues(inputs.data(),nPtCand,response.data());
+      for(Int_t i=0; i<nPtCand; i++) resp[ibdt*nPtCand+i]=response[i];
+    }
+    for(Int_t i=0; i<nPtCand; i++){
+      FillBDTResponseHistos(ipt,fBDTCandMass[cands[i]],fBDTCandMult[cands[i]],&resp[i],nPtCand);
+    }
+  }
+  fBDTCandPtBin.clear();
+  fBDTCandMass.clear();
+  fBDTCandMult.clear();
+  fBDTCandVars.clear();
+}
+
+//_________________________________________________________________________
+Double_t AliAnalysisTaskSED0BDT::GetBDTResponse(Int_t ptbin, Int_t ibdt, const std::vector<Double_t>& vars) const {
+  /// response of the BDT ibdt of the names list in the pt bin, from the
+  /// AliHFBDTForest if loaded, from the AliRDHFBDT of the BDT list otherwise
+  if(!fBDTForests.empty()) return fBDTForests[ptbin*fListBDTNames->GetEntries()+ibdt]->GetMvaValue(vars);
+  AliRDHFBDT *bdt=(AliRDHFBDT*)fListRDHFBDT->FindObject(Form("pT_%d_%s",ptbin,fListBDTNames->At(ibdt)->GetName()));
+  return bdt->GetResponse(vars);
+}
+
 //_________________________________________________________________________
 TProfile* AliAnalysisTaskSED0BDT::GetEstimatorHistogram(const AliVEvent* event){
   /// Get Estimator Histogram from period event->GetRunNumber();
@@ -30,9 +30,12 @@
 #include "AliRDHFBDT.h"
 #include "AliNormalizationCounter.h"
 #include "AliEventCuts.h"
+#include <vector>
 
 class AliAODEvent;
 
+class AliHFBDTForest;
+
 class AliAnalysisTaskSED0BDT : public AliAnalysisTaskSE
 {
  public:
@@ -322,6 +325,9 @@ class AliAnalysisTaskSED0BDT : public AliAnalysisTaskSE
   
   void SetBDTList(TList *bdtlist) {fListRDHFBDT=bdtlist;}
   void SetBDTNamesList(TList *namelist) {fListBDTNames=namelist;}
+  /// evaluate the BDTs with AliHFBDTForest from the weight files
+  /// dir/pT_<ptbin>_<name><ext> instead of the AliRDHFBDT objects of SetBDTList
+  void SetBDTForestFiles(TString dir, TString ext=".xml") {fBDTForestDir=dir; fBDTForestExt=ext;}
 
 
   void SetEnableCentralityCorrCutsPbPb(Bool_t flag=kFALSE, Int_t year=2018) {
@@ -355,6 +361,11 @@ class AliAnalysisTaskSED0BDT : public AliAnalysisTaskSE
   AliAnalysisTaskSED0BDT(const AliAnalysisTaskSED0BDT &source);
   AliAnalysisTaskSED0BDT& operator=(const AliAnalysisTaskSED0BDT& source);
   void	   DrawDetSignal(AliAODRecoDecayHF2Prong *part, TList *ListDetSignal);
+  Bool_t   LoadBDTForests();
+  Double_t GetBDTResponse(Int_t ptbin, Int_t ibdt, const std::vector<Double_t>& vars) const;
+  void     FillBDTResponse(Int_t ptbin, Float_t mass, Float_t mult, const std::vector<Double_t>& vars);
+  void     FillBDTResponseHistos(Int_t ptbin, Float_t mass, Float_t mult, const Float_t* resp, Int_t stride);
+  void     FlushBDTCandidates();
 
   void     FillMassHists(AliAODRecoDecayHF2Prong *part, TClonesArray *arrMC, AliAODMCHeader *mcHeader, AliRDHFCutsD0toKpi *cuts, TList *listout);
   void     FillVarHists(AliAODEvent *aodev,AliAODRecoDecayHF2Prong *part, TClonesArray *arrMC, AliRDHFCutsD0toKpi *cuts, TList *listout);
@@ -454,9 +465,16 @@ class AliAnalysisTaskSED0BDT : public AliAnalysisTaskSE
   
   TString		fBDTFullVarString;
   TString		fBDTClassifierVarString;
+  TString		fBDTForestDir;   /// directory of the BDT weight files for AliHFBDTForest
+  TString		fBDTForestExt;   /// extension of the BDT weight files (.xml or binary)
+  std::vector<AliHFBDTForest*> fBDTForests; //!<! forests per pt bin and BDT name
+  std::vector<Int_t>    fBDTCandPtBin; //!<! pt bin of the candidates queued for the forests
+  std::vector<Float_t>  fBDTCandMass;  //!<! invariant mass of the queued candidates
+  std::vector<Float_t>  fBDTCandMult;  //!<! multiplicity of the queued candidates
+  std::vector<Double_t> fBDTCandVars;  //!<! BDT input variables of the queued candidates
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskSED0BDT,25); /// AliAnalysisTaskSE for D0->Kpi
+  ClassDef(AliAnalysisTaskSED0BDT,26); /// AliAnalysisTaskSE for D0->Kpi
   /// \endcond
 };
 
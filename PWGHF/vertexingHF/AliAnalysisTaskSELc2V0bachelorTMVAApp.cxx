@@ -77,6 +77,7 @@
 #include <TMVA/MethodCuts.h>
 
 #include "IClassifierReader.h"
+#include "AliHFBDTForest.h"
 
 using std::cout;
 using std::endl;
@@ -248,7 +249,12 @@ AliAnalysisTaskSELc2V0bachelorTMVAApp::AliAnalysisTaskSELc2V0bachelorTMVAApp():
   fMultiplicityCutMin(0.),
   fMultiplicityCutMax(99999.),
   fUseXmlFileFromCVMFS(kFALSE),
-  fXmlFileFromCVMFS("")
+  fXmlFileFromCVMFS(""),
+  fBDTForestFile(""),
+  fBDTForest(0),
+  fBDTCandVars(),
+  fBDTCandFillVars(),
+  fBDTCandTMVA()
 {
   /// Default ctor
   //
@@ -417,7 +423,12 @@ AliAnalysisTaskSELc2V0bachelorTMVAApp::AliAnalysisTaskSELc2V0bachelorTMVAApp(con
   fMultiplicityCutMin(0.),
   fMultiplicityCutMax(99999.),
   fUseXmlFileFromCVMFS(kFALSE),
-  fXmlFileFromCVMFS("")
+  fXmlFileFromCVMFS(""),
+  fBDTForestFile(""),
+  fBDTForest(0),
+  fBDTCandVars(),
+  fBDTCandFillVars(),
+  fBDTCandTMVA()
 {
   //
   /// Constructor. Initialization of Inputs and Outputs
@@ -508,6 +519,7 @@ AliAnalysisTaskSELc2V0bachelorTMVAApp::~AliAnalysisTaskSELc2V0bachelorTMVAApp()
   if (fBDTReader) {
     //delete fBDTReader;
     fBDTReader = 0;
+    fBDTForest = 0;
   }
 
   if (fReader) {
@@ -1109,7 +1121,16 @@ void AliAnalysisTaskSELc2V0bachelorTMVAApp::UserCreateOutputObjects() {
       if (fUseXmlWeightsFile || fUseXmlFileFromCVMFS) fReader->AddSpectator(variable.Data(), &fVarsTMVASpectators[i]);
     }
     delete tokensSpectators;
-    if (fUseWeightsLibrary) {
+    if (fUseWeightsLibrary && !fBDTForestFile.IsNull()) {
+      // flat BDT evaluator reading the weights at runtime, no generated class needed
+      AliHFBDTForest* forest = new AliHFBDTForest(inputNamesVec);
+      if (!forest->Load(fBDTForestFile.Data())) {
+        AliFatal(Form("Cannot load BDT from %s", fBDTForestFile.Data()));
+      }
+      fBDTReader = forest;
+      fBDTForest = forest;
+    }
+    else if (fUseWeightsLibrary) {
       void* lib = dlopen(fTMVAlibName.Data(), RTLD_NOW);
       void* p = dlsym(lib, Form("%s", fTMVAlibPtBin.Data()));
       IClassifierReader* (*maker1)(std::vector<std::string>&) = (IClassifierReader* (*)(std::vector<std::string>&)) p;
@@ -1699,6 +1720,7 @@ void AliAnalysisTaskSELc2V0bachelorTMVAApp::MakeAnalysisForLc2prK0S(AliAODEvent
     //FillLc2pK0Sspectrum(lcK0spr, isLc, nSelectedAnal, cutsAnal, mcArray, iLctopK0s, aodEvent);
     FillLc2pK0Sspectrum(lcK0spr, isLc, nSelectedAnal, cutsAnal, mcArray, mcLabel, aodEvent);
   }
+  FlushBDTCandidates();
   
   delete vHF;
 
@@ -2270,30 +2292,32 @@ void AliAnalysisTaskSELc2V0bachelorTMVAApp::FillLc2pK0Sspectrum(AliAODRecoCascad
       Double_t BDTResponse = -1;
       Double_t tmva = -1;
       if (fUseXmlWeightsFile || fUseXmlFileFromCVMFS) tmva = fReader->EvaluateMVA("BDT method");
-      if (fUseWeightsLibrary) BDTResponse = fBDTReader->GetMvaValue(inputVars);
-      //Printf("BDTResponse = %f, invmassLc = %f", BDTResponse, invmassLc);
-      //Printf("tmva = %f", tmva); 
-      fBDTHisto->Fill(BDTResponse, invmassLc);
-      fBDTHistoTMVA->Fill(tmva, invmassLc); 
-      if (fDebugHistograms) {
-	if (fUseXmlWeightsFile || fUseXmlFileFromCVMFS) BDTResponse = tmva; // we fill the debug histogram with the output from the xml file
-	fBDTHistoVsMassK0S->Fill(BDTResponse, invmassK0s);
-	fBDTHistoVstImpParBach->Fill(BDTResponse, part->Getd0Prong(0));
-	fBDTHistoVstImpParV0->Fill(BDTResponse, part->Getd0Prong(1));
-	fBDTHistoVsBachelorPt->Fill(BDTResponse, bachelor->Pt());
-	fBDTHistoVsCombinedProtonProb->Fill(BDTResponse, probProton);
-	fBDTHistoVsCtau->Fill(BDTResponse, (part->DecayLengthV0())*0.497/(v0part->P()));
-	fBDTHistoVsCosPAK0S->Fill(BDTResponse, part->CosV0PointingAngle());
-	fBDTHistoVsSignd0->Fill(BDTResponse, signd0);
-	fBDTHistoVsCosThetaStar->Fill(BDTResponse, cts);
-	fBDTHistoVsnSigmaTPCpr->Fill(BDTResponse, nSigmaTPCpr);
-	fBDTHistoVsnSigmaTOFpr->Fill(BDTResponse, nSigmaTOFpr);
-	fBDTHistoVsnSigmaTPCpi->Fill(BDTResponse, nSigmaTPCpi);
-	fBDTHistoVsnSigmaTPCka->Fill(BDTResponse, nSigmaTPCka);
-	fBDTHistoVsBachelorP->Fill(BDTResponse, bachelor->P());
-	fBDTHistoVsBachelorTPCP->Fill(BDTResponse, bachelor->GetTPCmomentum());
-	fHistoNsigmaTPC->Fill(bachelor->P(), nSigmaTPCpr);
-	fHistoNsigmaTOF->Fill(bachelor->P(), nSigmaTOFpr);
+      Double_t fillVars[kNBDTFillVars];
+      fillVars[kBDTFillMassLc] = invmassLc;
+      fillVars[kBDTFillMassK0S] = invmassK0s;
+      fillVars[kBDTFillImpParBach] = part->Getd0Prong(0);
+      fillVars[kBDTFillImpParV0] = part->Getd0Prong(1);
+      fillVars[kBDTFillBachelorPt] = bachelor->Pt();
+      fillVars[kBDTFillProtonProb] = probProton;
+      fillVars[kBDTFillCtau] = (part->DecayLengthV0())*0.497/(v0part->P());
+      fillVars[kBDTFillCosPAK0S] = part->CosV0PointingAngle();
+      fillVars[kBDTFillSignd0] = signd0;
+      fillVars[kBDTFillCosThetaStar] = cts;
+      fillVars[kBDTFillnSigmaTPCpr] = nSigmaTPCpr;
+      fillVars[kBDTFillnSigmaTOFpr] = nSigmaTOFpr;
+      fillVars[kBDTFillnSigmaTPCpi] = nSigmaTPCpi;
+      fillVars[kBDTFillnSigmaTPCka] = nSigmaTPCka;
+      fillVars[kBDTFillBachelorP] = bachelor->P();
+      fillVars[kBDTFillBachelorTPCP] = bachelor->GetTPCmomentum();
+      if (fUseWeightsLibrary && fBDTForest) {
+	// evaluated with the other candidates of the event in FlushBDTCandidates()
+	fBDTCandVars.insert(fBDTCandVars.end(), inputVars.begin(), inputVars.end());
+	fBDTCandFillVars.insert(fBDTCandFillVars.end(), fillVars, fillVars+kNBDTFillVars);
+	fBDTCandTMVA.push_back(tmva);
+      }
+      else {
+	if (fUseWeightsLibrary) BDTResponse = fBDTReader->GetMvaValue(inputVars);
+	FillBDTHistos(BDTResponse, tmva, fillVars);
       }
     }
     
@@ -2304,6 +2328,53 @@ void AliAnalysisTaskSELc2V0bachelorTMVAApp::FillLc2pK0Sspectrum(AliAODRecoCascad
   
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSELc2V0bachelorTMVAApp::FillBDTHistos(Double_t BDTResponse, Double_t tmva, const Double_t *fillVars) {
+
+  /// fill the BDT histograms of a candidate, fillVars indexed by EBDTFillVar
+  //Printf("BDTResponse = %f, invmassLc = %f", BDTResponse, fillVars[kBDTFillMassLc]);
+  //Printf("tmva = %f", tmva);
+  fBDTHisto->Fill(BDTResponse, fillVars[kBDTFillMassLc]);
+  fBDTHistoTMVA->Fill(tmva, fillVars[kBDTFillMassLc]);
+  if (fDebugHistograms) {
+    if (fUseXmlWeightsFile || fUseXmlFileFromCVMFS) BDTResponse = tmva; // we fill the debug histogram with the output from the xml file
+    fBDTHistoVsMassK0S->Fill(BDTResponse, fillVars[kBDTFillMassK0S]);
+    fBDTHistoVstImpParBach->Fill(BDTResponse, fillVars[kBDTFillImpParBach]);
+    fBDTHistoVstImpParV0->Fill(BDTResponse, fillVars[kBDTFillImpParV0]);
+    fBDTHistoVsBachelorPt->Fill(BDTResponse, fillVars[kBDTFillBachelorPt]);
+    fBDTHistoVsCombinedProtonProb->Fill(BDTResponse, fillVars[kBDTFillProtonProb]);
+    fBDTHistoVsCtau->Fill(BDTResponse, fillVars[kBDTFillCtau]);
+    fBDTHistoVsCosPAK0S->Fill(BDTResponse, fillVars[kBDTFillCosPAK0S]);
+    fBDTHistoVsSignd0->Fill(BDTResponse, fillVars[kBDTFillSignd0]);
+    fBDTHistoVsCosThetaStar->Fill(BDTResponse, fillVars[kBDTFillCosThetaStar]);
+    fBDTHistoVsnSigmaTPCpr->Fill(BDTResponse, fillVars[kBDTFillnSigmaTPCpr]);
+    fBDTHistoVsnSigmaTOFpr->Fill(BDTResponse, fillVars[kBDTFillnSigmaTOFpr]);
+    fBDTHistoVsnSigmaTPCpi->Fill(BDTResponse, fillVars[kBDTFillnSigmaTPCpi]);
+    fBDTHistoVsnSigmaTPCka->Fill(BDTResponse, fillVars[kBDTFillnSigmaTPCka]);
+    fBDTHistoVsBachelorP->Fill(BDTResponse, fillVars[kBDTFillBachelorP]);
+    fBDTHistoVsBachelorTPCP->Fill(BDTResponse, fillVars[kBDTFillBachelorTPCP]);
+    fHistoNsigmaTPC->Fill(fillVars[kBDTFillBachelorP], fillVars[kBDTFillnSigmaTPCpr]);
+    fHistoNsigmaTOF->Fill(fillVars[kBDTFillBachelorP], fillVars[kBDTFillnSigmaTOFpr]);
+  }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskSELc2V0bachelorTMVAApp::FlushBDTCandidates() {
+
+  /// evaluate the candidates queued for AliHFBDTForest in one batch
+  /// (AliHFBDTForest::GetMvaValues) and fill the BDT histograms
+  const Int_t nCand = fBDTCandTMVA.size();
+  if (nCand == 0) return;
+  std::vector<Double_t> response(nCand);
+  fBDTForest->GetMvaValues(fBDTCandVars.data(), nCand, response.data());
+  for (Int_t icand = 0; icand < nCand; icand++) {
+    FillBDTHistos(response[icand], fBDTCandTMVA[icand], &fBDTCandFillVars[icand*kNBDTFillVars]);
+  }
+  fBDTCandVars.clear();
+  fBDTCandFillVars.clear();
+  fBDTCandTMVA.clear();
+}
+
 //________________________________________________________________________
 Int_t AliAnalysisTaskSELc2V0bachelorTMVAApp::CallKFVertexing(AliAODRecoCascadeHF *cascade, AliAODv0* v0part, AliAODTrack* bach, TClonesArray *mcArray,
 							  Double_t* V0KF, Double_t* errV0KF, Double_t* LcKF, Double_t* errLcKF,
@@ -39,10 +39,12 @@
 #include <TMVA/Reader.h>
 #include <TMVA/MethodCuts.h>
 #include <TProfile.h>
+#include <vector>
 
 /// \class AliAnalysisTaskSELc2V0bachelorTMVAApp
 
 class IClassifierReader;
+class AliHFBDTForest;
 class ReadBDT_Default;
 
 class TH1F;
@@ -188,6 +190,9 @@ class AliAnalysisTaskSELc2V0bachelorTMVAApp : public AliAnalysisTaskSE
   void SetXmlFileFromCVMFS(TString fileName) {fXmlFileFromCVMFS = fileName;}
   TString GetXmlFileFromCVMFS() const {return fXmlFileFromCVMFS;}
 
+  void SetBDTForestFile(TString fileName) {fBDTForestFile = fileName;}
+  TString GetBDTForestFile() const {return fBDTForestFile;}
+
   void SetUseMultiplicityCorrection(Bool_t flag){fUseMultCorrection=flag;}
 
   void SetReferenceMultiplcity(Double_t rmu){fRefMult=rmu;}
@@ -415,6 +420,14 @@ class AliAnalysisTaskSELc2V0bachelorTMVAApp : public AliAnalysisTaskSE
 			Double_t* distances, Double_t* armPolKF);
 
   void FillMCHisto(TClonesArray *mcArray);
+  void FillBDTHistos(Double_t BDTResponse, Double_t tmva, const Double_t *fillVars);
+  void FlushBDTCandidates();
+
+  /// variables of a candidate for the BDT histograms (FillBDTHistos)
+  enum EBDTFillVar {kBDTFillMassLc, kBDTFillMassK0S, kBDTFillImpParBach, kBDTFillImpParV0, kBDTFillBachelorPt,
+                    kBDTFillProtonProb, kBDTFillCtau, kBDTFillCosPAK0S, kBDTFillSignd0, kBDTFillCosThetaStar,
+                    kBDTFillnSigmaTPCpr, kBDTFillnSigmaTOFpr, kBDTFillnSigmaTPCpi, kBDTFillnSigmaTPCka,
+                    kBDTFillBachelorP, kBDTFillBachelorTPCP, kNBDTFillVars};
 
   AliAnalysisTaskSELc2V0bachelorTMVAApp(const AliAnalysisTaskSELc2V0bachelorTMVAApp &source);
   AliAnalysisTaskSELc2V0bachelorTMVAApp& operator=(const AliAnalysisTaskSELc2V0bachelorTMVAApp& source); 
@@ -605,6 +618,11 @@ class AliAnalysisTaskSELc2V0bachelorTMVAApp : public AliAnalysisTaskSE
   TH2D *fBDTHistoTMVA;                  //!<! BDT histo file for the case in which the xml file is used
   Bool_t fUseXmlFileFromCVMFS;          // Boolean to acces Xml from CVMFS path
   TString fXmlFileFromCVMFS;            // Path in CVMFS directory
+  TString fBDTForestFile;               // weight file (xml or binary) evaluated with AliHFBDTForest when using the weights library
+  AliHFBDTForest *fBDTForest;           //!<! fBDTReader if it is an AliHFBDTForest (candidates evaluated in batches)
+  std::vector<Double_t> fBDTCandVars;     //!<! BDT input variables of the candidates queued for fBDTForest
+  std::vector<Double_t> fBDTCandFillVars; //!<! histogram variables (EBDTFillVar) of the queued candidates
+  std::vector<Double_t> fBDTCandTMVA;     //!<! TMVA::Reader response of the queued candidates
   
   // Multiplicity corrections
   TProfile* GetEstimatorHistogram(const AliVEvent *event);
@@ -624,7 +642,7 @@ class AliAnalysisTaskSELc2V0bachelorTMVAApp : public AliAnalysisTaskSE
   TH2F* fHistoVzVsNtrCorr;           //!<! hist. Vz vs corrected tracklets
   
   /// \cond CLASSIMP    
-  ClassDef(AliAnalysisTaskSELc2V0bachelorTMVAApp, 12); /// class for Lc->p K0
+  ClassDef(AliAnalysisTaskSELc2V0bachelorTMVAApp, 13); /// class for Lc->p K0
   /// \endcond    
 };
 
@@ -80,6 +80,7 @@
 #include <TMVA/MethodCuts.h>
 
 #include "IClassifierReader.h"
+#include "AliHFBDTForest.h"
 
 using std::cout;
 using std::endl;
@@ -193,6 +194,7 @@ AliAnalysisTaskSESigmacTopK0Spi::AliAnalysisTaskSESigmacTopK0Spi():
   fMultiplicityCutMax(99999.),
   fUseXmlFileFromCVMFS(kFALSE),
   fXmlFileFromCVMFS(""),
+  fBDTForestFile(""),
   ftrackArraySelSoftPi(0x0),
   fnSelSoftPi(),
   fESDtrackCutsSoftPion(0x0),
@@ -318,6 +320,7 @@ AliAnalysisTaskSESigmacTopK0Spi::AliAnalysisTaskSESigmacTopK0Spi(const Char_t* n
   fMultiplicityCutMax(99999.),
   fUseXmlFileFromCVMFS(kFALSE),
   fXmlFileFromCVMFS(""),
+  fBDTForestFile(""),
   ftrackArraySelSoftPi(0x0),
   fnSelSoftPi(),
   fESDtrackCutsSoftPion(0x0),
@@ -872,7 +875,15 @@ void AliAnalysisTaskSESigmacTopK0Spi::UserCreateOutputObjects() {
       if (fUseXmlWeightsFile || fUseXmlFileFromCVMFS) fReader->AddSpectator(variable.Data(), &fVarsTMVASpectators[i]);
     }
     delete tokensSpectators;
-    if (fUseWeightsLibrary) {
+    if (fUseWeightsLibrary && !fBDTForestFile.IsNull()) {
+      // flat BDT evaluator reading the weights at runtime, no generated class needed
+      AliHFBDTForest* forest = new AliHFBDTForest(inputNamesVec);
+      if (!forest->Load(fBDTForestFile.Data())) {
+        AliFatal(Form("Cannot load BDT from %s", fBDTForestFile.Data()));
+      }
+      fBDTReader = forest;
+    }
+    else if (fUseWeightsLibrary) {
       void* lib = dlopen(fTMVAlibName.Data(), RTLD_NOW);
       void* p = dlsym(lib, Form("%s", fTMVAlibPtBin.Data()));
       IClassifierReader* (*maker1)(std::vector<std::string>&) = (IClassifierReader* (*)(std::vector<std::string>&)) p;
@@ -1934,6 +1945,7 @@ void AliAnalysisTaskSESigmacTopK0Spi::FillLc2pK0Sspectrum(AliAODRecoCascadeHF *p
       }
       
       if (fUseXmlWeightsFile || fUseXmlFileFromCVMFS) tmva = fReader->EvaluateMVA("BDT method");
+      // per candidate also with AliHFBDTForest: the response enters the Sigmac candidates built below
       if (fUseWeightsLibrary) BDTResponse = fBDTReader->GetMvaValue(inputVars);
       //Printf("BDTResponse = %f, invmassLc = %f", BDTResponse, invmassLc);
       //Printf("tmva = %f", tmva); 
@@ -182,6 +182,9 @@ class AliAnalysisTaskSESigmacTopK0Spi : public AliAnalysisTaskSE
   void SetXmlFileFromCVMFS(TString fileName) {fXmlFileFromCVMFS = fileName;}
   TString GetXmlFileFromCVMFS() const {return fXmlFileFromCVMFS;}
 
+  void SetBDTForestFile(TString fileName) {fBDTForestFile = fileName;}
+  TString GetBDTForestFile() const {return fBDTForestFile;}
+
   void SetUseMultiplicityCorrection(Bool_t flag){fUseMultCorrection=flag;}
 
   void SetReferenceMultiplcity(Double_t rmu){fRefMult=rmu;}
@@ -527,6 +530,7 @@ class AliAnalysisTaskSESigmacTopK0Spi : public AliAnalysisTaskSE
   TH2D *fBDTHistoTMVA;                  //!<! BDT histo file for the case in which the xml file is used
   Bool_t fUseXmlFileFromCVMFS;          // Boolean to acces Xml from CVMFS path
   TString fXmlFileFromCVMFS;            // Path in CVMFS directory
+  TString fBDTForestFile;               // weight file (xml or binary) evaluated with AliHFBDTForest when using the weights library
   
   // Multiplicity corrections
   TProfile* GetEstimatorHistogram(const AliVEvent *event);
@@ -563,7 +567,7 @@ class AliAnalysisTaskSESigmacTopK0Spi : public AliAnalysisTaskSE
   Bool_t isLcAnalysis;                    /// fill tree with only Lc candidates
   
   /// \cond CLASSIMP    
-  ClassDef(AliAnalysisTaskSESigmacTopK0Spi, 2); /// class for Sc ->pi Lc->p K0
+  ClassDef(AliAnalysisTaskSESigmacTopK0Spi, 3); /// class for Sc ->pi Lc->p K0
   /// \endcond    
 };
 
@@ -27,6 +27,7 @@
 //                F.Prino, R.Romita, X.M.Zhang
 //----------------------------------------------------------------------------
 #include <Riostream.h>
+#include <vector>
 #include <TFile.h>
 #include <TDatabasePDG.h>
 #include <TString.h>
@@ -142,6 +143,7 @@ fMassCutBeforeVertexing(kFALSE),
 fMassCalc2(0),
 fMassCalc3(0),
 fMassCalc4(0),
+fCand3ProngWork(0),
 fMinPt3Prong(0.),
 fOKInvMassD0(kFALSE),
 fOKInvMassJpsi(kFALSE),
@@ -241,6 +243,7 @@ fMassCutBeforeVertexing(source.fMassCutBeforeVertexing),
 fMassCalc2(source.fMassCalc2),
 fMassCalc3(source.fMassCalc3),
 fMassCalc4(source.fMassCalc4),
+fCand3ProngWork(0),
 fMinPt3Prong(source.fMinPt3Prong),
 fOKInvMassD0(source.fOKInvMassD0),
 fOKInvMassJpsi(source.fOKInvMassJpsi),
@@ -384,6 +387,7 @@ AliAnalysisVertexingHF::~AliAnalysisVertexingHF() {
   if(fMassCalc2) { delete fMassCalc2; fMassCalc2=0; }
   if(fMassCalc3) { delete fMassCalc3; fMassCalc3=0; }
   if(fMassCalc4) { delete fMassCalc4; fMassCalc4=0; }
+  if(fCand3ProngWork) { delete fCand3ProngWork; fCand3ProngWork=0; }
 }
 //----------------------------------------------------------------------------
 TList *AliAnalysisVertexingHF::FillListOfCuts() {
@@ -629,6 +633,46 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
 
+  // momenta of the selected tracks at the primary vertex, stored contiguously
+  // to pre-screen the 3- and 4-prong combinations with the invariant mass
+  // cuts before computing track-to-track DCAs
+  Double_t *seleMomX = new Double_t[nSeleTrks+1];
+  Double_t *seleMomY = new Double_t[nSeleTrks+1];
+  Double_t *seleMomZ = new Double_t[nSeleTrks+1];
+  for(Int_t iSele=0; iSele<nSeleTrks; iSele++){
+    Double_t momAtVtx[3];
+    ((AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iSele))->GetPxPyPz(momAtVtx);
+    seleMomX[iSele]=momAtVtx[0];
+    seleMomY[iSele]=momAtVtx[1];
+    seleMomZ[iSele]=momAtVtx[2];
+  }
+
+  // outcome of the track-to-track DCA cut (dcaMax) for the pairs of
+  // selected tracks already evaluated in this event, indexed as
+  // caller*nSeleTrks+argument of AliExternalTrackParam::GetDCA.
+  // The DCAs are always computed from the parameters at the primary
+  // vertex, so a pair failing the cut once fails it in every 2-, 3- and
+  // 4-prong combination and these are skipped before resetting the
+  // parameters and recomputing the DCA
+  const Int_t kMaxSeleTrksPairDCA=16384;
+  Bool_t usePairDCA=(nSeleTrks<=kMaxSeleTrksPairDCA);
+  std::vector<bool> pairDCAKnown, pairDCAFail;
+  if(usePairDCA){
+    pairDCAKnown.assign(nSeleTrks*nSeleTrks,false);
+    pairDCAFail.assign(nSeleTrks*nSeleTrks,false);
+  }
+  auto pairDCAFailed=[&](Int_t iCaller,Int_t iArg) -> Bool_t {
+    if(!usePairDCA) return kFALSE;
+    Int_t iPair=iCaller*nSeleTrks+iArg;
+    return pairDCAKnown[iPair] && pairDCAFail[iPair];
+  };
+  auto storePairDCA=[&](Int_t iCaller,Int_t iArg,Double_t dca) {
+    if(!usePairDCA) return;
+    Int_t iPair=iCaller*nSeleTrks+iArg;
+    pairDCAKnown[iPair]=true;
+    pairDCAFail[iPair]=(dca>dcaMax);
+  };
+
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
   TObjArray *twoTrackArray2    = new TObjArray(2);
@@ -868,6 +912,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
       }
 
+      // pair already known to fail the DCA cut
+      if(pairDCAFailed(iTrkP1,iTrkN1)) { negtrack1=0; continue; }
+
       // back to primary vertex
       //      postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
       //      negtrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -877,6 +924,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
       // DCA between the two tracks
       dcap1n1 = postrack1->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
+      storePairDCA(iTrkP1,iTrkN1,dcap1n1);
       if(dcap1n1>dcaMax) { negtrack1=0; continue; }
 
       // Vertexing
@@ -1129,6 +1177,25 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	  if(!TESTBIT(seleFlags[iTrkP1],kBitKaonCompat) &&
 	     !TESTBIT(seleFlags[iTrkP2],kBitKaonCompat) ) okForDsToKKpi=kFALSE;
 	}
+	// check invariant mass cuts for D+,Ds,Lc
+	// (momenta at primary vertex, before the more expensive DCA calculation)
+        massCutOK=kTRUE;
+	if(f3Prong && fMassCutBeforeVertexing) {
+	  mompos2[0]=seleMomX[iTrkP2]; mompos2[1]=seleMomY[iTrkP2]; mompos2[2]=seleMomZ[iTrkP2];
+	  Double_t pxDau[3]={mompos1[0],momneg1[0],mompos2[0]};
+	  Double_t pyDau[3]={mompos1[1],momneg1[1],mompos2[1]};
+	  Double_t pzDau[3]={mompos1[2],momneg1[2],mompos2[2]};
+	  //	    massCutOK = SelectInvMassAndPt3prong(threeTrackArray);
+	  massCutOK = SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus);
+	  if(!massCutOK && !f4Prong) {
+	    postrack2=0;
+	    continue;
+	  }
+	}
+
+	// pairs already known to fail the DCA cut
+	if(pairDCAFailed(iTrkP2,iTrkN1) || pairDCAFailed(iTrkP2,iTrkP1)) { postrack2=0; continue; }
+
 	// back to primary vertex
 	//	postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
 	//	postrack2->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -1140,12 +1207,12 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	//printf("********** %d %d %d\n",postrack1->GetID(),postrack2->GetID(),negtrack1->GetID());
 
 	dcap2n1 = postrack2->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
+	storePairDCA(iTrkP2,iTrkN1,dcap2n1);
 	if(dcap2n1>dcaMax) { postrack2=0; continue; }
 	dcap1p2 = postrack2->GetDCA(postrack1,fBzkG,xdummy,ydummy);
+	storePairDCA(iTrkP2,iTrkP1,dcap1p2);
 	if(dcap1p2>dcaMax) { postrack2=0; continue; }
 
-	// check invariant mass cuts for D+,Ds,Lc
-        massCutOK=kTRUE;
 	if(f3Prong) {
 	  if(postrack2->Charge()>0) {
 	    threeTrackArray->AddAt(postrack1,0);
@@ -1156,14 +1223,6 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    threeTrackArray->AddAt(postrack1,1);
 	    threeTrackArray->AddAt(postrack2,2);
 	  }
-	  if(fMassCutBeforeVertexing){
-	    postrack2->GetPxPyPz(mompos2);
-	    Double_t pxDau[3]={mompos1[0],momneg1[0],mompos2[0]};
-	    Double_t pyDau[3]={mompos1[1],momneg1[1],mompos2[1]};
-	    Double_t pzDau[3]={mompos1[2],momneg1[2],mompos2[2]};
-	    //	    massCutOK = SelectInvMassAndPt3prong(threeTrackArray);
-	    massCutOK = SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus);
-	  }
 	}
 
 	if(f3Prong && !massCutOK) {
@@ -1220,7 +1279,10 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    }
 
 	  }
-	  if(io3Prong) {delete io3Prong; io3Prong=NULL;}
+	  // io3Prong is owned by this class (fCand3ProngWork), not to be deleted:
+	  // drop its TRef to the secondary vertex before the vertex is deleted
+	  if(io3Prong) io3Prong->SetSecondaryVtx(0x0);
+	  io3Prong=NULL;
 	  if(secVert3PrAOD) {delete secVert3PrAOD; secVert3PrAOD=NULL;}
 	}
 
@@ -1267,6 +1329,20 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 		 evtNumber[iTrkN1]==evtNumber[iTrkP2]) continue;
 	    }
 
+	    // check invariant mass cuts for D0 before the DCA calculation
+	    if(fMassCutBeforeVertexing){
+	      Double_t pxDau4[4]={seleMomX[iTrkP1],seleMomX[iTrkN1],seleMomX[iTrkP2],seleMomX[iTrkN2]};
+	      Double_t pyDau4[4]={seleMomY[iTrkP1],seleMomY[iTrkN1],seleMomY[iTrkP2],seleMomY[iTrkN2]};
+	      Double_t pzDau4[4]={seleMomZ[iTrkP1],seleMomZ[iTrkN1],seleMomZ[iTrkP2],seleMomZ[iTrkN2]};
+	      if(!SelectInvMassAndPt4prong(pxDau4,pyDau4,pzDau4)) {
+		negtrack2=0;
+		continue;
+	      }
+	    }
+
+	    // pairs already known to fail the DCA cut (dcaMax is looser than the 4-prong one)
+	    if(pairDCAFailed(iTrkP1,iTrkN2) || pairDCAFailed(iTrkP2,iTrkN2)) { negtrack2=0; continue; }
+
 	    // back to primary vertex
 	    // postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
 	    // postrack2->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -1278,8 +1354,10 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 
 	    dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	    storePairDCA(iTrkP1,iTrkN2,dcap1n2);
 	    if(dcap1n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
             dcap2n2 = postrack2->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+            storePairDCA(iTrkP2,iTrkN2,dcap2n2);
             if(dcap2n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
 
 
@@ -1288,17 +1366,6 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    fourTrackArray->AddAt(postrack2,2);
 	    fourTrackArray->AddAt(negtrack2,3);
 
-	    // check invariant mass cuts for D0
-	    massCutOK=kTRUE;
-	    if(fMassCutBeforeVertexing)
-	      massCutOK = SelectInvMassAndPt4prong(fourTrackArray);
-
-	    if(!massCutOK) {
-	      fourTrackArray->Clear();
-	      negtrack2=0;
-	      continue;
-	    }
-
 	    // Vertexing
 	    AliAODVertex* secVert4PrAOD = ReconstructSecondaryVertex(fourTrackArray,dispersion);
 	    io4Prong = Make4Prong(fourTrackArray,event,secVert4PrAOD,vertexp1n1,vertexp1n1p2,dcap1n1,dcap1n2,dcap2n1,dcap2n2,ok4Prong);
@@ -1401,6 +1468,23 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	     !TESTBIT(seleFlags[iTrkN2],kBitKaonCompat) ) okForDsToKKpi=kFALSE;
 	}
 
+	// check invariant mass cuts for D+,Ds,Lc
+	// (momenta at primary vertex, before the more expensive DCA calculation)
+	if(fMassCutBeforeVertexing && f3Prong){
+	  momneg2[0]=seleMomX[iTrkN2]; momneg2[1]=seleMomY[iTrkN2]; momneg2[2]=seleMomZ[iTrkN2];
+	  Double_t pxDau[3]={momneg1[0],mompos1[0],momneg2[0]};
+	  Double_t pyDau[3]={momneg1[1],mompos1[1],momneg2[1]};
+	  Double_t pzDau[3]={momneg1[2],mompos1[2],momneg2[2]};
+	  //	  massCutOK = SelectInvMassAndPt3prong(threeTrackArray);
+	  if(!SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus)) {
+	    negtrack2=0;
+	    continue;
+	  }
+	}
+
+	// pairs already known to fail the DCA cut
+	if(pairDCAFailed(iTrkP1,iTrkN2) || pairDCAFailed(iTrkN1,iTrkN2)) { negtrack2=0; continue; }
+
 	// back to primary vertex
 	// postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
 	// negtrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -1411,30 +1495,16 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	//printf("********** %d %d %d\n",postrack1->GetID(),negtrack1->GetID(),negtrack2->GetID());
 
 	dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	storePairDCA(iTrkP1,iTrkN2,dcap1n2);
 	if(dcap1n2>dcaMax) { negtrack2=0; continue; }
 	dcan1n2 = negtrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	storePairDCA(iTrkN1,iTrkN2,dcan1n2);
 	if(dcan1n2>dcaMax) { negtrack2=0; continue; }
 
 	threeTrackArray->AddAt(negtrack1,0);
 	threeTrackArray->AddAt(postrack1,1);
 	threeTrackArray->AddAt(negtrack2,2);
 
-	// check invariant mass cuts for D+,Ds,Lc
-        massCutOK=kTRUE;
-	if(fMassCutBeforeVertexing && f3Prong){
-	  negtrack2->GetPxPyPz(momneg2);
-	  Double_t pxDau[3]={momneg1[0],mompos1[0],momneg2[0]};
-	  Double_t pyDau[3]={momneg1[1],mompos1[1],momneg2[1]};
-	  Double_t pzDau[3]={momneg1[2],mompos1[2],momneg2[2]};
-	  //	  massCutOK = SelectInvMassAndPt3prong(threeTrackArray);
-	  massCutOK = SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus);
-	}
-	if(!massCutOK) {
-	  threeTrackArray->Clear();
-	  negtrack2=0;
-	  continue;
-	}
-
 	// Vertexing
 	twoTrackArray2->AddAt(postrack1,0);
 	twoTrackArray2->AddAt(negtrack2,1);
@@ -1476,7 +1546,10 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
 	    }
 	  }
-	  if(io3Prong) {delete io3Prong; io3Prong=NULL;}
+	  // io3Prong is owned by this class (fCand3ProngWork), not to be deleted:
+	  // drop its TRef to the secondary vertex before the vertex is deleted
+	  if(io3Prong) io3Prong->SetSecondaryVtx(0x0);
+	  io3Prong=NULL;
 	  if(secVert3PrAOD) {delete secVert3PrAOD; secVert3PrAOD=NULL;}
 	}
 	threeTrackArray->Clear();
@@ -1538,6 +1611,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   threeTrackArray->Delete(); delete threeTrackArray;
   fourTrackArray->Delete();  delete fourTrackArray;
   delete [] seleFlags; seleFlags=NULL;
+  delete [] seleMomX; delete [] seleMomY; delete [] seleMomZ;
   if(evtNumber) {delete [] evtNumber; evtNumber=NULL;}
   tracksAtVertex.Delete();
 
@@ -2493,8 +2567,26 @@ AliAODRecoDecayHF3Prong* AliAnalysisVertexingHF::Make3Prong(
   Short_t charge=(Short_t)(postrack1->Charge()+postrack2->Charge()+negtrack->Charge());
 
 
-  // construct the candidate passing a NULL pointer for the secondary vertex to avoid creation of TRef
-  AliAODRecoDecayHF3Prong *the3Prong = new AliAODRecoDecayHF3Prong(0x0,px,py,pz,d0,d0err,dca,dispersion,dist12,dist23,charge);
+  // the candidate object is owned by this class and reused for all the triplets:
+  // it is copied to the output TClonesArray only if it passes the filtering cuts
+  // construct it passing a NULL pointer for the secondary vertex to avoid creation of TRef
+  AliAODRecoDecayHF3Prong *the3Prong = fCand3ProngWork;
+  if(!the3Prong){
+    the3Prong = new AliAODRecoDecayHF3Prong(0x0,px,py,pz,d0,d0err,dca,dispersion,dist12,dist23,charge);
+    fCand3ProngWork = the3Prong;
+  }else{
+    // reset the TRef (possibly) set for the previous candidate and refill the data members
+    the3Prong->SetSecondaryVtx(0x0);
+    the3Prong->SetPxPyPzProngs(3,px,py,pz);
+    the3Prong->SetDCAs(3,dca);
+    the3Prong->Setd0Prongs(3,d0);
+    the3Prong->Setd0errProngs(3,d0err);
+    the3Prong->SetCharge(charge);
+    the3Prong->SetSigmaVert(dispersion);
+    the3Prong->SetDist12toPrim(dist12);
+    the3Prong->SetDist23toPrim(dist23);
+    the3Prong->ResetSelectionMap();
+  }
   // add a pointer to the secondary vertex via SetOwnSecondaryVtx (no TRef created)
   AliAODVertex* ownsecv=secVert->CloneWithoutRefs();
   the3Prong->SetOwnSecondaryVtx(ownsecv);
@@ -332,6 +332,7 @@ class AliAnalysisVertexingHF : public TNamed {
   AliAODRecoDecay *fMassCalc2; /// for 2 prong
   AliAODRecoDecay *fMassCalc3; /// for 3 prong
   AliAODRecoDecay *fMassCalc4; /// for 4 prong
+  AliAODRecoDecayHF3Prong *fCand3ProngWork; //!<! 3 prong candidate reused for the filtering cuts
   Double_t fMinPt3Prong; /// minimum pt for 3 prong candidates
   Bool_t fOKInvMassD0; /// pair fullfilling D0 inv mass selection
   Bool_t fOKInvMassJpsi; /// pair fullfilling Jpsi inv mass selection
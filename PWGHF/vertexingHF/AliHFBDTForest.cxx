@@ -0,0 +1,438 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <TMath.h>
+#include <TString.h>
+#include <TSystem.h>
+#include <TXMLEngine.h>
+#include "AliLog.h"
+#include "AliHFBDTForest.h"
+
+/// \file AliHFBDTForest.cxx
+/// \brief Flat, data-driven evaluation of TMVA BDT weight files
+
+namespace {
+  const Int_t kBinaryVersion = 1;
+  const char kBinaryMagic[8] = {'A','L','I','H','F','B','D','T'};
+
+  //_________________________________________________________________________
+  XMLNodePointer_t FindChild(TXMLEngine& xml, XMLNodePointer_t node, const char* name){
+    /// first child of node with the given name
+    for(XMLNodePointer_t child=xml.GetChild(node); child; child=xml.GetNext(child)){
+      if(!strcmp(xml.GetNodeName(child),name)) return child;
+    }
+    return 0x0;
+  }
+
+  //_________________________________________________________________________
+  XMLNodePointer_t FindDaughter(TXMLEngine& xml, XMLNodePointer_t node, const char* pos){
+    /// daughter of a tree node at position "l" or "r"
+    for(XMLNodePointer_t child=xml.GetChild(node); child; child=xml.GetNext(child)){
+      if(strcmp(xml.GetNodeName(child),"Node")) continue;
+      const char* p=xml.GetAttr(child,"pos");
+      if(p && !strcmp(p,pos)) return child;
+    }
+    return 0x0;
+  }
+
+  //_________________________________________________________________________
+  Double_t GetAttrDouble(TXMLEngine& xml, XMLNodePointer_t node, const char* name, Double_t def=0.){
+    const char* val=xml.GetAttr(node,name);
+    return val ? atof(val) : def;
+  }
+}
+
+//_________________________________________________________________________
+AliHFBDTForest::AliHFBDTForest() :
+  IClassifierReader(),
+  fInputVars(),
+  fVarNames(),
+  fBoostType(kAdaBoost),
+  fUseYesNoLeaf(kTRUE),
+  fTreeRoot(),
+  fBoostWeights(),
+  fSumBoostWeights(0.),
+  fSelector(),
+  fCutValue(),
+  fRightNode(),
+  fCutType()
+{
+  /// default constructor, no check of the variable names
+  fStatusIsClean=false;
+}
+
+//_________________________________________________________________________
+AliHFBDTForest::AliHFBDTForest(const std::vector<std::string>& inputVars) :
+  IClassifierReader(),
+  fInputVars(inputVars),
+  fVarNames(),
+  fBoostType(kAdaBoost),
+  fUseYesNoLeaf(kTRUE),
+  fTreeRoot(),
+  fBoostWeights(),
+  fSumBoostWeights(0.),
+  fSelector(),
+  fCutValue(),
+  fRightNode(),
+  fCutType()
+{
+  /// standard constructor: the variable names are validated against
+  /// the ones stored in the weight file when it is loaded, as done by the
+  /// classes generated by TMVA
+  fStatusIsClean=false;
+}
+
+//_________________________________________________________________________
+void AliHFBDTForest::Reset(){
+  /// clear the forest
+  fVarNames.clear();
+  fBoostType=kAdaBoost;
+  fUseYesNoLeaf=kTRUE;
+  fTreeRoot.clear();
+  fBoostWeights.clear();
+  fSumBoostWeights=0.;
+  fSelector.clear();
+  fCutValue.clear();
+  fRightNode.clear();
+  fCutType.clear();
+  fStatusIsClean=false;
+}
+
+//_________________________________________________________________________
+Bool_t AliHFBDTForest::Load(const char* fileName){
+  /// load the forest, the format is chosen from the file extension
+  TString name(fileName);
+  if(name.EndsWith(".xml")) return LoadXML(fileName);
+  return LoadBinary(fileName);
+}
+
+//_________________________________________________________________________
+Bool_t AliHFBDTForest::LoadXML(const char* fileName){
+  /// read the trees from a TMVA BDT weight file
+
+  Reset();
+  TXMLEngine xml;
+  XMLDocPointer_t doc=xml.ParseFile(gSystem->ExpandPathName(TString(fileName)).Data());
+  if(!doc){
+    AliErrorGeneral("AliHFBDTForest",Form("Cannot parse BDT weight file %s",fileName));
+    return kFALSE;
+  }
+  XMLNodePointer_t mainNode=xml.DocGetRootElement(doc);
+
+  XMLNodePointer_t options=FindChild(xml,mainNode,"Options");
+  for(XMLNodePointer_t opt=(options ? xml.GetChild(options) : 0x0); opt; opt=xml.GetNext(opt)){
+    const char* optName=xml.GetAttr(opt,"name");
+    const char* optVal=xml.GetNodeContent(opt);
+    if(!optName || !optVal) continue;
+    if(!strcmp(optName,"BoostType") && !strcmp(optVal,"Grad")) fBoostType=kGrad;
+    if(!strcmp(optName,"UseYesNoLeaf")) fUseYesNoLeaf=!strcmp(optVal,"True");
+    if(!strcmp(optName,"VarTransform") && strcmp(optVal,"None")){
+      AliWarningGeneral("AliHFBDTForest",Form("Variable transformation %s is not applied by AliHFBDTForest",optVal));
+    }
+  }
+
+  XMLNodePointer_t vars=FindChild(xml,mainNode,"Variables");
+  for(XMLNodePointer_t var=(vars ? xml.GetChild(vars) : 0x0); var; var=xml.GetNext(var)){
+    const char* expr=xml.GetAttr(var,"Expression");
+    fVarNames.push_back(expr ? expr : "");
+  }
+
+  XMLNodePointer_t weights=FindChild(xml,mainNode,"Weights");
+  for(XMLNodePointer_t tree=(weights ? xml.GetChild(weights) : 0x0); tree; tree=xml.GetNext(tree)){
+    if(strcmp(xml.GetNodeName(tree),"BinaryTree")) continue;
+    Double_t boostWeight=GetAttrDouble(xml,tree,"boostWeight");
+    XMLNodePointer_t rootNode=FindChild(xml,tree,"Node");
+    if(!rootNode) continue;
+    fTreeRoot.push_back(fSelector.size());
+    fBoostWeights.push_back(boostWeight);
+    fSumBoostWeights+=boostWeight;
+
+    // depth-first flattening, the left daughter always follows its mother
+    std::vector<std::pair<XMLNodePointer_t,Int_t> > stack;
+    stack.push_back(std::make_pair(rootNode,-1));
+    while(!stack.empty()){
+      XMLNodePointer_t node=stack.back().first;
+      Int_t mother=stack.back().second;
+      stack.pop_back();
+      Int_t index=fSelector.size();
+      if(mother>=0) fRightNode[mother]=index;
+
+      XMLNodePointer_t left=FindDaughter(xml,node,"l");
+      XMLNodePointer_t right=FindDaughter(xml,node,"r");
+      Int_t nodeType=(Int_t)GetAttrDouble(xml,node,"nType");
+      if(!left || !right || nodeType!=0){
+        Double_t leafValue=nodeType;
+        if(fBoostType==kGrad) leafValue=GetAttrDouble(xml,node,"res");
+        else if(!fUseYesNoLeaf) leafValue=GetAttrDouble(xml,node,"purity");
+        fSelector.push_back(-1);
+        fCutValue.push_back(leafValue);
+        fRightNode.push_back(-1);
+        fCutType.push_back(0);
+        continue;
+      }
+      fSelector.push_back((Int_t)GetAttrDouble(xml,node,"IVar"));
+      fCutValue.push_back(GetAttrDouble(xml,node,"Cut"));
+      fRightNode.push_back(-1);
+      fCutType.push_back((Int_t)GetAttrDouble(xml,node,"cType")!=0);
+      // right daughter is pushed first so that the left one is processed next
+      stack.push_back(std::make_pair(right,index));
+      stack.push_back(std::make_pair(left,-1));
+    }
+  }
+  xml.FreeDoc(doc);
+
+  if(fTreeRoot.empty()){
+    AliErrorGeneral("AliHFBDTForest",Form("No decision tree found in %s",fileName));
+    return kFALSE;
+  }
+  if(!CheckNodes(fileName)) return kFALSE;
+  AliInfoGeneral("AliHFBDTForest",Form("Loaded %d trees with %d nodes from %s",GetNTrees(),GetNNodes(),fileName));
+  return CheckInputVars();
+}
+
+//_________________________________________________________________________
+Bool_t AliHFBDTForest::SaveBinary(const char* fileName) const {
+  /// dump the flat forest to a compact binary file
+  std::ofstream out(gSystem->ExpandPathName(TString(fileName)).Data(),std::ios::binary);
+  if(!out.good()){
+    AliErrorGeneral("AliHFBDTForest",Form("Cannot open %s for writing",fileName));
+    return kFALSE;
+  }
+  Int_t nVars=fVarNames.size();
+  Int_t nTrees=fTreeRoot.size();
+  Int_t nNodes=fSelector.size();
+  out.write(kBinaryMagic,sizeof(kBinaryMagic));
+  out.write((const char*)&kBinaryVersion,sizeof(Int_t));
+  out.write((const char*)&fBoostType,sizeof(Int_t));
+  out.write((const char*)&nVars,sizeof(Int_t));
+  for(Int_t i=0; i<nVars; i++){
+    Int_t len=fVarNames[i].size();
+    out.write((const char*)&len,sizeof(Int_t));
+    out.write(fVarNames[i].data(),len);
+  }
+  out.write((const char*)&nTrees,sizeof(Int_t));
+  out.write((const char*)&fTreeRoot[0],nTrees*sizeof(Int_t));
+  out.write((const char*)&fBoostWeights[0],nTrees*sizeof(Double_t));
+  out.write((const char*)&nNodes,sizeof(Int_t));
+  out.write((const char*)&fSelector[0],nNodes*sizeof(Int_t));
+  out.write((const char*)&fCutValue[0],nNodes*sizeof(Double_t));
+  out.write((const char*)&fRightNode[0],nNodes*sizeof(Int_t));
+  out.write((const char*)&fCutType[0],nNodes*sizeof(Char_t));
+  return out.good();
+}
+
+//_________________________________________________________________________
+Bool_t AliHFBDTForest::LoadBinary(const char* fileName){
+  /// read a forest written with SaveBinary. The sizes read from the file
+  /// are checked against the file length and the node links are validated,
+  /// a truncated or corrupted file leaves the forest empty
+  Reset();
+  std::ifstream in(gSystem->ExpandPathName(TString(fileName)).Data(),std::ios::binary);
+  if(!in.good()){
+    AliErrorGeneral("AliHFBDTForest",Form("Cannot open BDT binary file %s",fileName));
+    return kFALSE;
+  }
+  in.seekg(0,std::ios::end);
+  Long64_t fileSize=in.tellg();
+  in.seekg(0,std::ios::beg);
+  // bytes left after the current position
+  auto remaining=[&in,fileSize](){ return fileSize-(Long64_t)in.tellg(); };
+
+  char magic[sizeof(kBinaryMagic)];
+  Int_t version=0;
+  in.read(magic,sizeof(magic));
+  in.read((char*)&version,sizeof(Int_t));
+  if(!in.good() || memcmp(magic,kBinaryMagic,sizeof(magic)) || version!=kBinaryVersion){
+    AliErrorGeneral("AliHFBDTForest",Form("%s is not a valid BDT binary file",fileName));
+    return kFALSE;
+  }
+  Int_t nVars=0, nTrees=0, nNodes=0;
+  in.read((char*)&fBoostType,sizeof(Int_t));
+  in.read((char*)&nVars,sizeof(Int_t));
+  if(!in.good() || (fBoostType!=kAdaBoost && fBoostType!=kGrad) || nVars<0 || (Long64_t)nVars*sizeof(Int_t)>remaining()){
+    AliErrorGeneral("AliHFBDTForest",Form("Corrupted header in BDT binary file %s",fileName));
+    Reset();
+    return kFALSE;
+  }
+  for(Int_t i=0; i<nVars; i++){
+    Int_t len=0;
+    in.read((char*)&len,sizeof(Int_t));
+    if(!in.good() || len<0 || len>remaining()){
+      AliErrorGeneral("AliHFBDTForest",Form("Corrupted variable name in BDT binary file %s",fileName));
+      Reset();
+      return kFALSE;
+    }
+    std::string name(len,' ');
+    if(len>0) in.read(&name[0],len);
+    fVarNames.push_back(name);
+  }
+  in.read((char*)&nTrees,sizeof(Int_t));
+  if(!in.good() || nTrees<=0 || (Long64_t)nTrees*(sizeof(Int_t)+sizeof(Double_t))>remaining()){
+    AliErrorGeneral("AliHFBDTForest",Form("No decision tree found in %s",fileName));
+    Reset();
+    return kFALSE;
+  }
+  fTreeRoot.resize(nTrees);
+  fBoostWeights.resize(nTrees);
+  in.read((char*)&fTreeRoot[0],nTrees*sizeof(Int_t));
+  in.read((char*)&fBoostWeights[0],nTrees*sizeof(Double_t));
+  in.read((char*)&nNodes,sizeof(Int_t));
+  if(!in.good() || nNodes<=0 || (Long64_t)nNodes*(2*sizeof(Int_t)+sizeof(Double_t)+sizeof(Char_t))>remaining()){
+    AliErrorGeneral("AliHFBDTForest",Form("Corrupted BDT binary file %s",fileName));
+    Reset();
+    return kFALSE;
+  }
+  fSelector.resize(nNodes);
+  fCutValue.resize(nNodes);
+  fRightNode.resize(nNodes);
+  fCutType.resize(nNodes);
+  in.read((char*)&fSelector[0],nNodes*sizeof(Int_t));
+  in.read((char*)&fCutValue[0],nNodes*sizeof(Double_t));
+  in.read((char*)&fRightNode[0],nNodes*sizeof(Int_t));
+  in.read((char*)&fCutType[0],nNodes*sizeof(Char_t));
+  if(!in.good()){
+    AliErrorGeneral("AliHFBDTForest",Form("Corrupted BDT binary file %s",fileName));
+    Reset();
+    return kFALSE;
+  }
+  for(Int_t i=0; i<nTrees; i++) fSumBoostWeights+=fBoostWeights[i];
+  if(!CheckNodes(fileName)) return kFALSE;
+  return CheckInputVars();
+}
+
+//_________________________________________________________________________
+Bool_t AliHFBDTForest::CheckNodes(const char* fileName){
+  /// validate the flat node arrays: tree roots and variable indices in
+  /// range, daughters of each internal node after it (pre-order), so that
+  /// the descent in FindLeaf stays in the arrays and terminates.
+  /// The forest is cleared if a check fails
+  Int_t nNodes=fSelector.size();
+  Int_t nVars=fVarNames.size();
+  Bool_t ok=((Int_t)fCutValue.size()==nNodes && (Int_t)fRightNode.size()==nNodes && (Int_t)fCutType.size()==nNodes);
+  for(size_t itree=0; ok && itree<fTreeRoot.size(); itree++){
+    if(fTreeRoot[itree]<0 || fTreeRoot[itree]>=nNodes) ok=kFALSE;
+  }
+  for(Int_t inode=0; ok && inode<nNodes; inode++){
+    if(fSelector[inode]<0) continue;
+    if(fSelector[inode]>=nVars || inode+1>=nNodes ||
+       fRightNode[inode]<=inode+1 || fRightNode[inode]>=nNodes) ok=kFALSE;
+  }
+  if(!ok){
+    AliErrorGeneral("AliHFBDTForest",Form("Inconsistent tree structure in %s",fileName));
+    Reset();
+  }
+  return ok;
+}
+
+//_________________________________________________________________________
+Bool_t AliHFBDTForest::CheckInputVars(){
+  /// validate the variables passed to the constructor against those in the
+  /// weight file
+  fStatusIsClean=true;
+  if(fInputVars.empty()) return kTRUE;
+  if(fInputVars.size()!=fVarNames.size()){
+    AliErrorGeneral("AliHFBDTForest",Form("Mismatch in number of input values: %d != %d",(Int_t)fInputVars.size(),(Int_t)fVarNames.size()));
+    fStatusIsClean=false;
+    return kFALSE;
+  }
+  for(size_t i=0; i<fInputVars.size(); i++){
+    if(fInputVars[i]!=fVarNames[i]){
+      AliErrorGeneral("AliHFBDTForest",Form("Mismatch in input variable names for variable [%d]: %s != %s",(Int_t)i,fInputVars[i].c_str(),fVarNames[i].c_str()));
+      fStatusIsClean=false;
+    }
+  }
+  return fStatusIsClean;
+}
+
+//_________________________________________________________________________
+Int_t AliHFBDTForest::FindLeaf(Int_t node, const Double_t* inputValues) const {
+  /// descend a tree starting from its root node
+  while(fSelector[node]>=0){
+    // same convention as TMVA::DecisionTreeNode::GoesRight
+    Bool_t goesRight=(inputValues[fSelector[node]]>=fCutValue[node]);
+    if(!fCutType[node]) goesRight=!goesRight;
+    node = goesRight ? fRightNode[node] : node+1;
+  }
+  return node;
+}
+
+//_________________________________________________________________________
+Double_t AliHFBDTForest::Normalise(Double_t sum, Double_t norm) const {
+  /// combine the sum of the tree outputs as TMVA does
+  if(fBoostType==kGrad) return 2.0/(1.0+TMath::Exp(-2.0*sum))-1.0;
+  return norm>0. ? sum/norm : 0.;
+}
+
+//_________________________________________________________________________
+double AliHFBDTForest::GetMvaValue(const std::vector<double>& inputValues) const {
+  /// classifier response for one candidate
+  if(!IsStatusClean()){
+    AliErrorGeneral("AliHFBDTForest","Cannot return classifier response because status is dirty");
+    return 0.;
+  }
+  if(inputValues.size()<fVarNames.size()){
+    AliErrorGeneral("AliHFBDTForest",Form("Cannot return classifier response: %d input values given, %d needed",(Int_t)inputValues.size(),(Int_t)fVarNames.size()));
+    return 0.;
+  }
+  Double_t sum=0.;
+  Int_t nTrees=fTreeRoot.size();
+  for(Int_t itree=0; itree<nTrees; itree++){
+    Double_t leaf=fCutValue[FindLeaf(fTreeRoot[itree],&inputValues[0])];
+    sum += (fBoostType==kGrad) ? leaf : fBoostWeights[itree]*leaf;
+  }
+  return Normalise(sum,fSumBoostWeights);
+}
+
+//_________________________________________________________________________
+void AliHFBDTForest::GetMvaValues(const Double_t* inputValues, Int_t nCand, Double_t* response) const {
+  /// classifier response for a batch of candidates. inputValues holds
+  /// nCand rows of GetNVars() values each. The loop over candidates is the
+  /// inner one so that the nodes of a tree stay in cache for the whole batch
+  for(Int_t icand=0; icand<nCand; icand++) response[icand]=0.;
+  if(!IsStatusClean()){
+    AliErrorGeneral("AliHFBDTForest","Cannot return classifier response because status is dirty");
+    return;
+  }
+  Int_t nVars=fVarNames.size();
+  Int_t nTrees=fTreeRoot.size();
+  for(Int_t itree=0; itree<nTrees; itree++){
+    Int_t root=fTreeRoot[itree];
+    Double_t w = (fBoostType==kGrad) ? 1. : fBoostWeights[itree];
+    for(Int_t icand=0; icand<nCand; icand++){
+      response[icand] += w*fCutValue[FindLeaf(root,inputValues+icand*nVars)];
+    }
+  }
+  for(Int_t icand=0; icand<nCand; icand++) response[icand]=Normalise(response[icand],fSumBoostWeights);
+}
+
+//_________________________________________________________________________
+Int_t AliHFBDTForest::CompareResponse(const Double_t* inputValues, Int_t nCand, const Double_t* reference, Double_t tolerance) const {
+  /// compare the response for a batch of candidates (same layout as in
+  /// GetMvaValues) with a reference response, e.g. from TMVA::Reader or
+  /// from the class generated by TMVA. Returns the number of candidates
+  /// differing by more than tolerance, the first one is reported
+  std::vector<Double_t> response(nCand);
+  GetMvaValues(inputValues,nCand,response.data());
+  Int_t nDiff=0;
+  for(Int_t icand=0; icand<nCand; icand++){
+    if(TMath::Abs(response[icand]-reference[icand])<=tolerance) continue;
+    if(!nDiff) AliWarningGeneral("AliHFBDTForest",Form("Candidate %d: response %f, reference %f",icand,response[icand],reference[icand]));
+    nDiff++;
+  }
+  return nDiff;
+}
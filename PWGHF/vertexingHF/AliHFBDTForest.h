@@ -0,0 +1,67 @@
+#ifndef ALIHFBDTFOREST_H
+#define ALIHFBDTFOREST_H
+/* Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+#include <string>
+#include <Rtypes.h>
+#include "IClassifierReader.h"
+
+/// \class AliHFBDTForest
+/// \brief Data-driven evaluator of TMVA boosted decision trees
+///
+/// Replacement for the ReadBDT_* classes generated by TMVA MakeClass.
+/// The forest is loaded at runtime from the TMVA weight xml file (or from
+/// a compact binary dump of it, see SaveBinary) and stored as flat node
+/// arrays: the nodes of each tree are kept in pre-order, so the left
+/// daughter of an internal node is the next node and only the index of
+/// the right daughter needs to be stored.
+
+class AliHFBDTForest : public IClassifierReader {
+
+ public:
+  AliHFBDTForest();
+  AliHFBDTForest(const std::vector<std::string>& inputVars);
+  virtual ~AliHFBDTForest() {}
+
+  Bool_t LoadXML(const char* fileName);
+  Bool_t LoadBinary(const char* fileName);
+  Bool_t Load(const char* fileName);
+  Bool_t SaveBinary(const char* fileName) const;
+
+  virtual double GetMvaValue(const std::vector<double>& inputValues) const;
+  void GetMvaValues(const Double_t* inputValues, Int_t nCand, Double_t* response) const;
+  Int_t CompareResponse(const Double_t* inputValues, Int_t nCand, const Double_t* reference, Double_t tolerance=1.e-6) const;
+
+  Int_t GetNVars() const {return fVarNames.size();}
+  Int_t GetNTrees() const {return fBoostWeights.size();}
+  Int_t GetNNodes() const {return fSelector.size();}
+  const std::string& GetVarName(Int_t i) const {return fVarNames[i];}
+
+ private:
+  enum EBoostType {kAdaBoost, kGrad};
+
+  void Reset();
+  Bool_t CheckInputVars();
+  Bool_t CheckNodes(const char* fileName);
+  Int_t FindLeaf(Int_t rootNode, const Double_t* inputValues) const;
+  Double_t Normalise(Double_t sum, Double_t norm) const;
+
+  std::vector<std::string> fInputVars;  /// variables names requested by the user (optional)
+  std::vector<std::string> fVarNames;   /// variable expressions from the weight file
+  Int_t fBoostType;                     /// boost type, used to combine the tree outputs
+  Bool_t fUseYesNoLeaf;                 /// use leaf type (+-1) instead of purity for AdaBoost
+
+  std::vector<Int_t> fTreeRoot;         /// index of the root node of each tree
+  std::vector<Double_t> fBoostWeights;  /// boost weight of each tree
+  Double_t fSumBoostWeights;            /// sum of the boost weights
+
+  // flat node arrays
+  std::vector<Int_t> fSelector;         /// variable index of the cut, -1 for leaves
+  std::vector<Double_t> fCutValue;      /// cut value of internal nodes, leaf value for leaves
+  std::vector<Int_t> fRightNode;        /// index of the right daughter
+  std::vector<Char_t> fCutType;         /// 1 if x>=cut selects the right daughter
+};
+
+#endif
@@ -78,6 +78,7 @@ AliHFInvMassFitter::AliHFInvMassFitter() :
   fNSigma4SideBands(4.),
   fCheckSignalCountsAfterFirstFit(kTRUE),
   fFitOption("L,E"),
+  fMinimizer("Minuit"),
   fRawYield(0.),
   fRawYieldErr(0.),
   fSigFunc(0x0),
@@ -138,6 +139,7 @@ AliHFInvMassFitter::AliHFInvMassFitter(const TH1F *histoToFit, Double_t minvalue
   fNSigma4SideBands(4.),
   fCheckSignalCountsAfterFirstFit(kTRUE),
   fFitOption("L,E"),
+  fMinimizer("Minuit"),
   fRawYield(0.),
   fRawYieldErr(0.),
   fSigFunc(0x0),
@@ -245,7 +247,7 @@ Int_t AliHFInvMassFitter::MassFitter(Bool_t draw){
   /// returns 1 if the fit succeeds
   /// returns 2 if there is no signal and the fit is performed with only background
 
-  TVirtualFitter::SetDefaultFitter("Minuit");
+  if(!fMinimizer.IsNull()) TVirtualFitter::SetDefaultFitter(fMinimizer.Data());
 
   Double_t integralHisto=fHistoInvMass->Integral(fHistoInvMass->FindBin(fMinMass),fHistoInvMass->FindBin(fMaxMass),"width");
 
@@ -260,7 +262,7 @@ Int_t AliHFInvMassFitter::MassFitter(Bool_t draw){
       status=0;
     }
   }
-  else status=fHistoInvMass->Fit("funcbkgsb",Form("R,%s,+,0",fFitOption.Data()));
+  else status=fHistoInvMass->Fit(fBkgFuncSb,Form("R,%s,+,0",fFitOption.Data()));
   fBkgFuncSb->SetLineColor(kGray+1);
   if (status != 0){
     printf("   ---> Failed first fit with only background, minuit status = %d\n",status);
@@ -305,7 +307,7 @@ Int_t AliHFInvMassFitter::MassFitter(Bool_t draw){
 
   if(doFinalFit){
     printf("\n--- Final fit with signal+background on the full range ---\n");
-    status=fHistoInvMass->Fit("funcmass",Form("R,%s,+,0",fFitOption.Data()));
+    status=fHistoInvMass->Fit(fTotFunc,Form("R,%s,+,0",fFitOption.Data()));
     if (status != 0){
       printf("   ---> Failed fit with signal+background, minuit status = %d\n",status);
       return 0;
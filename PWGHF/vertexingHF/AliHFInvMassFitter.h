@@ -50,6 +50,9 @@ class AliHFInvMassFitter : public TNamed {
   void SetUseLikelihoodWithWeightsFit(){fFitOption="WL,E";}
   void SetUseChi2Fit(){fFitOption="E";}
   void SetFitOption(TString opt){fFitOption=opt.Data();};
+  /// minimizer set as ROOT default in MassFitter (empty: keep the current default,
+  /// used when the fits run in parallel threads, see AliHFInvMassMultiTrialFit)
+  void SetMinimizer(TString name){fMinimizer=name.Data();}
   void SetParticlePdgMass(Double_t mass){fMassParticle=mass;}
   Double_t GetParticlePdgMass(){return fMassParticle;}
   void SetPolDegreeForBackgroundFit(Int_t deg){
@@ -223,6 +226,7 @@ class AliHFInvMassFitter : public TNamed {
   Double_t  fNSigma4SideBands;     /// number of sigmas to veto the signal peak
   Bool_t    fCheckSignalCountsAfterFirstFit; /// switch for check after first fit 
   TString   fFitOption;            /// L, LW or Chi2
+  TString   fMinimizer;            /// minimizer (Minuit)
   Double_t  fRawYield;             /// signal gaussian integral
   Double_t  fRawYieldErr;          /// err on signal gaussian integral
   TF1*      fSigFunc;              /// Signal fit function
@@ -248,7 +252,7 @@ class AliHFInvMassFitter : public TNamed {
   TF1*      fTotFunc;              /// total fit function
 
   /// \cond CLASSIMP     
-  ClassDef(AliHFInvMassFitter,7); /// class for invariant mass fit
+  ClassDef(AliHFInvMassFitter,8); /// class for invariant mass fit
   /// \endcond
 };
 
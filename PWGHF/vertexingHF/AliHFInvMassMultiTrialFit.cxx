@@ -13,6 +13,8 @@
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
 
+#include <vector>
+#include <RConfigure.h>
 #include <TMath.h>
 #include <TPad.h>
 #include <TCanvas.h>
@@ -22,10 +24,15 @@
 #include <TF1.h>
 #include <TLatex.h>
 #include <TFile.h>
+#include <Math/MinimizerOptions.h>
 #include "AliHFInvMassFitter.h"
 #include "AliHFInvMassMultiTrialFit.h"
 #include "AliVertexingHFUtils.h"
 
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
+
 /// \cond CLASSIMP
 ClassImp(AliHFInvMassMultiTrialFit);
 /// \endcond
@@ -83,6 +90,8 @@ AliHFInvMassMultiTrialFit::AliHFInvMassMultiTrialFit() :
   fFixSigmaSecondPeak(kFALSE),
   fSaveBkgVal(kFALSE),
   fDrawIndividualFits(kFALSE),
+  fNumOfThreads(1),
+  fMinimizer("Minuit"),
   fHistoRawYieldDistAll(0x0),
   fHistoRawYieldTrialAll(0x0),
   fHistoSigmaTrialAll(0x0),
@@ -276,11 +285,14 @@ Bool_t AliHFInvMassMultiTrialFit::CreateHistos(){
 //________________________________________________________________________
 Bool_t AliHFInvMassMultiTrialFit::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
   // perform the multiple fits
+  // the rebinned histograms and the reflection templates are prepared once per
+  // binning and fit range, the fits of the trials (independent of each other)
+  // are run in parallel with SetNumberOfThreads(n>1) and the outputs are
+  // filled in the order of the trials
 
   Bool_t hOK=CreateHistos();
   if(!hOK) return kFALSE;
 
-  Int_t itrial=0;
   Int_t itrialBC=0;
   Int_t totTrials=fNumOfRebinSteps*fNumOfFirstBinSteps*fNumOfLowLimFitSteps*fNumOfUpLimFitSteps;
 
@@ -289,19 +301,75 @@ Bool_t AliHFInvMassMultiTrialFit::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePa
   Float_t xnt[16];
   Float_t xntBC[14];
 
+  // binning and fit range of a trial
+  struct TrialRange {
+    Int_t rebin;
+    Int_t firstBin;
+    Int_t itrial;
+    Double_t minMassForFit;
+    Double_t maxMassForFit;
+    Double_t hmin;
+    Double_t hmax;
+    TH1F* hRebinned;      // shared by the ranges with the same binning
+    TH1F* hReflModif;     // reflection template in range and binning
+    Double_t fixSoverRefAt;
+  };
+  // configuration and output of a fit
+  struct TrialFit {
+    Int_t range;
+    Int_t typeb;
+    Int_t types;
+    Int_t igs;
+    Int_t igm;
+    Bool_t out;
+    Double_t chisq, sigma, esigma, pos, epos, ry, ery;
+    Double_t significance, erSignif, bkg, erbkg, bkgBEdge, erbkgBEdge;
+    std::vector<Double_t> binCount; // cnts0, ecnts0, cnts1, ecnts1 per bin counting step
+    AliHFInvMassFitter* fitter;     // kept for drawing
+  };
+
+  std::vector<TH1F*> rebinned;
+  std::vector<TrialRange> ranges;
+  std::vector<TrialFit> fits;
+  Int_t nTrials=0;
   for(Int_t ir=0; ir<fNumOfRebinSteps; ir++){
     Int_t rebin=fRebinSteps[ir];
     for(Int_t iFirstBin=1; iFirstBin<=fNumOfFirstBinSteps; iFirstBin++) {
       TH1F* hRebinned=0x0;
       if(fNumOfFirstBinSteps==1) hRebinned=(TH1F*)AliVertexingHFUtils::RebinHisto(hInvMassHisto,rebin,-1);
       else hRebinned=(TH1F*)AliVertexingHFUtils::RebinHisto(hInvMassHisto,rebin,iFirstBin);
+      hRebinned->SetDirectory(0);
+      rebinned.push_back(hRebinned);
       for(Int_t iMinMass=0; iMinMass<fNumOfLowLimFitSteps; iMinMass++){
         Double_t minMassForFit=fLowLimFitSteps[iMinMass];
         Double_t hmin=TMath::Max(minMassForFit,hRebinned->GetBinLowEdge(2));
         for(Int_t iMaxMass=0; iMaxMass<fNumOfUpLimFitSteps; iMaxMass++){
           Double_t maxMassForFit=fUpLimFitSteps[iMaxMass];
           Double_t hmax=TMath::Min(maxMassForFit,hRebinned->GetBinLowEdge(hRebinned->GetNbinsX()));
-          ++itrial;
+          ++nTrials;
+          TrialRange range;
+          range.rebin=rebin;
+          range.firstBin=iFirstBin;
+          range.itrial=nTrials;
+          range.minMassForFit=minMassForFit;
+          range.maxMassForFit=maxMassForFit;
+          range.hmin=hmin;
+          range.hmax=hmax;
+          range.hRebinned=hRebinned;
+          range.hReflModif=0x0;
+          range.fixSoverRefAt=-1.;
+          // D0 Reflection
+          if(fhTemplRefl && fhTemplSign){
+            TH1F *hReflModif=(TH1F*)AliVertexingHFUtils::AdaptTemplateRangeAndBinning(fhTemplRefl,hRebinned,minMassForFit,maxMassForFit);
+            hReflModif->SetDirectory(0);
+            range.hReflModif=hReflModif;
+            if(fFixRefloS>0){
+              TH1F *hSigModif=(TH1F*)AliVertexingHFUtils::AdaptTemplateRangeAndBinning(fhTemplSign,hRebinned,minMassForFit,maxMassForFit);
+              range.fixSoverRefAt=fFixRefloS*(hReflModif->Integral(hReflModif->FindBin(minMassForFit*1.0001),hReflModif->FindBin(maxMassForFit*0.999))/hSigModif->Integral(hSigModif->FindBin(minMassForFit*1.0001),hSigModif->FindBin(maxMassForFit*0.999)));
+              delete hSigModif;
+            }
+          }
+          ranges.push_back(range);
           for(Int_t typeb=0; typeb<kNBkgFuncCases; typeb++){
             if(typeb==kExpoBkg && !fUseExpoBkg) continue;
             if(typeb==kLinBkg && !fUseLinBkg) continue;
@@ -340,223 +408,296 @@ Bool_t AliHFInvMassMultiTrialFit::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePa
 		    if (igm==kFixMeanUp && !fUseFixSigVarWithFixMean) continue;
 		    if (igm==kFixMeanDown && !fUseFixSigVarWithFixMean) continue;
 		  }
-		  
-		  Int_t theCase=igm*kNGausSigCases*kNBkgFuncCases*kNSigFuncCases+igs*kNBkgFuncCases*kNSigFuncCases+types*kNBkgFuncCases+typeb;
-		  Int_t globBin=itrial+theCase*totTrials;
-		  for(Int_t j=0; j<16; j++) xnt[j]=0.;
-		
-		  Bool_t mustDeleteFitter = kTRUE;
-		  AliHFInvMassFitter*  fitter=0x0;
-		  if(typeb==kExpoBkg){
-		    fitter=new AliHFInvMassFitter(hRebinned, hmin, hmax, AliHFInvMassFitter::kExpo, types);
-		  }else if(typeb==kLinBkg){
-		    fitter=new AliHFInvMassFitter(hRebinned, hmin, hmax, AliHFInvMassFitter::kLin, types);
-		  }else if(typeb==kPol2Bkg){
-		    fitter=new AliHFInvMassFitter(hRebinned, hmin, hmax, AliHFInvMassFitter::kPol2, types);
-		  }else if(typeb==kPowBkg){
-		    fitter=new AliHFInvMassFitter(hRebinned, hmin, hmax, AliHFInvMassFitter::kPow, types);
-		  }else if(typeb==kPowTimesExpoBkg){
-		    fitter=new AliHFInvMassFitter(hRebinned, hmin, hmax, AliHFInvMassFitter::kPowEx, types);
-		  }else{
-		    fitter=new AliHFInvMassFitter(hRebinned, hmin, hmax, 6, types);
-		    if(typeb==kPol3Bkg) fitter->SetPolDegreeForBackgroundFit(3);
-		    if(typeb==kPol4Bkg) fitter->SetPolDegreeForBackgroundFit(4);
-		    if(typeb==kPol5Bkg) fitter->SetPolDegreeForBackgroundFit(5);
-		  }
-		  if(types==k2Gaus){
-		    if(fFixSecondGausSig>=0.) fitter->SetFixSecondGaussianSigma(fFixSecondGausSig);
-		    if(fFixSecondGausFrac>=0.) fitter->SetFixFrac2Gaus(fFixSecondGausFrac);
-		  }else if(types==k2GausSigmaRatioPar){
-		    if(fFixSecondGausSigRat>=0.) fitter->SetFixRatio2GausSigma(fFixSecondGausSigRat);
-		    if(fFixSecondGausFrac>=0.) fitter->SetFixFrac2Gaus(fFixSecondGausFrac);
-		  }
-		  // D0 Reflection
-		  if(fhTemplRefl && fhTemplSign){
-		    TH1F *hReflModif=(TH1F*)AliVertexingHFUtils::AdaptTemplateRangeAndBinning(fhTemplRefl,hRebinned,minMassForFit,maxMassForFit);
-		    TH1F *hSigModif=(TH1F*)AliVertexingHFUtils::AdaptTemplateRangeAndBinning(fhTemplSign,hRebinned,minMassForFit,maxMassForFit);
-		    TH1F* hrfl=fitter->SetTemplateReflections(hReflModif,"2gaus",minMassForFit,maxMassForFit);
-		    if(!hrfl) printf("ERROR in SetTemplateReflections\n");
-		    if(fFixRefloS>0){
-		      Double_t fixSoverRefAt=fFixRefloS*(hReflModif->Integral(hReflModif->FindBin(minMassForFit*1.0001),hReflModif->FindBin(maxMassForFit*0.999))/hSigModif->Integral(hSigModif->FindBin(minMassForFit*1.0001),hSigModif->FindBin(maxMassForFit*0.999)));
-		      fitter->SetFixReflOverS(fixSoverRefAt);
-		    }
-		    delete hReflModif;
-		    delete hSigModif;
-		  }
-		  if(fUseSecondPeak){
-		    fitter->IncludeSecondGausPeak(fMassSecondPeak, fFixMassSecondPeak, fSigmaSecondPeak, fFixSigmaSecondPeak);
-		  }
-		  if(fFitOption==1) fitter->SetUseChi2Fit();
-		  fitter->SetInitialGaussianMean(fMassD);
-		  fitter->SetInitialGaussianSigma(fSigmaGausMC);
-		  xnt[0]=rebin;
-		  xnt[1]=iFirstBin;
-		  xnt[2]=minMassForFit;
-		  xnt[3]=maxMassForFit;
-		  xnt[4]=typeb;
-		  xnt[5]=types;
-		  if(igs==kFixSig){
-		    fitter->SetFixGaussianSigma(fSigmaGausMC);
-		    xnt[6]=1;
-		  }else if(igs==kFixSigUp){
-		    fitter->SetFixGaussianSigma(fSigmaGausMC*(1.+fSigmaMCVariationUp));
-		    xnt[6]=2;
-		  }else if(igs==kFixSigDown){
-		    fitter->SetFixGaussianSigma(fSigmaGausMC*(1.-fSigmaMCVariationDw));
-		    xnt[6]=3;
-		  }else{ // igs==kFreeSig
-		    xnt[6]=0;
-		  }
-		  if(igm==kFixMean){
-		    fitter->SetFixGaussianMean(fMassD);
-		    xnt[7]=1;
-		  }else if(igm==kFixMeanUp){
-		    fitter->SetFixGaussianMean(fUpperMassToFix);
-		    xnt[7]=2;
-		  }else if(igm==kFixMeanDown){
-		    fitter->SetFixGaussianMean(fLowerMassToFix);
-		    xnt[7]=3;
-		  }else{ // igm==kFreeMean){
-		    xnt[7]=0;
-		  }
-		  
-		  Bool_t out=kFALSE;
-		  Double_t chisq=-1.;
-		  Double_t sigma=0.;
-		  Double_t esigma=0.;
-		  Double_t pos=.0;
-		  Double_t epos=.0;
-		  Double_t ry=.0;
-		  Double_t ery=.0;
-		  Double_t significance=0.;
-		  Double_t erSignif=0.;
-		  Double_t bkg=0.;
-		  Double_t erbkg=0.;
-		  Double_t bkgBEdge=0;
-		  Double_t erbkgBEdge=0;
-		  if(typeb<kNBkgFuncCases){
-		    printf("****** START FIT OF HISTO %s WITH REBIN %d FIRST BIN %d MASS RANGE %f-%f BACKGROUND FIT FUNCTION=%d CONFIG SIGMA/MEAN=%d %d\n",hInvMassHisto->GetName(),rebin,iFirstBin,minMassForFit,maxMassForFit,typeb,igs,igm);
-		    out=fitter->MassFitter(0);
-		    chisq=fitter->GetReducedChiSquare();
-		    fitter->Significance(fnSigmaForBkgEval,significance,erSignif);
-		    sigma=fitter->GetSigma();
-		    pos=fitter->GetMean();
-		    esigma=fitter->GetSigmaUncertainty();
-		    if(esigma<0.00001) esigma=0.0001;
-		    epos=fitter->GetMeanUncertainty();
-		    if(epos<0.00001) epos=0.0001;
-		    ry=fitter->GetRawYield();
-		    ery=fitter->GetRawYieldError();
-		    fitter->Background(fnSigmaForBkgEval,bkg,erbkg);
-		    Double_t minval = hInvMassHisto->GetXaxis()->GetBinLowEdge(hInvMassHisto->FindBin(pos-fnSigmaForBkgEval*sigma));
-		    Double_t maxval = hInvMassHisto->GetXaxis()->GetBinUpEdge(hInvMassHisto->FindBin(pos+fnSigmaForBkgEval*sigma));
-		    fitter->Background(minval,maxval,bkgBEdge,erbkgBEdge);
-		    if(out && fDrawIndividualFits && thePad){
-		      thePad->Clear();
-		      fitter->DrawHere(thePad, fnSigmaForBkgEval);
-		      fMassFitters.push_back(fitter);
-		      mustDeleteFitter = kFALSE;
-		      for (auto format : fInvMassFitSaveAsFormats) {
-			thePad->SaveAs(Form("FitOutput_%s_Trial%d.%s",hInvMassHisto->GetName(),globBin, format.c_str()));
-		      }
-		    }
-		  }
-		  xnt[8]=chisq;
-		  if(out && chisq>0. && sigma>0.5*fSigmaGausMC && sigma<2.0*fSigmaGausMC){
-		    xnt[9]=significance;
-		    xnt[10]=pos;
-		    xnt[11]=epos;
-		    xnt[12]=sigma;
-		    xnt[13]=esigma;
-		    xnt[14]=ry;
-		    xnt[15]=ery;
-		    fHistoRawYieldDistAll->Fill(ry);
-		    fHistoRawYieldTrialAll->SetBinContent(globBin,ry);
-		    fHistoRawYieldTrialAll->SetBinError(globBin,ery);
-		    fHistoSigmaTrialAll->SetBinContent(globBin,sigma);
-		    fHistoSigmaTrialAll->SetBinError(globBin,esigma);
-		    fHistoMeanTrialAll->SetBinContent(globBin,pos);
-		    fHistoMeanTrialAll->SetBinError(globBin,epos);
-		    fHistoChi2TrialAll->SetBinContent(globBin,chisq);
-		    fHistoChi2TrialAll->SetBinError(globBin,0.00001);
-		    fHistoSignifTrialAll->SetBinContent(globBin,significance);
-		    fHistoSignifTrialAll->SetBinError(globBin,erSignif);
-		    if(fSaveBkgVal) {
-		      fHistoBkgTrialAll->SetBinContent(globBin,bkg);
-		      fHistoBkgTrialAll->SetBinError(globBin,erbkg);
-		      fHistoBkgInBinEdgesTrialAll->SetBinContent(globBin,bkgBEdge);
-		      fHistoBkgInBinEdgesTrialAll->SetBinError(globBin,erbkgBEdge);
-		    }
-		    
-		    if(ry<fMinYieldGlob) fMinYieldGlob=ry;
-		    if(ry>fMaxYieldGlob) fMaxYieldGlob=ry;
-		    fHistoRawYieldDist[theCase]->Fill(ry);
-		    fHistoRawYieldTrial[theCase]->SetBinContent(itrial,ry);
-		    fHistoRawYieldTrial[theCase]->SetBinError(itrial,ery);
-		    fHistoSigmaTrial[theCase]->SetBinContent(itrial,sigma);
-		    fHistoSigmaTrial[theCase]->SetBinError(itrial,esigma);
-		    fHistoMeanTrial[theCase]->SetBinContent(itrial,pos);
-		    fHistoMeanTrial[theCase]->SetBinError(itrial,epos);
-		    fHistoChi2Trial[theCase]->SetBinContent(itrial,chisq);
-		    fHistoChi2Trial[theCase]->SetBinError(itrial,0.00001);
-		    fHistoSignifTrial[theCase]->SetBinContent(itrial,significance);
-		    fHistoSignifTrial[theCase]->SetBinError(itrial,erSignif);
-		    if(fSaveBkgVal) {
-		      fHistoBkgTrial[theCase]->SetBinContent(itrial,bkg);
-		      fHistoBkgTrial[theCase]->SetBinError(itrial,erbkg);
-		      fHistoBkgInBinEdgesTrial[theCase]->SetBinContent(itrial,bkgBEdge);
-		      fHistoBkgInBinEdgesTrial[theCase]->SetBinError(itrial,erbkgBEdge);
-		    }
-		    fNtupleMultiTrials->Fill(xnt);
-		    if(types==0){
-		      // bin counting done only for 1 case of signal line shape
-		      for(Int_t j=0; j<9; j++) xntBC[j]=xnt[j];
-		      
-		      
-		      for(Int_t iStepBC=0; iStepBC<fNumOfnSigmaBinCSteps; iStepBC++){
-			Double_t minMassBC=fMassD-fnSigmaBinCSteps[iStepBC]*sigma;
-			Double_t maxMassBC=fMassD+fnSigmaBinCSteps[iStepBC]*sigma;
-			if(minMassBC>minMassForFit &&
-			   maxMassBC<maxMassForFit &&
-			   minMassBC>(hRebinned->GetXaxis()->GetXmin()) &&
-			   maxMassBC<(hRebinned->GetXaxis()->GetXmax())){
-			  Double_t cnts0,ecnts0;
-			  Double_t cnts1,ecnts1;
-			  cnts0=fitter->GetRawYieldBinCounting(ecnts0,fnSigmaBinCSteps[iStepBC],0,0);
-			  cnts1=fitter->GetRawYieldBinCounting(ecnts1,fnSigmaBinCSteps[iStepBC],1,0);
-			  xntBC[9]=fnSigmaBinCSteps[iStepBC];
-			  xntBC[10]=cnts0;
-			  xntBC[11]=ecnts0;
-			  xntBC[12]=cnts1;
-			  xntBC[13]=ecnts1;
-			  ++itrialBC;
-			  fHistoRawYieldDistBinC0All->Fill(cnts0);
-			  fHistoRawYieldTrialBinC0All->SetBinContent(globBin,iStepBC+1,cnts0);
-			  fHistoRawYieldTrialBinC0All->SetBinError(globBin,iStepBC+1,ecnts0);
-			  fHistoRawYieldTrialBinC0[theCase]->SetBinContent(itrial,iStepBC+1,cnts0);
-			  fHistoRawYieldTrialBinC0[theCase]->SetBinError(itrial,iStepBC+1,ecnts0);
-			  fHistoRawYieldDistBinC0[theCase]->Fill(cnts0);
-			  fHistoRawYieldDistBinC1All->Fill(cnts1);
-			  fHistoRawYieldTrialBinC1All->SetBinContent(globBin,iStepBC+1,cnts1);
-			  fHistoRawYieldTrialBinC1All->SetBinError(globBin,iStepBC+1,ecnts1);
-			  fHistoRawYieldTrialBinC1[theCase]->SetBinContent(itrial,iStepBC+1,cnts1);
-			  fHistoRawYieldTrialBinC1[theCase]->SetBinError(itrial,iStepBC+1,ecnts1);
-			  fHistoRawYieldDistBinC1[theCase]->Fill(cnts1);
-			  fNtupleBinCount->Fill(xntBC);
-			}
-		      }
-		    }
-		  }
-		  if (mustDeleteFitter) delete fitter;
+		  TrialFit fit;
+		  fit.range=ranges.size()-1;
+		  fit.typeb=typeb;
+		  fit.types=types;
+		  fit.igs=igs;
+		  fit.igm=igm;
+		  fit.out=kFALSE;
+		  fit.chisq=-1.;
+		  fit.sigma=fit.esigma=fit.pos=fit.epos=fit.ry=fit.ery=0.;
+		  fit.significance=fit.erSignif=fit.bkg=fit.erbkg=fit.bkgBEdge=fit.erbkgBEdge=0.;
+		  fit.fitter=0x0;
+		  fits.push_back(fit);
 		}
 	      }
 	    }
 	  }
 	}
       }
-      delete hRebinned;
     }
   }
+
+  // bin counting only within the fit range and the histogram limits
+  auto binCountInRange = [&](const TrialRange& range, Double_t sigma, Int_t iStepBC)
+  {
+    Double_t minMassBC=fMassD-fnSigmaBinCSteps[iStepBC]*sigma;
+    Double_t maxMassBC=fMassD+fnSigmaBinCSteps[iStepBC]*sigma;
+    return (minMassBC>range.minMassForFit &&
+	    maxMassBC<range.maxMassForFit &&
+	    minMassBC>(range.hRebinned->GetXaxis()->GetXmin()) &&
+	    maxMassBC<(range.hRebinned->GetXaxis()->GetXmax()));
+  };
+
+  Int_t nThreads=TMath::Max(fNumOfThreads,1);
+  if(nThreads>1 && fDrawIndividualFits && thePad){
+    printf("Individual fits are drawn, the fits are done serially\n");
+    nThreads=1;
+  }
+  TString minimizerName=fMinimizer.IsNull() ? TString(ROOT::Math::MinimizerOptions::DefaultMinimizerType()) : fMinimizer;
+  if(nThreads>1 && (minimizerName.EqualTo("Minuit",TString::kIgnoreCase) || minimizerName.EqualTo("TMinuit",TString::kIgnoreCase) || minimizerName.EqualTo("Fumili",TString::kIgnoreCase))){
+    printf("Minimizer %s is not thread safe, the fits are done serially (use SetMinimizer(\"Minuit2\") for parallel fits)\n",minimizerName.Data());
+    nThreads=1;
+  }
+#ifndef R__USE_IMT
+  if(nThreads>1) printf("ROOT built without implicit multi-threading, the fits are done serially\n");
+  nThreads=1;
+#endif
+  Bool_t keepFitters=(fDrawIndividualFits && thePad);
+
+  // fit of one configuration, only the fitter and the output of the trial are modified
+  auto fitTrial = [&](Int_t ifit)
+  {
+    TrialFit& fit=fits[ifit];
+    const TrialRange& range=ranges[fit.range];
+    Int_t typeb=fit.typeb;
+    Int_t types=fit.types;
+    TH1F* hRebinned=range.hRebinned;
+    AliHFInvMassFitter*  fitter=0x0;
+    if(typeb==kExpoBkg){
+      fitter=new AliHFInvMassFitter(hRebinned, range.hmin, range.hmax, AliHFInvMassFitter::kExpo, types);
+    }else if(typeb==kLinBkg){
+      fitter=new AliHFInvMassFitter(hRebinned, range.hmin, range.hmax, AliHFInvMassFitter::kLin, types);
+    }else if(typeb==kPol2Bkg){
+      fitter=new AliHFInvMassFitter(hRebinned, range.hmin, range.hmax, AliHFInvMassFitter::kPol2, types);
+    }else if(typeb==kPowBkg){
+      fitter=new AliHFInvMassFitter(hRebinned, range.hmin, range.hmax, AliHFInvMassFitter::kPow, types);
+    }else if(typeb==kPowTimesExpoBkg){
+      fitter=new AliHFInvMassFitter(hRebinned, range.hmin, range.hmax, AliHFInvMassFitter::kPowEx, types);
+    }else{
+      fitter=new AliHFInvMassFitter(hRebinned, range.hmin, range.hmax, 6, types);
+      if(typeb==kPol3Bkg) fitter->SetPolDegreeForBackgroundFit(3);
+      if(typeb==kPol4Bkg) fitter->SetPolDegreeForBackgroundFit(4);
+      if(typeb==kPol5Bkg) fitter->SetPolDegreeForBackgroundFit(5);
+    }
+    // the minimizer is set once before the threads are started
+    fitter->SetMinimizer(nThreads>1 ? "" : fMinimizer);
+    if(types==k2Gaus){
+      if(fFixSecondGausSig>=0.) fitter->SetFixSecondGaussianSigma(fFixSecondGausSig);
+      if(fFixSecondGausFrac>=0.) fitter->SetFixFrac2Gaus(fFixSecondGausFrac);
+    }else if(types==k2GausSigmaRatioPar){
+      if(fFixSecondGausSigRat>=0.) fitter->SetFixRatio2GausSigma(fFixSecondGausSigRat);
+      if(fFixSecondGausFrac>=0.) fitter->SetFixFrac2Gaus(fFixSecondGausFrac);
+    }
+    // D0 Reflection
+    if(range.hReflModif){
+      TH1F* hrfl=fitter->SetTemplateReflections(range.hReflModif,"2gaus",range.minMassForFit,range.maxMassForFit);
+      if(!hrfl) printf("ERROR in SetTemplateReflections\n");
+      if(fFixRefloS>0) fitter->SetFixReflOverS(range.fixSoverRefAt);
+    }
+    if(fUseSecondPeak){
+      fitter->IncludeSecondGausPeak(fMassSecondPeak, fFixMassSecondPeak, fSigmaSecondPeak, fFixSigmaSecondPeak);
+    }
+    if(fFitOption==1) fitter->SetUseChi2Fit();
+    fitter->SetInitialGaussianMean(fMassD);
+    fitter->SetInitialGaussianSigma(fSigmaGausMC);
+    if(fit.igs==kFixSig){
+      fitter->SetFixGaussianSigma(fSigmaGausMC);
+    }else if(fit.igs==kFixSigUp){
+      fitter->SetFixGaussianSigma(fSigmaGausMC*(1.+fSigmaMCVariationUp));
+    }else if(fit.igs==kFixSigDown){
+      fitter->SetFixGaussianSigma(fSigmaGausMC*(1.-fSigmaMCVariationDw));
+    }
+    if(fit.igm==kFixMean){
+      fitter->SetFixGaussianMean(fMassD);
+    }else if(fit.igm==kFixMeanUp){
+      fitter->SetFixGaussianMean(fUpperMassToFix);
+    }else if(fit.igm==kFixMeanDown){
+      fitter->SetFixGaussianMean(fLowerMassToFix);
+    }
+
+    if(typeb<kNBkgFuncCases){
+      printf("****** START FIT OF HISTO %s WITH REBIN %d FIRST BIN %d MASS RANGE %f-%f BACKGROUND FIT FUNCTION=%d CONFIG SIGMA/MEAN=%d %d\n",hInvMassHisto->GetName(),range.rebin,range.firstBin,range.minMassForFit,range.maxMassForFit,typeb,fit.igs,fit.igm);
+      fit.out=fitter->MassFitter(0);
+      fit.chisq=fitter->GetReducedChiSquare();
+      fitter->Significance(fnSigmaForBkgEval,fit.significance,fit.erSignif);
+      fit.sigma=fitter->GetSigma();
+      fit.pos=fitter->GetMean();
+      fit.esigma=fitter->GetSigmaUncertainty();
+      if(fit.esigma<0.00001) fit.esigma=0.0001;
+      fit.epos=fitter->GetMeanUncertainty();
+      if(fit.epos<0.00001) fit.epos=0.0001;
+      fit.ry=fitter->GetRawYield();
+      fit.ery=fitter->GetRawYieldError();
+      fitter->Background(fnSigmaForBkgEval,fit.bkg,fit.erbkg);
+      Double_t minval = hInvMassHisto->GetXaxis()->GetBinLowEdge(hInvMassHisto->GetXaxis()->FindBin(fit.pos-fnSigmaForBkgEval*fit.sigma));
+      Double_t maxval = hInvMassHisto->GetXaxis()->GetBinUpEdge(hInvMassHisto->GetXaxis()->FindBin(fit.pos+fnSigmaForBkgEval*fit.sigma));
+      fitter->Background(minval,maxval,fit.bkgBEdge,fit.erbkgBEdge);
+    }
+    if(fit.out && fit.chisq>0. && fit.sigma>0.5*fSigmaGausMC && fit.sigma<2.0*fSigmaGausMC && types==0){
+      // bin counting done only for 1 case of signal line shape
+      fit.binCount.assign(4*fNumOfnSigmaBinCSteps,0.);
+      for(Int_t iStepBC=0; iStepBC<fNumOfnSigmaBinCSteps; iStepBC++){
+	if(!binCountInRange(range,fit.sigma,iStepBC)) continue;
+	Double_t *cnts=&fit.binCount[4*iStepBC];
+	cnts[0]=fitter->GetRawYieldBinCounting(cnts[1],fnSigmaBinCSteps[iStepBC],0,0);
+	cnts[2]=fitter->GetRawYieldBinCounting(cnts[3],fnSigmaBinCSteps[iStepBC],1,0);
+      }
+    }
+    if(keepFitters && fit.out) fit.fitter=fitter;
+    else delete fitter;
+  };
+
+  // output of one trial in the histograms and ntuples
+  auto fillTrial = [&](Int_t ifit)
+  {
+    TrialFit& fit=fits[ifit];
+    const TrialRange& range=ranges[fit.range];
+    Int_t itrial=range.itrial;
+    Int_t theCase=fit.igm*kNGausSigCases*kNBkgFuncCases*kNSigFuncCases+fit.igs*kNBkgFuncCases*kNSigFuncCases+fit.types*kNBkgFuncCases+fit.typeb;
+    Int_t globBin=itrial+theCase*totTrials;
+    for(Int_t j=0; j<16; j++) xnt[j]=0.;
+    xnt[0]=range.rebin;
+    xnt[1]=range.firstBin;
+    xnt[2]=range.minMassForFit;
+    xnt[3]=range.maxMassForFit;
+    xnt[4]=fit.typeb;
+    xnt[5]=fit.types;
+    if(fit.igs==kFixSig) xnt[6]=1;
+    else if(fit.igs==kFixSigUp) xnt[6]=2;
+    else if(fit.igs==kFixSigDown) xnt[6]=3;
+    else xnt[6]=0; // igs==kFreeSig
+    if(fit.igm==kFixMean) xnt[7]=1;
+    else if(fit.igm==kFixMeanUp) xnt[7]=2;
+    else if(fit.igm==kFixMeanDown) xnt[7]=3;
+    else xnt[7]=0; // igm==kFreeMean
+
+    if(fit.fitter){
+      thePad->Clear();
+      fit.fitter->DrawHere(thePad, fnSigmaForBkgEval);
+      fMassFitters.push_back(fit.fitter);
+      fit.fitter=0x0;
+      for (auto format : fInvMassFitSaveAsFormats) {
+	thePad->SaveAs(Form("FitOutput_%s_Trial%d.%s",hInvMassHisto->GetName(),globBin, format.c_str()));
+      }
+    }
+
+    Double_t chisq=fit.chisq;
+    Double_t sigma=fit.sigma;
+    Double_t ry=fit.ry;
+    Double_t ery=fit.ery;
+    xnt[8]=chisq;
+    if(fit.out && chisq>0. && sigma>0.5*fSigmaGausMC && sigma<2.0*fSigmaGausMC){
+      xnt[9]=fit.significance;
+      xnt[10]=fit.pos;
+      xnt[11]=fit.epos;
+      xnt[12]=sigma;
+      xnt[13]=fit.esigma;
+      xnt[14]=ry;
+      xnt[15]=ery;
+      fHistoRawYieldDistAll->Fill(ry);
+      fHistoRawYieldTrialAll->SetBinContent(globBin,ry);
+      fHistoRawYieldTrialAll->SetBinError(globBin,ery);
+      fHistoSigmaTrialAll->SetBinContent(globBin,sigma);
+      fHistoSigmaTrialAll->SetBinError(globBin,fit.esigma);
+      fHistoMeanTrialAll->SetBinContent(globBin,fit.pos);
+      fHistoMeanTrialAll->SetBinError(globBin,fit.epos);
+      fHistoChi2TrialAll->SetBinContent(globBin,chisq);
+      fHistoChi2TrialAll->SetBinError(globBin,0.00001);
+      fHistoSignifTrialAll->SetBinContent(globBin,fit.significance);
+      fHistoSignifTrialAll->SetBinError(globBin,fit.erSignif);
+      if(fSaveBkgVal) {
+	fHistoBkgTrialAll->SetBinContent(globBin,fit.bkg);
+	fHistoBkgTrialAll->SetBinError(globBin,fit.erbkg);
+	fHistoBkgInBinEdgesTrialAll->SetBinContent(globBin,fit.bkgBEdge);
+	fHistoBkgInBinEdgesTrialAll->SetBinError(globBin,fit.erbkgBEdge);
+      }
+
+      if(ry<fMinYieldGlob) fMinYieldGlob=ry;
+      if(ry>fMaxYieldGlob) fMaxYieldGlob=ry;
+      fHistoRawYieldDist[theCase]->Fill(ry);
+      fHistoRawYieldTrial[theCase]->SetBinContent(itrial,ry);
+      fHistoRawYieldTrial[theCase]->SetBinError(itrial,ery);
+      fHistoSigmaTrial[theCase]->SetBinContent(itrial,sigma);
+      fHistoSigmaTrial[theCase]->SetBinError(itrial,fit.esigma);
+      fHistoMeanTrial[theCase]->SetBinContent(itrial,fit.pos);
+      fHistoMeanTrial[theCase]->SetBinError(itrial,fit.epos);
+      fHistoChi2Trial[theCase]->SetBinContent(itrial,chisq);
+      fHistoChi2Trial[theCase]->SetBinError(itrial,0.00001);
+      fHistoSignifTrial[theCase]->SetBinContent(itrial,fit.significance);
+      fHistoSignifTrial[theCase]->SetBinError(itrial,fit.erSignif);
+      if(fSaveBkgVal) {
+	fHistoBkgTrial[theCase]->SetBinContent(itrial,fit.bkg);
+	fHistoBkgTrial[theCase]->SetBinError(itrial,fit.erbkg);
+	fHistoBkgInBinEdgesTrial[theCase]->SetBinContent(itrial,fit.bkgBEdge);
+	fHistoBkgInBinEdgesTrial[theCase]->SetBinError(itrial,fit.erbkgBEdge);
+      }
+      fNtupleMultiTrials->Fill(xnt);
+      if(fit.types==0){
+	// bin counting done only for 1 case of signal line shape
+	for(Int_t j=0; j<9; j++) xntBC[j]=xnt[j];
+
+	for(Int_t iStepBC=0; iStepBC<fNumOfnSigmaBinCSteps; iStepBC++){
+	  if(!binCountInRange(range,sigma,iStepBC)) continue;
+	  Double_t cnts0=fit.binCount[4*iStepBC];
+	  Double_t ecnts0=fit.binCount[4*iStepBC+1];
+	  Double_t cnts1=fit.binCount[4*iStepBC+2];
+	  Double_t ecnts1=fit.binCount[4*iStepBC+3];
+	  xntBC[9]=fnSigmaBinCSteps[iStepBC];
+	  xntBC[10]=cnts0;
+	  xntBC[11]=ecnts0;
+	  xntBC[12]=cnts1;
+	  xntBC[13]=ecnts1;
+	  ++itrialBC;
+	  fHistoRawYieldDistBinC0All->Fill(cnts0);
+	  fHistoRawYieldTrialBinC0All->SetBinContent(globBin,iStepBC+1,cnts0);
+	  fHistoRawYieldTrialBinC0All->SetBinError(globBin,iStepBC+1,ecnts0);
+	  fHistoRawYieldTrialBinC0[theCase]->SetBinContent(itrial,iStepBC+1,cnts0);
+	  fHistoRawYieldTrialBinC0[theCase]->SetBinError(itrial,iStepBC+1,ecnts0);
+	  fHistoRawYieldDistBinC0[theCase]->Fill(cnts0);
+	  fHistoRawYieldDistBinC1All->Fill(cnts1);
+	  fHistoRawYieldTrialBinC1All->SetBinContent(globBin,iStepBC+1,cnts1);
+	  fHistoRawYieldTrialBinC1All->SetBinError(globBin,iStepBC+1,ecnts1);
+	  fHistoRawYieldTrialBinC1[theCase]->SetBinContent(itrial,iStepBC+1,cnts1);
+	  fHistoRawYieldTrialBinC1[theCase]->SetBinError(itrial,iStepBC+1,ecnts1);
+	  fHistoRawYieldDistBinC1[theCase]->Fill(cnts1);
+	  fNtupleBinCount->Fill(xntBC);
+	}
+      }
+    }
+  };
+
+  Int_t nFits=fits.size();
+#ifdef R__USE_IMT
+  if(nThreads>1 && nFits>1){
+    // same minimizer as in the serial fits (thread safe, checked above), fit
+    // functions and histograms of the fitters not registered in global lists
+    TString minimizer=ROOT::Math::MinimizerOptions::DefaultMinimizerType();
+    TString algo=ROOT::Math::MinimizerOptions::DefaultMinimizerAlgo();
+    ROOT::Math::MinimizerOptions::SetDefaultMinimizer(minimizerName.Data());
+    Bool_t addToGlobalList=TF1::DefaultAddToGlobalList(kFALSE);
+    Bool_t addDirectory=TH1::AddDirectoryStatus();
+    TH1::AddDirectory(kFALSE);
+    ROOT::EnableThreadSafety();
+    ROOT::TThreadExecutor executor(nThreads);
+    executor.Foreach(fitTrial,ROOT::TSeqI(nFits));
+    TH1::AddDirectory(addDirectory);
+    TF1::DefaultAddToGlobalList(addToGlobalList);
+    ROOT::Math::MinimizerOptions::SetDefaultMinimizer(minimizer.Data(),algo.Data());
+    for(Int_t ifit=0; ifit<nFits; ifit++) fillTrial(ifit);
+  }
+  else
+#endif
+  {
+    for(Int_t ifit=0; ifit<nFits; ifit++){
+      fitTrial(ifit);
+      fillTrial(ifit);
+    }
+  }
+
+  for(size_t ir=0; ir<ranges.size(); ir++) delete ranges[ir].hReflModif;
+  for(size_t ih=0; ih<rebinned.size(); ih++) delete rebinned[ih];
   return kTRUE;
 }
 
@@ -111,6 +111,10 @@ class AliHFInvMassMultiTrialFit : public TNamed {
   void SetSaveBkgValue(Bool_t opt=kTRUE, Double_t nsigma=3) {fSaveBkgVal=opt; fnSigmaForBkgEval=nsigma;}
 
   void SetDrawIndividualFits(Bool_t opt=kTRUE){fDrawIndividualFits=opt;}
+  /// number of threads for the fits (ROOT with implicit multi-threading, no drawing of individual fits)
+  void SetNumberOfThreads(Int_t nth){fNumOfThreads=nth;}
+  /// minimizer of the fits, serial and parallel (Minuit and Fumili are not thread safe, fits done serially)
+  void SetMinimizer(TString name){fMinimizer=name;}
 
   Bool_t DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad=0x0);
   void SaveToRoot(TString fileName, TString option="recreate") const;
@@ -197,6 +201,8 @@ class AliHFInvMassMultiTrialFit : public TNamed {
   Bool_t fSaveBkgVal;		/// switch for saving bkg values in nsigma
 
   Bool_t fDrawIndividualFits; /// flag for drawing fits
+  Int_t fNumOfThreads;        /// number of threads for the fits
+  TString fMinimizer;         /// minimizer of the fits
 
   TH1F* fHistoRawYieldDistAll;  /// histo with yield from all trials
   TH1F* fHistoRawYieldTrialAll; /// histo with yield from all trials
@@ -238,7 +244,7 @@ class AliHFInvMassMultiTrialFit : public TNamed {
   std::vector<AliHFInvMassFitter*> fMassFitters; //!<! Mass fitters
 
   /// \cond CLASSIMP
-  ClassDef(AliHFInvMassMultiTrialFit,7); /// class for multiple trials of invariant mass fit
+  ClassDef(AliHFInvMassMultiTrialFit,9); /// class for multiple trials of invariant mass fit
   /// \endcond
 };
 
@@ -39,7 +39,11 @@
 #include <TH2F.h>
 #include <TLegend.h>
 #include <TColor.h>
+#include <TFile.h>
+#include <TKey.h>
+#include <THashList.h>
 #include <Riostream.h>
+#include <mutex>
 
 #include "AliLog.h"
 #include "AliHFSystErr.h"
@@ -48,6 +52,11 @@
 ClassImp(AliHFSystErr);
 /// \endcond
 
+namespace {
+  /// guards the table cache, which is shared by all instances
+  std::mutex gTableCacheMutex;
+}
+
 //--------------------------------------------------------------------------
 AliHFSystErr::AliHFSystErr(const Char_t* name, const Char_t* title) :
   TNamed(name,title),
@@ -74,7 +83,8 @@ AliHFSystErr::AliHFSystErr(const Char_t* name, const Char_t* title) :
   fStandardBins(false),
   fIsRapidityScan(false),
   fIsMLAnalysis(false),
-  fIsDataDrivenFDAnalysis(false)
+  fIsDataDrivenFDAnalysis(false),
+  fTableFile("")
 {
   //
   /// Default Constructor
@@ -109,6 +119,8 @@ void AliHFSystErr::Init(Int_t decay){
   //    AliFatal("Only settings for 2010 and the low energy runs are implemented so far");
   //  }
 
+  if(!fTableFile.IsNull() && InitFromTableFile(decay)) return;
+
   switch(decay) {
     case 1: // D0->Kpi
       if (fCollisionType==0) {
@@ -592,6 +604,151 @@ void AliHFSystErr::Init(Int_t decay){
 
 }
 
+//--------------------------------------------------------------------------
+TString AliHFSystErr::GetTableKey(Int_t decay) const {
+  //
+  /// Name of the table for the current settings, used as directory name in the table file
+  //
+  TString key=Form("decay%d_coll%d_run%d_cent%s_rap%s_",decay,fCollisionType,fRunNumber,
+                   fCentralityClass.Data(),fRapidityRange.Data());
+  Bool_t flags[10]={fIsLowEnergy,fIsLowPtAnalysis,fIsPass4Analysis,fIs5TeVAnalysis,fIsBDTAnalysis,
+                    fIsCentScan,fStandardBins,fIsRapidityScan,fIsMLAnalysis,fIsDataDrivenFDAnalysis};
+  for(Int_t i=0;i<10;i++) key+=(flags[i] ? "1" : "0");
+  return key;
+}
+
+//--------------------------------------------------------------------------
+Bool_t AliHFSystErr::WriteTableToFile(Int_t decay, const char* fileName) {
+  //
+  /// Initialize from the hardcoded values and store the histograms
+  /// for the current settings in the table file
+  //
+  TString tableFile=fTableFile;
+  fTableFile="";
+  DeleteHistos();
+  Init(decay);
+  fTableFile=tableFile;
+
+  TFile *f=TFile::Open(fileName,"UPDATE");
+  if(!f || f->IsZombie()) {
+    AliError(Form("Cannot open table file %s",fileName));
+    delete f;
+    return kFALSE;
+  }
+  TString key=GetTableKey(decay);
+  TDirectory *dir=f->GetDirectory(key.Data());
+  if(!dir) dir=f->mkdir(key.Data());
+  dir->cd();
+  TH1F* histos[10]={fNorm,fRawYield,fTrackingEff,fBR,fCutsEff,fPIDEff,fMCPtShape,fPartAntipart,
+                    fDataDrivenFD,fRawYieldFDCorr};
+  const Char_t* names[10]={"fNorm","fRawYield","fTrackingEff","fBR","fCutsEff","fPIDEff","fMCPtShape","fPartAntipart",
+                           "fDataDrivenFD","fRawYieldFDCorr"};
+  for(Int_t i=0;i<10;i++) if(histos[i]) histos[i]->Write(names[i],TObject::kOverwrite);
+  f->Close();
+  delete f;
+
+  // the cached copy of this table, if any, is outdated now
+  std::lock_guard<std::mutex> lock(gTableCacheMutex);
+  TObject *cached=GetTableCache()->FindObject(Form("%s:%s",fileName,key.Data()));
+  if(cached) {
+    GetTableCache()->Remove(cached);
+    delete cached;
+  }
+  return kTRUE;
+}
+
+//--------------------------------------------------------------------------
+THashList* AliHFSystErr::GetTableCache() {
+  //
+  /// Tables read from the table files, shared by all instances.
+  /// To be used with gTableCacheMutex locked
+  //
+  static THashList *tableCache=0;
+  if(!tableCache) {
+    tableCache=new THashList();
+    tableCache->SetOwner();
+  }
+  return tableCache;
+}
+
+//--------------------------------------------------------------------------
+void AliHFSystErr::DeleteHistos() {
+  //
+  /// Delete the uncertainty histograms before they are set again
+  //
+  TH1F** histos[10]={&fNorm,&fRawYield,&fTrackingEff,&fBR,&fCutsEff,&fPIDEff,&fMCPtShape,&fPartAntipart,
+                     &fDataDrivenFD,&fRawYieldFDCorr};
+  for(Int_t i=0;i<10;i++) {
+    delete *histos[i];
+    *histos[i]=0x0;
+  }
+}
+
+//--------------------------------------------------------------------------
+Bool_t AliHFSystErr::InitFromTableFile(Int_t decay) {
+  //
+  /// Set the histograms from the table file. Each table is read from the
+  /// file only once and cached, also when it is missing
+  //
+  std::lock_guard<std::mutex> lock(gTableCacheMutex);
+  THashList *tableCache=GetTableCache();
+
+  TString key=GetTableKey(decay);
+  TString cacheName=Form("%s:%s",fTableFile.Data(),key.Data());
+  TObjArray *table=(TObjArray*)tableCache->FindObject(cacheName.Data());
+  if(!table) {
+    table=new TObjArray();
+    table->SetName(cacheName.Data());
+    table->SetOwner();
+    TFile *f=TFile::Open(fTableFile.Data());
+    if(f && !f->IsZombie()) {
+      TDirectory *dir=f->GetDirectory(key.Data());
+      if(dir) {
+        TIter next(dir->GetListOfKeys());
+        TKey *k=0;
+        while((k=(TKey*)next())) {
+          TH1F *h=dynamic_cast<TH1F*>(k->ReadObj());
+          if(!h) continue;
+          h->SetDirectory(0);
+          table->Add(h);
+        }
+      }
+      f->Close();
+    }
+    delete f;
+    tableCache->Add(table);
+  }
+  if(table->GetEntriesFast()==0) {
+    AliWarning(Form("Table %s not found in %s, using the hardcoded values",key.Data(),fTableFile.Data()));
+    return kFALSE;
+  }
+
+  DeleteHistos();
+  fNorm=GetHistoFromTable(table,"fNorm");
+  fRawYield=GetHistoFromTable(table,"fRawYield");
+  fTrackingEff=GetHistoFromTable(table,"fTrackingEff");
+  fBR=GetHistoFromTable(table,"fBR");
+  fCutsEff=GetHistoFromTable(table,"fCutsEff");
+  fPIDEff=GetHistoFromTable(table,"fPIDEff");
+  fMCPtShape=GetHistoFromTable(table,"fMCPtShape");
+  fPartAntipart=GetHistoFromTable(table,"fPartAntipart");
+  fDataDrivenFD=GetHistoFromTable(table,"fDataDrivenFD");
+  fRawYieldFDCorr=GetHistoFromTable(table,"fRawYieldFDCorr");
+  return kTRUE;
+}
+
+//--------------------------------------------------------------------------
+TH1F* AliHFSystErr::GetHistoFromTable(const TObjArray *table, const char* name) {
+  //
+  /// Copy of the cached histogram, which can then be modified via the Reset* methods
+  //
+  TH1F *h=(TH1F*)table->FindObject(name);
+  if(!h) return 0x0;
+  TH1F *hcopy=(TH1F*)h->Clone(name);
+  hcopy->SetDirectory(0);
+  return hcopy;
+}
+
 //--------------------------------------------------------------------------
 void AliHFSystErr::InitD0toKpi2010pp() {
   //
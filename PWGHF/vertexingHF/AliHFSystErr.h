@@ -14,9 +14,11 @@
 #include <TNamed.h>
 #include <TString.h>
 #include <TH1F.h>
+#include <TObjArray.h>
 #include "AliLog.h"
 #include "TGraphAsymmErrors.h"
 
+class THashList;
 
 class AliHFSystErr : public TNamed
 {
@@ -131,6 +133,15 @@ class AliHFSystErr : public TNamed
   /// Function to initialize the variables/histograms
   void Init(Int_t decay);
 
+  /// Tabulated uncertainties: if a table file is set, Init reads only the
+  /// histograms of the requested configuration from it (and keeps them in
+  /// memory for the following calls), falling back to the hardcoded values
+  /// if the configuration is not in the file
+  void SetTableFile(TString fileName) { fTableFile = fileName; }
+  TString GetTableFile() const { return fTableFile; }
+  TString GetTableKey(Int_t decay) const;
+  Bool_t WriteTableToFile(Int_t decay, const char* fileName);
+
   void InitD0toKpi2010PbPb010CentScan();
   void InitD0toKpi2010PbPb1020CentScan();
   void InitD0toKpi2010PbPb2040CentScan();
@@ -399,6 +410,11 @@ class AliHFSystErr : public TNamed
 
   TH1F* ReflectHisto(TH1F *hin) const;
 
+  Bool_t InitFromTableFile(Int_t decay);
+  static TH1F* GetHistoFromTable(const TObjArray *table, const char* name);
+  static THashList* GetTableCache();
+  void DeleteHistos();
+
   TH1F *fNorm;            /// normalization
   TH1F *fRawYield;        /// raw yield
   TH1F *fTrackingEff;     /// tracking efficiency
@@ -426,9 +442,10 @@ class AliHFSystErr : public TNamed
   Bool_t fIsRapidityScan;  /// flag for the pPb vs y measurement
   Bool_t fIsMLAnalysis;   /// flag for the Lc ML analysis
   Bool_t fIsDataDrivenFDAnalysis;   /// flag for the non-prompt data-driven analyses 
+  TString fTableFile;      /// file with the tabulated uncertainties (empty: hardcoded values)
 
   /// \cond CLASSIMP
-  ClassDef(AliHFSystErr,14);  /// class for systematic errors of charm hadrons
+  ClassDef(AliHFSystErr,15);  /// class for systematic errors of charm hadrons
   /// \endcond
 };
 
@@ -236,6 +236,12 @@ public:
    * @return True if initialized
    */
   virtual Bool_t IsInit() const { return fIsInit; }
+  /** 
+   * Get the run number the corrections were read for
+   * 
+   * @return Run number 
+   */
+  ULong_t GetRun() const { return fRun; }
   /** 
    * Print information
    * 
@@ -60,7 +60,14 @@ AliFMDDensityCalculator::AliFMDDensityCalculator()
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fDoDiagnostics(true),
+    fLutELossFit(0),
+    fLutRun(0),
+    fLutFits(),
+    fLutMaxWeight(),
+    fLutCut(),
+    fRingCache()
 {
   // 
   // Constructor 
@@ -98,7 +105,14 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const char* title)
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fDoDiagnostics(true),
+    fLutELossFit(0),
+    fLutRun(0),
+    fLutFits(),
+    fLutMaxWeight(),
+    fLutCut(),
+    fRingCache()
 {
   // 
   // Constructor 
@@ -167,7 +181,14 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const
     fDoTiming(o.fDoTiming),
     fHTiming(o.fHTiming), 
   fMaxOutliers(o.fMaxOutliers),
-  fOutlierCut(o.fOutlierCut)
+  fOutlierCut(o.fOutlierCut),
+  fDoDiagnostics(o.fDoDiagnostics),
+  fLutELossFit(0),
+  fLutRun(0),
+  fLutFits(),
+  fLutMaxWeight(),
+  fLutCut(),
+  fRingCache()
 {
   // 
   // Copy constructor 
@@ -232,6 +253,9 @@ AliFMDDensityCalculator::operator=(const AliFMDDensityCalculator& o)
   fHTiming            = o.fHTiming;
   fMaxOutliers        = o.fMaxOutliers;
   fOutlierCut         = o.fOutlierCut;
+  fDoDiagnostics      = o.fDoDiagnostics;
+  fLutELossFit        = 0; // Tables are rebuilt on first use
+  fLutRun             = 0;
 
   fRingHistos.Delete();
   TIter    next(&o.fRingHistos);
@@ -396,11 +420,39 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
   //                       TMath::Power(ip.Y(),2));
   START_TIMER(totalT);
   
-  Double_t etaCache[20*512]; // Same number of strips per ring 
-  Double_t phiCache[20*512]; // whether it is inner our outer. 
-  // We do not use TArrayD because we do not wont a bounds check 
-  // TArrayD etaCache(20*512); // Same number of strips per ring
-  // TArrayD phiCache(20*512); // whether it is inner our outer. 
+  // The strips of a ring are processed as arrays: first all strips
+  // are read (and eta,phi re-calculated), then N_ch and corrections
+  // are evaluated from the look-up tables, and finally the
+  // histograms are filled in the original strip order.  The work
+  // arrays hold the same number of strips per ring whether it is
+  // inner or outer.  We do not use TArrayD::At because we do not
+  // want a bounds check.
+  const Int_t kNStrips = 20*512;
+  if (fRingCache.GetSize() < 8*kNStrips) fRingCache.Set(8*kNStrips);
+  Double_t* etaCache  = fRingCache.GetArray();
+  Double_t* phiCache  = etaCache  + kNStrips;
+  Double_t* oldEtas   = phiCache  + kNStrips;
+  Double_t* oldPhis   = oldEtas   + kNStrips;
+  Double_t* multCache = oldPhis   + kNStrips; // Raw signal
+  Double_t* elossCache= multCache + kNStrips; // Signal used 
+  Double_t* nCache    = elossCache+ kNStrips; // Corrected N_ch
+  Double_t* cCache    = nCache    + kNStrips; // Correction 
+  Float_t   accCache[512];
+
+  // --- Update look-up tables if the energy loss fits changed -------
+  // The tables are keyed on the run the corrections were read for as
+  // well as the correction object, since a new object may be
+  // allocated at the address of the one it replaces.
+  AliForwardCorrectionManager& fcm = AliForwardCorrectionManager::Instance();
+  const AliFMDCorrELossFit*    cor = fcm.GetELossFit();
+  TAxis* cutAxis = fLowCuts->GetXaxis();
+  Int_t  nCut    = cutAxis->GetNbins()+2;
+  if (!cor) { 
+    AliError("No energy loss fits");
+    return false;
+  }
+  if (!IsLookupValid(cor) || fLutCut.GetSize() != 5*nCut) 
+    CacheLookupTables(cor);
   
   // --- Loop over detectors -----------------------------------------
   for (UShort_t d=1; d<=3; d++) { 
@@ -421,25 +473,17 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
       rh->fTotal->Reset();
       rh->fGood->Reset();
       // rh->ResetPoissonHistos(h, fEtaLumping, fPhiLumping);
+      const Double_t* lutCut = fLutCut.GetArray() + cor->GetRingIndex(d,r)*nCut;
 
-      // Reset our eta cache 
-      // for (Int_t i = 0; i < 20*512; i++) 
-      // etaCache[i] = phiCache[i] = AliESDFMD::kInvalidEta;
-      memset(etaCache, 0, sizeof(Double_t)*20*512);
-      memset(phiCache, 0, sizeof(Double_t)*20*512);
-      // etaCache.Reset(AliESDFMD::kInvalidEta);
-      // phiCache.Reset(AliESDFMD::kInvalidEta);
-
-      // --- Loop over sectors and strips ----------------------------
+      // --- Read strips, re-calculate eta,phi if needed -------------
+      START_TIMER(timer);
       for (UShort_t s=0; s<ns; s++) { 
 	for (UShort_t t=0; t<nt; t++) {
-	  
-	  Float_t  mult   = fmd.Multiplicity(d,r,s,t);
+	  Int_t    i      = s*nt+t;
 	  Double_t phi    = fmd.Phi(d,r,s,t) * TMath::DegToRad();
 	  Double_t eta    = fmd.Eta(d,r,s,t);
 	  Double_t oldPhi = phi;
 	  Double_t oldEta = eta;
-	  START_TIMER(timer);
 	  if (fRecalculatePhi) {
 	    // Correct for (x,y) off set of the interaction point 
 	    // AliForwardUtil::GetEtaPhiFromStrip(r,t,eta,phi,ip.X(),ip.Y());
@@ -454,79 +498,95 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	    DMSG(fDebug, 10, "IP(x,y,z)=%f,%f,%f Eta=%f -> %f Phi=%f -> %f",
 		 ip.X(), ip.Y(), ip.Z(), oldEta, eta, oldPhi, phi);
 	  }
-	  ADD_TIMER(timer,rePhiTime);
-	  START_TIMER(timer);
-	  etaCache[s*nt+t] = eta;
-	  phiCache[s*nt+t] = phi;
+	  multCache[i] = fmd.Multiplicity(d,r,s,t);
+	  etaCache[i]  = eta;
+	  phiCache[i]  = phi;
+	  oldEtas[i]   = oldEta;
+	  oldPhis[i]   = oldPhi;
+	} // for t
+      } // for s 
+      ADD_TIMER(timer,rePhiTime);
 
-	  // --- Check this strip ------------------------------------
-	  rh->fTotal->Fill(eta);
-	  if (mult == AliESDFMD::kInvalidMult) { //  || mult > 20) {
-	    // Do not count invalid stuff 
-	    rh->fELoss->Fill(-1);
-	    // rh->fEvsN->Fill(mult,-1);
-	    // rh->fEvsM->Fill(mult,-1);
-	    continue;
-	  }
+      // --- Calculate correction per strip if needed ----------------
+      START_TIMER(timer);
+      for (UShort_t t=0; t<nt; t++) 
+	accCache[t] = (fUsePhiAcceptance == kPhiNoCorrect ? 1 :
+		       AcceptanceCorrection(r,t));
+      ADD_TIMER(timer,corrTime);
+
+      // --- Now caluculate Nch for all strips using fits ------------
+      START_TIMER(timer);
+      for (UShort_t s=0; s<ns; s++) { 
+	for (UShort_t t=0; t<nt; t++) {
+	  Int_t   i    = s*nt+t;
+	  Float_t mult = multCache[i];
+	  if (mult == AliESDFMD::kInvalidMult) continue;
 	  if (mult > 20) 
 	    AliWarningF("Raw multiplicity of FMD%d%c[%02d,%03d] = %f > 20",
 			d, r, s, t, mult);
-	  // --- Automatic calculation of acceptance -----------------
-	  rh->fGood->Fill(eta);
-
-	  // --- If we asked to re-calculate phi for (x,y) IP --------
-	  // START_TIMER(timer);
-	  // if (fRecalculatePhi) {
-	  // oldPhi = phi;
-	  //  phi = AliForwardUtil::GetPhiFromStrip(r, t, phi, ip.X(), ip.Y());
-	  // }
-	  // phiCache[s*nt+t] = phi;
-	  // ADD_TIMER(timer,rePhiTime);
 
 	  // --- Apply phi corner correction to eloss ----------------
-	  if (fUsePhiAcceptance == kPhiCorrectELoss) 
-	    mult *= AcceptanceCorrection(r,t);
+	  if (fUsePhiAcceptance == kPhiCorrectELoss) mult *= accCache[t];
 
 	  // --- Get the low multiplicity cut ------------------------
+	  Double_t eta  = etaCache[i];
 	  Double_t cut  = 1024;
-	  if (eta != AliESDFMD::kInvalidEta) cut = GetMultCut(d, r, eta,false);
+	  if (eta != AliESDFMD::kInvalidEta) 
+	    cut = lutCut[cutAxis->FindBin(eta)];
 	  else AliWarningF("Eta for FMD%d%c[%02d,%03d] is invalid: %f", 
 			   d, r, s, t, eta);
 
-	  // --- Now caluculate Nch for this strip using fits --------
-	  START_TIMER(timer);
 	  Double_t n   = 0;
 	  if (cut > 0 && mult > cut) n = NParticles(mult,d,r,eta,lowFlux);
-	  rh->fELoss->Fill(mult);
-	  // rh->fEvsN->Fill(mult,n);
-	  // rh->fEtaVsN->Fill(eta, n);
-	  ADD_TIMER(timer,nPartTime);
-	  
-	  // --- Calculate correction if needed ----------------------
-	  START_TIMER(timer);
+
 	  // Temporary stuff - remove Correction call 
 	  Double_t c = 1;
-	  if (fUsePhiAcceptance == kPhiCorrectNch) 
-	    c = AcceptanceCorrection(r,t);
+	  if (fUsePhiAcceptance == kPhiCorrectNch) c = accCache[t];
 	  // Double_t c = Correction(d,r,t,eta,lowFlux);
-	  ADD_TIMER(timer,corrTime);
-	  fCorrections->Fill(c);
 	  if (c > 0) n /= c;
-	  // rh->fEvsM->Fill(mult,n);
-	  // rh->fEtaVsM->Fill(eta, n);
-	  rh->fCorr  ->Fill(eta, c);
-	  
-	  // --- Accumulate Poisson statistics -----------------------
-	  Bool_t hit = (n > fHitThreshold && c > 0);
-	  if (hit) {
-	    rh->fELossUsed->Fill(mult);
-	    if (fRecalculatePhi) {
-	      rh->fPhiBefore->Fill(oldPhi);
-	      rh->fPhiAfter->Fill(phi);
-	      rh->fEtaBefore->Fill(oldEta);
-	      rh->fEtaAfter->Fill(oldEta);	      
+
+	  elossCache[i] = mult;
+	  nCache[i]     = n;
+	  cCache[i]     = c;
+	} // for t
+      } // for s 
+      ADD_TIMER(timer,nPartTime);
+
+      // --- Fill histograms and accumulate Poisson statistics -------
+      for (UShort_t s=0; s<ns; s++) { 
+	for (UShort_t t=0; t<nt; t++) {
+	  Int_t    i   = s*nt+t;
+	  Double_t eta = etaCache[i];
+	  Double_t phi = phiCache[i];
+
+	  // --- Check this strip ------------------------------------
+	  rh->fTotal->Fill(eta);
+	  if (multCache[i] == AliESDFMD::kInvalidMult) { 
+	    // Do not count invalid stuff 
+	    if (fDoDiagnostics) rh->fELoss->Fill(-1);
+	    continue;
+	  }
+	  // --- Automatic calculation of acceptance -----------------
+	  rh->fGood->Fill(eta);
+
+	  Double_t mult = elossCache[i];
+	  Double_t n    = nCache[i];
+	  Double_t c    = cCache[i];
+	  Bool_t   hit  = (n > fHitThreshold && c > 0);
+	  if (fDoDiagnostics) { 
+	    rh->fELoss->Fill(mult);
+	    fCorrections->Fill(c);
+	    rh->fCorr  ->Fill(eta, c);
+	    if (hit) {
+	      rh->fELossUsed->Fill(mult);
+	      if (fRecalculatePhi) {
+		rh->fPhiBefore->Fill(oldPhis[i]);
+		rh->fPhiAfter->Fill(phi);
+		rh->fEtaBefore->Fill(oldEtas[i]);
+		rh->fEtaAfter->Fill(oldEtas[i]);	      
+	      }
+	      rh->fSignal->Fill(eta, mult);
 	    }
-	    rh->fSignal->Fill(eta, mult);
 	  }
 	  rh->fPoisson.Fill(t,s,hit,1./c);
 	  h->Fill(eta,phi,n);
@@ -593,7 +653,7 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	h->SetBinContent(ieta, nY+1, phiAcc);
 	h->SetBinError(ieta, nY+1, phiAccE);
 	Double_t eta     = h->GetXaxis()->GetBinCenter(ieta);
-	rh->fPhiAcc->Fill(eta, ip.Z(), phiAcc);
+	if (fDoDiagnostics) rh->fPhiAcc->Fill(eta, ip.Z(), phiAcc);
 	for (Int_t iphi=1; iphi<= nY; iphi++) { 
 	  
 	  Double_t poissonV =  0; //h->GetBinContent(,s+1);
@@ -612,24 +672,26 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	    continue;
 				      
 	  Bool_t   outlier = CheckOutlier(eLossV, poissonV, fOutlierCut);
+	  if (outlier) nOut++;
+	  else         nIn++;
+	  if (!fDoDiagnostics) continue;
+
 	  Double_t rel     = eLossV < 1e-12 ? 0 : (poissonV - eLossV) / eLossV;
 	  if (outlier) {
 	    rh->fELossVsPoissonOut->Fill(eLossV, poissonV);
 	    rh->fDiffELossPoissonOut->Fill(rel);
-	    nOut++;
-	}
+	  }
 	  else {
 	    rh->fELossVsPoisson->Fill(eLossV, poissonV);
 	    rh->fDiffELossPoisson->Fill(rel);
-	    nIn++;
 	  } // if (outlier)
 	} // for (iphi)
       } // for (ieta)
       Int_t    nTotal   = (nIn+nOut);
       Double_t outRatio = (nTotal > 0 ? Double_t(nOut) / nTotal : 0);
-      rh->fOutliers->Fill(outRatio);
-      if (outRatio < fMaxOutliers) rh->fPoisson.FillDiagnostics();
-      else                         h->SetBit(AliForwardUtil::kSkipRing);
+      if (outRatio >= fMaxOutliers) h->SetBit(AliForwardUtil::kSkipRing);
+      else if (fDoDiagnostics)      rh->fPoisson.FillDiagnostics();
+      if (fDoDiagnostics)           rh->fOutliers->Fill(outRatio);
       ADD_TIMER(timer,diagTime);
       // delete hclone;
       
@@ -771,6 +833,71 @@ AliFMDDensityCalculator::CacheMaxWeights(const TAxis& axis)
 
   // Cache cuts in histogram
   fCuts.FillHistogram(fLowCuts);
+
+  CacheLookupTables(cor);
+}
+
+//_____________________________________________________________________
+void
+AliFMDDensityCalculator::CacheLookupTables(const AliFMDCorrELossFit* cor)
+{
+  // 
+  // Fill the flat look-up tables of fits, maximum weights, and low
+  // cuts per ring and eta bin.  The fit and maximum weight tables are
+  // indexed by AliFMDCorrELossFit::FindEtaBin, the cut table by the
+  // bin (including under- and overflow) of the fLowCuts eta axis.
+  // The fits are copied, so that the tables stay valid even if the
+  // correction manager replaces the fit object.
+  // 
+  // Parameters:
+  //    cor Energy loss fits 
+  //
+  DGUARD(fDebug, 2, "Cache look-up tables in FMD density calculator");
+  fLutELossFit = cor;
+  fLutRun      = AliForwardCorrectionManager::Instance().GetRun();
+
+  Int_t nCut = fLowCuts->GetNbinsX()+2;
+  fLutCut.Set(5*nCut);
+  for (Int_t q = 0; q < 5; q++) 
+    for (Int_t i = 0; i < nCut; i++) 
+      fLutCut[q*nCut+i] = fLowCuts->GetBinContent(i, q+1);
+
+  Int_t nFit = (cor ? cor->GetEtaAxis().GetNbins()+1 : 0);
+  fLutFits.SetOwner(true);
+  fLutFits.Clear();
+  fLutFits.Expand(5*nFit);
+  fLutMaxWeight.Set(5*nFit);
+  if (!cor) return;
+  for (UShort_t d=1; d<=3; d++) { 
+    UShort_t nr = (d == 1 ? 1 : 2);
+    for (UShort_t q=0; q<nr; q++) { 
+      Char_t r   = (q == 0 ? 'I' : 'O');
+      Int_t  off = cor->GetRingIndex(d,r)*nFit;
+      for (Int_t i = 0; i < nFit; i++) { 
+	AliFMDCorrELossFit::ELossFit* fit = cor->FindFit(d, r, i, -1);
+	if (fit) fLutFits.AddAt(new AliFMDCorrELossFit::ELossFit(*fit), off+i);
+	fLutMaxWeight[off+i] = GetMaxWeight(d, r, i-1);
+      }
+    }
+  }
+}
+
+//_____________________________________________________________________
+Bool_t
+AliFMDDensityCalculator::IsLookupValid(const AliFMDCorrELossFit* cor) const
+{
+  // 
+  // Check if the look-up tables were made for the passed fits and
+  // the run the correction manager is currently set up for
+  // 
+  // Parameters:
+  //    cor Energy loss fits 
+  //
+  // Return:
+  //    true if the look-up tables can be used 
+  //
+  return (cor && cor == fLutELossFit && 
+	  fLutRun == AliForwardCorrectionManager::Instance().GetRun());
 }
 
 //_____________________________________________________________________
@@ -864,14 +991,29 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   if (lowFlux) return 1;
   
   AliForwardCorrectionManager&  fcm = AliForwardCorrectionManager::Instance();
-  AliFMDCorrELossFit::ELossFit* fit = fcm.GetELossFit()->FindFit(d,r,eta, -1);
+  const AliFMDCorrELossFit*     cor = fcm.GetELossFit();
+  AliFMDCorrELossFit::ELossFit* fit = 0;
+  Int_t                         m   = -1;
+  Int_t                         bin = cor->FindEtaBin(eta);
+  if (IsLookupValid(cor)) { 
+    // Use the look-up tables 
+    Int_t nFit = fLutMaxWeight.GetSize() / 5;
+    Int_t idx  = cor->GetRingIndex(d,r)*nFit + bin;
+    if (bin >= 0 && bin < nFit) { 
+      fit = static_cast<AliFMDCorrELossFit::ELossFit*>(fLutFits.UncheckedAt(idx));
+      m   = fLutMaxWeight[idx];
+    }
+  }
+  else {
+    fit = cor->FindFit(d,r,bin, -1);
+    m   = GetMaxWeight(d,r,bin-1); // fit->FindMaxWeight();
+  }
   if (!fit) { 
     AliWarning(Form("No energy loss fit for FMD%d%c at eta=%f qual=%d", 
 		    d, r, eta, fMinQuality));
     return 0;
   }
   
-  Int_t    m   = GetMaxWeight(d,r,eta); // fit->FindMaxWeight();
   if (m < 1) { 
     AliWarning(Form("No good fits for FMD%d%c at eta=%f", d, r, eta));
     return 0;
@@ -884,8 +1026,10 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
     AliInfo(Form("FMD%d%c, eta=%7.4f, %8.5f -> %8.5f", d, r, eta, mult, ret));
   }
     
-  fWeightedSum->Fill(ret);
-  fSumOfWeights->Fill(ret);
+  if (fDoDiagnostics) { 
+    fWeightedSum->Fill(ret);
+    fSumOfWeights->Fill(ret);
+  }
   
   return ret;
 }
@@ -1120,6 +1264,7 @@ AliFMDDensityCalculator::CreateOutputObjects(TList* dir)
   d->Add(AliForwardUtil::MakeParameter("maxOutliers",  fMaxOutliers));
   d->Add(AliForwardUtil::MakeParameter("outlierCut",   fOutlierCut));
   d->Add(AliForwardUtil::MakeParameter("hitThreshold", fHitThreshold));
+  d->Add(AliForwardUtil::MakeParameter("diagnostics",  fDoDiagnostics));
   d->Add(nFiles);
   // d->Add(nxi);
   fCuts.Output(d,"lCuts");
@@ -1201,6 +1346,7 @@ AliFMDDensityCalculator::Print(Option_t* option) const
   PFV("Threshold(hit)",         fHitThreshold);
   PFV("Max(outliers)",          fMaxOutliers);
   PFV("Cut(outlier)",           fOutlierCut);
+  PFB("Diagnostics",            fDoDiagnostics);
   PFV("Lower cut", "");
   fCuts.Print();
 
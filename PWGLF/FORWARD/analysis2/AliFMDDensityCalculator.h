@@ -16,6 +16,8 @@
 #include <TNamed.h>
 #include <TList.h>
 #include <TArrayI.h>
+#include <TArrayD.h>
+#include <TObjArray.h>
 #include <TVector3.h>
 #include "AliForwardUtil.h"
 #include "AliFMDMultCuts.h"
@@ -135,6 +137,15 @@ public:
    */
   void SetDebug(Int_t dbg=1) { fDebug = dbg; }	
   void SetDoTiming(Bool_t enable=true) { fDoTiming = enable; }
+  /** 
+   * Whether to fill the per-strip and per-bin diagnostics histograms
+   * (energy loss, signal, corrections, @f$\phi@f$ acceptance, energy
+   * loss vs. Poisson, ...).  The results and the outlier rejection
+   * do not depend on this.
+   * 
+   * @param enable If true, fill the diagnostics histograms 
+   */
+  void SetDoDiagnostics(Bool_t enable=true) { fDoDiagnostics = enable; }
   /** 
    * Maximum particle weight to use 
    * 
@@ -297,6 +308,24 @@ protected:
    * @param axis Default @f$\eta@f$ axis from parent task 
    */  
   void CacheMaxWeights(const TAxis& axis);
+  /** 
+   * Fill the flat look-up tables of energy loss fits, maximum
+   * weights, and low cuts per ring and @f$\eta@f$ bin.  This is done
+   * in SetupForData and again whenever the energy loss fits change
+   * (e.g., on a new run).
+   * 
+   * @param cor Energy loss fits 
+   */
+  void CacheLookupTables(const AliFMDCorrELossFit* cor);
+  /** 
+   * Check if the look-up tables were made for the passed fits and
+   * the run the correction manager is currently set up for
+   * 
+   * @param cor Energy loss fits 
+   * 
+   * @return true if the look-up tables can be used 
+   */
+  Bool_t IsLookupValid(const AliFMDCorrELossFit* cor) const;
   /** 
    * Find the (cached) maximum weight for FMD<i>dr</i> in 
    * @f$\eta@f$ bin @a iEta
@@ -504,8 +533,15 @@ protected:
   TProfile*              fHTiming;
   Double_t               fMaxOutliers; // Maximum ratio of outlier bins 
   Double_t               fOutlierCut;  // Maximum relative diviation 
+  Bool_t                 fDoDiagnostics; // Whether to fill diagnostics
+  const AliFMDCorrELossFit* fLutELossFit; //! Fits the look-up tables are for
+  ULong_t                fLutRun;       //! Run the look-up tables are for
+  TObjArray              fLutFits;      //! Fit per ring and eta bin 
+  TArrayI                fLutMaxWeight; //! Max weight per ring and eta bin
+  TArrayD                fLutCut;       //! Low cut per ring and eta bin
+  TArrayD                fRingCache;    //! Per-strip arrays of one ring
 
-  ClassDef(AliFMDDensityCalculator,16); // Calculate Nch density 
+  ClassDef(AliFMDDensityCalculator,17); // Calculate Nch density 
 };
 
 #endif
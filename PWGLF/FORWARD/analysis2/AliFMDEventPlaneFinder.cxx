@@ -10,9 +10,11 @@
 #include "TROOT.h"
 #include <iostream>
 #include <iomanip>
+#include <vector>
 #include <TString.h>
 #include <TFile.h>
 #include "AliOADBContainer.h"
+#include "AliEPCalibrationCache.h"
 #include "AliAnalysisManager.h"
 #include "AliVEvent.h"
 #include "AliEventplane.h"
@@ -54,7 +56,8 @@ AliFMDEventPlaneFinder::AliFMDEventPlaneFinder()
     fOADBContainer(0),
     fPhiDist(0),
     fRunNumber(0),
-    fUsePhiWeights(0)
+    fUsePhiWeights(0),
+    fCalib(0)
 {
   // 
   // Constructor 
@@ -91,7 +94,8 @@ AliFMDEventPlaneFinder::AliFMDEventPlaneFinder(const char* title)
     fOADBContainer(0),
     fPhiDist(0),
     fRunNumber(0),
-    fUsePhiWeights(1)
+    fUsePhiWeights(1),
+    fCalib(0)
 {
   // 
   // Constructor 
@@ -131,7 +135,8 @@ AliFMDEventPlaneFinder::AliFMDEventPlaneFinder(const
     fOADBContainer(o.fOADBContainer),
     fPhiDist(o.fPhiDist),
     fRunNumber(o.fRunNumber),
-    fUsePhiWeights(o.fUsePhiWeights)
+    fUsePhiWeights(o.fUsePhiWeights),
+    fCalib(o.fCalib)
 {
   // 
   // Copy constructor 
@@ -193,6 +198,7 @@ AliFMDEventPlaneFinder::operator=(const AliFMDEventPlaneFinder& o)
   fPhiDist             = o.fPhiDist;
   fRunNumber           = o.fRunNumber;
   fUsePhiWeights       = o.fUsePhiWeights;
+  fCalib               = o.fCalib;
 
   return *this;
 }
@@ -387,10 +393,18 @@ AliFMDEventPlaneFinder::CalcQVectors(TH2D* h, TH1D* eHist)
   //
   DGUARD(fDebug,5,"Calculate Q-vectors in AliFMDEventPlaneFinder");
   Double_t phi = 0, eta = 0, weight = 0;
+  // cos(2 phi), sin(2 phi) of the phi bins, same for all eta bins
+  const Int_t nPhi = h->GetNbinsY();
+  std::vector<Double_t> cos2Phi(nPhi+1), sin2Phi(nPhi+1);
+  for (Int_t p = 1; p <= nPhi; p++) {
+    phi = h->GetYaxis()->GetBinCenter(p);
+    cos2Phi[p] = TMath::Cos(2.*phi);
+    sin2Phi[p] = TMath::Sin(2.*phi);
+  }
   for (Int_t e = 1; e <= h->GetNbinsX(); e++) {
     Double_t qx = 0, qy = 0;
     eta = h->GetXaxis()->GetBinCenter(e);
-    for (Int_t p = 1; p <= h->GetNbinsY(); p++) {
+    for (Int_t p = 1; p <= nPhi; p++) {
       phi = h->GetYaxis()->GetBinCenter(p);
       weight = h->GetBinContent(e, p);
       if (fUsePhiWeights) weight *= GetPhiWeight(e, p);
@@ -404,8 +418,8 @@ AliFMDEventPlaneFinder::CalcQVectors(TH2D* h, TH1D* eHist)
       fHPhi->Fill(eta, -1., weight);
       
       // increment Q vectors
-      qx += weight*TMath::Cos(2.*phi);
-      qy += weight*TMath::Sin(2.*phi);
+      qx += weight*cos2Phi[p];
+      qy += weight*sin2Phi[p];
     }
     TVector2 qVec(qx, qy);
     fQt += qVec;
@@ -500,13 +514,11 @@ AliFMDEventPlaneFinder::GetPhiWeight(Int_t etaBin, Int_t phiBin) const
   //
   Double_t phiWeight = 1;
   
-  if (!fPhiDist) return phiWeight;
+  if (!fPhiDist || !fCalib) return phiWeight;
 
-  Double_t nParticles   = fPhiDist->GetBinContent(etaBin, 0);
-  Double_t nPhiBins     = fPhiDist->GetNbinsY();
-  Double_t phiDistValue = fPhiDist->GetBinContent(etaBin, phiBin);
-  
-  if (phiDistValue > 0) phiWeight = nParticles/nPhiBins/phiDistValue;
+  // nParticles/nPhiBins/phiDistValue with nParticles in the
+  // phi underflow bin, 1 for empty bins
+  phiWeight = fCalib->GetPhiWeight2D(etaBin, phiBin);
 
   return phiWeight;
 }
@@ -540,6 +552,14 @@ AliFMDEventPlaneFinder::GetPhiDist()
 				->Clone(Form("fPhiDist_%d", fRunNumber)));
   fList->Add(fPhiDist);
 
+  // flat table of the weights, filled once per run
+  fCalib = AliEPCalibrationCache::Get(Form("AliFMDEventPlaneFinder.%s", 
+					   fOADBFileName.Data()));
+  if (!fCalib->IsValid(fRunNumber)) {
+    fCalib->SetRunNumber(fRunNumber);
+    fCalib->SetPhiWeights2D(fPhiDist);
+  }
+
   return;
 }
 
@@ -23,6 +23,7 @@ class TH2D;
 class TString;
 class AliOADBContainer;
 class AliAODForwardEP;
+class AliEPCalibrationCache;
 
 /**
  * Find the event plane using the FMD
@@ -150,7 +151,9 @@ public:
 
 protected:
   /**
-   * Get the phi weight from OADB histogram for the ep flattening
+   * Get the phi weight from OADB histogram for the ep flattening.
+   * The weights of the run are taken from a flat table shared by
+   * all finders using the same OADB file.
    *
    * @param etaBin which eta bin
    * @param phiBin which phi bin
@@ -232,6 +235,7 @@ protected:
   TH2D*             fPhiDist;            // Phi dist. for phi weights
   Int_t             fRunNumber;          // Run number supplied
   Bool_t            fUsePhiWeights;      // Flag for phi weights
+  AliEPCalibrationCache* fCalib;         //! Phi weights of the run
 
   ClassDef(AliFMDEventPlaneFinder,2); //  
 };
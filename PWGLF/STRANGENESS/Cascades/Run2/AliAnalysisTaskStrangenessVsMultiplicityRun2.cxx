@@ -63,6 +63,7 @@ class AliESDv0;
 class AliAODv0;
 
 #include <Riostream.h>
+#include <vector>
 #include "TList.h"
 #include "TH1.h"
 #include "TH2.h"
@@ -121,11 +122,341 @@ class AliAODv0;
 using std::cout;
 using std::endl;
 
+//________________________________________________________________________
+// Superlight output mode: the registered AliV0Result and AliCascadeResult
+// configurations are compiled once (in UserCreateOutputObjects) into
+// structure-of-arrays cut tables, with one contiguous block per mass
+// hypothesis. Per candidate, everything that does not depend on the
+// configuration is computed once and all configurations are then checked
+// in tight loops over plain arrays instead of going through the result
+// objects. All cut values are stored as Double_t; the ones the per-object
+// checks held in single precision (CosPA and DCA between the cascade
+// daughters, combined with the Float_t parametric cuts) are rounded to
+// Float_t when the table is built, so the selection is unchanged.
+//________________________________________________________________________
+
+//Pool of distinct pt-dependent cut parametrizations
+//  p0*exp(p1*pt) + p2*exp(p3*pt) + p4, optionally passed through a cosine.
+//Configurations refer to it by index (-1: parametric cut not used), so that
+//each distinct parametrization is only evaluated once per candidate.
+namespace {
+class VariableCutPool {
+public:
+    VariableCutPool(Bool_t lCosine) : fCosine(lCosine), fPars(), fValue() {}
+    void Clear() { fPars.clear(); fValue.clear(); }
+    Int_t Add(Bool_t lUse, Double_t lP0, Double_t lP1, Double_t lP2, Double_t lP3, Double_t lP4);
+    void Evaluate(Float_t lPt);
+    Float_t GetValue(Int_t lIndex) const { return fValue[lIndex]; }
+private:
+    Bool_t fCosine;                 //apply cosine to the parametrization
+    std::vector<Float_t> fPars;     //5 parameters per parametrization
+    std::vector<Float_t> fValue;    //value for the current candidate
+};
+
+Int_t VariableCutPool::Add(Bool_t lUse, Double_t lP0, Double_t lP1, Double_t lP2, Double_t lP3, Double_t lP4)
+{
+    if( !lUse ) return -1;
+    //Parameters kept in single precision, as in the original per-configuration evaluation
+    const Float_t lPar[5] = { (Float_t)lP0, (Float_t)lP1, (Float_t)lP2, (Float_t)lP3, (Float_t)lP4 };
+    const Int_t lNPars = fValue.size();
+    for(Int_t ipar=0; ipar<lNPars; ipar++){
+        const Float_t *lThisPar = &fPars[5*ipar];
+        if( lThisPar[0]==lPar[0] && lThisPar[1]==lPar[1] && lThisPar[2]==lPar[2] &&
+           lThisPar[3]==lPar[3] && lThisPar[4]==lPar[4] ) return ipar;
+    }
+    fPars.insert(fPars.end(), lPar, lPar+5);
+    fValue.push_back(0);
+    return lNPars;
+}
+
+void VariableCutPool::Evaluate(Float_t lPt)
+{
+    const Int_t lNPars = fValue.size();
+    for(Int_t ipar=0; ipar<lNPars; ipar++){
+        const Float_t *lPar = &fPars[5*ipar];
+        const Double_t lArg = lPar[0]*TMath::Exp(lPar[1]*lPt) + lPar[2]*TMath::Exp(lPar[3]*lPt) + lPar[4];
+        fValue[ipar] = fCosine ? TMath::Cos(lArg) : lArg;
+    }
+}
+} //anonymous namespace
+
+//V0 configurations, blocks ordered as AliV0Result::EMassHypo
+class AliAnalysisTaskStrangenessVsMultiplicityRun2::V0CutTable {
+public:
+    V0CutTable() : fVarV0CosPA(kTRUE) { for(Int_t i=0; i<4; i++) fFirst[i] = 0; }
+    void Build(TList *lK0Short, TList *lLambda, TList *lAntiLambda);
+    
+    Long_t fFirst[4]; //configurations of hypothesis h are [fFirst[h], fFirst[h+1])
+    VariableCutPool fVarV0CosPA;
+    
+    std::vector<TH3F*>    fHisto;
+    std::vector<Int_t>    fUseOnTheFly;
+    std::vector<Double_t> fMinEtaTracks;
+    std::vector<Double_t> fMaxEtaTracks;
+    std::vector<Double_t> fMinRapidity;
+    std::vector<Double_t> fMaxRapidity;
+    std::vector<Double_t> fV0Radius;
+    std::vector<Double_t> fMaxV0Radius;
+    std::vector<Double_t> fDCANegToPV;
+    std::vector<Double_t> fDCAPosToPV;
+    std::vector<Double_t> fDCAV0Daughters;
+    std::vector<Double_t> fV0CosPA; //single precision value
+    std::vector<Int_t>    fVarV0CosPAIndex;
+    std::vector<Double_t> fProperLifetime;
+    std::vector<Double_t> fLeastNumberOfCrossedRows;
+    std::vector<Double_t> fLeastNumberOfCrossedRowsOverFindable;
+    std::vector<Double_t> fMinBaryonMomentum;
+    std::vector<Double_t> fTPCdEdx;
+    std::vector<UChar_t>  fArmenteros;
+    std::vector<Double_t> fArmenterosParameter;
+    std::vector<UChar_t>  fUseITSRefitTracks;
+    std::vector<Double_t> fMaxChi2PerCluster;
+    std::vector<Double_t> fMinTrackLength;
+    std::vector<UChar_t>  fUseParametricLength;
+    std::vector<UChar_t>  f276TeVLikedEdx;
+    std::vector<UChar_t>  fAtLeastOneTOF;
+    std::vector<Int_t>    fIsCowboy;
+    std::vector<Double_t> fMinCrossedRowsOverLength;
+    std::vector<UChar_t>  fITSorTOF;
+    
+    std::vector<UChar_t>  fPass; //selection result for the current candidate
+};
+
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::V0CutTable::Build(TList *lK0Short, TList *lLambda, TList *lAntiLambda)
+{
+    TList *lLists[3] = { lK0Short, lLambda, lAntiLambda };
+    
+    fVarV0CosPA.Clear();
+    fHisto.clear(); fUseOnTheFly.clear(); fMinEtaTracks.clear(); fMaxEtaTracks.clear();
+    fMinRapidity.clear(); fMaxRapidity.clear(); fV0Radius.clear(); fMaxV0Radius.clear();
+    fDCANegToPV.clear(); fDCAPosToPV.clear(); fDCAV0Daughters.clear(); fV0CosPA.clear();
+    fVarV0CosPAIndex.clear(); fProperLifetime.clear(); fLeastNumberOfCrossedRows.clear();
+    fLeastNumberOfCrossedRowsOverFindable.clear(); fMinBaryonMomentum.clear(); fTPCdEdx.clear();
+    fArmenteros.clear(); fArmenterosParameter.clear(); fUseITSRefitTracks.clear();
+    fMaxChi2PerCluster.clear(); fMinTrackLength.clear(); fUseParametricLength.clear();
+    f276TeVLikedEdx.clear(); fAtLeastOneTOF.clear(); fIsCowboy.clear();
+    fMinCrossedRowsOverLength.clear(); fITSorTOF.clear();
+    
+    for(Int_t ihypo=0; ihypo<3; ihypo++){
+        fFirst[ihypo] = fHisto.size();
+        for(Int_t ilist=0; ilist<3; ilist++){
+            if( !lLists[ilist] ) continue;
+            for(Int_t icfg=0; icfg<lLists[ilist]->GetEntries(); icfg++){
+                AliV0Result *lV0Result = (AliV0Result*) lLists[ilist]->At(icfg);
+                if( lV0Result->GetMassHypothesis() != ihypo ) continue;
+                
+                fHisto.push_back( lV0Result->GetHistogram() );
+                fUseOnTheFly.push_back( lV0Result->GetUseOnTheFly() );
+                fMinEtaTracks.push_back( lV0Result->GetCutMinEtaTracks() );
+                fMaxEtaTracks.push_back( lV0Result->GetCutMaxEtaTracks() );
+                fMinRapidity.push_back( lV0Result->GetCutMinRapidity() );
+                fMaxRapidity.push_back( lV0Result->GetCutMaxRapidity() );
+                fV0Radius.push_back( lV0Result->GetCutV0Radius() );
+                fMaxV0Radius.push_back( lV0Result->GetCutMaxV0Radius() );
+                fDCANegToPV.push_back( lV0Result->GetCutDCANegToPV() );
+                fDCAPosToPV.push_back( lV0Result->GetCutDCAPosToPV() );
+                fDCAV0Daughters.push_back( lV0Result->GetCutDCAV0Daughters() );
+                fV0CosPA.push_back( (Float_t)lV0Result->GetCutV0CosPA() );
+                fVarV0CosPAIndex.push_back( fVarV0CosPA.Add( lV0Result->GetCutUseVarV0CosPA(),
+                                                            lV0Result->GetCutVarV0CosPAExp0Const(),
+                                                            lV0Result->GetCutVarV0CosPAExp0Slope(),
+                                                            lV0Result->GetCutVarV0CosPAExp1Const(),
+                                                            lV0Result->GetCutVarV0CosPAExp1Slope(),
+                                                            lV0Result->GetCutVarV0CosPAConst() ) );
+                fProperLifetime.push_back( lV0Result->GetCutProperLifetime() );
+                fLeastNumberOfCrossedRows.push_back( lV0Result->GetCutLeastNumberOfCrossedRows() );
+                fLeastNumberOfCrossedRowsOverFindable.push_back( lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() );
+                fMinBaryonMomentum.push_back( lV0Result->GetCutMinBaryonMomentum() );
+                fTPCdEdx.push_back( lV0Result->GetCutTPCdEdx() );
+                fArmenteros.push_back( lV0Result->GetCutArmenteros() );
+                fArmenterosParameter.push_back( lV0Result->GetCutArmenterosParameter() );
+                fUseITSRefitTracks.push_back( lV0Result->GetCutUseITSRefitTracks() );
+                fMaxChi2PerCluster.push_back( lV0Result->GetCutMaxChi2PerCluster() );
+                fMinTrackLength.push_back( lV0Result->GetCutMinTrackLength() );
+                fUseParametricLength.push_back( lV0Result->GetCutUseParametricLength() );
+                f276TeVLikedEdx.push_back( lV0Result->GetCut276TeVLikedEdx() );
+                fAtLeastOneTOF.push_back( lV0Result->GetCutAtLeastOneTOF() );
+                fIsCowboy.push_back( lV0Result->GetCutIsCowboy() );
+                fMinCrossedRowsOverLength.push_back( lV0Result->GetCutMinCrossedRowsOverLength() );
+                fITSorTOF.push_back( lV0Result->GetCutITSorTOF() );
+            }
+        }
+    }
+    fFirst[3] = fHisto.size();
+    fPass.assign( fHisto.size(), 0 );
+}
+
+//Cascade configurations, blocks ordered as AliCascadeResult::EMassHypo
+class AliAnalysisTaskStrangenessVsMultiplicityRun2::CascadeCutTable {
+public:
+    CascadeCutTable() : fVarCascCosPA(kTRUE), fVarV0CosPA(kTRUE), fVarBBCosPA(kTRUE), fVarDCACascDau(kFALSE) { for(Int_t i=0; i<5; i++) fFirst[i] = 0; }
+    void Build(TList *lXiMinus, TList *lXiPlus, TList *lOmegaMinus, TList *lOmegaPlus, const TString &lConfigToSave);
+    
+    Long_t fFirst[5]; //configurations of hypothesis h are [fFirst[h], fFirst[h+1])
+    VariableCutPool fVarCascCosPA;
+    VariableCutPool fVarV0CosPA;
+    VariableCutPool fVarBBCosPA;
+    VariableCutPool fVarDCACascDau;
+    
+    std::vector<TH3F*>    fHisto;
+    std::vector<UChar_t>  fSaveToTree; //configuration selected with SetSaveSpecificCascadeConfig
+    std::vector<Int_t>    fCharge;     //expected charge, bachelor charge swap included
+    std::vector<Double_t> fMinEtaTracks;
+    std::vector<Double_t> fMaxEtaTracks;
+    std::vector<Double_t> fMinRapidity;
+    std::vector<Double_t> fMaxRapidity;
+    std::vector<Double_t> fDCANegToPV;
+    std::vector<Double_t> fDCAPosToPV;
+    std::vector<Double_t> fDCAV0Daughters;
+    std::vector<Double_t> fV0CosPA; //single precision value
+    std::vector<Int_t>    fVarV0CosPAIndex;
+    std::vector<Double_t> fV0Radius;
+    std::vector<Double_t> fDCAV0ToPV;
+    std::vector<Double_t> fV0Mass;
+    std::vector<Double_t> fV0MassSigma;
+    std::vector<Double_t> fDCABachToPV;
+    std::vector<Double_t> fDCACascDaughters; //single precision value
+    std::vector<Int_t>    fVarDCACascDauIndex;
+    std::vector<Double_t> fCascCosPA; //single precision value
+    std::vector<Int_t>    fVarCascCosPAIndex;
+    std::vector<Double_t> fCascRadius;
+    std::vector<Double_t> fProperLifetime;
+    std::vector<Double_t> fLeastNumberOfClusters;
+    std::vector<Double_t> fTPCdEdx;
+    std::vector<UChar_t>  fUseTOFUnchecked;
+    std::vector<Double_t> fXiRejection;
+    std::vector<Double_t> fDCABachToBaryon;
+    std::vector<Double_t> fBachBaryonCosPA; //single precision value
+    std::vector<Int_t>    fVarBBCosPAIndex;
+    std::vector<Double_t> fMinV0Lifetime;
+    std::vector<Double_t> fMaxV0Lifetime;
+    std::vector<UChar_t>  fUseITSRefitTracks;
+    std::vector<Double_t> fMaxChi2PerCluster;
+    std::vector<Double_t> fMinTrackLength;
+    std::vector<UChar_t>  fUseParametricLength;
+    std::vector<UChar_t>  fUse276TeVV0CosPA;
+    std::vector<Double_t> fDCACascadeToPV;
+    std::vector<UChar_t>  fAtLeastOneTOF;
+    std::vector<UChar_t>  fUseITSRefitNegative;
+    std::vector<UChar_t>  fUseITSRefitPositive;
+    std::vector<UChar_t>  fUseITSRefitBachelor;
+    std::vector<Int_t>    fIsCowboy;
+    std::vector<Int_t>    fIsCascadeCowboy;
+    std::vector<Double_t> fMinCrossedRowsOverLength;
+    std::vector<Double_t> fLeastNumberOfCrossedRows;
+    std::vector<UChar_t>  fITSorTOF;
+    
+    std::vector<UChar_t>  fPass; //selection result for the current candidate
+};
+
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::CascadeCutTable::Build(TList *lXiMinus, TList *lXiPlus, TList *lOmegaMinus, TList *lOmegaPlus, const TString &lConfigToSave)
+{
+    TList *lLists[4] = { lXiMinus, lXiPlus, lOmegaMinus, lOmegaPlus };
+    const Int_t lBaseCharge[4] = { -1, +1, -1, +1 };
+    
+    fVarCascCosPA.Clear(); fVarV0CosPA.Clear(); fVarBBCosPA.Clear(); fVarDCACascDau.Clear();
+    fHisto.clear(); fSaveToTree.clear(); fCharge.clear(); fMinEtaTracks.clear(); fMaxEtaTracks.clear();
+    fMinRapidity.clear(); fMaxRapidity.clear(); fDCANegToPV.clear(); fDCAPosToPV.clear();
+    fDCAV0Daughters.clear(); fV0CosPA.clear(); fVarV0CosPAIndex.clear(); fV0Radius.clear();
+    fDCAV0ToPV.clear(); fV0Mass.clear(); fV0MassSigma.clear(); fDCABachToPV.clear();
+    fDCACascDaughters.clear(); fVarDCACascDauIndex.clear(); fCascCosPA.clear(); fVarCascCosPAIndex.clear();
+    fCascRadius.clear(); fProperLifetime.clear(); fLeastNumberOfClusters.clear(); fTPCdEdx.clear();
+    fUseTOFUnchecked.clear(); fXiRejection.clear(); fDCABachToBaryon.clear(); fBachBaryonCosPA.clear();
+    fVarBBCosPAIndex.clear(); fMinV0Lifetime.clear(); fMaxV0Lifetime.clear(); fUseITSRefitTracks.clear();
+    fMaxChi2PerCluster.clear(); fMinTrackLength.clear(); fUseParametricLength.clear();
+    fUse276TeVV0CosPA.clear(); fDCACascadeToPV.clear(); fAtLeastOneTOF.clear();
+    fUseITSRefitNegative.clear(); fUseITSRefitPositive.clear(); fUseITSRefitBachelor.clear();
+    fIsCowboy.clear(); fIsCascadeCowboy.clear(); fMinCrossedRowsOverLength.clear();
+    fLeastNumberOfCrossedRows.clear(); fITSorTOF.clear();
+    
+    for(Int_t ihypo=0; ihypo<4; ihypo++){
+        fFirst[ihypo] = fHisto.size();
+        for(Int_t ilist=0; ilist<4; ilist++){
+            if( !lLists[ilist] ) continue;
+            for(Int_t icfg=0; icfg<lLists[ilist]->GetEntries(); icfg++){
+                AliCascadeResult *lCascadeResult = (AliCascadeResult*) lLists[ilist]->At(icfg);
+                if( lCascadeResult->GetMassHypothesis() != ihypo ) continue;
+                
+                fHisto.push_back( lCascadeResult->GetHistogram() );
+                fSaveToTree.push_back( lConfigToSave.EqualTo( lCascadeResult->GetName() ) );
+                fCharge.push_back( lCascadeResult->GetSwapBachelorCharge() ? -lBaseCharge[ihypo] : lBaseCharge[ihypo] );
+                fMinEtaTracks.push_back( lCascadeResult->GetCutMinEtaTracks() );
+                fMaxEtaTracks.push_back( lCascadeResult->GetCutMaxEtaTracks() );
+                fMinRapidity.push_back( lCascadeResult->GetCutMinRapidity() );
+                fMaxRapidity.push_back( lCascadeResult->GetCutMaxRapidity() );
+                fDCANegToPV.push_back( lCascadeResult->GetCutDCANegToPV() );
+                fDCAPosToPV.push_back( lCascadeResult->GetCutDCAPosToPV() );
+                fDCAV0Daughters.push_back( lCascadeResult->GetCutDCAV0Daughters() );
+                fV0CosPA.push_back( (Float_t)lCascadeResult->GetCutV0CosPA() );
+                fVarV0CosPAIndex.push_back( fVarV0CosPA.Add( lCascadeResult->GetCutUseVarV0CosPA(),
+                                                            lCascadeResult->GetCutVarV0CosPAExp0Const(),
+                                                            lCascadeResult->GetCutVarV0CosPAExp0Slope(),
+                                                            lCascadeResult->GetCutVarV0CosPAExp1Const(),
+                                                            lCascadeResult->GetCutVarV0CosPAExp1Slope(),
+                                                            lCascadeResult->GetCutVarV0CosPAConst() ) );
+                fV0Radius.push_back( lCascadeResult->GetCutV0Radius() );
+                fDCAV0ToPV.push_back( lCascadeResult->GetCutDCAV0ToPV() );
+                fV0Mass.push_back( lCascadeResult->GetCutV0Mass() );
+                fV0MassSigma.push_back( lCascadeResult->GetCutV0MassSigma() );
+                fDCABachToPV.push_back( lCascadeResult->GetCutDCABachToPV() );
+                fDCACascDaughters.push_back( (Float_t)lCascadeResult->GetCutDCACascDaughters() );
+                fVarDCACascDauIndex.push_back( fVarDCACascDau.Add( lCascadeResult->GetCutUseVarDCACascDau(),
+                                                                  lCascadeResult->GetCutVarDCACascDauExp0Const(),
+                                                                  lCascadeResult->GetCutVarDCACascDauExp0Slope(),
+                                                                  lCascadeResult->GetCutVarDCACascDauExp1Const(),
+                                                                  lCascadeResult->GetCutVarDCACascDauExp1Slope(),
+                                                                  lCascadeResult->GetCutVarDCACascDauConst() ) );
+                fCascCosPA.push_back( (Float_t)lCascadeResult->GetCutCascCosPA() );
+                fVarCascCosPAIndex.push_back( fVarCascCosPA.Add( lCascadeResult->GetCutUseVarCascCosPA(),
+                                                                lCascadeResult->GetCutVarCascCosPAExp0Const(),
+                                                                lCascadeResult->GetCutVarCascCosPAExp0Slope(),
+                                                                lCascadeResult->GetCutVarCascCosPAExp1Const(),
+                                                                lCascadeResult->GetCutVarCascCosPAExp1Slope(),
+                                                                lCascadeResult->GetCutVarCascCosPAConst() ) );
+                fCascRadius.push_back( lCascadeResult->GetCutCascRadius() );
+                fProperLifetime.push_back( lCascadeResult->GetCutProperLifetime() );
+                fLeastNumberOfClusters.push_back( lCascadeResult->GetCutLeastNumberOfClusters() );
+                fTPCdEdx.push_back( lCascadeResult->GetCutTPCdEdx() );
+                fUseTOFUnchecked.push_back( lCascadeResult->GetCutUseTOFUnchecked() );
+                fXiRejection.push_back( lCascadeResult->GetCutXiRejection() );
+                fDCABachToBaryon.push_back( lCascadeResult->GetCutDCABachToBaryon() );
+                fBachBaryonCosPA.push_back( (Float_t)lCascadeResult->GetCutBachBaryonCosPA() );
+                fVarBBCosPAIndex.push_back( fVarBBCosPA.Add( lCascadeResult->GetCutUseVarBBCosPA(),
+                                                            lCascadeResult->GetCutVarBBCosPAExp0Const(),
+                                                            lCascadeResult->GetCutVarBBCosPAExp0Slope(),
+                                                            lCascadeResult->GetCutVarBBCosPAExp1Const(),
+                                                            lCascadeResult->GetCutVarBBCosPAExp1Slope(),
+                                                            lCascadeResult->GetCutVarBBCosPAConst() ) );
+                fMinV0Lifetime.push_back( lCascadeResult->GetCutMinV0Lifetime() );
+                fMaxV0Lifetime.push_back( lCascadeResult->GetCutMaxV0Lifetime() );
+                fUseITSRefitTracks.push_back( lCascadeResult->GetCutUseITSRefitTracks() );
+                fMaxChi2PerCluster.push_back( lCascadeResult->GetCutMaxChi2PerCluster() );
+                fMinTrackLength.push_back( lCascadeResult->GetCutMinTrackLength() );
+                fUseParametricLength.push_back( lCascadeResult->GetCutUseParametricLength() );
+                fUse276TeVV0CosPA.push_back( lCascadeResult->GetCutUse276TeVV0CosPA() );
+                fDCACascadeToPV.push_back( lCascadeResult->GetCutDCACascadeToPV() );
+                fAtLeastOneTOF.push_back( lCascadeResult->GetCutAtLeastOneTOF() );
+                fUseITSRefitNegative.push_back( lCascadeResult->GetCutUseITSRefitNegative() );
+                fUseITSRefitPositive.push_back( lCascadeResult->GetCutUseITSRefitPositive() );
+                fUseITSRefitBachelor.push_back( lCascadeResult->GetCutUseITSRefitBachelor() );
+                fIsCowboy.push_back( lCascadeResult->GetCutIsCowboy() );
+                fIsCascadeCowboy.push_back( lCascadeResult->GetCutIsCascadeCowboy() );
+                fMinCrossedRowsOverLength.push_back( lCascadeResult->GetCutMinCrossedRowsOverLength() );
+                fLeastNumberOfCrossedRows.push_back( lCascadeResult->GetCutLeastNumberOfCrossedRows() );
+                fITSorTOF.push_back( lCascadeResult->GetCutITSorTOF() );
+            }
+        }
+    }
+    fFirst[4] = fHisto.size();
+    fPass.assign( fHisto.size(), 0 );
+}
+
 ClassImp(AliAnalysisTaskStrangenessVsMultiplicityRun2)
 
 AliAnalysisTaskStrangenessVsMultiplicityRun2::AliAnalysisTaskStrangenessVsMultiplicityRun2()
 : AliAnalysisTaskSE(), fListHist(0), fListK0Short(0), fListLambda(0), fListAntiLambda(0),
 fListXiMinus(0), fListXiPlus(0), fListOmegaMinus(0), fListOmegaPlus(0),
+fV0CutTable(0), fCascadeCutTable(0),
 fTreeEvent(0), fTreeV0(0), fTreeCascade(0),
 fPIDResponse(0), fESDtrackCuts(0),
 fESDtrackCutsITSsa2010(0), fESDtrackCutsGlobal2015(0),
@@ -486,6 +817,7 @@ fHistEventMatrix(0)
 AliAnalysisTaskStrangenessVsMultiplicityRun2::AliAnalysisTaskStrangenessVsMultiplicityRun2(Bool_t lSaveEventTree, Bool_t lSaveV0Tree, Bool_t lSaveCascadeTree, const char *name, TString lExtraOptions)
 : AliAnalysisTaskSE(name), fListHist(0), fListK0Short(0), fListLambda(0), fListAntiLambda(0),
 fListXiMinus(0), fListXiPlus(0), fListOmegaMinus(0), fListOmegaPlus(0),
+fV0CutTable(0), fCascadeCutTable(0),
 fTreeEvent(0), fTreeV0(0), fTreeCascade(0),
 fPIDResponse(0), fESDtrackCuts(0),
 fESDtrackCutsITSsa2010(0), fESDtrackCutsGlobal2015(0),
@@ -946,6 +1278,14 @@ AliAnalysisTaskStrangenessVsMultiplicityRun2::~AliAnalysisTaskStrangenessVsMulti
         delete fListOmegaPlus;
         fListOmegaPlus = 0x0;
     }
+    if (fV0CutTable) {
+        delete fV0CutTable;
+        fV0CutTable = 0x0;
+    }
+    if (fCascadeCutTable) {
+        delete fCascadeCutTable;
+        fCascadeCutTable = 0x0;
+    }
     if (fTreeEvent) {
         delete fTreeEvent;
         fTreeEvent = 0x0;
@@ -1493,6 +1833,12 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserCreateOutputObjects()
     
     AliWarning( Form("Initialized %i cascade output objects!", lTotalCfgs));
     
+    //Compile the configurations into cut tables for the event loop
+    if ( !fV0CutTable      ) fV0CutTable      = new V0CutTable();
+    if ( !fCascadeCutTable ) fCascadeCutTable = new CascadeCutTable();
+    fV0CutTable->Build( fListK0Short, fListLambda, fListAntiLambda );
+    fCascadeCutTable->Build( fListXiMinus, fListXiPlus, fListOmegaMinus, fListOmegaPlus, fkConfigToSave );
+    
     //Regular Output: Slots 1-8
     PostData(1, fListHist    );
     PostData(2, fListK0Short    );
@@ -2216,30 +2562,24 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         
         //AliWarning(Form("[V0 Analyses] Processing different configurations (%i detected)",lNumberOfConfigurations));
-        TH3F *histoout         = 0x0;
-        AliV0Result *lV0Result = 0x0;
-        
-        //pointers to valid results
-        AliV0Result *lPointers[50000];
-        Long_t lValidConfigurations=0;
-        
-        for( Int_t icfg=0; icfg<fListK0Short->GetEntries(); icfg++ ){
-            lPointers[lValidConfigurations] = (AliV0Result*) fListK0Short->At(icfg);
-            lValidConfigurations++;
-        }
-        for( Int_t icfg=0; icfg<fListLambda->GetEntries(); icfg++ ){
-            lPointers[lValidConfigurations] = (AliV0Result*) fListLambda->At(icfg);
-            lValidConfigurations++;
-        }
-        for( Int_t icfg=0; icfg<fListAntiLambda->GetEntries(); icfg++ ){
-            lPointers[lValidConfigurations] = (AliV0Result*) fListAntiLambda->At(icfg);
-            lValidConfigurations++;
-        }
-        
-        for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
-            lV0Result = lPointers[lcfg];
-            histoout  = lV0Result->GetHistogram();
-            
+        V0CutTable &lV0Table = *fV0CutTable;
+        
+        //Candidate properties shared by all configurations
+        lV0Table.fVarV0CosPA.Evaluate( fTreeVariablePt );
+        const Float_t lMinTrackEta = TMath::Min( fTreeVariableNegEta, fTreeVariablePosEta );
+        const Float_t lMaxTrackEta = TMath::Max( fTreeVariableNegEta, fTreeVariablePosEta );
+        const Bool_t lBothITSrefit =
+        (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) &&
+        (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit);
+        const Bool_t lHasTOFSignal =
+        TMath::Abs(fTreeVariableNegTOFSignal) < 100 ||
+        TMath::Abs(fTreeVariablePosTOFSignal) < 100;
+        const Float_t lAbsAlphaV0 = TMath::Abs(fTreeVariableAlphaV0);
+        //rough parametrization of the minimum track length, tune me!
+        const Double_t lLengthPtTerm     = TMath::Power(1/(fTreeVariablePt+1e-6),1.5);
+        const Double_t lLengthRadiusTerm = TMath::Max(fTreeVariableV0Radius-85., 0.);
+        
+        for(Int_t lHypo=AliV0Result::kK0Short; lHypo<=AliV0Result::kAntiLambda; lHypo++){
             Float_t lMass = 0;
             Float_t lRap  = 0;
             Float_t lPDGMass = -1;
@@ -2249,33 +2589,14 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
             Float_t lBaryonPt = -0.5;
             Float_t lBaryondEdxFromProton = 0;
             
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lV0Result -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeVariablePt) +
-                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeVariablePt) +
-                                             lVarV0CosPApar[4]);
-            if( lV0Result->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
-            
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short     ){
+            if ( lHypo == AliV0Result::kK0Short     ){
                 lMass    = fTreeVariableInvMassK0s;
                 lRap     = fTreeVariableRapK0Short;
                 lPDGMass = 0.497;
                 lNegdEdx = fTreeVariableNSigmasNegPion;
                 lPosdEdx = fTreeVariableNSigmasPosPion;
             }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kLambda      ){
+            if ( lHypo == AliV0Result::kLambda      ){
                 lMass = fTreeVariableInvMassLambda;
                 lRap = fTreeVariableRapLambda;
                 lPDGMass = 1.115683;
@@ -2285,7 +2606,7 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
                 lBaryonPt = lThisPosInnerPt;
                 lBaryondEdxFromProton = fTreeVariableNSigmasPosProton;
             }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kAntiLambda  ){
+            if ( lHypo == AliV0Result::kAntiLambda  ){
                 lMass = fTreeVariableInvMassAntiLambda;
                 lRap = fTreeVariableRapLambda;
                 lPDGMass = 1.115683;
@@ -2296,98 +2617,89 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
                 lBaryondEdxFromProton = fTreeVariableNSigmasNegProton;
             }
             
-            if (
+            //Hypothesis-dependent properties shared by all configurations of this block
+            const Bool_t lIsK0Short = ( lHypo == AliV0Result::kK0Short );
+            const Float_t lProperLifetime = fTreeVariableDistOverTotMom*lPDGMass;
+            const Float_t lMaxAbsdEdx = TMath::Max( TMath::Abs(lNegdEdx), TMath::Abs(lPosdEdx) );
+            // Logic: either K0Short, or high-pT baryon daughter, or passes cut!
+            const Bool_t lPass276TeVLikedEdx = lIsK0Short || ( lBaryonPt > 1.0 || TMath::Abs(lBaryondEdxFromProton)<3.0 );
+            
+            const Long_t lFirst = lV0Table.fFirst[lHypo];
+            const Long_t lLast  = lV0Table.fFirst[lHypo+1];
+            
+            //Evaluate all configurations of this hypothesis without branching on the cuts
+            for(Long_t lcfg=lFirst; lcfg<lLast; lcfg++){
+                //Variable V0 CosPA: only use if tighter than the non-variable cut
+                Float_t lV0CosPACut = lV0Table.fV0CosPA[lcfg];
+                const Int_t lVarIndex = lV0Table.fVarV0CosPAIndex[lcfg];
+                if( lVarIndex >= 0 && lV0Table.fVarV0CosPA.GetValue(lVarIndex) > lV0CosPACut )
+                    lV0CosPACut = lV0Table.fVarV0CosPA.GetValue(lVarIndex);
+                
+                lV0Table.fPass[lcfg] =
                 //Check 1: Offline Vertexer
-                lOnFlyStatus == lV0Result->GetUseOnTheFly() &&
+                ( lOnFlyStatus == lV0Table.fUseOnTheFly[lcfg] ) &
                 
                 //Check 2: Basic Acceptance cuts
-                lV0Result->GetCutMinEtaTracks() < fTreeVariableNegEta && fTreeVariableNegEta < lV0Result->GetCutMaxEtaTracks() &&
-                lV0Result->GetCutMinEtaTracks() < fTreeVariablePosEta && fTreeVariablePosEta < lV0Result->GetCutMaxEtaTracks() &&
-                lRap > lV0Result->GetCutMinRapidity() &&
-                lRap < lV0Result->GetCutMaxRapidity() &&
+                ( lV0Table.fMinEtaTracks[lcfg] < lMinTrackEta ) &
+                ( lMaxTrackEta < lV0Table.fMaxEtaTracks[lcfg] ) &
+                ( lRap > lV0Table.fMinRapidity[lcfg] ) &
+                ( lRap < lV0Table.fMaxRapidity[lcfg] ) &
                 
                 //Check 3: Topological Variables
-                fTreeVariableV0Radius > lV0Result->GetCutV0Radius() &&
-                fTreeVariableV0Radius < lV0Result->GetCutMaxV0Radius() &&
-                fTreeVariableDcaNegToPrimVertex > lV0Result->GetCutDCANegToPV() &&
-                fTreeVariableDcaPosToPrimVertex > lV0Result->GetCutDCAPosToPV() &&
-                fTreeVariableDcaV0Daughters < lV0Result->GetCutDCAV0Daughters() &&
-                fTreeVariableV0CosineOfPointingAngle > lV0CosPACut &&
-                fTreeVariableDistOverTotMom*lPDGMass < lV0Result->GetCutProperLifetime() &&
-                fTreeVariableLeastNbrCrossedRows > lV0Result->GetCutLeastNumberOfCrossedRows() &&
-                fTreeVariableLeastRatioCrossedRowsOverFindable > lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() &&
+                ( fTreeVariableV0Radius > lV0Table.fV0Radius[lcfg] ) &
+                ( fTreeVariableV0Radius < lV0Table.fMaxV0Radius[lcfg] ) &
+                ( fTreeVariableDcaNegToPrimVertex > lV0Table.fDCANegToPV[lcfg] ) &
+                ( fTreeVariableDcaPosToPrimVertex > lV0Table.fDCAPosToPV[lcfg] ) &
+                ( fTreeVariableDcaV0Daughters < lV0Table.fDCAV0Daughters[lcfg] ) &
+                ( fTreeVariableV0CosineOfPointingAngle > lV0CosPACut ) &
+                ( lProperLifetime < lV0Table.fProperLifetime[lcfg] ) &
+                ( fTreeVariableLeastNbrCrossedRows > lV0Table.fLeastNumberOfCrossedRows[lcfg] ) &
+                ( fTreeVariableLeastRatioCrossedRowsOverFindable > lV0Table.fLeastNumberOfCrossedRowsOverFindable[lcfg] ) &
                 
                 //Check 4: Minimum momentum of baryon daughter
-                ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short || lBaryonMomentum > lV0Result->GetCutMinBaryonMomentum() ) &&
+                ( lIsK0Short || lBaryonMomentum > lV0Table.fMinBaryonMomentum[lcfg] ) &
                 
                 //Check 5: TPC dEdx selections
-                TMath::Abs(lNegdEdx)<lV0Result->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx)<lV0Result->GetCutTPCdEdx() &&
+                ( lMaxAbsdEdx < lV0Table.fTPCdEdx[lcfg] ) &
                 
                 //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
-                ( ( lV0Result->GetCutArmenteros() == kFALSE || lV0Result->GetMassHypothesis() != AliV0Result::kK0Short ) || ( fTreeVariablePtArmV0>lV0Result->GetCutArmenterosParameter()*TMath::Abs(fTreeVariableAlphaV0) ) ) &&
+                ( !lV0Table.fArmenteros[lcfg] || !lIsK0Short || fTreeVariablePtArmV0 > lV0Table.fArmenterosParameter[lcfg]*lAbsAlphaV0 ) &
                 
                 //Check 7: kITSrefit track selection if requested
-                (
-                 ( (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit) )
-                 ||
-                 !lV0Result->GetCutUseITSRefitTracks()
-                 )&&
+                ( lBothITSrefit || !lV0Table.fUseITSRefitTracks[lcfg] ) &
                 
                 //Check 8: Max Chi2/Clusters if not absurd
-                ( lV0Result->GetCutMaxChi2PerCluster()>1e+3 ||
-                 (fTreeVariableMaxChi2PerCluster < lV0Result->GetCutMaxChi2PerCluster())
-                 ) &&
+                ( lV0Table.fMaxChi2PerCluster[lcfg]>1e+3 || fTreeVariableMaxChi2PerCluster < lV0Table.fMaxChi2PerCluster[lcfg] ) &
                 
                 //Check 9: Min Track Length if positive
-                ( lV0Result->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 (fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()&& !lV0Result->GetCutUseParametricLength()) ||
-                 (fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()
-                  - (TMath::Power(1/(fTreeVariablePt+1e-6),1.5)) //rough parametrization, tune me!
-                  - TMath::Max(fTreeVariableV0Radius-85., 0.) //rough parametrization, tune me!
-                  && lV0Result->GetCutUseParametricLength())
-                 )&&
+                ( lV0Table.fMinTrackLength[lcfg]<0 || //this is a bit paranoid...
+                 ( fTreeVariableMinTrackLength > lV0Table.fMinTrackLength[lcfg] && !lV0Table.fUseParametricLength[lcfg] ) ||
+                 ( fTreeVariableMinTrackLength > lV0Table.fMinTrackLength[lcfg] - lLengthPtTerm - lLengthRadiusTerm && lV0Table.fUseParametricLength[lcfg] )
+                 ) &
                 
                 //Check 10: Special 2.76TeV-like dedx
-                // Logic: either not requested, or K0Short, or high-pT baryon daughter, or passes cut!
-                ( !lV0Result->GetCut276TeVLikedEdx() ||
-                 ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short ||
-                  ( lBaryonPt > 1.0 || TMath::Abs(lBaryondEdxFromProton)<3.0 )
-                  )
-                 )&&
+                ( !lV0Table.f276TeVLikedEdx[lcfg] || lPass276TeVLikedEdx ) &
                 
                 //Check 14: has at least one track with some TOF info, please (reject pileup)
                 //          warning: this is still to be studied in more detail!
-                (
-                 lV0Result->GetCutAtLeastOneTOF() == kFALSE ||
-                 (
-                  TMath::Abs(fTreeVariableNegTOFSignal) < 100 ||
-                  TMath::Abs(fTreeVariablePosTOFSignal) < 100
-                  )
-                 )&&
+                ( !lV0Table.fAtLeastOneTOF[lcfg] || lHasTOFSignal ) &
                 
                 //Check 15: cowboy/sailor for V0
-                (
-                 lV0Result->GetCutIsCowboy()==0 ||
-                 (lV0Result->GetCutIsCowboy()== 1 && fTreeVariableIsCowboy==kTRUE ) ||
-                 (lV0Result->GetCutIsCowboy()==-1 && fTreeVariableIsCowboy==kFALSE)
-                 )&&//end cowboy/sailor
+                ( lV0Table.fIsCowboy[lcfg]==0 ||
+                 (lV0Table.fIsCowboy[lcfg]== 1 && fTreeVariableIsCowboy==kTRUE ) ||
+                 (lV0Table.fIsCowboy[lcfg]==-1 && fTreeVariableIsCowboy==kFALSE)
+                 ) &
                 
                 //Check 16: modern track quality selections
-                (
-                 lV0Result->GetCutMinCrossedRowsOverLength()<0 ||
-                 (lLeastNcrOverLength>lV0Result->GetCutMinCrossedRowsOverLength())
-                 )&&
-                //Check 17: ITS or TOF required 
-                (
-                 lV0Result->GetCutITSorTOF()==kFALSE || lITSorTOFsatisfied==kTRUE
-                 )
-                )//end major if
-            {
-                //This satisfies all my conditionals! Fill histogram
-                histoout -> Fill ( fCentrality, fTreeVariablePt, lMass );
+                ( lV0Table.fMinCrossedRowsOverLength[lcfg]<0 || lLeastNcrOverLength>lV0Table.fMinCrossedRowsOverLength[lcfg] ) &
+                
+                //Check 17: ITS or TOF required
+                ( !lV0Table.fITSorTOF[lcfg] || lITSorTOFsatisfied==kTRUE );
             }
+            
+            //This satisfies all my conditionals! Fill histogram
+            for(Long_t lcfg=lFirst; lcfg<lLast; lcfg++)
+                if( lV0Table.fPass[lcfg] ) lV0Table.fHisto[lcfg] -> Fill ( fCentrality, fTreeVariablePt, lMass );
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         // End Superlight adaptive output mode
@@ -3269,39 +3581,60 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         // Superlight adaptive output mode
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         
-        //Step 1: Sweep members of the output object TLists and fill all of them as appropriate
-        TH3F *histoout         = 0x0;
-        AliCascadeResult *lCascadeResult = 0x0;
-        
-        //pointers to valid results
-        AliCascadeResult *lPointers[50000];
-        Long_t lValidConfigurations=0;
-        
-        if( lValidXiMinus )
-            for( Int_t icfg=0; icfg<fListXiMinus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiMinus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidXiPlus )
-            for( Int_t icfg=0; icfg<fListXiPlus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiPlus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidOmegaMinus )
-            for( Int_t icfg=0; icfg<fListOmegaMinus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaMinus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidOmegaPlus )
-            for( Int_t icfg=0; icfg<fListOmegaPlus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaPlus->At(icfg);
-                lValidConfigurations++;
-            }
-        
-        for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
-            lCascadeResult = lPointers[lcfg];
-            Bool_t lTheOne = fkConfigToSave.EqualTo( lCascadeResult->GetName() );
-            histoout  = lCascadeResult->GetHistogram();
+        //Step 1: Sweep the compiled configuration table and fill all outputs as appropriate
+        CascadeCutTable &lCascTable = *fCascadeCutTable;
+        const Bool_t lValidHypo[4] = { lValidXiMinus, lValidXiPlus, lValidOmegaMinus, lValidOmegaPlus };
+        
+        //Candidate properties shared by all configurations
+        lCascTable.fVarCascCosPA.Evaluate( fTreeCascVarPt );
+        lCascTable.fVarV0CosPA.Evaluate( fTreeCascVarPt );
+        lCascTable.fVarBBCosPA.Evaluate( fTreeCascVarPt );
+        lCascTable.fVarDCACascDau.Evaluate( fTreeCascVarPt );
+        
+        //For parametric V0 Mass selection
+        Float_t lExpV0Mass =
+        fLambdaMassMean[0]+
+        fLambdaMassMean[1]*TMath::Exp(fLambdaMassMean[2]*lV0Pt)+
+        fLambdaMassMean[3]*TMath::Exp(fLambdaMassMean[4]*lV0Pt);
+        
+        Float_t lExpV0Sigma =
+        fLambdaMassSigma[0]+fLambdaMassSigma[1]*lV0Pt+
+        fLambdaMassSigma[2]*TMath::Exp(fLambdaMassSigma[3]*lV0Pt);
+        
+        //========================================================================
+        //For 2.76TeV-like parametric V0 CosPA
+        Float_t l276TeVV0CosPA = 0.998;
+        Float_t pThr=1.5;
+        if (lV0TotMomentum<pThr) {
+            //Below the threshold "pThr", try a momentum dependent cos(PA) cut
+            const Double_t bend=0.03; // approximate Xi bending angle
+            const Double_t qt=0.211;  // max Lambda pT in Omega decay
+            const Double_t cpaThr=TMath::Cos(TMath::ATan(qt/pThr) + bend);
+            Double_t
+            cpaCut=(0.998/cpaThr)*TMath::Cos(TMath::ATan(qt/lV0TotMomentum) + bend);
+            l276TeVV0CosPA = cpaCut;
+        }
+        //========================================================================
+        
+        const Float_t lMinTrackEta = TMath::Min( fTreeCascVarPosEta, TMath::Min( fTreeCascVarNegEta, fTreeCascVarBachEta ) );
+        const Float_t lMaxTrackEta = TMath::Max( fTreeCascVarPosEta, TMath::Max( fTreeCascVarNegEta, fTreeCascVarBachEta ) );
+        const Bool_t lNegITSrefit  = fTreeCascVarNegTrackStatus  & AliESDtrack::kITSrefit;
+        const Bool_t lPosITSrefit  = fTreeCascVarPosTrackStatus  & AliESDtrack::kITSrefit;
+        const Bool_t lBachITSrefit = fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit;
+        const Bool_t lAllITSrefit  = lNegITSrefit && lPosITSrefit && lBachITSrefit;
+        const Bool_t lHasTOFSignal =
+        TMath::Abs(fTreeCascVarNegTOFSignal) < 100 ||
+        TMath::Abs(fTreeCascVarPosTOFSignal) < 100 ||
+        TMath::Abs(fTreeCascVarBachTOFSignal) < 100;
+        const Bool_t lPass276TeVV0CosPA = fTreeCascVarV0CosPointingAngle>l276TeVV0CosPA;
+        const Double_t lCascDCAToPV = TMath::Sqrt(fTreeCascVarCascDCAtoPVz*fTreeCascVarCascDCAtoPVz + fTreeCascVarCascDCAtoPVxy*fTreeCascVarCascDCAtoPVxy);
+        const Double_t lXiMassDifference = TMath::Abs( fTreeCascVarMassAsXi - 1.32171 );
+        //rough parametrization of the minimum track length, tune me!
+        const Double_t lLengthPtTerm     = TMath::Power(1/(fTreeCascVarPt+1e-6),1.5);
+        const Double_t lLengthRadiusTerm = TMath::Max(fTreeCascVarV0Radius-85., 0.);
+        
+        for(Int_t lHypo=AliCascadeResult::kXiMinus; lHypo<=AliCascadeResult::kOmegaPlus; lHypo++){
+            if( !lValidHypo[lHypo] ) continue;
             
             Float_t lMass = 0;
             Float_t lV0Mass = 0;
@@ -3313,117 +3646,8 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
             Float_t lNegTOFsigma = 100;
             Float_t lPosTOFsigma = 100;
             Float_t lBachTOFsigma = 100;
-            Short_t  lCharge = -2;
-            Int_t lChargePos =  1;
-            Int_t lChargeNeg = -1;
-            Float_t lprpx, lprpy, lprpz, lpipx, lpipy, lpipz;
-            lpipx = fTreeCascVarBachPx;
-            lpipy = fTreeCascVarBachPy;
-            lpipz = fTreeCascVarBachPz;
-            
-            //For parametric V0 Mass selection
-            Float_t lExpV0Mass =
-            fLambdaMassMean[0]+
-            fLambdaMassMean[1]*TMath::Exp(fLambdaMassMean[2]*lV0Pt)+
-            fLambdaMassMean[3]*TMath::Exp(fLambdaMassMean[4]*lV0Pt);
-            
-            Float_t lExpV0Sigma =
-            fLambdaMassSigma[0]+fLambdaMassSigma[1]*lV0Pt+
-            fLambdaMassSigma[2]*TMath::Exp(fLambdaMassSigma[3]*lV0Pt);
             
-            //========================================================================
-            //For 2.76TeV-like parametric V0 CosPA
-            Float_t l276TeVV0CosPA = 0.998;
-            Float_t pThr=1.5;
-            if (lV0TotMomentum<pThr) {
-                //Below the threshold "pThr", try a momentum dependent cos(PA) cut
-                const Double_t bend=0.03; // approximate Xi bending angle
-                const Double_t qt=0.211;  // max Lambda pT in Omega decay
-                const Double_t cpaThr=TMath::Cos(TMath::ATan(qt/pThr) + bend);
-                Double_t
-                cpaCut=(0.998/cpaThr)*TMath::Cos(TMath::ATan(qt/lV0TotMomentum) + bend);
-                l276TeVV0CosPA = cpaCut;
-            }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable Cascade CosPA
-            Float_t lCascCosPACut = lCascadeResult -> GetCutCascCosPA();
-            Float_t lVarCascCosPApar[5];
-            lVarCascCosPApar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
-            lVarCascCosPApar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
-            lVarCascCosPApar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
-            lVarCascCosPApar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
-            lVarCascCosPApar[4] = lCascadeResult->GetCutVarCascCosPAConst();
-            Float_t lVarCascCosPA = TMath::Cos(
-                                               lVarCascCosPApar[0]*TMath::Exp(lVarCascCosPApar[1]*fTreeCascVarPt) +
-                                               lVarCascCosPApar[2]*TMath::Exp(lVarCascCosPApar[3]*fTreeCascVarPt) +
-                                               lVarCascCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarCascCosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarCascCosPA > lCascCosPACut ) lCascCosPACut = lVarCascCosPA;
-            }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lCascadeResult -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lCascadeResult->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeCascVarPt) +
-                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeCascVarPt) +
-                                             lVarV0CosPApar[4]);
-            if( lCascadeResult->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable BB CosPA
-            Float_t lBBCosPACut = lCascadeResult -> GetCutBachBaryonCosPA();
-            Float_t lVarBBCosPApar[5];
-            lVarBBCosPApar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
-            lVarBBCosPApar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
-            lVarBBCosPApar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
-            lVarBBCosPApar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
-            lVarBBCosPApar[4] = lCascadeResult->GetCutVarBBCosPAConst();
-            Float_t lVarBBCosPA = TMath::Cos(
-                                             lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarBBCosPA() ){
-                //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
-                if( lVarBBCosPA > lBBCosPACut ) lBBCosPACut = lVarBBCosPA;
-            }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable DCA Casc Dau
-            Float_t lDCACascDauCut = lCascadeResult -> GetCutDCACascDaughters();
-            Float_t lVarDCACascDaupar[5];
-            lVarDCACascDaupar[0] = lCascadeResult->GetCutVarDCACascDauExp0Const();
-            lVarDCACascDaupar[1] = lCascadeResult->GetCutVarDCACascDauExp0Slope();
-            lVarDCACascDaupar[2] = lCascadeResult->GetCutVarDCACascDauExp1Const();
-            lVarDCACascDaupar[3] = lCascadeResult->GetCutVarDCACascDauExp1Slope();
-            lVarDCACascDaupar[4] = lCascadeResult->GetCutVarDCACascDauConst();
-            Float_t lVarDCACascDau = lVarDCACascDaupar[0]*TMath::Exp(lVarDCACascDaupar[1]*fTreeCascVarPt) +
-            lVarDCACascDaupar[2]*TMath::Exp(lVarDCACascDaupar[3]*fTreeCascVarPt) +
-            lVarDCACascDaupar[4];
-            if( lCascadeResult->GetCutUseVarDCACascDau() ){
-                //Loosest: default cut, parametric can go tighter
-                if( lVarDCACascDau < lDCACascDauCut ) lDCACascDauCut = lVarDCACascDau;
-            }
-            //========================================================================
-            
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+            if ( lHypo == AliCascadeResult::kXiMinus     ){
                 lMass    = fTreeCascVarMassAsXi;
                 lV0Mass  = fTreeCascVarV0MassLambda;
                 lRap     = fTreeCascVarRapXi;
@@ -3434,13 +3658,8 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
                 lNegTOFsigma = fTreeCascVarNegTOFNSigmaPion;
                 lPosTOFsigma = fTreeCascVarPosTOFNSigmaProton;
                 lBachTOFsigma = fTreeCascVarBachTOFNSigmaPion;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
             }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+            if ( lHypo == AliCascadeResult::kXiPlus      ){
                 lMass    = fTreeCascVarMassAsXi;
                 lV0Mass  = fTreeCascVarV0MassAntiLambda;
                 lRap     = fTreeCascVarRapXi;
@@ -3451,13 +3670,8 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
                 lNegTOFsigma = fTreeCascVarNegTOFNSigmaProton;
                 lPosTOFsigma = fTreeCascVarPosTOFNSigmaPion;
                 lBachTOFsigma = fTreeCascVarBachTOFNSigmaPion;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
             }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+            if ( lHypo == AliCascadeResult::kOmegaMinus     ){
                 lMass    = fTreeCascVarMassAsOmega;
                 lV0Mass  = fTreeCascVarV0MassLambda;
                 lRap     = fTreeCascVarRapOmega;
@@ -3468,13 +3682,8 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
                 lNegTOFsigma = fTreeCascVarNegTOFNSigmaPion;
                 lPosTOFsigma = fTreeCascVarPosTOFNSigmaProton;
                 lBachTOFsigma = fTreeCascVarBachTOFNSigmaKaon;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
             }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+            if ( lHypo == AliCascadeResult::kOmegaPlus      ){
                 lMass    = fTreeCascVarMassAsOmega;
                 lV0Mass  = fTreeCascVarV0MassAntiLambda;
                 lRap     = fTreeCascVarRapOmega;
@@ -3485,165 +3694,148 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
                 lNegTOFsigma = fTreeCascVarNegTOFNSigmaProton;
                 lPosTOFsigma = fTreeCascVarPosTOFNSigmaPion;
                 lBachTOFsigma = fTreeCascVarBachTOFNSigmaKaon;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
             }
             
-            if (lCascadeResult->GetCutUseTOFUnchecked() == kFALSE ){
-                //Always-pass values
-                lNegTOFsigma = 0;
-                lPosTOFsigma = 0;
-                lBachTOFsigma = 0;
-            }
+            //Hypothesis-dependent properties shared by all configurations of this block
+            const Bool_t lIsOmega = ( lHypo == AliCascadeResult::kOmegaMinus || lHypo == AliCascadeResult::kOmegaPlus );
+            const Double_t lV0MassDifference = TMath::Abs(lV0Mass-1.116);
+            const Float_t lV0MassNSigma = TMath::Abs( (lV0Mass-lExpV0Mass) / lExpV0Sigma );
+            const Float_t lProperLifetime = fTreeCascVarDistOverTotMom*lPDGMass;
+            const Float_t lMaxAbsdEdx = TMath::Max( TMath::Abs(lBachdEdx), TMath::Max( TMath::Abs(lNegdEdx), TMath::Abs(lPosdEdx) ) );
+            //TOF selections (experimental), only applied if GetCutUseTOFUnchecked
+            const Bool_t lPassTOF = TMath::Abs(lNegTOFsigma)<4 && TMath::Abs(lPosTOFsigma)<4 && TMath::Abs(lBachTOFsigma)<4;
+            
+            const Long_t lFirst = lCascTable.fFirst[lHypo];
+            const Long_t lLast  = lCascTable.fFirst[lHypo+1];
             
-            if (
+            //Evaluate all configurations of this hypothesis without branching on the cuts
+            for(Long_t lcfg=lFirst; lcfg<lLast; lcfg++){
+                //Variable cuts: V0 and cascade CosPA only if tighter, BB CosPA only if looser
+                //(WARNING: BEWARE INVERSE LOGIC), DCA casc dau: default cut, parametric can go tighter
+                Int_t lVarIndex = 0;
+                Float_t lCascCosPACut = lCascTable.fCascCosPA[lcfg];
+                lVarIndex = lCascTable.fVarCascCosPAIndex[lcfg];
+                if( lVarIndex >= 0 && lCascTable.fVarCascCosPA.GetValue(lVarIndex) > lCascCosPACut )
+                    lCascCosPACut = lCascTable.fVarCascCosPA.GetValue(lVarIndex);
+                Float_t lV0CosPACut = lCascTable.fV0CosPA[lcfg];
+                lVarIndex = lCascTable.fVarV0CosPAIndex[lcfg];
+                if( lVarIndex >= 0 && lCascTable.fVarV0CosPA.GetValue(lVarIndex) > lV0CosPACut )
+                    lV0CosPACut = lCascTable.fVarV0CosPA.GetValue(lVarIndex);
+                Float_t lBBCosPACut = lCascTable.fBachBaryonCosPA[lcfg];
+                lVarIndex = lCascTable.fVarBBCosPAIndex[lcfg];
+                if( lVarIndex >= 0 && lCascTable.fVarBBCosPA.GetValue(lVarIndex) > lBBCosPACut )
+                    lBBCosPACut = lCascTable.fVarBBCosPA.GetValue(lVarIndex);
+                Float_t lDCACascDauCut = lCascTable.fDCACascDaughters[lcfg];
+                lVarIndex = lCascTable.fVarDCACascDauIndex[lcfg];
+                if( lVarIndex >= 0 && lCascTable.fVarDCACascDau.GetValue(lVarIndex) < lDCACascDauCut )
+                    lDCACascDauCut = lCascTable.fVarDCACascDau.GetValue(lVarIndex);
+                
+                lCascTable.fPass[lcfg] =
                 //Check 1: Charge consistent with expectations
-                fTreeCascVarCharge == lCharge &&
+                ( fTreeCascVarCharge == lCascTable.fCharge[lcfg] ) &
                 
                 //Check 2: Basic Acceptance cuts
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarPosEta && fTreeCascVarPosEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarNegEta && fTreeCascVarNegEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarBachEta && fTreeCascVarBachEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lRap > lCascadeResult->GetCutMinRapidity() &&
-                lRap < lCascadeResult->GetCutMaxRapidity() &&
+                ( lCascTable.fMinEtaTracks[lcfg] < lMinTrackEta ) &
+                ( lMaxTrackEta < lCascTable.fMaxEtaTracks[lcfg] ) &
+                ( lRap > lCascTable.fMinRapidity[lcfg] ) &
+                ( lRap < lCascTable.fMaxRapidity[lcfg] ) &
                 
                 //Check 3: Topological Variables
                 // - V0 Selections
-                fTreeCascVarDCANegToPrimVtx > lCascadeResult->GetCutDCANegToPV() &&
-                fTreeCascVarDCAPosToPrimVtx > lCascadeResult->GetCutDCAPosToPV() &&
-                fTreeCascVarDCAV0Daughters < lCascadeResult->GetCutDCAV0Daughters() &&
-                fTreeCascVarV0CosPointingAngle > lV0CosPACut &&
-                fTreeCascVarV0Radius > lCascadeResult->GetCutV0Radius() &&
+                ( fTreeCascVarDCANegToPrimVtx > lCascTable.fDCANegToPV[lcfg] ) &
+                ( fTreeCascVarDCAPosToPrimVtx > lCascTable.fDCAPosToPV[lcfg] ) &
+                ( fTreeCascVarDCAV0Daughters < lCascTable.fDCAV0Daughters[lcfg] ) &
+                ( fTreeCascVarV0CosPointingAngle > lV0CosPACut ) &
+                ( fTreeCascVarV0Radius > lCascTable.fV0Radius[lcfg] ) &
                 // - Cascade Selections
-                fTreeCascVarDCAV0ToPrimVtx > lCascadeResult->GetCutDCAV0ToPV() &&
-                TMath::Abs(lV0Mass-1.116) < lCascadeResult->GetCutV0Mass() &&
-                fTreeCascVarDCABachToPrimVtx > lCascadeResult->GetCutDCABachToPV() &&
-                fTreeCascVarDCACascDaughters < lDCACascDauCut &&
-                fTreeCascVarCascCosPointingAngle > lCascCosPACut &&
-                fTreeCascVarCascRadius > lCascadeResult->GetCutCascRadius() &&
+                ( fTreeCascVarDCAV0ToPrimVtx > lCascTable.fDCAV0ToPV[lcfg] ) &
+                ( lV0MassDifference < lCascTable.fV0Mass[lcfg] ) &
+                ( fTreeCascVarDCABachToPrimVtx > lCascTable.fDCABachToPV[lcfg] ) &
+                ( fTreeCascVarDCACascDaughters < lDCACascDauCut ) &
+                ( fTreeCascVarCascCosPointingAngle > lCascCosPACut ) &
+                ( fTreeCascVarCascRadius > lCascTable.fCascRadius[lcfg] ) &
                 
                 // - Implementation of a parametric V0 Mass cut if requested
-                (
-                 ( lCascadeResult->GetCutV0MassSigma() > 50 ) || //anything goes
-                 (TMath::Abs( (lV0Mass-lExpV0Mass) / lExpV0Sigma ) < lCascadeResult->GetCutV0MassSigma() )
-                 ) &&
+                ( lCascTable.fV0MassSigma[lcfg] > 50 || //anything goes
+                 lV0MassNSigma < lCascTable.fV0MassSigma[lcfg] ) &
                 
                 // - Miscellaneous
-                fTreeCascVarDistOverTotMom*lPDGMass < lCascadeResult->GetCutProperLifetime() &&
-                fTreeCascVarLeastNbrClusters > lCascadeResult->GetCutLeastNumberOfClusters() &&
+                ( lProperLifetime < lCascTable.fProperLifetime[lcfg] ) &
+                ( fTreeCascVarLeastNbrClusters > lCascTable.fLeastNumberOfClusters[lcfg] ) &
                 
                 //Check 4: TPC dEdx selections
-                TMath::Abs(lNegdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lBachdEdx)<lCascadeResult->GetCutTPCdEdx() &&
+                ( lMaxAbsdEdx < lCascTable.fTPCdEdx[lcfg] ) &
                 
                 //Check 4bis: TOF selections (experimental)
-                //WARNING: if lCascadeResult->GetCutUseTOFUnchecked is false, the TOFsigmas will be zero: will always pass
-                TMath::Abs(lNegTOFsigma )< 4 &&
-                TMath::Abs(lPosTOFsigma )< 4 &&
-                TMath::Abs(lBachTOFsigma)< 4 &&
+                ( !lCascTable.fUseTOFUnchecked[lcfg] || lPassTOF ) &
                 
                 //Check 5: Xi rejection for Omega analysis
-                ( ( lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaMinus && lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaPlus  ) || ( TMath::Abs( fTreeCascVarMassAsXi - 1.32171 ) > lCascadeResult->GetCutXiRejection() ) ) &&
+                ( !lIsOmega || lXiMassDifference > lCascTable.fXiRejection[lcfg] ) &
                 
                 //Check 6: Experimental DCA Bachelor to Baryon cut
-                ( fTreeCascVarDCABachToBaryon > lCascadeResult->GetCutDCABachToBaryon() ) &&
+                ( fTreeCascVarDCABachToBaryon > lCascTable.fDCABachToBaryon[lcfg] ) &
                 
                 //Check 7: Experimental Bach Baryon CosPA
-                ( fTreeCascVarWrongCosPA < lBBCosPACut  ) &&
+                ( fTreeCascVarWrongCosPA < lBBCosPACut ) &
                 
                 //Check 8: Min/Max V0 Lifetime cut
-                ( ( fTreeCascVarV0Lifetime > lCascadeResult->GetCutMinV0Lifetime() ) &&
-                 ( fTreeCascVarV0Lifetime < lCascadeResult->GetCutMaxV0Lifetime() ||
-                  lCascadeResult->GetCutMaxV0Lifetime() > 1e+3 ) ) &&
+                ( fTreeCascVarV0Lifetime > lCascTable.fMinV0Lifetime[lcfg] ) &
+                ( fTreeCascVarV0Lifetime < lCascTable.fMaxV0Lifetime[lcfg] || lCascTable.fMaxV0Lifetime[lcfg] > 1e+3 ) &
                 
                 //Check 9: kITSrefit track selection if requested
-                (
-                 ( (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit)
-                  )
-                 ||
-                 !lCascadeResult->GetCutUseITSRefitTracks()
-                 ) &&
+                ( lAllITSrefit || !lCascTable.fUseITSRefitTracks[lcfg] ) &
                 
                 //Check 10: Max Chi2/Clusters if not absurd
-                ( lCascadeResult->GetCutMaxChi2PerCluster()>1e+3 ||
-                 (fTreeCascVarMaxChi2PerCluster < lCascadeResult->GetCutMaxChi2PerCluster())
-                 )&&
+                ( lCascTable.fMaxChi2PerCluster[lcfg]>1e+3 || fTreeCascVarMaxChi2PerCluster < lCascTable.fMaxChi2PerCluster[lcfg] ) &
                 
                 //Check 11: Min Track Length if positive, [min - (1/pt)^1.5] if parametric requested
-                ( lCascadeResult->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 (fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength() && !lCascadeResult->GetCutUseParametricLength())||
-                 (fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength()
-                  - (TMath::Power(1/(fTreeCascVarPt+1e-6),1.5)) //rough parametrization, tune me!
-                  - TMath::Max(fTreeCascVarV0Radius-85., 0.) //rough parametrization, tune me!
-                  && lCascadeResult->GetCutUseParametricLength())
-                 )&&
+                ( lCascTable.fMinTrackLength[lcfg]<0 || //this is a bit paranoid...
+                 ( fTreeCascVarMinTrackLength > lCascTable.fMinTrackLength[lcfg] && !lCascTable.fUseParametricLength[lcfg] ) ||
+                 ( fTreeCascVarMinTrackLength > lCascTable.fMinTrackLength[lcfg] - lLengthPtTerm - lLengthRadiusTerm && lCascTable.fUseParametricLength[lcfg] )
+                 ) &
                 
                 //Check 12: Check if special V0 CosPA cut used
-                //either don't use the cut at all, or make sure it's above threshold
-                ( lCascadeResult->GetCutUse276TeVV0CosPA()==kFALSE ||
-                 fTreeCascVarV0CosPointingAngle>l276TeVV0CosPA
-                 )&&
+                ( !lCascTable.fUse276TeVV0CosPA[lcfg] || lPass276TeVV0CosPA ) &
                 
                 //Check 13: 3D Cascade DCA to PV
-                ( lCascadeResult->GetCutDCACascadeToPV() > 999 ||
-                 (TMath::Sqrt(fTreeCascVarCascDCAtoPVz*fTreeCascVarCascDCAtoPVz + fTreeCascVarCascDCAtoPVxy*fTreeCascVarCascDCAtoPVxy)<lCascadeResult->GetCutDCACascadeToPV() )
-                 )&&
+                ( lCascTable.fDCACascadeToPV[lcfg] > 999 || lCascDCAToPV < lCascTable.fDCACascadeToPV[lcfg] ) &
                 
                 //Check 14: has at least one track with some TOF info, please (reject pileup)
                 //          warning: this is still to be studied in more detail!
-                (
-                 lCascadeResult->GetCutAtLeastOneTOF() == kFALSE ||
-                 (
-                  TMath::Abs(fTreeCascVarNegTOFSignal) < 100 ||
-                  TMath::Abs(fTreeCascVarPosTOFSignal) < 100 ||
-                  TMath::Abs(fTreeCascVarBachTOFSignal) < 100
-                  )
-                 )&&
+                ( !lCascTable.fAtLeastOneTOF[lcfg] || lHasTOFSignal ) &
                 
                 //Check 15: check each prong for ITS refit
-                (
-                 ( lCascadeResult->GetCutUseITSRefitNegative()==kFALSE || fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit ) &&
-                 ( lCascadeResult->GetCutUseITSRefitPositive()==kFALSE || fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit ) &&
-                 ( lCascadeResult->GetCutUseITSRefitBachelor()==kFALSE || fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit )
-                 )&&
+                ( !lCascTable.fUseITSRefitNegative[lcfg] || lNegITSrefit ) &
+                ( !lCascTable.fUseITSRefitPositive[lcfg] || lPosITSrefit ) &
+                ( !lCascTable.fUseITSRefitBachelor[lcfg] || lBachITSrefit ) &
                 
                 //Check 16: cowboy/sailor for V0
-                (
-                    lCascadeResult->GetCutIsCowboy()==0 ||
-                 (lCascadeResult->GetCutIsCowboy()== 1 && fTreeCascVarIsCowboy==kTRUE ) ||
-                 (lCascadeResult->GetCutIsCowboy()==-1 && fTreeCascVarIsCowboy==kFALSE)
-                )&&//end cowboy/sailor
+                ( lCascTable.fIsCowboy[lcfg]==0 ||
+                 (lCascTable.fIsCowboy[lcfg]== 1 && fTreeCascVarIsCowboy==kTRUE ) ||
+                 (lCascTable.fIsCowboy[lcfg]==-1 && fTreeCascVarIsCowboy==kFALSE)
+                 ) &
                 
                 //Check 17: cowboy/sailor for cascade
-                (
-                 lCascadeResult->GetCutIsCascadeCowboy()==0 ||
-                 (lCascadeResult->GetCutIsCascadeCowboy()== 1 && fTreeCascVarIsCascadeCowboy==kTRUE ) ||
-                 (lCascadeResult->GetCutIsCascadeCowboy()==-1 && fTreeCascVarIsCascadeCowboy==kFALSE)
-                 )&&//end cowboy/sailor
+                ( lCascTable.fIsCascadeCowboy[lcfg]==0 ||
+                 (lCascTable.fIsCascadeCowboy[lcfg]== 1 && fTreeCascVarIsCascadeCowboy==kTRUE ) ||
+                 (lCascTable.fIsCascadeCowboy[lcfg]==-1 && fTreeCascVarIsCascadeCowboy==kFALSE)
+                 ) &
                 
                 //Check 18: modern track quality selections
-                (
-                 lCascadeResult->GetCutMinCrossedRowsOverLength()<0 ||
-                 (lLeastNcrOverLength>lCascadeResult->GetCutMinCrossedRowsOverLength())
-                 )&&
+                ( lCascTable.fMinCrossedRowsOverLength[lcfg]<0 || lLeastNcrOverLength>lCascTable.fMinCrossedRowsOverLength[lcfg] ) &
+                
                 //Check 19: modern track quality selections
-                (
-                 lCascadeResult->GetCutLeastNumberOfCrossedRows()<0 ||
-                 (lLeastNbrCrossedRows>lCascadeResult->GetCutLeastNumberOfCrossedRows())
-                 )&&
-                //Check 20: ITS or TOF required 
-                (
-                 lCascadeResult->GetCutITSorTOF()==kFALSE || lITSorTOFsatisfied==kTRUE
-                 )
-                )//end major if
-            {
-                //This satisfies all my conditionals! Fill histogram
-                if( lTheOne && fkSaveSpecificConfig ) fTreeCascade->Fill();
-                histoout -> Fill ( fCentrality, fTreeCascVarPt, lMass );
+                ( lCascTable.fLeastNumberOfCrossedRows[lcfg]<0 || lLeastNbrCrossedRows>lCascTable.fLeastNumberOfCrossedRows[lcfg] ) &
+                
+                //Check 20: ITS or TOF required
+                ( !lCascTable.fITSorTOF[lcfg] || lITSorTOFsatisfied==kTRUE );
+            }
+            
+            //This satisfies all my conditionals! Fill histogram
+            for(Long_t lcfg=lFirst; lcfg<lLast; lcfg++){
+                if( !lCascTable.fPass[lcfg] ) continue;
+                if( lCascTable.fSaveToTree[lcfg] && fkSaveSpecificConfig ) fTreeCascade->Fill();
+                lCascTable.fHisto[lcfg] -> Fill ( fCentrality, fTreeCascVarPt, lMass );
             }
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
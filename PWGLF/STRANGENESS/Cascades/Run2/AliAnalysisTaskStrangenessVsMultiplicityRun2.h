@@ -231,6 +231,10 @@ public:
 //---------------------------------------------------------------------------------------
     
 private:
+    //Superlight mode cut tables, defined in the implementation file
+    class V0CutTable;
+    class CascadeCutTable;
+    
     // Note : In ROOT, "//!" means "do not stream the data from Master node to Worker node" ...
     // your data member object is created on the worker nodes and streaming is not needed.
     // http://root.cern.ch/download/doc/11InputOutput.pdf, page 14
@@ -242,6 +246,8 @@ private:
     TList  *fListXiPlus;   // List of XiPlus outputs
     TList  *fListOmegaMinus;   // List of XiMinus outputs
     TList  *fListOmegaPlus;   // List of XiPlus outputs
+    V0CutTable      *fV0CutTable;      //! V0 configurations compiled into cut arrays
+    CascadeCutTable *fCascadeCutTable; //! Cascade configurations compiled into cut arrays
     TTree  *fTreeEvent;              //! Output Tree, Events
     TTree  *fTreeV0;              //! Output Tree, V0s
     TTree  *fTreeCascade;              //! Output Tree, Cascades
@@ -104,9 +104,80 @@ class AliAODv0;
 #include "AliTrackerBase.h"
 #include "AliV0HypSel.h"
 
+#include <vector>
+#include <algorithm>
+#include "RConfigure.h"
+#ifdef R__USE_IMT
+#include "TROOT.h"
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 using std::cout;
 using std::endl;
 
+//________________________________________________________________________
+// Bookkeeping of one chunk of the parallel V0/cascade finding: counters
+// replace the histogram fills and are merged in the sequential order
+struct AliWeakDecayVertexerCounts {
+    AliWeakDecayVertexerCounts() : fInvalidOTFV0s() {
+        for (Int_t i=0; i<9; i++) fV0Statistics[i] = 0;
+        for (Int_t i=0; i<3; i++) fOptimalTrackParamUse[i] = 0;
+        for (Int_t i=0; i<10; i++) fPropagationStatus[i] = 0;
+    }
+    Long64_t fV0Statistics[9];          // fHistV0Statistics bins
+    Long64_t fOptimalTrackParamUse[3];  // fHistV0OptimalTrackParamUse(Bachelor) bins
+    Long64_t fPropagationStatus[10];    // fHistV0ToBachelorPropagationStatus bins
+    std::vector<Int_t> fInvalidOTFV0s;  // invalid on-the-fly V0 indices, for warnings
+};
+
+namespace {
+    //Helix radius classes used to bin the positive daughters in the XY plane
+    const Int_t kNRadiusBuckets = 16;
+    
+    Int_t GetRadiusBucket(Double_t lRadius){
+        //factor 2 in radius per class, everything below 16 cm in the first
+        Int_t lBucket = 0;
+        for (Double_t lEdge = 16.; lBucket < kNRadiusBuckets-1 && lRadius > lEdge; lEdge *= 2.) lBucket++;
+        return lBucket;
+    }
+    
+    Bool_t AreHelixCirclesApart(const Double_t lNeg[3], const Double_t lPos[3], Double_t lMargin){
+        //XY-plane test of the GetDCAV0Dau fast skipper: circles (center x, y, radius)
+        //too far away from each other or one too deep inside the other
+        Double_t lDist = TMath::Sqrt(
+                                     TMath::Power( lNeg[0] - lPos[0] , 2) +
+                                     TMath::Power( lNeg[1] - lPos[1] , 2)
+                                     );
+        if( lDist > lNeg[2] + lPos[2] + lMargin ) return kTRUE;
+        if( lDist < TMath::Abs(lNeg[2] - lPos[2]) - lMargin ) return kTRUE;
+        return kFALSE;
+    }
+    
+    void FillCounts(TH1D *lHisto, const Long64_t *lCounts, Int_t lNBins){
+        //add bookkept counts to a counting histogram
+        Bool_t lAdded = kFALSE;
+        for (Int_t ibin=0; ibin<lNBins; ibin++) {
+            if( !lCounts[ibin] ) continue;
+            //equivalent to lCounts[ibin] unit-weight fills
+            lHisto->AddBinContent(ibin+1, lCounts[ibin]);
+            if( lHisto->GetSumw2N() ) lHisto->GetSumw2()->fArray[ibin+1] += lCounts[ibin];
+            lAdded = kTRUE;
+        }
+        if( lAdded ) lHisto->ResetStats();
+    }
+    
+    template <typename F> void RunVertexingChunks(ROOT::TThreadExecutor *lExecutor, Int_t lNChunks, F &lWork){
+        //process chunks [0, lNChunks), with the thread pool of the task if given
+#ifdef R__USE_IMT
+        if( lExecutor && lNChunks > 1 ){
+            lExecutor->Foreach([&lWork](Int_t lChunk){ lWork(lChunk); }, ROOT::TSeqI(lNChunks));
+            return;
+        }
+#endif
+        for (Int_t lChunk=0; lChunk<lNChunks; lChunk++) lWork(lChunk);
+    }
+}
+
 ClassImp(AliAnalysisTaskWeakDecayVertexer)
 
 AliAnalysisTaskWeakDecayVertexer::AliAnalysisTaskWeakDecayVertexer()
@@ -154,6 +225,8 @@ fkDoCascadeRefit( kFALSE ) ,
 fMaxIterationsWhenMinimizing(27),
 fkPreselectX(kTRUE),
 fkSkipLargeXYDCA(kTRUE),
+fNThreads(1),
+fExecutor(0x0),
 fkMonteCarlo(kFALSE),
 fkUseOptimalTrackParams(kFALSE),
 fkUseOptimalTrackParamsBachelor(kFALSE),
@@ -223,6 +296,8 @@ fkDoCascadeRefit( kFALSE ) ,
 fMaxIterationsWhenMinimizing(27),
 fkPreselectX(kTRUE),
 fkSkipLargeXYDCA(kTRUE),
+fNThreads(1),
+fExecutor(0x0),
 fkMonteCarlo(kFALSE), 
 fkUseOptimalTrackParams(kFALSE),
 fkUseOptimalTrackParamsBachelor(kFALSE),
@@ -279,6 +354,12 @@ AliAnalysisTaskWeakDecayVertexer::~AliAnalysisTaskWeakDecayVertexer()
         delete fListHist;
         fListHist = 0x0;
     }
+#ifdef R__USE_IMT
+    if (fExecutor) {
+        delete fExecutor;
+        fExecutor = 0x0;
+    }
+#endif
 }
 
 //________________________________________________________________________
@@ -293,6 +374,20 @@ void AliAnalysisTaskWeakDecayVertexer::UserCreateOutputObjects()
     fPIDResponse = inputHandler->GetPIDResponse();
     inputHandler->SetNeedField();
     
+    if( fNThreads > 1 ){
+#ifdef R__USE_IMT
+        //thread safety is steered by the train: ROOT::EnableImplicitMT() has to be called there
+        if( ROOT::IsImplicitMTEnabled() ){
+            //one thread pool for the whole task, reused by every event
+            if( !fExecutor ) fExecutor = new ROOT::TThreadExecutor(fNThreads);
+        } else {
+            AliWarning("Implicit multi-threading not enabled in the steering (ROOT::EnableImplicitMT()), V0s and cascades are found serially");
+        }
+#else
+        AliWarning("ROOT was built without implicit multi-threading, V0s and cascades are found serially");
+#endif
+    }
+    
     //------------------------------------------------
     // V0 Multiplicity Histograms
     //------------------------------------------------
@@ -697,159 +792,272 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
         if (esdTrack->GetSign() > 0. && TMath::Abs(d)>fV0VertexerSels[2]) pos[npos++]=i;
     }
     
-      int nHypSel = fV0HypSelArray ? fV0HypSelArray->GetEntriesFast() : 0;
-    
+    int nHypSel = fV0HypSelArray ? fV0HypSelArray->GetEntriesFast() : 0;
+    
+    //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+    //Per-track preparation: starting parameters and helix circles are computed
+    //once per track instead of once per pair
+    //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+    std::vector<AliExternalTrackParam> lNegParams(nneg), lPosParams(npos);
+    std::vector<Double_t> lNegCircles(3*nneg), lPosCircles(3*npos); //helix center (x,y), radius
+    //missing tracks are skipped, as they are in the pair loop, and not counted as considered pairs
+    std::vector<UChar_t> lPosValid(npos, 0);
+    Long_t lNPosValid = 0;
     for (i=0; i<nneg; i++) {
-        Long_t nidx=neg[i];
-        AliESDtrack *ntrk=event->GetTrack(nidx);
-        if(!ntrk) continue;
-        
+        AliESDtrack *ntrk=event->GetTrack(neg[i]);
+        if(ntrk) PrepareV0Daughter(ntrk, vtxT3D, b, lNegParams[i], &lNegCircles[3*i]);
+    }
+    for (i=0; i<npos; i++) {
+        AliESDtrack *ptrk=event->GetTrack(pos[i]);
+        if(!ptrk) continue;
+        PrepareV0Daughter(ptrk, vtxT3D, b, lPosParams[i], &lPosCircles[3*i]);
+        lPosValid[i] = 1;
+        lNPosValid++;
+    }
+    
+    //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+    //XY-plane pre-selection: pairs whose helix circles are far from touching are
+    //rejected by the fast skipper of GetDCAV0Dau anyway, so they are dropped before
+    //any copy or propagation. Positive tracks are bucketed by helix radius and
+    //sorted by helix center X, so only a window of them is tested per negative.
+    //Pairs with on-the-fly parameters have different circles and are always kept.
+    //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+    const Bool_t lPreselectXY = fkDoImprovedDCAV0DauPropagation && fkSkipLargeXYDCA && fV0VertexerSels[3] < 2000;
+    const Double_t lXYMargin = 2*fV0VertexerSels[3];
+    std::vector< std::vector< std::pair<Double_t,Int_t> > > lPosBuckets(kNRadiusBuckets);
+    std::vector<Double_t> lPosBucketMaxRadius(kNRadiusBuckets, 0.);
+    std::vector<Int_t> lPosUnbucketed; //non-finite circles: tested one by one
+    if( lPreselectXY ){
         for (Int_t k=0; k<npos; k++) {
-            Int_t pidx=pos[k];
-            AliESDtrack *ptrk=event->GetTrack(pidx);
-            if(!ptrk) continue;
-            
-            fHistV0Statistics->Fill(0.5); //number of considered pairs
-            
-            Double_t lNegMassForTracking = ntrk->GetMassForTracking();
-            Double_t lPosMassForTracking = ptrk->GetMassForTracking();
-            
-            fHistV0Statistics->Fill(1.5); //pass distance to PV
+            if( !lPosValid[k] ) continue;
+            const Double_t *lCircle = &lPosCircles[3*k];
+            if( !TMath::Finite(lCircle[0]) || !TMath::Finite(lCircle[1]) || !TMath::Finite(lCircle[2]) ){
+                lPosUnbucketed.push_back(k);
+                continue;
+            }
+            Int_t lBucket = GetRadiusBucket(lCircle[2]);
+            lPosBuckets[lBucket].push_back( std::make_pair(lCircle[0], k) );
+            if( lCircle[2] > lPosBucketMaxRadius[lBucket] ) lPosBucketMaxRadius[lBucket] = lCircle[2];
+        }
+        for (Int_t ib=0; ib<kNRadiusBuckets; ib++) std::sort( lPosBuckets[ib].begin(), lPosBuckets[ib].end() );
+    }
+    //track index -> position in pos array, to locate on-the-fly partners
+    std::vector<Int_t> lPosSlot;
+    if( fkUseOptimalTrackParams ){
+        lPosSlot.assign(nentr, -1);
+        for (Int_t k=0; k<npos; k++) lPosSlot[pos[k]] = k;
+    }
+    
+    //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+    //Pair finding: negative tracks are split in contiguous chunks, processed in
+    //parallel if requested; candidates are stored per chunk and added to the
+    //event in the sequential order afterwards
+    //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+    const Int_t lNThreads = GetNumberOfVertexingThreads();
+    const Int_t lNChunks = (lNThreads>1 && nneg>1) ? TMath::Min( (Int_t)nneg, 8*lNThreads ) : 1;
+    std::vector< std::vector<AliESDv0> > lChunkV0s(lNChunks);
+    std::vector<AliWeakDecayVertexerCounts> lChunkCounts(lNChunks);
+    
+    auto lFindV0s = [&](Int_t lChunk) {
+        std::vector<AliESDv0> &lV0s = lChunkV0s[lChunk];
+        AliWeakDecayVertexerCounts &lCounts = lChunkCounts[lChunk];
+        std::vector<Int_t> lCandidates;
+        lCandidates.reserve(npos);
+        
+        for (Long_t in=lChunk*nneg/lNChunks; in<(lChunk+1)*nneg/lNChunks; in++) {
+            Long_t nidx=neg[in];
+            AliESDtrack *ntrk=event->GetTrack(nidx);
+            if(!ntrk) continue;
+            
+            //Positive partners to be examined, in the original order
+            lCandidates.clear();
+            const Double_t *lNegCircle = &lNegCircles[3*in];
+            if( !lPreselectXY ){
+                for (Int_t k=0; k<npos; k++) if( lPosValid[k] ) lCandidates.push_back(k);
+            }else if( !TMath::Finite(lNegCircle[0]) || !TMath::Finite(lNegCircle[1]) || !TMath::Finite(lNegCircle[2]) ){
+                for (Int_t k=0; k<npos; k++)
+                    if( lPosValid[k] && !AreHelixCirclesApart(lNegCircle, &lPosCircles[3*k], lXYMargin) ) lCandidates.push_back(k);
+            }else{
+                for (Int_t ib=0; ib<kNRadiusBuckets; ib++) {
+                    const std::vector< std::pair<Double_t,Int_t> > &lBucket = lPosBuckets[ib];
+                    if( lBucket.empty() ) continue;
+                    //centers farther apart in X than this cannot have touching circles (small slack for rounding)
+                    const Double_t lReach = (lNegCircle[2] + lPosBucketMaxRadius[ib] + lXYMargin)*(1.+1e-9) + 1e-9;
+                    std::vector< std::pair<Double_t,Int_t> >::const_iterator lIt =
+                    std::lower_bound( lBucket.begin(), lBucket.end(), std::make_pair(lNegCircle[0]-lReach, -1) );
+                    for ( ; lIt!=lBucket.end() && lIt->first <= lNegCircle[0]+lReach; ++lIt )
+                        if( !AreHelixCirclesApart(lNegCircle, &lPosCircles[3*lIt->second], lXYMargin) ) lCandidates.push_back(lIt->second);
+                }
+                for (size_t iu=0; iu<lPosUnbucketed.size(); iu++)
+                    if( !AreHelixCirclesApart(lNegCircle, &lPosCircles[3*lPosUnbucketed[iu]], lXYMargin) ) lCandidates.push_back(lPosUnbucketed[iu]);
+            }
+            if( lPreselectXY ){
+                //on-the-fly partners are always examined
+                if( fkUseOptimalTrackParams ){
+                    map<pair<int,int>, int>::const_iterator lOTF = fOTFMap.lower_bound(make_pair((int)nidx, -1));
+                    for ( ; lOTF!=fOTFMap.end() && lOTF->first.first==nidx; ++lOTF )
+                        if( lOTF->first.second>=0 && lOTF->first.second<nentr && lPosSlot[lOTF->first.second]>=0 && lPosValid[lPosSlot[lOTF->first.second]] )
+                            lCandidates.push_back( lPosSlot[lOTF->first.second] );
+                }
+                std::sort( lCandidates.begin(), lCandidates.end() );
+                lCandidates.erase( std::unique( lCandidates.begin(), lCandidates.end() ), lCandidates.end() );
+            }
             
-            AliExternalTrackParam nt(*ntrk), pt(*ptrk);
-            Bool_t lUsedOptimalParams = kFALSE;
+            //Pairs dropped by the pre-selection: counted as considered, offline prongs
+            lCounts.fV0Statistics[0] += lNPosValid; //number of considered pairs
+            lCounts.fV0Statistics[1] += lNPosValid; //pass distance to PV
+            if( fkUseOptimalTrackParams ) lCounts.fOptimalTrackParamUse[0] += lNPosValid - (Long_t)lCandidates.size();
             
-            if( fkUseOptimalTrackParams ){
-                //reroute to pointers obtained with on-the-fly finding, please
-                map<pair<int,int>, int>::iterator iter = fOTFMap.find(make_pair(nidx,pidx));
-                if(iter != fOTFMap.end())
-                {
-                    Int_t lEquivalentOTFV0 = (*iter).second; // or iter->second;
-                    AliESDv0 *v0_otf = ((AliESDEvent*)event)->GetV0(lEquivalentOTFV0);
-                    if(!v0_otf){
-                        AliWarning(Form("Invalid V0 at position %i!", lEquivalentOTFV0));
-                        fHistV0OptimalTrackParamUse->Fill(2.5);
-                    }else{
-                        AliExternalTrackParam ptimproved(*(v0_otf->GetParamP()));
-                        AliExternalTrackParam ntimproved(*(v0_otf->GetParamN()));
-                        if( v0_otf->GetParamP()->Charge() > 0 && v0_otf->GetParamN()->Charge() < 0 ) {
-                            //V0 daughter track swapping is required! Note: everything is swapped here... P->N, N->P
-                            pt = ptimproved;
-                            nt = ntimproved;
+            for (size_t ic=0; ic<lCandidates.size(); ic++) {
+                Int_t k=lCandidates[ic];
+                Int_t pidx=pos[k];
+                AliESDtrack *ptrk=event->GetTrack(pidx);
+                if(!ptrk) continue;
+                
+                Double_t lNegMassForTracking = ntrk->GetMassForTracking();
+                Double_t lPosMassForTracking = ptrk->GetMassForTracking();
+                
+                AliExternalTrackParam nt(lNegParams[in]), pt(lPosParams[k]);
+                Bool_t lUsedOptimalParams = kFALSE;
+                
+                if( fkUseOptimalTrackParams ){
+                    //reroute to pointers obtained with on-the-fly finding, please
+                    map<pair<int,int>, int>::const_iterator iter = fOTFMap.find(make_pair(nidx,pidx));
+                    if(iter != fOTFMap.end())
+                    {
+                        Int_t lEquivalentOTFV0 = (*iter).second; // or iter->second;
+                        AliESDv0 *v0_otf = ((AliESDEvent*)event)->GetV0(lEquivalentOTFV0);
+                        if(!v0_otf){
+                            lCounts.fInvalidOTFV0s.push_back(lEquivalentOTFV0);
+                            lCounts.fOptimalTrackParamUse[2]++;
                         }else{
-                            //swap charges if charges are swapped
-                            pt = ntimproved;
-                            nt = ptimproved;
+                            AliExternalTrackParam ptimproved(*(v0_otf->GetParamP()));
+                            AliExternalTrackParam ntimproved(*(v0_otf->GetParamN()));
+                            if( v0_otf->GetParamP()->Charge() > 0 && v0_otf->GetParamN()->Charge() < 0 ) {
+                                //V0 daughter track swapping is required! Note: everything is swapped here... P->N, N->P
+                                pt = ptimproved;
+                                nt = ntimproved;
+                            }else{
+                                //swap charges if charges are swapped
+                                pt = ntimproved;
+                                nt = ptimproved;
+                            }
+                            lCounts.fOptimalTrackParamUse[1]++;
+                            lUsedOptimalParams=kTRUE;
                         }
-                        fHistV0OptimalTrackParamUse->Fill(1.5);
-                        lUsedOptimalParams=kTRUE;
+                    }else{
+                        //OTF not available for this pair
+                        lCounts.fOptimalTrackParamUse[0]++;
                     }
-                }else{
-                    //OTF not available for this pair
-                    fHistV0OptimalTrackParamUse->Fill(0.5);
                 }
-            }
-            AliExternalTrackParam *ntp=&nt, *ptp=&pt;
-            Double_t xn, xp, dca;
-            
-            //Improved call: use own function, including XY-pre-opt stage
-            
-            //Re-propagate to closest position to the primary vertex if asked to do so
-            if (fkResetInitialPositions){
-                Double_t dztemp[2], covartemp[3];
-                //Safety margin: 250 -> exceedingly large... not sure this makes sense, but ok
-                ntp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
-                ptp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
-            }
-            
-            if( fkDoImprovedDCAV0DauPropagation ){
-                //Improved: use own call
-                dca=GetDCAV0Dau(ptp, ntp, xp, xn, b, lNegMassForTracking, lPosMassForTracking);
-            }else{
-                //Old: use old call
-                dca=nt.GetDCA(&pt,b,xn,xp);
-            }
-            
-            if (dca > fV0VertexerSels[3]) continue;
-            
-            fHistV0Statistics->Fill(2.5); //pass dca
-            
-            if ((xn+xp) > 2*fV0VertexerSels[6] && fkPreselectX) continue;
-            if ((xn+xp) < 2*fV0VertexerSels[5] && fkPreselectX) continue;
-            
-            fHistV0Statistics->Fill(3.5); //pass X within R2D cut
-            
-            if(!fkDoMaterialCorrection){
-                nt.PropagateTo(xn,b);
-                pt.PropagateTo(xp,b);
-            }else{
                 AliExternalTrackParam *ntp=&nt, *ptp=&pt;
-                AliTrackerBase::PropagateTrackTo(ntp, xn, lNegMassForTracking, 3, kFALSE, 0.75, kFALSE, kTRUE );
-                AliTrackerBase::PropagateTrackTo(ptp, xp, lPosMassForTracking, 3, kFALSE, 0.75, kFALSE, kTRUE );
-            }
-            
-            //select maximum eta range (after propagation)
-            if (TMath::Abs(nt.Eta())>0.8&&fkExtraCleanup) continue;
-            if (TMath::Abs(pt.Eta())>0.8&&fkExtraCleanup) continue;
-            
-            fHistV0Statistics->Fill(4.5); //pass eta cut
-            
-            AliESDv0 vertex(nt,nidx,pt,pidx);
-            
-            //Experimental: refit V0 if asked to do so
-            if( fkDoV0Refit ) vertex.Refit();
-            
-            //No selection: it was not previously applied, don't  apply now.
-            //if (vertex.GetChi2V0() > fChi2max) continue;
-            
-            Double_t x=vertex.Xv(), y=vertex.Yv();
-            Double_t r2=x*x + y*y;
-            if (r2 < fV0VertexerSels[5]*fV0VertexerSels[5]) continue;
-            if (r2 > fV0VertexerSels[6]*fV0VertexerSels[6]) continue;
-            
-            fHistV0Statistics->Fill(5.5); //pass radius cut
-            
-            Float_t cpa=vertex.GetV0CosineOfPointingAngle(xPrimaryVertex,yPrimaryVertex,zPrimaryVertex);
-            
-            //Simple cosine cut (no pt dependence for now)
-            if (cpa < fV0VertexerSels[4]) continue;
-            
-            fHistV0Statistics->Fill(6.5); //pass cosPA
-            
-            vertex.SetDcaV0Daughters(dca);
-            vertex.SetV0CosineOfPointingAngle(cpa);
-            vertex.ChangeMassHypothesis(kK0Short);
-            
-            //pre-select on pT
-            Double_t lMomX       = 0. , lMomY = 0., lMomZ = 0.;
-            Double_t lTransvMom  = 0. ;
-            vertex.GetPxPyPz( lMomX, lMomY, lMomZ );
-            lTransvMom      = TMath::Sqrt( lMomX*lMomX   + lMomY*lMomY );
-            if(lTransvMom<fMinPtV0) continue;
-            if(lTransvMom>fMaxPtV0) continue;
-            
-            fHistV0Statistics->Fill(7.5); //within pT range
-            if (lUsedOptimalParams) fHistV0Statistics->Fill(8.5); //good V0, used OTF params
-
-            if (nHypSel) { // do we select particular hypthesis? - i.e. does object exist
-                Bool_t reject = kTRUE;
-                float pt = vertex.Pt();
-                for (int ih=0;ih<nHypSel;ih++) {
-                    const AliV0HypSel* hyp = (const AliV0HypSel*)(*fV0HypSelArray)[ih];
-                    double m = vertex.GetEffMassExplicit(hyp->GetM0(),hyp->GetM1());
-                    if (TMath::Abs(m - hyp->GetMass())<hyp->GetMassMargin(pt)) {
-                        reject = kFALSE;
-                        break;
+                Double_t xn, xp, dca;
+                
+                //Re-propagate to closest position to the primary vertex if asked to do so
+                //(offline prongs were already re-propagated in the per-track preparation)
+                if (fkResetInitialPositions && lUsedOptimalParams){
+                    Double_t dztemp[2], covartemp[3];
+                    //Safety margin: 250 -> exceedingly large... not sure this makes sense, but ok
+                    ntp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
+                    ptp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
+                }
+                
+                if( fkDoImprovedDCAV0DauPropagation ){
+                    //Improved: use own call
+                    dca=GetDCAV0Dau(ptp, ntp, xp, xn, b, lNegMassForTracking, lPosMassForTracking);
+                }else{
+                    //Old: use old call
+                    dca=nt.GetDCA(&pt,b,xn,xp);
+                }
+                
+                if (dca > fV0VertexerSels[3]) continue;
+                
+                lCounts.fV0Statistics[2]++; //pass dca
+                
+                if ((xn+xp) > 2*fV0VertexerSels[6] && fkPreselectX) continue;
+                if ((xn+xp) < 2*fV0VertexerSels[5] && fkPreselectX) continue;
+                
+                lCounts.fV0Statistics[3]++; //pass X within R2D cut
+                
+                if(!fkDoMaterialCorrection){
+                    nt.PropagateTo(xn,b);
+                    pt.PropagateTo(xp,b);
+                }else{
+                    AliExternalTrackParam *ntp=&nt, *ptp=&pt;
+                    AliTrackerBase::PropagateTrackTo(ntp, xn, lNegMassForTracking, 3, kFALSE, 0.75, kFALSE, kTRUE );
+                    AliTrackerBase::PropagateTrackTo(ptp, xp, lPosMassForTracking, 3, kFALSE, 0.75, kFALSE, kTRUE );
+                }
+                
+                //select maximum eta range (after propagation)
+                if (TMath::Abs(nt.Eta())>0.8&&fkExtraCleanup) continue;
+                if (TMath::Abs(pt.Eta())>0.8&&fkExtraCleanup) continue;
+                
+                lCounts.fV0Statistics[4]++; //pass eta cut
+                
+                AliESDv0 vertex(nt,nidx,pt,pidx);
+                
+                //Experimental: refit V0 if asked to do so
+                if( fkDoV0Refit ) vertex.Refit();
+                
+                Double_t x=vertex.Xv(), y=vertex.Yv();
+                Double_t r2=x*x + y*y;
+                if (r2 < fV0VertexerSels[5]*fV0VertexerSels[5]) continue;
+                if (r2 > fV0VertexerSels[6]*fV0VertexerSels[6]) continue;
+                
+                lCounts.fV0Statistics[5]++; //pass radius cut
+                
+                Float_t cpa=vertex.GetV0CosineOfPointingAngle(xPrimaryVertex,yPrimaryVertex,zPrimaryVertex);
+                
+                //Simple cosine cut (no pt dependence for now)
+                if (cpa < fV0VertexerSels[4]) continue;
+                
+                lCounts.fV0Statistics[6]++; //pass cosPA
+                
+                vertex.SetDcaV0Daughters(dca);
+                vertex.SetV0CosineOfPointingAngle(cpa);
+                vertex.ChangeMassHypothesis(kK0Short);
+                
+                //pre-select on pT
+                Double_t lMomX       = 0. , lMomY = 0., lMomZ = 0.;
+                Double_t lTransvMom  = 0. ;
+                vertex.GetPxPyPz( lMomX, lMomY, lMomZ );
+                lTransvMom      = TMath::Sqrt( lMomX*lMomX   + lMomY*lMomY );
+                if(lTransvMom<fMinPtV0) continue;
+                if(lTransvMom>fMaxPtV0) continue;
+                
+                lCounts.fV0Statistics[7]++; //within pT range
+                if (lUsedOptimalParams) lCounts.fV0Statistics[8]++; //good V0, used OTF params
+                
+                if (nHypSel) { // do we select particular hypthesis? - i.e. does object exist
+                    Bool_t reject = kTRUE;
+                    float pt = vertex.Pt();
+                    for (int ih=0;ih<nHypSel;ih++) {
+                        const AliV0HypSel* hyp = (const AliV0HypSel*)(*fV0HypSelArray)[ih];
+                        double m = vertex.GetEffMassExplicit(hyp->GetM0(),hyp->GetM1());
+                        if (TMath::Abs(m - hyp->GetMass())<hyp->GetMassMargin(pt)) {
+                            reject = kFALSE;
+                            break;
+                        }
                     }
+                    if (reject) continue;
                 }
-                if (reject) continue;
+                
+                lV0s.push_back(vertex);
             }
-            
-            event->AddV0(&vertex);
-            
+        }
+    };
+    RunVertexingChunks( lNThreads>1 ? fExecutor : 0x0, lNChunks, lFindV0s );
+    
+    //Merge: candidates and counters in the sequential order
+    for (Int_t lChunk=0; lChunk<lNChunks; lChunk++) {
+        AliWeakDecayVertexerCounts &lCounts = lChunkCounts[lChunk];
+        for (size_t iw=0; iw<lCounts.fInvalidOTFV0s.size(); iw++)
+            AliWarning(Form("Invalid V0 at position %i!", lCounts.fInvalidOTFV0s[iw]));
+        FillCounts( fHistV0Statistics, lCounts.fV0Statistics, 9 );
+        FillCounts( fHistV0OptimalTrackParamUse, lCounts.fOptimalTrackParamUse, 3 );
+        for (size_t iv=0; iv<lChunkV0s[lChunk].size(); iv++) {
+            event->AddV0(&lChunkV0s[lChunk][iv]);
             nvtx++;
-            
-            //if ( nvtx % 10000 ) gObjectTable->Print(); //debug, REMOVE ME PLEASE
         }
     }
     AliWarning(Form("Tracks2V0vertices","Number of reconstructed V0 vertices: %ld",nvtx));
@@ -1284,196 +1492,140 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
     Double_t massLambda=1.11568;
     Long_t ncasc=0;
     
-    // Looking for the cascades...
-    for (i=0; i<nV0; i++) { //loop on V0s
-        AliESDv0 *v=(AliESDv0*)vtcs.UncheckedAt(i);
-        AliESDv0 v0(*v);
-        v0.ChangeMassHypothesis(kLambda0); // the v0 must be Lambda
-        if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
-        for (Int_t j=0; j<ntr; j++) {//loop on tracks
-            Int_t bidx=trk[j];
-            //Bo:   if (bidx==v->GetNindex()) continue; //bachelor and v0's negative tracks must be different
-            if (bidx==v0.GetIndex(0)) continue; //Bo:  consistency 0 for neg
-            
-            AliESDtrack *btrk=event->GetTrack(bidx);
-            Float_t lBachMassForTracking=btrk->GetMassForTracking();
-            
-            if (btrk->GetSign()>0) continue;  // bachelor's charge
-            
-            AliESDv0 *pv0=&v0;
-            AliExternalTrackParam bt(*btrk);
-            if(fkUseOptimalTrackParamsBachelor) {
-                //Look for a better bachelor description, please
-                //reroute to pointers obtained with on-the-fly finding
-                map<pair<int,int>, int>::iterator iter = fOTFMap.find(make_pair(bidx,v->GetPindex()));
-                if(iter != fOTFMap.end())
-                {
-                    Int_t lEquivalentOTFV0 = (*iter).second; // or iter->second;
-                    AliESDv0 *v0_otf = ((AliESDEvent*)event)->GetV0(lEquivalentOTFV0);
-                    if(!v0_otf){
-                        AliWarning(Form("Invalid V0 at position %i!", lEquivalentOTFV0));
-                        fHistV0OptimalTrackParamUseBachelor->Fill(2.5);
-                    }else{
-                        AliExternalTrackParam btimproved(*(v0_otf->GetParamN()));
-                        bt = btimproved;
-                        fHistV0OptimalTrackParamUseBachelor->Fill(1.5);
-                    }
-                }else{
-                    //OTF not available for this pair
-                    fHistV0OptimalTrackParamUseBachelor->Fill(0.5);
-                }
-            }
-            AliExternalTrackParam *pbt=&bt;
-            
-            Double_t dca=PropagateToDCA(pv0,pbt,event,b,lBachMassForTracking);
-            if (dca > fCascadeVertexerSels[4]) continue;
-            
-            //eta cut - test
-            if (TMath::Abs(pbt->Eta())>0.8&&fkExtraCleanup) continue;
-            
-            AliESDcascade cascade(*pv0,*pbt,bidx);//constucts a cascade candidate
-            //PH        if (cascade.GetChi2Xi() > fChi2max) continue;
-            
-            //Improve estimate of cascade decay position using uncertainties if requested to do so
-            if( fkDoCascadeRefit ) cascade.RefitCascade(pbt);
-                
-            Double_t x,y,z; cascade.GetXYZcascade(x,y,z); // Bo: bug correction
-            Double_t r2=x*x + y*y;
-            if (r2 > fCascadeVertexerSels[7]*fCascadeVertexerSels[7]) continue;   // condition on fiducial zone
-            if (r2 < fCascadeVertexerSels[6]*fCascadeVertexerSels[6]) continue;
-            
-            Double_t pxV0,pyV0,pzV0;
-            pv0->GetPxPyPz(pxV0,pyV0,pzV0);
-            if (x*pxV0+y*pyV0+z*pzV0 < 0) continue; //causality
-            
-            Double_t x1,y1,z1; pv0->GetXYZ(x1,y1,z1);
-            if (r2 > (x1*x1+y1*y1)) continue;
-            
-            if (cascade.GetCascadeCosineOfPointingAngle(xPrimaryVertex,yPrimaryVertex,zPrimaryVertex) <fCascadeVertexerSels[5]) continue; //condition on the cascade pointing angle
-            
-            //pre-select on pT
-            Double_t lXiMomX       = 0. , lXiMomY = 0., lXiMomZ = 0.;
-            Double_t lXiTransvMom  = 0. ;
-            cascade.GetPxPyPz( lXiMomX, lXiMomY, lXiMomZ );
-            lXiTransvMom      = TMath::Sqrt( lXiMomX*lXiMomX   + lXiMomY*lXiMomY );
-            if(lXiTransvMom<fMinPtCascade) continue;
-            if(lXiTransvMom>fMaxPtCascade) continue;
-            
-            //Filter masses: anti-cascade hypotheses
-            Double_t lV0quality = 0.;
-            cascade.ChangeMassHypothesis(lV0quality , 3312); // pdg code -3312 = Xi+
-            Double_t lInvMassXi = cascade.GetEffMassXi();
-            cascade.ChangeMassHypothesis(lV0quality , 3334); // pdg code -3312 = Xi+
-            Double_t lInvMassOmega = cascade.GetEffMassXi();
-            
-            //Remove if outside window of interest
-            if(TMath::Abs(lInvMassXi   -1.322)>fMassWindowAroundCascade &&
-               TMath::Abs(lInvMassOmega-1.672)>fMassWindowAroundCascade ) continue;
-            
-            cascade.SetDcaXiDaughters(dca);
-            
-            //Change back to default XiMinus hypothesis
-            cascade.ChangeMassHypothesis(lV0quality , 3312);
-            event->AddCascade(&cascade);
-            ncasc++;
-        } // end loop tracks
-    } // end loop V0s
+    //Bachelor candidates split by charge: the charge requirement of each pass
+    //is applied once instead of once per V0
+    std::vector<Int_t> lBachelors[2];
+    for (Long_t j=0; j<ntr; j++) {
+        AliESDtrack *btrk=event->GetTrack(trk[j]);
+        if (!(btrk->GetSign()>0)) lBachelors[0].push_back(trk[j]); //cascades: bachelor's charge
+        if (!(btrk->GetSign()<0)) lBachelors[1].push_back(trk[j]); //anti-cascades: bachelor's charge
+    }
     
-    // Looking for the anti-cascades...
-    for (i=0; i<nV0; i++) { //loop on V0s
-        AliESDv0 *v=(AliESDv0*)vtcs.UncheckedAt(i);
-        AliESDv0 v0(*v);
-        v0.ChangeMassHypothesis(kLambda0Bar); //the v0 must be anti-Lambda
-        if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
-        
-        for (Int_t j=0; j<ntr; j++) {//loop on tracks
-            Int_t bidx=trk[j];
-            if (bidx==v0.GetIndex(1)) continue; //Bo:  consistency 1 for pos
-            
-            AliESDtrack *btrk=event->GetTrack(bidx);
-            Float_t lBachMassForTracking=btrk->GetMassForTracking();
-            
-            if (btrk->GetSign()<0) continue;  // bachelor's charge
-            
-            AliESDv0 *pv0=&v0;
-            AliExternalTrackParam bt(*btrk);
-            if(fkUseOptimalTrackParamsBachelor) {
-                //Look for a better bachelor description, please
-                //reroute to pointers obtained with on-the-fly finding
-                map<pair<int,int>, int>::iterator iter = fOTFMap.find(make_pair(v->GetNindex(),bidx));
-                if(iter != fOTFMap.end())
-                {
-                    Int_t lEquivalentOTFV0 = (*iter).second; // or iter->second;
-                    AliESDv0 *v0_otf = ((AliESDEvent*)event)->GetV0(lEquivalentOTFV0);
-                    if(!v0_otf){
-                        AliWarning(Form("Invalid V0 at position %i!", lEquivalentOTFV0));
-                        fHistV0OptimalTrackParamUseBachelor->Fill(2.5);
-                    }else{
-                        AliExternalTrackParam btimproved(*(v0_otf->GetParamP()));
-                        bt = btimproved;
-                        fHistV0OptimalTrackParamUseBachelor->Fill(1.5);
+    //V0s are split in contiguous chunks, processed in parallel if requested;
+    //candidates are stored per chunk and added to the event in the sequential order
+    const Int_t lNThreads = GetNumberOfVertexingThreads();
+    const Int_t lNChunks = (lNThreads>1 && nV0>1) ? TMath::Min( nV0, 8*lNThreads ) : 1;
+    
+    // Looking for the cascades (lPass = 0), then for the anti-cascades (lPass = 1)...
+    for (Int_t lPass=0; lPass<2; lPass++) {
+        const Bool_t lAnti = (lPass==1);
+        const std::vector<Int_t> &lBach = lBachelors[lPass];
+        std::vector< std::vector<AliESDcascade> > lChunkCascades(lNChunks);
+        std::vector<AliWeakDecayVertexerCounts> lChunkCounts(lNChunks);
+        
+        auto lFindCascades = [&](Int_t lChunk) {
+            std::vector<AliESDcascade> &lCascades = lChunkCascades[lChunk];
+            AliWeakDecayVertexerCounts &lCounts = lChunkCounts[lChunk];
+            
+            for (Long_t iv=lChunk*(Long_t)nV0/lNChunks; iv<(lChunk+1)*(Long_t)nV0/lNChunks; iv++) { //loop on V0s
+                AliESDv0 *v=(AliESDv0*)vtcs.UncheckedAt(iv);
+                AliESDv0 v0(*v);
+                v0.ChangeMassHypothesis(lAnti ? kLambda0Bar : kLambda0); // the v0 must be (anti-)Lambda
+                if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
+                
+                for (size_t j=0; j<lBach.size(); j++) {//loop on tracks
+                    Int_t bidx=lBach[j];
+                    //Bo:   if (bidx==v->GetNindex()) continue; //bachelor and v0's negative tracks must be different
+                    if (bidx==v0.GetIndex(lAnti ? 1 : 0)) continue; //Bo:  consistency 0 for neg, 1 for pos
+                    
+                    AliESDtrack *btrk=event->GetTrack(bidx);
+                    Float_t lBachMassForTracking=btrk->GetMassForTracking();
+                    
+                    AliESDv0 *pv0=&v0;
+                    AliExternalTrackParam bt(*btrk);
+                    if(fkUseOptimalTrackParamsBachelor) {
+                        //Look for a better bachelor description, please
+                        //reroute to pointers obtained with on-the-fly finding
+                        map<pair<int,int>, int>::const_iterator iter = lAnti ?
+                        fOTFMap.find(make_pair(v->GetNindex(),bidx)) : fOTFMap.find(make_pair(bidx,v->GetPindex()));
+                        if(iter != fOTFMap.end())
+                        {
+                            Int_t lEquivalentOTFV0 = (*iter).second; // or iter->second;
+                            AliESDv0 *v0_otf = ((AliESDEvent*)event)->GetV0(lEquivalentOTFV0);
+                            if(!v0_otf){
+                                lCounts.fInvalidOTFV0s.push_back(lEquivalentOTFV0);
+                                lCounts.fOptimalTrackParamUse[2]++;
+                            }else{
+                                AliExternalTrackParam btimproved(lAnti ? *(v0_otf->GetParamP()) : *(v0_otf->GetParamN()));
+                                bt = btimproved;
+                                lCounts.fOptimalTrackParamUse[1]++;
+                            }
+                        }else{
+                            //OTF not available for this pair
+                            lCounts.fOptimalTrackParamUse[0]++;
+                        }
                     }
-                }else{
-                    //OTF not available for this pair
-                    fHistV0OptimalTrackParamUseBachelor->Fill(0.5);
-                }
+                    AliExternalTrackParam *pbt=&bt;
+                    
+                    Double_t dca=PropagateToDCA(pv0,pbt,event,b,lBachMassForTracking,lCounts.fPropagationStatus);
+                    if (dca > fCascadeVertexerSels[4]) continue;
+                    
+                    //eta cut - test
+                    if (TMath::Abs(pbt->Eta())>0.8&&fkExtraCleanup) continue;
+                    
+                    AliESDcascade cascade(*pv0,*pbt,bidx);//constucts a cascade candidate
+                    //PH        if (cascade.GetChi2Xi() > fChi2max) continue;
+                    
+                    //Improve estimate of cascade decay position using uncertainties if requested to do so
+                    if( fkDoCascadeRefit ) cascade.RefitCascade(pbt);
+                    
+                    Double_t x,y,z; cascade.GetXYZcascade(x,y,z); // Bo: bug correction
+                    Double_t r2=x*x + y*y;
+                    if (r2 > fCascadeVertexerSels[7]*fCascadeVertexerSels[7]) continue;   // condition on fiducial zone
+                    if (r2 < fCascadeVertexerSels[6]*fCascadeVertexerSels[6]) continue;
+                    
+                    Double_t pxV0,pyV0,pzV0;
+                    pv0->GetPxPyPz(pxV0,pyV0,pzV0);
+                    if (x*pxV0+y*pyV0+z*pzV0 < 0) continue; //causality
+                    
+                    Double_t x1,y1,z1; pv0->GetXYZ(x1,y1,z1);
+                    if (r2 > (x1*x1+y1*y1)) continue;
+                    
+                    if (cascade.GetCascadeCosineOfPointingAngle(xPrimaryVertex,yPrimaryVertex,zPrimaryVertex) <fCascadeVertexerSels[5]) continue; //condition on the cascade pointing angle
+                    
+                    //pre-select on pT
+                    Double_t lXiMomX       = 0. , lXiMomY = 0., lXiMomZ = 0.;
+                    Double_t lXiTransvMom  = 0. ;
+                    cascade.GetPxPyPz( lXiMomX, lXiMomY, lXiMomZ );
+                    lXiTransvMom      = TMath::Sqrt( lXiMomX*lXiMomX   + lXiMomY*lXiMomY );
+                    if(lXiTransvMom<fMinPtCascade) continue;
+                    if(lXiTransvMom>fMaxPtCascade) continue;
+                    
+                    //Filter masses: (anti-)cascade hypotheses
+                    Double_t lV0quality = 0.;
+                    const Int_t lSign = lAnti ? -1 : +1;
+                    cascade.ChangeMassHypothesis(lV0quality , lSign*3312); // pdg code 3312 = Xi-, -3312 = Xi+
+                    Double_t lInvMassXi = cascade.GetEffMassXi();
+                    cascade.ChangeMassHypothesis(lV0quality , lSign*3334); // pdg code 3334 = Omega-, -3334 = Omega+
+                    Double_t lInvMassOmega = cascade.GetEffMassXi();
+                    
+                    //Remove if outside window of interest
+                    if(TMath::Abs(lInvMassXi   -1.322)>fMassWindowAroundCascade &&
+                       TMath::Abs(lInvMassOmega-1.672)>fMassWindowAroundCascade ) continue;
+                    
+                    cascade.SetDcaXiDaughters(dca);
+                    
+                    //Change back to default XiMinus/XiPlus hypothesis
+                    cascade.ChangeMassHypothesis(lV0quality , lSign*3312);
+                    lCascades.push_back(cascade);
+                } // end loop tracks
+            } // end loop V0s
+        };
+        RunVertexingChunks( lNThreads>1 ? fExecutor : 0x0, lNChunks, lFindCascades );
+        
+        //Merge: candidates and counters in the sequential order
+        for (Int_t lChunk=0; lChunk<lNChunks; lChunk++) {
+            AliWeakDecayVertexerCounts &lCounts = lChunkCounts[lChunk];
+            for (size_t iw=0; iw<lCounts.fInvalidOTFV0s.size(); iw++)
+                AliWarning(Form("Invalid V0 at position %i!", lCounts.fInvalidOTFV0s[iw]));
+            FillCounts( fHistV0OptimalTrackParamUseBachelor, lCounts.fOptimalTrackParamUse, 3 );
+            FillCounts( fHistV0ToBachelorPropagationStatus, lCounts.fPropagationStatus, 10 );
+            for (size_t ic=0; ic<lChunkCascades[lChunk].size(); ic++) {
+                event->AddCascade(&lChunkCascades[lChunk][ic]);
+                ncasc++;
             }
-            AliExternalTrackParam *pbt=&bt;
-            
-            Double_t dca=PropagateToDCA(pv0,pbt,event,b,lBachMassForTracking);
-            if (dca > fCascadeVertexerSels[4]) continue;
-            
-            //eta cut - test
-            if (TMath::Abs(pbt->Eta())>0.8 && fkExtraCleanup) continue;
-            
-            AliESDcascade cascade(*pv0,*pbt,bidx); //constucts a cascade candidate
-            //PH         if (cascade.GetChi2Xi() > fChi2max) continue;
-            
-            //Improve estimate of cascade decay position using uncertainties if requested to do so
-            if( fkDoCascadeRefit ) cascade.RefitCascade(pbt);
-            
-            Double_t x,y,z; cascade.GetXYZcascade(x,y,z); // Bo: bug correction
-            Double_t r2=x*x + y*y;
-            if (r2 > fCascadeVertexerSels[7]*fCascadeVertexerSels[7]) continue;   // condition on fiducial zone
-            if (r2 < fCascadeVertexerSels[6]*fCascadeVertexerSels[6]) continue;
-            
-            Double_t pxV0,pyV0,pzV0;
-            pv0->GetPxPyPz(pxV0,pyV0,pzV0);
-            if (x*pxV0+y*pyV0+z*pzV0 < 0) continue; //causality
-            
-            Double_t x1,y1,z1; pv0->GetXYZ(x1,y1,z1);
-            if (r2 > (x1*x1+y1*y1)) continue;
-            
-            if (cascade.GetCascadeCosineOfPointingAngle(xPrimaryVertex,yPrimaryVertex,zPrimaryVertex) < fCascadeVertexerSels[5]) continue; //condition on the cascade pointing angle
-            
-            //pre-select on pT
-            Double_t lXiMomX       = 0. , lXiMomY = 0., lXiMomZ = 0.;
-            Double_t lXiTransvMom  = 0. ;
-            cascade.GetPxPyPz( lXiMomX, lXiMomY, lXiMomZ );
-            lXiTransvMom  	= TMath::Sqrt( lXiMomX*lXiMomX   + lXiMomY*lXiMomY );
-            if(lXiTransvMom<fMinPtCascade) continue;
-            if(lXiTransvMom>fMaxPtCascade) continue;
-            
-            //Filter masses: anti-cascade hypotheses
-            Double_t lV0quality = 0.;
-            cascade.ChangeMassHypothesis(lV0quality , -3312); // pdg code -3312 = Xi+
-            Double_t lInvMassXi = cascade.GetEffMassXi();
-            cascade.ChangeMassHypothesis(lV0quality , -3334); // pdg code -3312 = Xi+
-            Double_t lInvMassOmega = cascade.GetEffMassXi();
-            
-            //Remove if outside window of interest
-            if(TMath::Abs(lInvMassXi   -1.322)>fMassWindowAroundCascade &&
-               TMath::Abs(lInvMassOmega-1.672)>fMassWindowAroundCascade ) continue;
-            
-            cascade.SetDcaXiDaughters(dca);
-            
-            //Change back to default XiPlus hypothesis
-            cascade.ChangeMassHypothesis(lV0quality , -3312);
-            event->AddCascade(&cascade);
-            ncasc++;
-            
-        } // end loop tracks
-    } // end loop V0s
+        }
+    }
     
     AliWarning(Form("V0sTracks2CascadeVertices","Number of reconstructed cascades: %ld",ncasc));
     
@@ -2109,13 +2261,23 @@ Double_t AliAnalysisTaskWeakDecayVertexer::Det(Double_t a00,Double_t a01,Double_
 }
 
 //________________________________________________________________________
-Double_t AliAnalysisTaskWeakDecayVertexer::PropagateToDCA(AliESDv0 *v, AliExternalTrackParam *t, AliESDEvent *event, Double_t b, Double_t lBachMassForTracking) {
+void AliAnalysisTaskWeakDecayVertexer::CountPropagationStatus(Int_t lBin, Long64_t *lStatusCounts) {
+    //--------------------------------------------------------------------
+    // Bookkeeps the propagation status in the local counters if provided
+    // (parallel finding, merged afterwards), in the histogram otherwise
+    //--------------------------------------------------------------------
+    if( lStatusCounts ) lStatusCounts[lBin]++;
+    else fHistV0ToBachelorPropagationStatus->Fill(lBin+0.5);
+}
+
+//________________________________________________________________________
+Double_t AliAnalysisTaskWeakDecayVertexer::PropagateToDCA(AliESDv0 *v, AliExternalTrackParam *t, AliESDEvent *event, Double_t b, Double_t lBachMassForTracking, Long64_t *lStatusCounts) {
     //--------------------------------------------------------------------
     // This function returns the DCA between the V0 and the track
     //--------------------------------------------------------------------
     
     //Count received
-    fHistV0ToBachelorPropagationStatus->Fill(0.5);
+    CountPropagationStatus(0, lStatusCounts);
     
     Double_t alpha=t->GetAlpha(), cs1=TMath::Cos(alpha), sn1=TMath::Sin(alpha);
     Double_t r[3]; t->GetXYZ(r);
@@ -2150,17 +2312,17 @@ Double_t AliAnalysisTaskWeakDecayVertexer::PropagateToDCA(AliESDv0 *v, AliExtern
         x1=x1*cs1 + y1*sn1;
         if (!t->PropagateTo(x1,b)) {
             //Count linear propagation failures
-            fHistV0ToBachelorPropagationStatus->Fill(1.5);
+            CountPropagationStatus(1, lStatusCounts);
             Error("PropagateToDCA","Propagation failed !");
             return 1.e+33;
         }
         //Count linear propagation successes
-        fHistV0ToBachelorPropagationStatus->Fill(2.5);
+        CountPropagationStatus(2, lStatusCounts);
     }
     
     if( fkDoImprovedDCACascDauPropagation ){
         //Count Improved Cascade propagation received
-        fHistV0ToBachelorPropagationStatus->Fill(3.5); //bin 4
+        CountPropagationStatus(3, lStatusCounts); //bin 4
         
         //DCA Calculation improved -> non-linear propagation
         //Preparatory step 1: get two tracks corresponding to V0
@@ -2374,12 +2536,12 @@ Double_t AliAnalysisTaskWeakDecayVertexer::PropagateToDCA(AliESDv0 *v, AliExtern
                     if ((gt1*gt1+gt2*gt2) > 1.e-4/dy2/dy2){
                         AliDebug(1," stopped at not a stationary point !");
                         //Count not stationary point
-                        fHistV0ToBachelorPropagationStatus->Fill(4.5); //bin 5
+                        CountPropagationStatus(4, lStatusCounts); //bin 5
                     }
                     Double_t lmb=h11+h22; lmb=lmb-TMath::Sqrt(lmb*lmb-4*det);
                     if (lmb < 0.){
                         //Count stopped at not a minimum
-                        fHistV0ToBachelorPropagationStatus->Fill(5.5);
+                        CountPropagationStatus(5, lStatusCounts);
                         AliDebug(1," stopped at not a minimum !");
                     }
                     break;
@@ -2396,7 +2558,7 @@ Double_t AliAnalysisTaskWeakDecayVertexer::PropagateToDCA(AliESDv0 *v, AliExtern
                 if (div>512) {
                     AliDebug(1," overshoot !"); break;
                     //Count overshoots
-                    fHistV0ToBachelorPropagationStatus->Fill(6.5);
+                    CountPropagationStatus(6, lStatusCounts);
                 }
             }
             dm=dd;
@@ -2409,7 +2571,7 @@ Double_t AliAnalysisTaskWeakDecayVertexer::PropagateToDCA(AliESDv0 *v, AliExtern
         if (max<=0){
             AliDebug(1," too many iterations !");
             //Count excessive iterations
-            fHistV0ToBachelorPropagationStatus->Fill(7.5);
+            CountPropagationStatus(7, lStatusCounts);
         }
         
         Double_t cs=TMath::Cos(t->GetAlpha());
@@ -2421,7 +2583,7 @@ Double_t AliAnalysisTaskWeakDecayVertexer::PropagateToDCA(AliESDv0 *v, AliExtern
             if (!t->PropagateTo(xthis,b)) {
                 //AliWarning(" propagation failed !";
                 //Count curved propagation failures
-                fHistV0ToBachelorPropagationStatus->Fill(8.5);
+                CountPropagationStatus(8, lStatusCounts);
                 return 1e+33;
             }
         }else{
@@ -2431,7 +2593,7 @@ Double_t AliAnalysisTaskWeakDecayVertexer::PropagateToDCA(AliESDv0 *v, AliExtern
         //V0 distance to bachelor: the desired distance
         Double_t rBachDCAPt[3]; t->GetXYZ(rBachDCAPt);
         dca = v->GetD(rBachDCAPt[0],rBachDCAPt[1],rBachDCAPt[2]);
-        fHistV0ToBachelorPropagationStatus->Fill(9.5);
+        CountPropagationStatus(9, lStatusCounts);
     }
     
     return dca;
@@ -2615,9 +2777,11 @@ Double_t AliAnalysisTaskWeakDecayVertexer::GetDCAV0Dau( AliExternalTrackParam *p
         
         //______________________
         //fast skipper: if XY plane pre-optimization says they're far, they're far! don't insist
+        //(same test as the XY-plane pre-selection of Tracks2V0vertices)
         if ( fkSkipLargeXYDCA ) {
-            if( lDist > NegRadius + PosRadius + 2*fV0VertexerSels[3] ) return 2000;
-            if( lDist < TMath::Abs(NegRadius - PosRadius) - 2*fV0VertexerSels[3] ) return 2000;
+            Double_t lNegCircle[3] = {xNegCenter, yNegCenter, NegRadius};
+            Double_t lPosCircle[3] = {xPosCenter, yPosCenter, PosRadius};
+            if( AreHelixCirclesApart(lNegCircle, lPosCircle, 2*fV0VertexerSels[3]) ) return 2000;
         }
         
         //______________________
@@ -2922,6 +3086,37 @@ void AliAnalysisTaskWeakDecayVertexer::GetHelixCenter(const AliExternalTrackPara
     return;
 }
 
+///________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::PrepareV0Daughter(const AliESDtrack *track, const AliESDVertex *vtx, Double_t b, AliExternalTrackParam &lParam, Double_t lCircle[3]){
+    // Starting parameters of a V0 daughter candidate, shared by all pairs it enters:
+    // re-propagated to the primary vertex if requested, plus helix circle in XY
+    lParam = AliExternalTrackParam(*track);
+    
+    //Re-propagate to closest position to the primary vertex if asked to do so
+    if (fkResetInitialPositions){
+        Double_t dztemp[2], covartemp[3];
+        //Safety margin: 250 -> exceedingly large... not sure this makes sense, but ok
+        lParam.PropagateToDCA( vtx , b , 250, dztemp, covartemp );
+    }
+    
+    Double_t lHelix[6];
+    lParam.GetHelixParameters(lHelix,b);
+    GetHelixCenter( &lParam, lCircle, b );
+    lCircle[2] = TMath::Abs(1./lHelix[4]);
+}
+
+///________________________________________________________________________
+Int_t AliAnalysisTaskWeakDecayVertexer::GetNumberOfVertexingThreads() const {
+    // Threads used for pair finding: material corrections access the geometry,
+    // which is not thread-safe, and need implicit multi-threading enabled in the steering
+#ifdef R__USE_IMT
+    if( fkDoMaterialCorrection || fNThreads < 1 || !fExecutor ) return 1;
+    return fNThreads;
+#else
+    return 1;
+#endif
+}
+
 ///________________________________________________________________________
 void AliAnalysisTaskWeakDecayVertexer::SelectiveResetV0s(AliESDEvent *event, Int_t lType){
     //Selectively reset V0s
@@ -3007,6 +3202,7 @@ void AliAnalysisTaskWeakDecayVertexer::Print()
     cout<<" DCA casc dau pre-opt.......: "<<fkDoXYPlanePreOptCascade<<endl;
     cout<<" Casc. mass window (GeV/c2).: "<<fMassWindowAroundCascade<<endl;
     cout<<" Master Niterations value...: "<<fMaxIterationsWhenMinimizing<<endl;
+    cout<<" Number of threads..........: "<<fNThreads<<endl;
     cout<<" Skip large DCAXY in opt....: "<<fkSkipLargeXYDCA<<endl;
     cout<<" MC associated only (MCflag): "<<fkMonteCarlo<<endl;
     cout<<" --> Experimental flags: "<<endl;
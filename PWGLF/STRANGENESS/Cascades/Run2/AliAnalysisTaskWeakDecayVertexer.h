@@ -34,7 +34,10 @@ class TH1F;
 class AliV0HypSel;
 class AliESDpid;
 class AliESDEvent;
+class AliESDtrack;
+class AliESDVertex;
 class AliPhysicsSelection;
+namespace ROOT { class TThreadExecutor; }
 
 #include "AliEventCuts.h"
 //For mapping functionality
@@ -113,6 +116,11 @@ public:
     void SetMaxIterations (Long_t lMaxIter = 100){
         fMaxIterationsWhenMinimizing = lMaxIter;
     }
+    void SetNumberOfThreads (Int_t lNThreads = 1){
+        //Pair finding in parallel; needs ROOT::EnableImplicitMT() in the steering
+        //Note: not used with material corrections (geometry access)
+        fNThreads = lNThreads;
+    }
     
     
 //---------------------------------------------------------------------------------------
@@ -305,7 +313,8 @@ public:
     Double_t Det(Double_t a00,Double_t a01,Double_t a02,
                  Double_t a10,Double_t a11,Double_t a12,
                  Double_t a20,Double_t a21,Double_t a22) const;
-    Double_t PropagateToDCA(AliESDv0 *vtx,AliExternalTrackParam *trk, AliESDEvent *event, Double_t b, Double_t lBachMassForTracking=0.139);
+    Double_t PropagateToDCA(AliESDv0 *vtx,AliExternalTrackParam *trk, AliESDEvent *event, Double_t b, Double_t lBachMassForTracking=0.139, Long64_t *lStatusCounts=0x0);
+    void CountPropagationStatus(Int_t lBin, Long64_t *lStatusCounts);
     void Evaluate(const Double_t *h, Double_t t,
                   Double_t r[3],  //radius vector
                   Double_t g[3],  //first defivatives
@@ -315,6 +324,8 @@ public:
     //Improved DCA V0 Dau
     Double_t GetDCAV0Dau ( AliExternalTrackParam *pt, AliExternalTrackParam *nt, Double_t &xp, Double_t &xn, Double_t b, Double_t lNegMassForTracking=0.139, Double_t lPosMassForTracking=0.139);
     void GetHelixCenter(const AliExternalTrackParam *track,Double_t center[2], Double_t b);
+    void PrepareV0Daughter(const AliESDtrack *track, const AliESDVertex *vtx, Double_t b, AliExternalTrackParam &lParam, Double_t lCircle[3]);
+    Int_t GetNumberOfVertexingThreads() const;
     //---------------------------------------------------------------------------------------
     
     //---------------------------------------------------------------------------------------
@@ -385,6 +396,8 @@ private:
     Long_t fMaxIterationsWhenMinimizing;
     Bool_t fkPreselectX;
     Bool_t fkSkipLargeXYDCA;
+    Int_t fNThreads; //number of threads for V0/cascade pair finding
+    ROOT::TThreadExecutor *fExecutor; //! thread pool for V0/cascade pair finding, created once per task
     
     //Master MC switch
     Bool_t fkMonteCarlo; //do MC association in vertexing
@@ -432,8 +445,9 @@ private:
     AliAnalysisTaskWeakDecayVertexer(const AliAnalysisTaskWeakDecayVertexer&);            // not implemented
     AliAnalysisTaskWeakDecayVertexer& operator=(const AliAnalysisTaskWeakDecayVertexer&); // not implemented
 
-    ClassDef(AliAnalysisTaskWeakDecayVertexer, 1);
+    ClassDef(AliAnalysisTaskWeakDecayVertexer, 2);
     //1: first implementation
+    //2: multithreaded V0/cascade finding
 };
 
 #endif
@@ -40,7 +40,7 @@
 #include <TDatabasePDG.h>
 
 #include "TChain.h"
-#include "TTreeStream.h"
+#include "AliTreeSRedirectorColumnar.h"
 #include "TTree.h"
 #include "TH1F.h"
 #include "TH3.h"
@@ -114,6 +114,8 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fTrigger(AliTriggerAnalysis::kMB1) 
   , fAnalysisMode(kTPCAnalysisMode) 
   , fTreeSRedirector(0)
+  , fStreamerFlattenClasses()
+  , fStreamerParallelCompression(kFALSE)
   , fCentralityEstimator(0)
   , fLowPtTrackDownscaligF(0)
   , fLowPtV0DownscaligF(0)
@@ -209,7 +211,11 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
   //
   //get the output file to make sure the trees will be associated to it
   OpenFile(1);
-  fTreeSRedirector = new TTreeSRedirector();
+  fTreeSRedirector = new AliTreeSRedirectorColumnar();
+  TObjArray *flattenClasses = fStreamerFlattenClasses.Tokenize(";");
+  for (Int_t i=0; i<flattenClasses->GetEntriesFast(); i++) fTreeSRedirector->AddFlattenClass(flattenClasses->At(i)->GetName());
+  delete flattenClasses;
+  if (fStreamerParallelCompression) fTreeSRedirector->SetParallelCompression(kTRUE);
 
   //
   // Create trees
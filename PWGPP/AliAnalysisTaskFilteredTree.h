@@ -41,7 +41,7 @@ class AliStack;
 class TList;
 class TObjArray;
 class TTree;
-class TTreeSRedirector;
+class AliTreeSRedirectorColumnar;
 class TParticle;
 class TH3D;
 class AliESDtools;
@@ -130,6 +130,10 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   static Int_t GetMCTrueTrackMult(AliMCEvent *const mcEvent, AliFilteredTreeEventCuts *const evtCuts, AliFilteredTreeAcceptanceCuts *const accCuts);
 
   void SetFillTrees(Bool_t filltree) { fFillTree = filltree ;}
+  /// objects of the classes (separated by ;) are written as primitive columns "name.fMember" instead of objects
+  void SetStreamerFlattenClasses(const char *classes) { fStreamerFlattenClasses = classes; }
+  /// compress the tree baskets in parallel, with the implicit MT enabled by the train steering
+  void SetStreamerParallelCompression(Bool_t parallel) { fStreamerParallelCompression = parallel; }
   Bool_t GetFillTrees() { return fFillTree ;}
 
   void FillHistograms(AliESDtrack* const ptrack, AliExternalTrackParam* const ptpcInnerC, Double_t centralityF, Double_t chi2TPCInnerC);
@@ -164,7 +168,9 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   AliTriggerAnalysis::Trigger fTrigger;    // trigger settings
   EAnalysisMode fAnalysisMode;   // analysis mode TPC only, TPC + ITS
 
-  TTreeSRedirector* fTreeSRedirector;      //! temp tree to dump output
+  AliTreeSRedirectorColumnar* fTreeSRedirector;      //! temp tree to dump output
+  TString fStreamerFlattenClasses;         // classes written as primitive columns (separated by ;)
+  Bool_t  fStreamerParallelCompression;    // parallel compression of the trees (implicit MT)
 
   TString fCentralityEstimator;     // use centrality can be "VOM" (default), "FMD", "TRK", "TKL", "CL0", "CL1", "V0MvsFMD", "TKLvsV0M", "ZEMvsZDC"
 
@@ -205,7 +211,7 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
 
   AliAnalysisTaskFilteredTree(const AliAnalysisTaskFilteredTree&); // not implemented
   AliAnalysisTaskFilteredTree& operator=(const AliAnalysisTaskFilteredTree&); // not implemented
-  ClassDef(AliAnalysisTaskFilteredTree, 1); // example of analysis
+  ClassDef(AliAnalysisTaskFilteredTree, 2); // example of analysis
 };
 
 #endif
@@ -38,10 +38,10 @@
   tree->Scan("AliESDtools::GetTrackMatchEff(0,0):AliESDtools::GetTrackCounters(0,0):AliESDtools::GetTrackCounters(4,0):AliESDtools::GetMeanHisTPCVertexA():AliESDtools::GetMeanHisTPCVertexC():Entry$",\
       "AliESDtools::SCalculateEventVariables(Entry$)")
   /// 2.) Exercise: stream event information
-  TTreeSRedirector *pcstream = new TTreeSRedirector("test.root","recreate")
+  TTreeSRedirector *pcstream = new TTreeSRedirector("test.root","recreate")   // or AliTreeSRedirectorColumnar
   tools->SetStreamer(pcstream);
   tree->Draw("AliESDtools::SDumpEventVariables()","AliESDtools::SCalculateEventVariables(Entry$)");
-  tools->SetStreamer(0);
+  tools->SetStreamer((TTreeSRedirector*)0);
   delete pcstream;
 */
 
@@ -73,6 +73,7 @@
 #include "AliCentrality.h"
 #include "AliMultSelection.h"
 #include "AliESDtools.h"
+#include "AliTreeSRedirectorColumnar.h"
 #include "AliMathBase.h"
 #include "AliESDTOFHit.h"
 #include "AliTOFGeometry.h"
@@ -118,7 +119,8 @@ AliESDtools::AliESDtools():
   fCacheTrackChi2(nullptr),             // chi2 counter
   fCacheTrackMatchEff(nullptr),         // matchEff counter
   fLumiGraph(nullptr),                  // graph for the interaction rate info for a run
-  fStreamer(nullptr)
+  fStreamer(nullptr),
+  fStreamerColumnar(nullptr)
 {
   fgInstance=this;
   fTriggerAnalysis=new AliTriggerAnalysis;
@@ -784,6 +786,55 @@ Double_t AliESDtools::LoadESD(Int_t entry, Int_t verbose) {
   fgInstance->fEvent->ConnectTracks();
   return 2;
 }
+/// Cached vector of given type - to be used for array access to the event variables (see ECacheType)
+/// \param cacheType - cache type
+/// \return          - pointer to the cached vector (NULL for unknown type)
+const TVectorF *AliESDtools::GetCacheVector(Int_t cacheType){
+  switch (cacheType){
+    case kTrackCounters:     return fgInstance->fCacheTrackCounters;
+    case kTrackTPCCountersZ: return fgInstance->fCacheTrackTPCCountersZ;
+    case kTrackdEdxRatio:    return fgInstance->fCacheTrackdEdxRatio;
+    case kTrackNcl:          return fgInstance->fCacheTrackNcl;
+    case kTrackChi2:         return fgInstance->fCacheTrackChi2;
+    case kTrackMatchEff:     return fgInstance->fCacheTrackMatchEff;
+    case kVertexInfo:        return fgInstance->fTPCVertexInfo;
+  }
+  return NULL;
+}
+
+/// Calculate event variables for a range of entries and extract all requested values at once
+/// Equivalent of the per entry query "GetTrackCounters(index[0],0):GetTrackdEdxRatio(index[1],0):..." with selection
+/// "SCalculateEventVariables(Entry$)" - event is loaded and variables are calculated only once per entry
+/// This is a convenience loop, not a batched calculation: each entry is still read and processed by
+/// SCalculateEventVariables, the gain is only in the value extraction (no TTreeFormula per value)
+/// Example:
+/// \code
+///   Int_t type[2]={AliESDtools::kTrackCounters,AliESDtools::kTrackdEdxRatio}, index[2]={0,4};
+///   std::vector<Float_t> values(2*1000);
+///   AliESDtools::SCalculateEventVariablesN(0,1000,2,type,index,values.data());
+/// \endcode
+/// \param firstEntry  - first entry in the ESD tree
+/// \param nEntries    - number of entries
+/// \param nValues     - number of values per entry
+/// \param cacheType   - cache type of value (nValues)
+/// \param index       - index in the cache vector of value (nValues)
+/// \param result      - output array [nEntries*nValues], value i of entry firstEntry+j stored at j*nValues+i
+/// \return            - number of entries processed
+Int_t AliESDtools::SCalculateEventVariablesN(Long64_t firstEntry, Int_t nEntries, Int_t nValues, const Int_t *cacheType, const Int_t *index, Float_t *result){
+  if (fgInstance==NULL || fgInstance->fESDtree==NULL) return 0;
+  const Long64_t lastEntry=TMath::Min(firstEntry+nEntries, fgInstance->fESDtree->GetEntries());
+  Int_t nProcessed=0;
+  for (Long64_t entry=firstEntry; entry<lastEntry; entry++, nProcessed++){
+    SCalculateEventVariables(entry);
+    Float_t *entryResult=&result[nProcessed*nValues];
+    for (Int_t i=0; i<nValues; i++) {
+      const TVectorF *cache=GetCacheVector(cacheType[i]);
+      entryResult[i]= (cache && index[i]>=0 && index[i]<cache->GetNrows()) ? (*cache)[index[i]] : 0;
+    }
+  }
+  return nProcessed;
+}
+
 /// Find (biggest) pile-up TPC vertex  - high efficiency for the PbPb - for pp should be still optimized
 /// Cache pileup vertex information into  fTPCVertexInfo
 /// \param entry
@@ -952,12 +1003,19 @@ Int_t AliESDtools::FillMCCounters() {
 
 
 /// DumpEvent variables ito the tree
+/// Event variables are streamed to the TTreeSRedirector or to the AliTreeSRedirectorColumnar set by SetStreamer
 /// \return
 Int_t AliESDtools::DumpEventVariables() {
-  if (fStreamer== nullptr) {
-    ::Error("AliESDtools::DumpEventVariable","Streamer not set");
-    return 0;
-  }
+  if (fStreamer) return StreamEventVariables(*fStreamer);
+  if (fStreamerColumnar) return StreamEventVariables(*fStreamerColumnar);
+  ::Error("AliESDtools::DumpEventVariable","Streamer not set");
+  return 0;
+}
+
+/// Stream event variables - the same branches are written by both redirector types
+/// \param streamer - TTreeSRedirector or AliTreeSRedirectorColumnar
+/// \return
+template <class TRedirector> Int_t AliESDtools::StreamEventVariables(TRedirector &streamer) {
   Int_t tpcClusterMultiplicity   = fEvent->GetNumberOfTPCClusters();
   Int_t tpcTrackBeforeClean=fEvent->GetNTPCTrackBeforeClean();
   const AliMultiplicity *multObj = fEvent->GetMultiplicity();
@@ -1129,7 +1187,7 @@ Int_t AliESDtools::DumpEventVariables() {
   }
 
   // dump event variables into tree
-  (*fStreamer)<<"events"<<
+  streamer<<"events"<<
                      "run="                  << runNumber             <<  // run Number
                      "intrate="              << intrate               <<  // run Number
                      "bField="               << bField                <<  // b field
@@ -1196,11 +1254,11 @@ Int_t AliESDtools::DumpEventVariables() {
                      "nTOFmatches="<<nTOFmatches<<
                      "nCaloClusters="<<nCaloClusters;                     // calorimeter multiplicity estimators
 
-                     if (fMCEvent) (*fStreamer)<<"events"<<
+                     if (fMCEvent) streamer<<"events"<<
                       "hist2DMCCounter.="      << fHist2DMCCounter<<           // 2D MC Phi x tgl histogram
                       "hist2DMCSumPt.="        << fHist2DMCSumPt<<            // 2D MC Phi x tgl sum pt histogram
                       "eventInfoMC.="          << eventInfoMC;                // event informatiion matrix colums= (x,y,z,time entries), rows (generators)
-                     (*fStreamer)<<"events"<<
+                     streamer<<"events"<<
                      "\n";
   if ( eventInfoMC) delete eventInfoMC;
   return 0;
@@ -1330,6 +1388,17 @@ Int_t AliESDtools::SetDefaultAliases(TTree* tree) {
   return 1;
 }
 
+/// Stream one TOF cluster - the same branches are written by both redirector types
+/// \param streamer - TTreeSRedirector or AliTreeSRedirectorColumnar
+template <class TRedirector> void AliESDtools::StreamTOFCluster(TRedirector &streamer, Double_t x, Double_t y, Double_t z, AliESDTOFHit *hit){
+  streamer<<"TOFcl"<<
+    "x="<<x<<
+    "y="<<y<<
+    "z="<<z<<
+    "hit.="<<hit<<
+    "\n";
+}
+
 /// cache TOF information for the mutplicity
 Int_t  AliESDtools::CacheTOFEventInformation(Bool_t dumpStreamer){
   if (fEvent== nullptr) return 0;
@@ -1344,13 +1413,8 @@ Int_t  AliESDtools::CacheTOFEventInformation(Bool_t dumpStreamer){
     x=AliTOFGeometry::GetX(ind);
     y=AliTOFGeometry::GetY(ind);
     z=AliTOFGeometry::GetY(ind);
-    if (dumpStreamer)
-      (*fStreamer)<<"TOFcl"<<
-        "x="<<x<<
-        "y="<<y<<
-        "z="<<z<<
-        "hit.="<<hit<<
-        "\n";
+    if (dumpStreamer && fStreamer) StreamTOFCluster(*fStreamer,x,y,z,hit);
+    if (dumpStreamer && fStreamerColumnar) StreamTOFCluster(*fStreamerColumnar,x,y,z,hit);
   }
 }
 
@@ -3,12 +3,14 @@
 
 class AliPIDResponse;
 class TTreeSRedirector;
+class AliTreeSRedirectorColumnar;
 class TTreeStream;
 class TTree;
 class TGraph;
 class TH1F;
 class AliExternalTrackParam;
 class AliESDEvent;
+class AliESDTOFHit;
 class AliESDfriend;
 class AliTriggerAnalysis;
 class AliMCEvent;
@@ -17,9 +19,11 @@ class AliMCEvent;
 
 class AliESDtools : public TNamed {
   public:
+  enum ECacheType { kTrackCounters=0, kTrackTPCCountersZ=1, kTrackdEdxRatio=2, kTrackNcl=3, kTrackChi2=4, kTrackMatchEff=5, kVertexInfo=6, kNCacheTypes=7 };
   AliESDtools();
   void Init(TTree* tree, AliESDEvent *event= nullptr);
-  void SetStreamer(TTreeSRedirector *streamer){fStreamer=streamer;}
+  void SetStreamer(TTreeSRedirector *streamer){fStreamer=streamer; fStreamerColumnar=nullptr;}
+  void SetStreamer(AliTreeSRedirectorColumnar *streamer){fStreamerColumnar=streamer; fStreamer=nullptr;}
   static Double_t LoadESD(Int_t entry, Int_t verbose=0);
   void SetMCEvent(AliMCEvent*event){fMCEvent=event;}
   Bool_t IsPileup(Int_t index);
@@ -48,6 +52,9 @@ class AliESDtools : public TNamed {
   static Double_t GetMeanHisTPCVertexA(){return fgInstance->fHisTPCVertexA->GetMean();}
   static Double_t GetMeanHisTPCVertexC(){return fgInstance->fHisTPCVertexC->GetMean();}
   static Double_t GetVertexInfo(Int_t index){return (*fgInstance->fTPCVertexInfo)[index];}
+  // array interface - cached vectors and event variables for a range of entries evaluated at once
+  static const TVectorF *GetCacheVector(Int_t cacheType);
+  static Int_t    SCalculateEventVariablesN(Long64_t firstEntry, Int_t nEntries, Int_t nValues, const Int_t *cacheType, const Int_t *index, Float_t *result);
   static Int_t SetDefaultAliases(TTree* tree);
   static Double_t SCachePileupVertexTPC(Int_t entry, Int_t doReset, Int_t verbose=0){ return fgInstance->CachePileupVertexTPC(entry, doReset, verbose);}
   static Double_t SCacheITSVertexInformation(Bool_t doReset=1, Double_t dcaCut=0.05, Double_t dcaZcut=0.15){ return fgInstance->CacheITSVertexInformation(doReset, dcaCut, dcaZcut);}
@@ -93,8 +100,11 @@ class AliESDtools : public TNamed {
   TGraph           * fLumiGraph;                  // graph for the interaction rate info for a run
   //
   TTreeSRedirector * fStreamer;                  /// streamer
+  AliTreeSRedirectorColumnar * fStreamerColumnar; //! columnar streamer (used instead of fStreamer if set)
   static AliESDtools* fgInstance;                /// instance of the tool -needed in order to use static functions (for TTreeFormula)
   private:
+  template <class TRedirector> Int_t StreamEventVariables(TRedirector &streamer);
+  template <class TRedirector> void StreamTOFCluster(TRedirector &streamer, Double_t x, Double_t y, Double_t z, AliESDTOFHit *hit);
   AliESDtools(AliESDtools&);
   AliESDtools &operator=(const AliESDtools&);
   ClassDef(AliESDtools, 1) 
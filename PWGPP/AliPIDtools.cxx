@@ -6,6 +6,19 @@
 #include "AliESDtrack.h"
 #include "AliPIDtools.h"
 #include "TLeaf.h"
+#include <atomic>
+
+namespace {
+  /// last used PID response of the thread - avoid map look-up for consecutive calls with the same hash
+  struct AliPIDtoolsPin {
+    Int_t              fHash;         /// hash of the pinned PID response
+    UInt_t             fGeneration;   /// value of gPIDGeneration when pinned
+    AliPIDResponse    *fPID;          /// pinned PID response
+    AliTPCPIDResponse *fTPC;          /// pinned TPC PID response
+  };
+  thread_local AliPIDtoolsPin gPinnedPID = {0, 0, NULL, NULL};
+  std::atomic<UInt_t> gPIDGeneration(0);  /// incremented by LoadPID - invalidates the pins of all threads
+}
 
 std::map<Int_t, AliTPCPIDResponse *> AliPIDtools::pidTPC;     /// we should use better hash map
 std::map<Int_t, AliPIDResponse *> AliPIDtools::pidAll;        /// we should use better hash map
@@ -18,6 +31,41 @@ AliTPCPIDResponse& AliPIDtools::GetTPCPID(Int_t hash ) {return pidAll[hash]->Get
 AliITSPIDResponse& AliPIDtools::GetITSPID(Int_t hash ) {return pidAll[hash]->GetITSResponse();}
 AliTOFPIDResponse& AliPIDtools::GetTOFPID(Int_t hash ) {return pidAll[hash]->GetTOFResponse();}
 
+/// Find PID response for hash without inserting into the map. The last used hash is pinned per thread -
+/// consecutive calls with the same hash (typical in TTree formulas) do not search the map
+/// \param hash   - hash value
+/// \return       - PID response or NULL if not registered
+AliPIDResponse* AliPIDtools::FindPID(Int_t hash){
+  const UInt_t generation=gPIDGeneration.load();
+  if (gPinnedPID.fPID!=NULL && gPinnedPID.fHash==hash && gPinnedPID.fGeneration==generation) return gPinnedPID.fPID;
+  AliTPCPIDResponse *tpcPID=NULL;
+  AliPIDResponse *pid=ResolvePID(hash,tpcPID);
+  if (pid==NULL) return NULL;
+  gPinnedPID.fHash=hash;
+  gPinnedPID.fGeneration=generation;
+  gPinnedPID.fPID=pid;
+  gPinnedPID.fTPC=tpcPID;
+  return pid;
+}
+
+AliTPCPIDResponse* AliPIDtools::FindTPCPID(Int_t hash){
+  return FindPID(hash) ? gPinnedPID.fTPC : NULL;
+}
+
+/// Look-up of the PID response for hash in the maps, without pinning.
+/// Used by the array functions - the response is resolved once per call
+/// \param hash   - hash value
+/// \param tpcPID - TPC PID response (NULL if not registered)
+/// \return       - PID response or NULL if not registered
+AliPIDResponse* AliPIDtools::ResolvePID(Int_t hash, AliTPCPIDResponse *&tpcPID){
+  tpcPID=NULL;
+  std::map<Int_t, AliPIDResponse *>::const_iterator it=pidAll.find(hash);
+  if (it==pidAll.end() || it->second==NULL) return NULL;
+  std::map<Int_t, AliTPCPIDResponse *>::const_iterator itTPC=pidTPC.find(hash);
+  if (itTPC!=pidTPC.end()) tpcPID=itTPC->second;
+  return it->second;
+}
+
 Int_t AliPIDtools::GetHash(Int_t run, Int_t passNumber, TString recoPass,Bool_t isMC){
   recoPass+=run;
   recoPass+=passNumber;
@@ -26,12 +74,12 @@ Int_t AliPIDtools::GetHash(Int_t run, Int_t passNumber, TString recoPass,Bool_t
 }
 
 Double_t AliPIDtools::BetheBlochAleph(Int_t hash, Double_t bg){
-  AliTPCPIDResponse *tpcPID=pidTPC[hash];
+  AliTPCPIDResponse *tpcPID=FindTPCPID(hash);
   if (tpcPID) return tpcPID->Bethe(bg);
   return 0;
 }
 Double_t AliPIDtools::BetheBlochAleph(Int_t hash, Double_t p,Int_t type){
-  AliTPCPIDResponse *tpcPID=pidTPC[hash];
+  AliTPCPIDResponse *tpcPID=FindTPCPID(hash);
   Float_t bg = p/AliPID::ParticleMass(type);
   if (tpcPID) return tpcPID->Bethe(bg);
   return 0;
@@ -43,9 +91,9 @@ Double_t AliPIDtools::BetheBlochAleph(Int_t hash, Double_t p,Int_t type){
 /// \param mass   - mass
 /// \return
 Double_t AliPIDtools::BetheBlochITS(Int_t hash, Double_t p, Double_t mass){
-  if (pidAll[hash]== nullptr) return 0;
-  AliITSPIDResponse &itsPID=GetITSPID(hash);
-  return itsPID.Bethe(p, mass);
+  AliPIDResponse *pid=FindPID(hash);
+  if (pid== nullptr) return 0;
+  return pid->GetITSResponse().Bethe(p, mass);
 }
 
 /// AliPIDtools::GetExpectedITSSignal(
@@ -53,9 +101,9 @@ Double_t AliPIDtools::BetheBlochITS(Int_t hash, Double_t p, Double_t mass){
 /// \param p      - momentum (where?)
 /// \return
 Double_t AliPIDtools::GetExpectedITSSignal(Int_t hash, Double_t p, Int_t  particle){
-  if (pidAll[hash]== nullptr) return 0;
-  AliITSPIDResponse &itsPID=GetITSPID(hash);
-  return itsPID.Bethe(p, (AliPID::EParticleType)particle);
+  AliPIDResponse *pid=FindPID(hash);
+  if (pid== nullptr) return 0;
+  return pid->GetITSResponse().Bethe(p, (AliPID::EParticleType)particle);
 }
 
 
@@ -68,7 +116,7 @@ Double_t AliPIDtools::GetExpectedTPCSignal(Int_t hash, Double_t p, Int_t  partic
   Double_t xyz[3] = {0., 0., 0.};
   Double_t pxyz[3] = {0, 0., 0.};
   Double_t cv[21] = {0.}; // dummy parameters for dummy tracks
-  AliTPCPIDResponse *tpcPID=pidTPC[hash];
+  AliTPCPIDResponse *tpcPID=FindTPCPID(hash);
   if (tpcPID==0) return 0;
   pxyz[0]=p;
   dummyTrack.Set(xyz, pxyz, cv, 1);
@@ -95,14 +143,15 @@ Int_t AliPIDtools::LoadPID(Int_t run, Int_t passNumber, TString recoPass, Bool_t
   Int_t  hash=GetHash(run,passNumber, recoPass,isMC);
   pidAll[hash]=pid;     /// we should clone them
   pidTPC[hash]=&tpcpid;  ///
+  gPIDGeneration++;       // re-registered - drop pinned responses
   return hash;
 }
 
 Double_t AliPIDtools::GetExpectedTOFSigma(Int_t hash, Float_t mom, Int_t  type){
   Double_t dummyTime=0;
-  if (pidAll[hash]== nullptr) return 0;
-  AliTOFPIDResponse &tofPID=GetTOFPID(hash);
-  return tofPID.GetExpectedSigma(mom,dummyTime,(AliPID::EParticleType)type);
+  AliPIDResponse *pid=FindPID(hash);
+  if (pid== nullptr) return 0;
+  return pid->GetTOFResponse().GetExpectedSigma(mom,dummyTime,(AliPID::EParticleType)type);
 
 }
 Double_t AliPIDtools::GetExpectedTOFSignal(Int_t hash, const AliVTrack *track, Int_t type){
@@ -111,6 +160,90 @@ Double_t AliPIDtools::GetExpectedTOFSignal(Int_t hash, const AliVTrack *track, I
   return tofPID.GetExpectedSignal(track, (AliPID::EParticleType)type);
 }
 
+/// Array version of BetheBlochAleph(hash,bg)
+/// \param hash     - hash value
+/// \param n        - number of values
+/// \param bg       - input array of beta*gamma
+/// \param result   - output array (n values), 0 if hash not registered
+/// \return         - number of values evaluated
+Int_t AliPIDtools::BetheBlochAlephN(Int_t hash, Int_t n, const Double_t *bg, Double_t *result){
+  AliTPCPIDResponse *tpcPID=NULL;
+  ResolvePID(hash,tpcPID);
+  if (tpcPID==NULL) {
+    for (Int_t i=0; i<n; i++) result[i]=0;
+    return 0;
+  }
+  for (Int_t i=0; i<n; i++) result[i]=tpcPID->Bethe(bg[i]);
+  return n;
+}
+
+/// Array version of BetheBlochAleph(hash,p,type)
+/// \param p        - input array of momenta
+/// \param type     - particle type
+Int_t AliPIDtools::BetheBlochAlephN(Int_t hash, Int_t n, const Double_t *p, Int_t type, Double_t *result){
+  AliTPCPIDResponse *tpcPID=NULL;
+  ResolvePID(hash,tpcPID);
+  if (tpcPID==NULL) {
+    for (Int_t i=0; i<n; i++) result[i]=0;
+    return 0;
+  }
+  const Double_t invMass=1./AliPID::ParticleMass(type);
+  for (Int_t i=0; i<n; i++) {
+    Float_t bg = p[i]*invMass;
+    result[i]=tpcPID->Bethe(bg);
+  }
+  return n;
+}
+
+/// Array version of GetExpectedTPCSignal(hash,p,particle)
+/// \param p        - input array of momenta
+/// \param particle - particle type
+Int_t AliPIDtools::GetExpectedTPCSignalN(Int_t hash, Int_t n, const Double_t *p, Int_t particle, Double_t *result){
+  AliTPCPIDResponse *tpcPID=NULL;
+  ResolvePID(hash,tpcPID);
+  if (tpcPID==NULL) {
+    for (Int_t i=0; i<n; i++) result[i]=0;
+    return 0;
+  }
+  Double_t xyz[3] = {0., 0., 0.};
+  Double_t pxyz[3] = {0, 0., 0.};
+  Double_t cv[21] = {0.}; // dummy parameters for dummy tracks
+  AliESDtrack track;      // one dummy track per call instead of the shared dummyTrack
+  for (Int_t i=0; i<n; i++) {
+    pxyz[0]=p[i];
+    track.Set(xyz, pxyz, cv, 1);
+    result[i] = tpcPID->GetExpectedSignal(&track, (AliPID::EParticleType)particle, AliTPCPIDResponse::kdEdxDefault, kFALSE, kTRUE);
+  }
+  return n;
+}
+
+/// Array version of GetExpectedITSSignal(hash,p,particle)
+Int_t AliPIDtools::GetExpectedITSSignalN(Int_t hash, Int_t n, const Double_t *p, Int_t particle, Double_t *result){
+  AliTPCPIDResponse *tpcPID=NULL;
+  AliPIDResponse *pid=ResolvePID(hash,tpcPID);
+  if (pid==NULL) {
+    for (Int_t i=0; i<n; i++) result[i]=0;
+    return 0;
+  }
+  AliITSPIDResponse &itsPID=pid->GetITSResponse();
+  for (Int_t i=0; i<n; i++) result[i]=itsPID.Bethe(p[i], (AliPID::EParticleType)particle);
+  return n;
+}
+
+/// Array version of GetExpectedTOFSigma(hash,mom,type)
+Int_t AliPIDtools::GetExpectedTOFSigmaN(Int_t hash, Int_t n, const Float_t *mom, Int_t type, Double_t *result){
+  AliTPCPIDResponse *tpcPID=NULL;
+  AliPIDResponse *pid=ResolvePID(hash,tpcPID);
+  if (pid==NULL) {
+    for (Int_t i=0; i<n; i++) result[i]=0;
+    return 0;
+  }
+  Double_t dummyTime=0;
+  AliTOFPIDResponse &tofPID=pid->GetTOFResponse();
+  for (Int_t i=0; i<n; i++) result[i]=tofPID.GetExpectedSigma(mom[i],dummyTime,(AliPID::EParticleType)type);
+  return n;
+}
+
 ///  SetFiltered tree
 /// \param filteredTree   - pointer to filtered tree
 /// \return
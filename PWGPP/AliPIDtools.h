@@ -21,6 +21,15 @@
 /// #### Example 3: Draw Expected dEdx
 /// AliPIDtools::SetFilteredTreeV0(treeV0)
 /// treeV0->Draw("log(track0.fTPCsignal/(AliPIDtools::GetExpectedTPCSignalV0(pidHash,0,0x1,0)))","type==1&&abs(log(track1.fTPCsignal/(AliPIDtools::GetExpectedTPCSignalV0(pidHash,0,0x1,1))))<0.1","colz",20000)
+/// #### Example 4: array functions - n values evaluated in one call, PID parameters resolved once per call
+/// The array functions need a collection per entry (RVec column in RDataFrame, here "p" - momenta of the tracks of an event).
+/// A per-entry scalar, e.g. esdTrack.fIp.P() in the highPt tree, is evaluated with the scalar functions.
+/// \code
+///  auto dfBB = df.Define("bbPion",[hash](const ROOT::VecOps::RVec<Double_t> &p){
+///    ROOT::VecOps::RVec<Double_t> bb(p.size()); AliPIDtools::BetheBlochAlephN(hash,p.size(),p.data(),AliPID::kPion,bb.data()); return bb;},{"p"});
+///  ROOT::RDataFrame dfHighPt("highPt",fileName);
+///  auto dfHighPtBB = dfHighPt.Define("bbPion",Form("AliPIDtools::BetheBlochAleph(%d,esdTrack.fIp.P()/0.13957)",hash));
+/// \endcode
 
 #include "map"
 #include  "AliESDtrack.h"
@@ -48,6 +57,12 @@ public:
   static Double_t GetExpectedITSSignal(Int_t hash, Double_t p, Int_t  particle);
   static Double_t GetExpectedTOFSigma(Int_t hash, Float_t mom, Int_t type);
   static Double_t GetExpectedTOFSignal(Int_t hash, const AliVTrack *track, Int_t  type);
+  // array interface - n values evaluated with the PID response resolved once, return number of values filled (0 - unknown hash)
+  static Int_t BetheBlochAlephN(Int_t hash, Int_t n, const Double_t *bg, Double_t *result);
+  static Int_t BetheBlochAlephN(Int_t hash, Int_t n, const Double_t *p, Int_t type, Double_t *result);
+  static Int_t GetExpectedTPCSignalN(Int_t hash, Int_t n, const Double_t *p, Int_t particle, Double_t *result);
+  static Int_t GetExpectedITSSignalN(Int_t hash, Int_t n, const Double_t *p, Int_t particle, Double_t *result);
+  static Int_t GetExpectedTOFSigmaN(Int_t hash, Int_t n, const Float_t *mom, Int_t type, Double_t *result);
   // TTree interface
   static AliESDtrack* GetCurrentTrack();
   static AliESDtrack* GetCurrentTrackV0(Int_t index);
@@ -84,6 +99,9 @@ public:
   static TTree *       fFilteredTreeV0;  /// pointer to filteredTree V0
   static void UnitTest();                       /// unit test of invariants
 private:
+  static AliPIDResponse *FindPID(Int_t hash);
+  static AliTPCPIDResponse *FindTPCPID(Int_t hash);
+  static AliPIDResponse *ResolvePID(Int_t hash, AliTPCPIDResponse *&tpcPID);
   static AliESDtrack  dummyTrack;     /// dummy value to save CPU - unfortunately PID object use AliVtrack - for the moment create global varaible t avoid object constructions
 
 };
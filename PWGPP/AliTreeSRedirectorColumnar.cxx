@@ -0,0 +1,459 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/*
+  Columnar backend for the TTreeSRedirector "<<" streaming syntax - see header for details
+  Example usage:
+  \code
+    AliTreeSRedirectorColumnar *pcstream = new AliTreeSRedirectorColumnar("test.root","recreate");
+    pcstream->AddFlattenClass("AliExternalTrackParam");    // optional - primitive columns for track parameters
+    pcstream->SetParallelCompression(kTRUE);                // optional - parallel basket compression, if ROOT::EnableImplicitMT was called
+    AliExternalTrackParam param;
+    for (Int_t i=0; i<1000; i++){
+      Double_t x=i;
+      (*pcstream)<<"test"<<"x="<<x<<"param.="<<&param<<"\n";
+    }
+    delete pcstream;
+    // the tree can be queried as the TTreeSRedirector tree: test->Draw("param.fP[4]:x");
+  \endcode
+*/
+
+#include <cstring>
+#include "RConfigure.h"
+#include "TClass.h"
+#include "TDataMember.h"
+#include "TDataType.h"
+#include "TDirectory.h"
+#include "TFile.h"
+#include "TObjArray.h"
+#include "TObjString.h"
+#include "TRealData.h"
+#include "TROOT.h"
+#include "TTree.h"
+#include "AliTreeSRedirectorColumnar.h"
+
+ClassImp(AliTreeStreamColumnar)
+ClassImp(AliTreeSRedirectorColumnar)
+
+/// Data element of the stream layout. The element owns the column buffer the branches point to.
+class AliTreeStreamColumnarElement {
+public:
+  struct Column {
+    Int_t fSource;       // offset of the data member in the object
+    Int_t fTarget;       // offset in the column buffer
+    Int_t fSize;         // size in bytes
+  };
+  AliTreeStreamColumnarElement(): fName(), fType(0), fSize(0), fClass(NULL), fPointer(NULL), fFlat(kFALSE), fColumns(), fBuffer(1,0) {}
+  char *Buffer() { return reinterpret_cast<char*>(&fBuffer[0]); }
+  TString  fName;                  // branch name
+  Char_t   fType;                  // leaf type of basic types, 0 for objects
+  Int_t    fSize;                  // size of the basic type
+  TClass  *fClass;                 // class of objects
+  void    *fPointer;               // address of the value (object) for the current entry
+  Bool_t   fFlat;                  // object streamed as primitive columns
+  std::vector<Column>   fColumns;  // columns of the flattened object
+  std::vector<Long64_t> fBuffer;   // column buffer (8 byte aligned)
+};
+
+namespace {
+  /// leaf type code for the basic data type, 0 if not supported
+  Char_t LeafCode(Int_t type){
+    switch (type) {
+      case kChar_t:     return 'B';
+      case kchar:       return 'B';
+      case kUChar_t:    return 'b';
+      case kShort_t:    return 'S';
+      case kUShort_t:   return 's';
+      case kInt_t:      return 'I';
+      case kUInt_t:     return 'i';
+      case kBits:       return 'i';
+      case kLong_t:     return sizeof(Long_t)==8 ? 'L':'I';
+      case kULong_t:    return sizeof(ULong_t)==8 ? 'l':'i';
+      case kLong64_t:   return 'L';
+      case kULong64_t:  return 'l';
+      case kFloat_t:    return 'F';
+      case kFloat16_t:  return 'F';
+      case kDouble_t:   return 'D';
+      case kDouble32_t: return 'D';
+      case kBool_t:     return 'O';
+      default:          return 0;
+    }
+  }
+}
+
+//_____________________________________________________________________________
+AliTreeStreamColumnar::AliTreeStreamColumnar(const char *treename, TTree *externalTree):
+  TNamed(treename,treename),
+  fElements(),
+  fNBranched(0),
+  fTree(externalTree),
+  fCurrentIndex(0),
+  fNextName(),
+  fNextNameCounter(0),
+  fStatus(0),
+  fFlattenClasses(),
+  fParallelCompression(kFALSE)
+{
+  /// Constructor - the tree is created in the current directory
+  if (!fTree) fTree = new TTree(treename, treename);
+}
+
+//_____________________________________________________________________________
+AliTreeStreamColumnar::~AliTreeStreamColumnar()
+{
+  /// Destructor - the tree belongs to the directory
+  for (size_t i=0; i<fElements.size(); i++) delete fElements[i];
+  fElements.clear();
+}
+
+//_____________________________________________________________________________
+AliTreeStreamColumnarElement *AliTreeStreamColumnar::NextElement()
+{
+  /// append new element to the layout, name defined by the last "name=" token
+  AliTreeStreamColumnarElement *element = new AliTreeStreamColumnarElement;
+  if (fNextName.Length()>0) {
+    if (fNextNameCounter==0) element->fName = fNextName;
+    else element->fName.Form("%s%d", fNextName.Data(), fNextNameCounter);
+    fNextNameCounter++;
+  } else {
+    element->fName.Form("B%d.", fCurrentIndex);
+  }
+  fElements.push_back(element);
+  return element;
+}
+
+//_____________________________________________________________________________
+Int_t AliTreeStreamColumnar::CheckIn(Char_t type, void *pointer, Int_t size)
+{
+  /// register basic type value for the current entry
+  /// \return 0 - OK, 1 - type does not match the layout
+  if (fCurrentIndex>=Int_t(fElements.size())) {
+    AliTreeStreamColumnarElement *element = NextElement();
+    element->fType = type;
+    element->fSize = size;
+    element->fPointer = pointer;
+    fCurrentIndex++;
+    return 0;
+  }
+  AliTreeStreamColumnarElement *element = fElements[fCurrentIndex];
+  if (element->fType!=type) {
+    fStatus++;
+    return 1;
+  }
+  element->fPointer = pointer;
+  fCurrentIndex++;
+  return 0;
+}
+
+//_____________________________________________________________________________
+Int_t AliTreeStreamColumnar::CheckIn(TClass *cl, void *pointer)
+{
+  /// register object for the current entry
+  /// \return 0 - OK, 1 - class does not match the layout
+  if (fCurrentIndex>=Int_t(fElements.size())) {
+    AliTreeStreamColumnarElement *element = NextElement();
+    element->fClass = cl;
+    element->fPointer = pointer;
+    fCurrentIndex++;
+    return 0;
+  }
+  AliTreeStreamColumnarElement *element = fElements[fCurrentIndex];
+  if (element->fType || (cl && element->fClass && element->fClass!=cl)) {
+    fStatus++;
+    return 1;
+  }
+  if (!element->fClass) element->fClass = cl;
+  element->fPointer = pointer;
+  fCurrentIndex++;
+  return 0;
+}
+
+//_____________________________________________________________________________
+AliTreeStreamColumnar &AliTreeStreamColumnar::operator<<(const Char_t *name)
+{
+  /// "\n" - fill the entry, "name=" - name of the next element
+  /// Names are used only to define the layout - once the tree has entries they are ignored (as in TTreeStream)
+  if (name[0]=='\n') return Endl();
+  if (fTree && fTree->GetEntries()>0) return *this;
+  Int_t last = strlen(name);
+  if (last>0 && name[last-1]=='=') {
+    fNextName = name;
+    fNextName.Remove(last-1);
+    fNextNameCounter = 0;
+  }
+  return *this;
+}
+
+//_____________________________________________________________________________
+AliTreeStreamColumnar &AliTreeStreamColumnar::Endl()
+{
+  /// fill the entry and start the next one
+  Fill();
+  fCurrentIndex = 0;
+  return *this;
+}
+
+//_____________________________________________________________________________
+Bool_t AliTreeStreamColumnar::IsFlatten(TClass *cl) const
+{
+  /// true if objects of the class are streamed as primitive columns
+  if (!cl || fFlattenClasses.IsNull()) return kFALSE;
+  TObjArray *classes = fFlattenClasses.Tokenize(";");
+  Bool_t flatten = kFALSE;
+  for (Int_t i=0; i<classes->GetEntriesFast() && !flatten; i++) {
+    flatten = cl->InheritsFrom(((TObjString*)classes->At(i))->GetName());
+  }
+  delete classes;
+  return flatten;
+}
+
+//_____________________________________________________________________________
+void AliTreeStreamColumnar::BuildFlatBranches(AliTreeStreamColumnarElement *element)
+{
+  /// one branch per persistent basic data member (arrays of fixed size included), named <element>.<member>
+  TClass *cl = element->fClass;
+  if (!cl->GetListOfRealData()) cl->BuildRealData();
+  TString prefix = element->fName;
+  if (!prefix.EndsWith(".")) prefix += ".";
+  std::vector<TString> names, leaves;
+  Int_t nbytes = 0;
+  TIter next(cl->GetListOfRealData());
+  TRealData *rd = NULL;
+  while ((rd = (TRealData*)next())) {
+    TDataMember *dm = rd->GetDataMember();
+    if (!dm || !dm->IsPersistent() || !dm->IsBasic() || dm->IsaPointer()) continue;
+    TDataType *dt = dm->GetDataType();
+    Char_t code = dt ? LeafCode(dt->GetType()) : 0;
+    if (!code) continue;
+    TString leaf = dm->GetName();
+    Int_t length = 1;
+    for (Int_t dim=0; dim<dm->GetArrayDim(); dim++) {
+      length *= dm->GetMaxIndex(dim);
+      leaf += TString::Format("[%d]", dm->GetMaxIndex(dim));
+    }
+    TString name = rd->GetName();
+    if (name.Index("[")>=0) name.Remove(name.Index("["));
+    AliTreeStreamColumnarElement::Column column;
+    column.fSource = rd->GetThisOffset();
+    column.fTarget = nbytes;
+    column.fSize = length*dt->Size();
+    nbytes += 8*((column.fSize+7)/8);
+    element->fColumns.push_back(column);
+    names.push_back(prefix+name);
+    leaves.push_back(TString::Format("%s/%c", leaf.Data(), code));
+  }
+  element->fBuffer.assign(nbytes/8+1, 0);
+  for (size_t i=0; i<element->fColumns.size(); i++) {
+    fTree->Branch(names[i], element->Buffer()+element->fColumns[i].fTarget, leaves[i]);
+  }
+  element->fFlat = kTRUE;
+}
+
+//_____________________________________________________________________________
+void AliTreeStreamColumnar::BuildTree()
+{
+  /// create branches for the elements appended since the last call
+  /// Branch addresses point to the element buffers (basic types, flattened objects) or
+  /// to the element object pointer - they are never reset in Fill()
+  if (!fTree) fTree = new TTree(GetName(), GetName());
+  for (Int_t i=fNBranched; i<Int_t(fElements.size()); i++) {
+    AliTreeStreamColumnarElement *element = fElements[i];
+    TString bname = element->fName;
+    if (bname.IsNull()) bname.Form("B%d", i);
+    if (element->fType) {
+      fTree->Branch(bname, element->Buffer(), TString::Format("%s/%c", bname.Data(), element->fType));
+    } else if (element->fClass) {
+      if (IsFlatten(element->fClass)) BuildFlatBranches(element);
+      else fTree->Branch(bname, element->fClass->GetName(), &(element->fPointer));
+    }
+  }
+  fNBranched = fElements.size();
+#ifdef R__USE_IMT
+  fTree->SetImplicitMT(fParallelCompression);
+#endif
+}
+
+//_____________________________________________________________________________
+void AliTreeStreamColumnar::Fill()
+{
+  /// copy the values of the current entry into the column buffers and fill the tree
+  /// The entry is not filled in case of a layout conflict
+  if (!fTree) return;
+  if (Int_t(fElements.size())>fNBranched) BuildTree();
+  for (Int_t i=0; i<fNBranched; i++) {
+    AliTreeStreamColumnarElement *element = fElements[i];
+    if (element->fType) {
+      if (element->fPointer) memcpy(element->Buffer(), element->fPointer, element->fSize);
+      continue;
+    }
+    if (!element->fFlat) continue;
+    char *buffer = element->Buffer();
+    const char *object = static_cast<const char*>(element->fPointer);
+    if (!object) {
+      memset(buffer, 0, element->fBuffer.size()*sizeof(Long64_t));
+      continue;
+    }
+    for (size_t j=0; j<element->fColumns.size(); j++) {
+      const AliTreeStreamColumnarElement::Column &column = element->fColumns[j];
+      memcpy(buffer+column.fTarget, object+column.fSource, column.fSize);
+    }
+  }
+  if (fStatus==0) fTree->Fill();
+  fStatus = 0;
+}
+
+//_____________________________________________________________________________
+Double_t AliTreeStreamColumnar::GetSize()
+{
+  /// compressed size of the tree
+  return fTree ? fTree->GetZipBytes() : 0;
+}
+
+//_____________________________________________________________________________
+void AliTreeStreamColumnar::AddFlattenClass(const char *className)
+{
+  /// objects inheriting from className are streamed as primitive columns
+  /// Applies to elements without branches only (layout is fixed at the first fill)
+  if (!fFlattenClasses.IsNull()) fFlattenClasses += ";";
+  fFlattenClasses += className;
+}
+
+//_____________________________________________________________________________
+void AliTreeStreamColumnar::SetParallelCompression(Bool_t parallel)
+{
+  /// compress the baskets of the branches in parallel when they are flushed
+  fParallelCompression = parallel;
+#ifdef R__USE_IMT
+  if (fTree) fTree->SetImplicitMT(parallel);
+#endif
+}
+
+//_____________________________________________________________________________
+AliTreeSRedirectorColumnar::AliTreeSRedirectorColumnar(const char *fname, const char *option):
+  TObject(),
+  fDirectory(NULL),
+  fDirectoryOwner(kTRUE),
+  fDataLayouts(NULL),
+  fFlattenClasses(),
+  fParallelCompression(kFALSE)
+{
+  /// Constructor - empty fname: trees are created in the current directory
+  TString name(fname);
+  if (!name.IsNull()) {
+    TDirectory *backup = gDirectory;
+    fDirectory = new TFile(fname, option);
+    if (backup) backup->cd();
+  } else {
+    fDirectory = gDirectory;
+    fDirectoryOwner = kFALSE;
+  }
+}
+
+//_____________________________________________________________________________
+AliTreeSRedirectorColumnar::~AliTreeSRedirectorColumnar()
+{
+  /// Destructor - write the trees, close the file if owned
+  Close();
+  if (fDirectoryOwner && fDirectory) {
+    fDirectory->Close();
+    delete fDirectory;
+  }
+  fDirectory = NULL;
+}
+
+//_____________________________________________________________________________
+void AliTreeSRedirectorColumnar::Close()
+{
+  /// write the trees to the directory and delete the streams
+  if (!fDataLayouts) return;
+  TDirectory *backup = gDirectory;
+  if (fDirectory) fDirectory->cd();
+  for (Int_t i=0; i<fDataLayouts->GetEntriesFast(); i++) {
+    AliTreeStreamColumnar *layout = (AliTreeStreamColumnar*)fDataLayouts->At(i);
+    if (layout && layout->fTree) layout->fTree->Write(layout->GetName());
+  }
+  fDataLayouts->Delete();
+  delete fDataLayouts;
+  fDataLayouts = NULL;
+  if (backup) backup->cd();
+}
+
+//_____________________________________________________________________________
+AliTreeStreamColumnar &AliTreeSRedirectorColumnar::operator()(const char *name)
+{
+  /// stream for the tree name, created in the redirector directory at first use
+  if (!fDataLayouts) fDataLayouts = new TObjArray;
+  for (Int_t i=0; i<fDataLayouts->GetEntriesFast(); i++) {
+    AliTreeStreamColumnar *layout = (AliTreeStreamColumnar*)fDataLayouts->UncheckedAt(i);
+    if (strcmp(layout->GetName(), name)==0) return *layout;
+  }
+  TDirectory *backup = gDirectory;
+  if (fDirectory) fDirectory->cd();
+  AliTreeStreamColumnar *layout = new AliTreeStreamColumnar(name);
+  if (!fFlattenClasses.IsNull()) layout->AddFlattenClass(fFlattenClasses);
+  layout->SetParallelCompression(fParallelCompression);
+  fDataLayouts->AddLast(layout);
+  if (backup) backup->cd();
+  return *layout;
+}
+
+//_____________________________________________________________________________
+void AliTreeSRedirectorColumnar::StoreObject(TObject *object)
+{
+  /// write object to the redirector directory
+  TDirectory *backup = gDirectory;
+  if (fDirectory) fDirectory->cd();
+  object->Write();
+  if (backup) backup->cd();
+}
+
+//_____________________________________________________________________________
+TFile *AliTreeSRedirectorColumnar::GetFile()
+{
+  /// file of the output directory
+  return fDirectory ? fDirectory->GetFile() : NULL;
+}
+
+//_____________________________________________________________________________
+void AliTreeSRedirectorColumnar::AddFlattenClass(const char *className)
+{
+  /// objects inheriting from className are streamed as primitive columns "name.fMember"
+  /// in all streams (for the existing streams only elements without branches are affected)
+  if (!fFlattenClasses.IsNull()) fFlattenClasses += ";";
+  fFlattenClasses += className;
+  if (!fDataLayouts) return;
+  for (Int_t i=0; i<fDataLayouts->GetEntriesFast(); i++) {
+    ((AliTreeStreamColumnar*)fDataLayouts->UncheckedAt(i))->AddFlattenClass(className);
+  }
+}
+
+//_____________________________________________________________________________
+void AliTreeSRedirectorColumnar::SetParallelCompression(Bool_t parallel)
+{
+  /// compress the baskets of the trees of this redirector in parallel when they are flushed
+  /// This is a per tree setting: the thread pool is the one of the implicit MT enabled by the
+  /// application (ROOT::EnableImplicitMT), the global state is not changed here
+  fParallelCompression = parallel;
+#ifdef R__USE_IMT
+  if (parallel && !ROOT::IsImplicitMTEnabled()) ::Info("AliTreeSRedirectorColumnar::SetParallelCompression","implicit multi-threading is not enabled, baskets are compressed serially until it is");
+#else
+  if (parallel) ::Warning("AliTreeSRedirectorColumnar::SetParallelCompression","ROOT was built without implicit multi-threading, baskets are compressed serially");
+  fParallelCompression = kFALSE;
+#endif
+  if (!fDataLayouts) return;
+  for (Int_t i=0; i<fDataLayouts->GetEntriesFast(); i++) {
+    ((AliTreeStreamColumnar*)fDataLayouts->UncheckedAt(i))->SetParallelCompression(fParallelCompression);
+  }
+}
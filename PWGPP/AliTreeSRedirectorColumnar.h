@@ -0,0 +1,114 @@
+#ifndef ALITREESREDIRECTORCOLUMNAR_H
+#define ALITREESREDIRECTORCOLUMNAR_H
+
+/// \class AliTreeStreamColumnar
+/// \class AliTreeSRedirectorColumnar
+/// \brief Columnar backend for the TTreeSRedirector streaming syntax
+///
+/// Drop-in replacement of TTreeSRedirector/TTreeStream for the filtering tasks:
+/// \code
+///   AliTreeSRedirectorColumnar *pcstream = new AliTreeSRedirectorColumnar("filtered.root","recreate");
+///   (*pcstream)<<"highPt"<<"pt="<<pt<<"esdTrack.="<<track<<"\n";
+/// \endcode
+/// As in TTreeStream, values are taken by address and read at the time of the "\n" (fill),
+/// the layout (names, types) is defined by the first entry and the tree branches are identical.
+/// Differences:
+///   * the layout is resolved once - each element owns a fixed column buffer, branch addresses
+///     are set when the branch is created and never reset on fill (values are copied into the buffer)
+///   * optional parallel compression of the baskets when they are flushed: per tree, using the
+///     implicit MT enabled by the application (the global thread pool is not changed)
+///   * optional flattening of objects of selected classes (e.g. AliExternalTrackParam) into primitive
+///     columns "name.fX", "name.fP[5]", ... (all persistent basic data members, pointers are skipped)
+///
+/// \author ALICE PWGPP
+
+#include "TNamed.h"
+#include "TString.h"
+#include "TClass.h"
+#include <typeinfo>
+#include <vector>
+
+class TTree;
+class TFile;
+class TDirectory;
+class TObjArray;
+class AliTreeStreamColumnarElement;
+
+class AliTreeStreamColumnar : public TNamed {
+  friend class AliTreeSRedirectorColumnar;
+public:
+  AliTreeStreamColumnar(const char *treename, TTree *externalTree=NULL);
+  virtual ~AliTreeStreamColumnar();
+  void BuildTree();
+  void Fill();
+  Double_t GetSize();
+  AliTreeStreamColumnar &Endl();
+  TTree *GetTree() const { return fTree; }
+  void AddFlattenClass(const char *className);
+  void SetParallelCompression(Bool_t parallel);
+  //
+  // Bool_t is stored as 'B' like in TTreeStream
+  AliTreeStreamColumnar &operator<<(Bool_t    &b){ CheckIn('B',&b,sizeof(b)); return *this; }
+  AliTreeStreamColumnar &operator<<(Char_t    &c){ CheckIn('B',&c,sizeof(c)); return *this; }
+  AliTreeStreamColumnar &operator<<(UChar_t   &c){ CheckIn('b',&c,sizeof(c)); return *this; }
+  AliTreeStreamColumnar &operator<<(Short_t   &h){ CheckIn('S',&h,sizeof(h)); return *this; }
+  AliTreeStreamColumnar &operator<<(UShort_t  &h){ CheckIn('s',&h,sizeof(h)); return *this; }
+  AliTreeStreamColumnar &operator<<(Int_t     &i){ CheckIn('I',&i,sizeof(i)); return *this; }
+  AliTreeStreamColumnar &operator<<(UInt_t    &i){ CheckIn('i',&i,sizeof(i)); return *this; }
+  AliTreeStreamColumnar &operator<<(Long_t    &l){ CheckIn('L',&l,sizeof(l)); return *this; }
+  AliTreeStreamColumnar &operator<<(ULong_t   &l){ CheckIn('l',&l,sizeof(l)); return *this; }
+  AliTreeStreamColumnar &operator<<(Long64_t  &l){ CheckIn('L',&l,sizeof(l)); return *this; }
+  AliTreeStreamColumnar &operator<<(ULong64_t &l){ CheckIn('l',&l,sizeof(l)); return *this; }
+  AliTreeStreamColumnar &operator<<(Float_t   &f){ CheckIn('F',&f,sizeof(f)); return *this; }
+  AliTreeStreamColumnar &operator<<(Double_t  &d){ CheckIn('D',&d,sizeof(d)); return *this; }
+  AliTreeStreamColumnar &operator<<(const Char_t *name);
+  template <class T>
+  AliTreeStreamColumnar &operator<<(T *obj){
+    CheckIn(obj ? TClass::GetClass(typeid(*obj)) : TClass::GetClass(typeid(T)), (void*)obj);
+    return *this;
+  }
+private:
+  AliTreeStreamColumnar(const AliTreeStreamColumnar &stream);
+  AliTreeStreamColumnar &operator=(const AliTreeStreamColumnar &stream);
+  Int_t CheckIn(Char_t type, void *pointer, Int_t size);
+  Int_t CheckIn(TClass *cl, void *pointer);
+  AliTreeStreamColumnarElement *NextElement();
+  Bool_t IsFlatten(TClass *cl) const;
+  void   BuildFlatBranches(AliTreeStreamColumnarElement *element);
+  //
+  std::vector<AliTreeStreamColumnarElement*> fElements; //! data elements in the order of the entry layout
+  Int_t   fNBranched;         //! number of elements with branches
+  TTree  *fTree;              //! data storage
+  Int_t   fCurrentIndex;      //! index of current element
+  TString fNextName;          //! name for next element
+  Int_t   fNextNameCounter;   //! next name counter
+  Int_t   fStatus;            //! status of the layout (>0 - type conflict, entry not filled)
+  TString fFlattenClasses;    //! classes streamed as primitive columns (separated by ;)
+  Bool_t  fParallelCompression; //! compress baskets in parallel (implicit MT)
+  ClassDef(AliTreeStreamColumnar,1)
+};
+
+class AliTreeSRedirectorColumnar : public TObject {
+public:
+  AliTreeSRedirectorColumnar(const char *fname="", const char *option="update");
+  virtual ~AliTreeSRedirectorColumnar();
+  void Close();
+  AliTreeStreamColumnar &operator<<(const char *name){ return (*this)(name); }
+  AliTreeStreamColumnar &operator()(const char *name);
+  void StoreObject(TObject *object);
+  TFile *GetFile();
+  TDirectory *GetDirectory() { return fDirectory; }
+  void AddFlattenClass(const char *className);
+  void SetParallelCompression(Bool_t parallel);
+private:
+  AliTreeSRedirectorColumnar(const AliTreeSRedirectorColumnar &redirector);
+  AliTreeSRedirectorColumnar &operator=(const AliTreeSRedirectorColumnar &redirector);
+  TDirectory *fDirectory;          //! output directory
+  Bool_t      fDirectoryOwner;     //! file was opened by the redirector
+  TObjArray  *fDataLayouts;        //! streams
+  TString     fFlattenClasses;     //! classes streamed as primitive columns (separated by ;)
+  Bool_t      fParallelCompression; //! compress the baskets of the trees in parallel
+  ClassDef(AliTreeSRedirectorColumnar,1)
+};
+
+#endif
@@ -49,6 +49,7 @@
 #pragma link C++ class AliPerformanceTPC+;
 #pragma link C++ class AliPerformanceMC+;
 #pragma link C++ class AliPerformanceMatch+;
+#pragma link C++ class AliPerformanceQAEngine+;
 #pragma link C++ class AliPerformancePtCalib+;
 #pragma link C++ class AliPerformancePtCalibMC+;
 #pragma link C++ class AliPerfAnalyzeInvPt+;
@@ -59,6 +60,8 @@
 #pragma link C++ class std::map<int,AliTPCPIDResponse *>+;
 #pragma link C++ class std::map<int,AliPIDResponse *>+;
 #pragma link C++ class AliESDtools+;
+#pragma link C++ class AliTreeStreamColumnar+;
+#pragma link C++ class AliTreeSRedirectorColumnar+;
 #pragma link C++ class AliIntSpotEstimator+;
 #pragma link C++ class AliAnalysisTaskIPInfo+;
 
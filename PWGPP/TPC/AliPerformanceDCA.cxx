@@ -43,6 +43,7 @@
 #include <TF1.h>
 
 #include "AliPerformanceDCA.h" 
+#include "AliPerformanceEventRecord.h"
 #include "AliVEvent.h"
 #include "AliESDVertex.h"
 #include "AliVVertex.h"
@@ -155,6 +156,18 @@ void AliPerformanceDCA::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
     */
   }
 
+  FillTPCDCA(vTrack);
+
+  //
+  // Fill rec vs MC information
+  //
+  return;
+
+}
+
+//_____________________________________________________________________________
+void AliPerformanceDCA::FillTPCDCA(AliVTrack *const vTrack)
+{
   // get TPC inner params at DCA to prim. vertex 
   const AliExternalTrackParam *etpTrack = vTrack->GetTPCInnerParam();
   if(!etpTrack) return;
@@ -168,12 +181,6 @@ void AliPerformanceDCA::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
  
 Double_t vDCAHisto[5]={dca[0],dca[1],etpTrack->Eta(),etpTrack->Pt(),etpTrack->Phi()};
   fDCAHisto->Fill(vDCAHisto);
-
-  //
-  // Fill rec vs MC information
-  //
-  return;
-
 }
 
 //_____________________________________________________________________________
@@ -254,14 +261,15 @@ return count;
 }
 
 //_____________________________________________________________________________
-void AliPerformanceDCA::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
+Bool_t AliPerformanceDCA::SelectEvent(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
 {
-  // Process comparison information 
+  //
+  // check event input, trigger and vertex
   //
   if(!vEvent) 
   {
     Error("Exec","vEvent not available");
-    return;
+    return kFALSE;
   }
   AliHeader* header = 0;
   AliGenEventHeader* genHeader = 0;
@@ -271,19 +279,19 @@ void AliPerformanceDCA::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
   {
     if(!mcEvent) {
       Error("Exec","mcEvent not available");
-      return;
+      return kFALSE;
     }
     // get MC event header
     header = mcEvent->Header();
     if (!header) {
       Error("Exec","Header not available");
-      return;
+      return kFALSE;
     }
     // get MC vertex
     genHeader = header->GenEventHeader();
     if (!genHeader) {
       Error("Exec","Could not retrieve genHeader from Header");
-      return;
+      return kFALSE;
     }
     genHeader->PrimaryVertex(vtxMC);
   } 
@@ -291,14 +299,14 @@ void AliPerformanceDCA::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
   if(bUseVfriend) {
     if(!vFriendEvent) {
       Error("Exec","vFriend not available");
-      return;
+      return kFALSE;
     }
   }
 
   // trigger
   if(!bUseMC &&GetTriggerClass()) {
     Bool_t isEventTriggered = vEvent->IsTriggerClassFired(GetTriggerClass());
-    if(!isEventTriggered) return; 
+    if(!isEventTriggered) return kFALSE; 
   }
 
   // get event vertex
@@ -312,7 +320,17 @@ void AliPerformanceDCA::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
     // TPC track vertex
     vVertex = vEvent->GetPrimaryVertexTPC();
   }
-  if(vVertex && (vVertex->GetStatus()<=0)) return;
+  if(vVertex && (vVertex->GetStatus()<=0)) return kFALSE;
+
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceDCA::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
+{
+  // Process comparison information 
+  //
+  if(!SelectEvent(mcEvent,vEvent,vFriendEvent,bUseMC,bUseVfriend)) return;
 
   //  Process events
   for (Int_t iTrack = 0; iTrack < vEvent->GetNumberOfTracks(); iTrack++) 
@@ -329,6 +347,56 @@ void AliPerformanceDCA::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
   }
 }
 
+//_____________________________________________________________________________
+AliPerformanceObject* AliPerformanceDCA::CreateWorker() const
+{
+  //
+  // empty copy for parallel processing
+  //
+  AliPerformanceDCA *worker = (AliPerformanceDCA*)Clone();
+  worker->ResetOutputData();
+  return worker;
+}
+
+//_____________________________________________________________________________
+Int_t AliPerformanceDCA::GetRecordMask()
+{
+  // quantities needed from the event record
+  return IsUseTrackVertex() ? AliPerformanceEventRecord::kField : 0;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceDCA::ExecRecord(const AliPerformanceEventRecord &record, AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
+{
+  //
+  // Process comparison information from the common event record (TPC mode)
+  // same as Exec() and ProcessTPC(), the magnetic field at the track
+  // position and the track vertex are taken from the record
+  //
+  if(!record.IsFilled(vEvent) || !IsRecordSupported() || (record.GetMask()&GetRecordMask())!=GetRecordMask()) {
+    Exec(mcEvent,vEvent,vFriendEvent,bUseMC,bUseVfriend);
+    return;
+  }
+  if(!SelectEvent(mcEvent,vEvent,vFriendEvent,bUseMC,bUseVfriend)) return;
+
+  for (Int_t iTrack = 0; iTrack < record.GetNumberOfTracks(); iTrack++)
+  {
+    const AliPerformanceTrackRecord &rec = record.GetTrack(iTrack);
+    AliVTrack *vTrack = rec.fTrack;
+    if(!vTrack) continue;
+    // min. nb. TPC clusters, checked again in FillTPCDCA - skip the propagation
+    if(rec.fTPCNcls<fCutsRC.GetMinNClustersTPC()) continue;
+    if( IsUseTrackVertex() )
+    {
+      // Relate TPC inner params to prim. vertex
+      Double_t b[3] = {rec.fB[0],rec.fB[1],rec.fB[2]};
+      Bool_t isOK = vTrack->RelateToVVertexTPCBxByBz(record.GetVertexTracks(), b, kVeryBig);
+      if(!isOK) continue;
+    }
+    FillTPCDCA(vTrack);
+  }
+}
+
 //_____________________________________________________________________________
 void AliPerformanceDCA::Analyse()
 {
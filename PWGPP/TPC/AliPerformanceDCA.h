@@ -37,6 +37,11 @@ public :
   // Execute analysis
   virtual void Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend);
 
+  // Execute analysis from the common event record (TPC mode only)
+  virtual Bool_t IsRecordSupported() { return GetAnalysisMode() == 0; }
+  virtual Int_t  GetRecordMask();
+  virtual void   ExecRecord(const AliPerformanceEventRecord &record, AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend);
+
   // Merge output objects (needed by PROOF) 
   virtual Long64_t Merge(TCollection* const list);
 
@@ -59,12 +64,18 @@ public :
   // getters
   THnSparse* GetDCAHisto() const {return fDCAHisto;}
 
+  virtual void ResetOutputData() { if(fDCAHisto) fDCAHisto->Reset("ICE"); }
+  virtual AliPerformanceObject* CreateWorker() const;
+
   // Make stat histograms
   TH1F* MakeStat1D(TH2 *hist, Int_t delta1, Int_t type);
   TH2F* MakeStat2D(TH3 *hist, Int_t delta0, Int_t delta1, Int_t type);
 
 private:
 
+  Bool_t SelectEvent(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend);
+  void   FillTPCDCA(AliVTrack *const vTrack);
+
   // DCA histograms
   THnSparseF *fDCAHisto; //-> dca_r:dca_z:eta:pt:phi 
  
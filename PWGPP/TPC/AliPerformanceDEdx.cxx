@@ -47,6 +47,7 @@
 #include "TChain.h"
 
 #include "AliPerformanceDEdx.h"
+#include "AliPerformanceEventRecord.h"
 #include "AliPerformanceTPC.h"
 #include "AliTPCPerformanceSummary.h"
 #include "AliVEvent.h"
@@ -266,7 +267,14 @@ void AliPerformanceDEdx::ProcessInnerTPC(AliMCEvent* const mcev, AliVTrack *cons
     AliExternalTrackParam* innerParam = &innerTrackParams;
 
     if((vTrack->GetStatus()&AliVTrack::kTPCrefit)==0) return; // TPC refit
+    FillInnerTPC(vTrack, innerParam, dca);
     
+    if(!mcev) return;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceDEdx::FillInnerTPC(AliVTrack *const vTrack, const AliExternalTrackParam *innerParam, const Double_t dca[2])
+{
     //
     // select primaries
     //
@@ -306,8 +314,6 @@ void AliPerformanceDEdx::ProcessInnerTPC(AliMCEvent* const mcev, AliVTrack *cons
     Double_t vDeDxHisto[10] = {dedx,phi,y,z,snp,tgl,Double_t(ncls),p,Double_t(TPCSignalN),nClsF};
     if(fUseSparse) fDeDxHisto->Fill(vDeDxHisto);
     else  FilldEdxHisotgram(vDeDxHisto);
-    
-    if(!mcev) return;
 }
 
 //_____________________________________________________________________________
@@ -370,14 +376,15 @@ return count;
 }
 
 //_____________________________________________________________________________
-void AliPerformanceDEdx::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
+Bool_t AliPerformanceDEdx::SelectEvent(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
 {
-  // Process comparison information 
+  //
+  // check event input, trigger and vertex
   //
   if(!vEvent)
   {
       AliDebug(AliLog::kError, "esdEvent not available");
-      return;
+      return kFALSE;
   }
   AliHeader* header = 0;
   AliGenEventHeader* genHeader = 0;
@@ -387,21 +394,21 @@ void AliPerformanceDEdx::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent
   {
     if(!mcEvent) {
       AliDebug(AliLog::kError, "mcEvent not available");
-      return;
+      return kFALSE;
     }
 
     // get MC event header
     header = mcEvent->Header();
     if (!header) {
       AliDebug(AliLog::kError, "Header not available");
-      return;
+      return kFALSE;
     }
 
     // get MC vertex
     genHeader = header->GenEventHeader();
     if (!genHeader) {
       AliDebug(AliLog::kError, "Could not retrieve genHeader from Header");
-      return;
+      return kFALSE;
     }
     genHeader->PrimaryVertex(vtxMC);
 
@@ -411,14 +418,14 @@ void AliPerformanceDEdx::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent
   if(bUseVfriend) {
     if(!vFriendEvent) {
       AliDebug(AliLog::kError, "vFriend not available");
-      return;
+      return kFALSE;
     }
   }
 
   // trigger
   if(!bUseMC && GetTriggerClass()) {
     Bool_t isEventTriggered = vEvent->IsTriggerClassFired(GetTriggerClass());
-    if(!isEventTriggered) return; 
+    if(!isEventTriggered) return kFALSE; 
   }
 
   // get event vertex
@@ -431,12 +438,22 @@ void AliPerformanceDEdx::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent
     // TPC track vertex
     vVertex = vEvent->GetPrimaryVertexTPC();
   }
-  if(vVertex && (vVertex->GetStatus()<=0)) return;
+  if(vVertex && (vVertex->GetStatus()<=0)) return kFALSE;
   if(!vVertex) {
     printf("ERROR: Could not determine primary vertex");
-    return;
+    return kFALSE;
   }
   
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceDEdx::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
+{
+  // Process comparison information 
+  //
+  if(!SelectEvent(mcEvent,vEvent,vFriendEvent,bUseMC,bUseVfriend)) return;
+  
   //  Process events
   for (Int_t iTrack = 0; iTrack < vEvent->GetNumberOfTracks(); iTrack++) 
   {
@@ -456,6 +473,44 @@ void AliPerformanceDEdx::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent
   }
 }
 
+//_____________________________________________________________________________
+Int_t AliPerformanceDEdx::GetRecordMask()
+{
+  // quantities needed from the event record
+  Int_t mask = AliPerformanceEventRecord::kIp;
+  if(IsUseTrackVertex()) mask |= AliPerformanceEventRecord::kDCA;
+  return mask;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceDEdx::ExecRecord(const AliPerformanceEventRecord &record, AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
+{
+  //
+  // Process comparison information from the common event record (inner TPC mode)
+  // same selection as Exec() and ProcessInnerTPC(), inner parameters and
+  // DCA to the track vertex are taken from the record
+  //
+  if(!record.IsFilled(vEvent) || !IsRecordSupported() || (record.GetMask()&GetRecordMask())!=GetRecordMask()) {
+    Exec(mcEvent,vEvent,vFriendEvent,bUseMC,bUseVfriend);
+    return;
+  }
+  if(!SelectEvent(mcEvent,vEvent,vFriendEvent,bUseMC,bUseVfriend)) return;
+
+  for (Int_t iTrack = 0; iTrack < record.GetNumberOfTracks(); iTrack++)
+  {
+    const AliPerformanceTrackRecord &rec = record.GetTrack(iTrack);
+    AliVTrack *vTrack = rec.fTrack;
+    if(!vTrack) continue;
+    if(!rec.HasFlag(AliPerformanceTrackRecord::kTPCrefit)) continue; // TPC refit
+    Double_t dca[2] = {0.,0.};
+    if( IsUseTrackVertex() ) {
+      if(!rec.HasFlag(AliPerformanceTrackRecord::kDCAOK)) continue;
+      dca[0] = rec.fDCA[0]; dca[1] = rec.fDCA[1];
+    }
+    FillInnerTPC(vTrack, &rec.fIp, dca);
+  }
+}
+
 //_____________________________________________________________________________
 void AliPerformanceDEdx::Analyse()
 {
@@ -711,6 +766,46 @@ void AliPerformanceDEdx::ResetOutputData(){
     
 }
 
+//_____________________________________________________________________________
+void AliPerformanceDEdx::ConnectOutputData()
+{
+    //
+    // reconnect the histogram pointers (not streamed) to the histograms in fFolderObj
+    //
+    if(fUseSparse || !fFolderObj) return;
+    h_tpc_dedx_mips_0 = (TH1D*)fFolderObj->FindObject("h_tpc_dedx_mips_0");
+    h_tpc_dedx_mipsele_0 = (TH1D*)fFolderObj->FindObject("h_tpc_dedx_mipsele_0");
+    h_tpc_dedx_mips_c_0_5 = (TH2D*)fFolderObj->FindObject("h_tpc_dedx_mips_c_0_5");
+    h_tpc_dedx_mips_a_0_5 = (TH2D*)fFolderObj->FindObject("h_tpc_dedx_mips_a_0_5");
+    h_tpc_dedx_mips_c_0_1 = (TH2D*)fFolderObj->FindObject("h_tpc_dedx_mips_c_0_1");
+    h_tpc_dedx_mips_a_0_1 = (TH2D*)fFolderObj->FindObject("h_tpc_dedx_mips_a_0_1");
+}
+
+//_____________________________________________________________________________
+AliPerformanceObject* AliPerformanceDEdx::CreateWorker() const
+{
+    //
+    // empty copy for parallel processing
+    //
+    AliPerformanceDEdx *worker = (AliPerformanceDEdx*)Clone();
+    worker->ConnectOutputData();
+    worker->ResetOutputData();
+    return worker;
+}
+
+//_____________________________________________________________________________
+Long64_t AliPerformanceDEdx::MergeWorkers(TCollection* list)
+{
+    //
+    // merge the workers, the global THnSparse merging setting is ignored
+    //
+    Bool_t useMerge = fgUseMergeTHnSparse;
+    fgUseMergeTHnSparse = kFALSE;
+    Long64_t count = AliPerformanceObject::MergeWorkers(list);
+    fgUseMergeTHnSparse = useMerge;
+    return count;
+}
+
 //_____________________________________________________________________________
 TCollection* AliPerformanceDEdx::GetListOfDrawableObjects()
 {
@@ -19,6 +19,7 @@ class AliVEvent;
 class AliVfriendEvent;
 class AliMCEvent;
 class AliVTrack;
+class AliExternalTrackParam;
 class TRootIOCtor;
 
 #include "THnSparse.h"
@@ -37,6 +38,11 @@ public :
   // Execute analysis
     virtual void Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend);
 
+  // Execute analysis from the common event record (inner TPC mode only)
+  virtual Bool_t IsRecordSupported() { return GetAnalysisMode() == 3; }
+  virtual Int_t  GetRecordMask();
+  virtual void   ExecRecord(const AliPerformanceEventRecord &record, AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend);
+
   // Merge output objects (needed by PROOF) 
   virtual Long64_t Merge(TCollection* list);
 
@@ -75,9 +81,15 @@ public :
   TCollection* GetListOfDrawableObjects();
     
   virtual void ResetOutputData();
+  virtual void ConnectOutputData();
+  virtual AliPerformanceObject* CreateWorker() const;
+  virtual Long64_t MergeWorkers(TCollection* list);
 
 private:
 
+  Bool_t SelectEvent(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vFriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend);
+  void   FillInnerTPC(AliVTrack *const vTrack, const AliExternalTrackParam *innerParam, const Double_t dca[2]);
+
   static Bool_t fgMergeTHnSparse;
   static Bool_t fgUseMergeTHnSparse;
   
@@ -0,0 +1,146 @@
+/**************************************************************************
+* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+//------------------------------------------------------------------------------
+// Implementation of the common per-event and per-track record
+// of the performance objects (see AliPerformanceObject::ExecRecord()).
+//------------------------------------------------------------------------------
+
+#include <mutex>
+#include "TMath.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+#include "AliVVertex.h"
+#include "AliTracker.h"
+#include "AliPerformanceEventRecord.h"
+
+namespace {
+  // AliMagF caches the parametrisation of the last evaluated point,
+  // the field is evaluated by one thread at a time
+  std::mutex gFieldMutex;
+}
+
+//_____________________________________________________________________________
+AliPerformanceTrackRecord::AliPerformanceTrackRecord():
+  fTrack(0),
+  fParam(),
+  fInnerTPC(),
+  fInnerTPCDCA(),
+  fIp(),
+  fParamOK(kFALSE),
+  fInnerTPCOK(kFALSE),
+  fIpOK(kFALSE),
+  fTOFBunchCrossing(0),
+  fFlags(0),
+  fTPCNcls(0)
+{
+  // constructor
+  for (Int_t i=0; i<3; i++) { fB[i]=0.; fCov[i]=0.; }
+  fDCA[0]=fDCA[1]=0.;
+}
+
+//_____________________________________________________________________________
+AliPerformanceEventRecord::AliPerformanceEventRecord():
+  fEvent(0),
+  fMask(0),
+  fVertexTracks(0),
+  fVertexTPC(0),
+  fVertexTracksCopy(),
+  fVertexTPCCopy(),
+  fVertexTracksStatus(-1),
+  fVertexTPCStatus(-1),
+  fNTracks(0),
+  fTracks()
+{
+  // constructor
+}
+
+//_____________________________________________________________________________
+void AliPerformanceEventRecord::Fill(AliVEvent *const vEvent, Int_t mask)
+{
+  //
+  // Fill the record for vEvent. The track records are evaluated in the same
+  // way as in the Process methods of the performance objects:
+  // - track and TPC inner parameters (default parameters if not available,
+  //   as the local copies in the Process methods)
+  // - inner parameters (kIp)
+  // - field at the position of the track parameters (kField)
+  // - TPC inner parameters related to the copy of the track vertex
+  //   with the field at the position of the track parameters (kDCA)
+  // - TOF bunch crossing with the event magnetic field (kTOFBunchCrossing)
+  // Only the requested quantities are evaluated, the others are reset.
+  // The common track cuts (kink daughter, TPC noise signal below 5 as in
+  // AliPerformanceTPC, TPC refit, DCA available) are stored as flags and
+  // the number of TPC clusters is kept for the per-object minimum.
+  //
+  Reset();
+  if(!vEvent) return;
+  fEvent = vEvent;
+  fMask = mask;
+
+  fVertexTracks = vEvent->GetPrimaryVertexTracks();
+  fVertexTPC = vEvent->GetPrimaryVertexTPC();
+  fVertexTracksStatus = vEvent->GetPrimaryVertexTracks(fVertexTracksCopy);
+  fVertexTPCStatus = vEvent->GetPrimaryVertexTPC(fVertexTPCCopy);
+
+  const Double_t bz = vEvent->GetMagneticField();
+  const Bool_t needField = (mask & (kField|kDCA)) != 0;
+  const AliExternalTrackParam defaultParam;
+  fNTracks = vEvent->GetNumberOfTracks();
+  if((Int_t)fTracks.size() < fNTracks) fTracks.resize(fNTracks);
+
+  for (Int_t iTrack = 0; iTrack < fNTracks; iTrack++)
+  {
+    AliPerformanceTrackRecord &rec = fTracks[iTrack];
+    rec.fTrack = dynamic_cast<AliVTrack*>(vEvent->GetTrack(iTrack));
+    rec.fParam = defaultParam;
+    rec.fInnerTPC = defaultParam;
+    rec.fParamOK = rec.fInnerTPCOK = rec.fIpOK = kFALSE;
+    rec.fB[0] = rec.fB[1] = rec.fB[2] = 0.;
+    rec.fDCA[0] = rec.fDCA[1] = 0.;
+    rec.fCov[0] = rec.fCov[1] = rec.fCov[2] = 0.;
+    rec.fTOFBunchCrossing = 0;
+    rec.fFlags = 0;
+    rec.fTPCNcls = 0;
+    if(!rec.fTrack) continue;
+
+    AliVTrack *vTrack = rec.fTrack;
+    if(vTrack->GetKinkIndex(0) > 0) rec.fFlags |= AliPerformanceTrackRecord::kKinkDaughter;
+    if(vTrack->GetTPCsignal() < 5) rec.fFlags |= AliPerformanceTrackRecord::kTPCNoise;
+    if(vTrack->GetStatus()&AliVTrack::kTPCrefit) rec.fFlags |= AliPerformanceTrackRecord::kTPCrefit;
+    rec.fTPCNcls = vTrack->GetTPCNcls();
+    rec.fParamOK = vTrack->GetTrackParam(rec.fParam);
+    rec.fInnerTPCOK = vTrack->GetTrackParamTPCInner(rec.fInnerTPC);
+    if(mask & kIp) {
+      rec.fIp = defaultParam;
+      rec.fIpOK = vTrack->GetTrackParamIp(rec.fIp);
+    }
+
+    if(needField) {
+      Double_t x[3];
+      rec.fParam.GetXYZ(x);
+      std::lock_guard<std::mutex> lock(gFieldMutex);
+      AliTracker::GetBxByBz(x,rec.fB);
+    }
+
+    if(mask & kDCA) {
+      rec.fInnerTPCDCA = rec.fInnerTPC;
+      if(TMath::Abs(rec.fB[2])>0.000001 &&
+         rec.fInnerTPCDCA.RelateToVVertexBxByBzDCA(&fVertexTracksCopy, rec.fB, kVeryBig, NULL, rec.fDCA, rec.fCov))
+        rec.fFlags |= AliPerformanceTrackRecord::kDCAOK;
+    }
+    if(mask & kTOFBunchCrossing) rec.fTOFBunchCrossing = vTrack->GetTOFBunchCrossing(bz);
+  }
+}
@@ -0,0 +1,85 @@
+#ifndef ALIPERFORMANCEEVENTRECORD_H
+#define ALIPERFORMANCEEVENTRECORD_H
+
+//------------------------------------------------------------------------------
+// Common per-event and per-track record for the performance objects.
+// Quantities used by several performance objects (event vertices, track
+// parameters, magnetic field at the track position, TPC inner parameters
+// related to the track vertex, TOF bunch crossing) are evaluated once per
+// event and shared by all objects processed with ExecRecord().
+//------------------------------------------------------------------------------
+
+#include <vector>
+#include "AliExternalTrackParam.h"
+#include "AliESDVertex.h"
+
+class AliVEvent;
+class AliVTrack;
+class AliVVertex;
+
+class AliPerformanceTrackRecord {
+public:
+  // common per-track cut flags, evaluated once in AliPerformanceEventRecord::Fill()
+  enum { kKinkDaughter=0x1, kTPCNoise=0x2, kTPCrefit=0x4, kDCAOK=0x8 };
+
+  AliPerformanceTrackRecord();
+
+  Bool_t HasFlag(UInt_t flag) const { return (fFlags & flag) != 0; }
+
+  AliVTrack *fTrack;                   // track (not owner)
+  AliExternalTrackParam fParam;        // track parameters
+  AliExternalTrackParam fInnerTPC;     // TPC inner parameters
+  AliExternalTrackParam fInnerTPCDCA;  // TPC inner parameters related to the track vertex
+  AliExternalTrackParam fIp;           // inner parameters (kIp)
+  Bool_t   fParamOK;                   // track parameters available
+  Bool_t   fInnerTPCOK;                // TPC inner parameters available
+  Bool_t   fIpOK;                      // inner parameters available
+  Double_t fB[3];                      // magnetic field at the track position (kField)
+  Double_t fDCA[2];                    // DCA of fInnerTPCDCA to the track vertex
+  Double_t fCov[3];                    // DCA covariance
+  Int_t    fTOFBunchCrossing;          // TOF bunch crossing
+  UInt_t   fFlags;                     // common cut flags (kKinkDaughter, kTPCNoise, kTPCrefit, kDCAOK)
+  Int_t    fTPCNcls;                   // number of TPC clusters (for the per-object minimum)
+};
+
+class AliPerformanceEventRecord {
+public:
+  // quantities to be evaluated in addition to the track and TPC inner parameters
+  // (kDCA implies kField)
+  enum { kDCA=0x1, kTOFBunchCrossing=0x2, kField=0x4, kIp=0x8 };
+
+  AliPerformanceEventRecord();
+
+  void Fill(AliVEvent *const vEvent, Int_t mask);
+  void Reset() { fEvent=0; fNTracks=0; }
+
+  Bool_t IsFilled(const AliVEvent *const vEvent) const { return vEvent && fEvent==vEvent; }
+  Int_t  GetMask() const { return fMask; }
+  Int_t  GetNumberOfTracks() const { return fNTracks; }
+  const AliPerformanceTrackRecord &GetTrack(Int_t i) const { return fTracks[i]; }
+
+  // vertices as returned by the AliVEvent getters
+  const AliVVertex *GetVertexTracks() const { return fVertexTracks; }
+  const AliVVertex *GetVertexTPC() const { return fVertexTPC; }
+  const AliESDVertex &GetVertexTracksCopy() const { return fVertexTracksCopy; }
+  const AliESDVertex &GetVertexTPCCopy() const { return fVertexTPCCopy; }
+  Int_t GetVertexTracksStatus() const { return fVertexTracksStatus; }
+  Int_t GetVertexTPCStatus() const { return fVertexTPCStatus; }
+
+private:
+  AliPerformanceEventRecord(const AliPerformanceEventRecord&);
+  AliPerformanceEventRecord& operator=(const AliPerformanceEventRecord&);
+
+  const AliVEvent *fEvent;             // event of the record (not owner)
+  Int_t fMask;                         // evaluated quantities
+  const AliVVertex *fVertexTracks;     // track vertex (not owner)
+  const AliVVertex *fVertexTPC;        // TPC vertex (not owner)
+  AliESDVertex fVertexTracksCopy;      // copy of the track vertex
+  AliESDVertex fVertexTPCCopy;         // copy of the TPC vertex
+  Int_t fVertexTracksStatus;           // return value of GetPrimaryVertexTracks(AliESDVertex&)
+  Int_t fVertexTPCStatus;              // return value of GetPrimaryVertexTPC(AliESDVertex&)
+  Int_t fNTracks;                      // number of tracks in the record
+  std::vector<AliPerformanceTrackRecord> fTracks; // track records, reused between events
+};
+
+#endif
@@ -62,6 +62,7 @@
 #include "AliTRDtrackV1.h" 
 #include "AliTreeDraw.h" 
 #include "AliFlatESDTrack.h"
+#include "AliPerformanceEventRecord.h"
 
 using namespace std;
 
@@ -535,14 +536,15 @@ void AliPerformanceMatch::FillHistograms(AliVTrack *const refParamVTrack, AliVTr
     }
 }
 //_____________________________________________________________________________
-void AliPerformanceMatch::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent */*const vfriendEvent*/, const Bool_t bUseMC, const Bool_t /*bUseVfriend*/)
+Bool_t AliPerformanceMatch::SelectEvent(AliMCEvent* const mcEvent, AliVEvent *const vEvent, const Bool_t bUseMC)
 {
-  // Process comparison information 
+  //
+  // check event input, trigger and event vertex
   //
   if(!vEvent)
   {
     Error("Exec","vEvent not available");
-    return;
+    return kFALSE;
   }
   AliHeader* header = 0;
   AliGenEventHeader* genHeader = 0;
@@ -552,19 +554,19 @@ void AliPerformanceMatch::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEven
   {
     if(!mcEvent) {
       Error("Exec","mcEvent not available");
-      return;
+      return kFALSE;
     }
     // get MC event header
     header = mcEvent->Header();
     if (!header) {
       Error("Exec","Header not available");
-      return;
+      return kFALSE;
     }
     // get MC vertex
     genHeader = header->GenEventHeader();
     if (!genHeader) {
       Error("Exec","Could not retrieve genHeader from Header");
-      return;
+      return kFALSE;
     }
     genHeader->PrimaryVertex(vtxMC);
   } 
@@ -572,13 +574,23 @@ void AliPerformanceMatch::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEven
   // trigger
   if(!bUseMC && GetTriggerClass()) {
     Bool_t isEventTriggered = vEvent->IsTriggerClassFired(GetTriggerClass());
-    if(!isEventTriggered) return; 
+    if(!isEventTriggered) return kFALSE; 
   }
 
   // get TPC event vertex
     AliESDVertex vertex;
     vEvent->GetPrimaryVertex(vertex);
-    if(!(vertex.GetStatus())) return;
+    if(!(vertex.GetStatus())) return kFALSE;
+
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceMatch::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent */*const vfriendEvent*/, const Bool_t bUseMC, const Bool_t /*bUseVfriend*/)
+{
+  // Process comparison information 
+  //
+  if(!SelectEvent(mcEvent,vEvent,bUseMC)) return;
 
   //  Process events
   for (Int_t iTrack = 0; iTrack < vEvent->GetNumberOfTracks(); iTrack++) 
@@ -620,6 +632,38 @@ void AliPerformanceMatch::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEven
 
 }
 
+//_____________________________________________________________________________
+Int_t AliPerformanceMatch::GetRecordMask()
+{
+  // quantities needed from the event record
+  return IsUseTOFBunchCrossing() ? AliPerformanceEventRecord::kTOFBunchCrossing : 0;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceMatch::ExecRecord(const AliPerformanceEventRecord &record, AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vfriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
+{
+  //
+  // Process comparison information from the common event record
+  // (TPCITS and TPC constrain modes), same selection as Exec(),
+  // the TOF bunch crossing is taken from the record
+  //
+  if(!record.IsFilled(vEvent) || !IsRecordSupported() || (record.GetMask()&GetRecordMask())!=GetRecordMask()) {
+    Exec(mcEvent,vEvent,vfriendEvent,bUseMC,bUseVfriend);
+    return;
+  }
+  if(!SelectEvent(mcEvent,vEvent,bUseMC)) return;
+
+  for (Int_t iTrack = 0; iTrack < record.GetNumberOfTracks(); iTrack++)
+  {
+    const AliPerformanceTrackRecord &rec = record.GetTrack(iTrack);
+    AliVTrack *track = rec.fTrack;
+    if(!track) continue;
+    if(IsUseTOFBunchCrossing() && rec.fTOFBunchCrossing!=0) continue;
+    if(GetAnalysisMode() == 0) ProcessTPCITS(mcEvent,vEvent,track);
+    else ProcessTPCConstrain(mcEvent,vEvent,track);
+  }
+}
+
 //_____________________________________________________________________________
 TH1F* AliPerformanceMatch::MakeResol(TH2F * his, Int_t integ, Bool_t type, Int_t cut){
   // Create resolution histograms
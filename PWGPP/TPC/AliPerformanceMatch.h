@@ -42,6 +42,11 @@ public :
   // Execute analysis
   virtual void  Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,AliVfriendEvent *const vfriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend);
 
+  // Execute analysis with the common event record (TPCITS and TPC constrain modes)
+  virtual Bool_t IsRecordSupported() { return GetAnalysisMode() == 0 || GetAnalysisMode() == 2; }
+  virtual Int_t  GetRecordMask();
+  virtual void   ExecRecord(const AliPerformanceEventRecord &record, AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vfriendEvent, const Bool_t bUseMC=kFALSE, const Bool_t bUseVfriend=kFALSE);
+
   // Merge output objects (needed by PROOF) 
   virtual Long64_t Merge(TCollection* list);
 
@@ -91,6 +96,7 @@ public :
   virtual void ResetOutputData();
 
 private:
+  Bool_t SelectEvent(AliMCEvent* const mcEvent, AliVEvent *const vEvent, const Bool_t bUseMC);
 
   static Bool_t fgMergeTHnSparse;
   static Bool_t fgUseMergeTHnSparse;
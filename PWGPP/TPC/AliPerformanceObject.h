@@ -23,6 +23,7 @@ class AliMCInfoCuts;
 class AliVfriendEvent;
 class AliESDVertex;
 class TRootIOCtor;
+class AliPerformanceEventRecord;
 #include "AliRecInfoCuts.h"
 #include "AliMCInfoCuts.h"
 
@@ -44,6 +45,15 @@ public :
   // call in the event loop 
   virtual void Exec(AliMCEvent* const infoMC=0, AliVEvent* const infoRC=0, AliVfriendEvent* const vfriendEvent=0, const Bool_t bUseMC=kFALSE, const Bool_t bUseVfriend=kFALSE) = 0;
 
+  // Execute analysis from the common event record
+  // (filled once per event and shared by all objects, see AliPerformanceQAEngine)
+  // IsRecordSupported() - record can be used in the current configuration,
+  //                       otherwise Exec() is called
+  // GetRecordMask()     - quantities to be evaluated in the record
+  virtual Bool_t IsRecordSupported() { return kFALSE; }
+  virtual Int_t  GetRecordMask() { return 0; }
+  virtual void   ExecRecord(const AliPerformanceEventRecord& /*record*/, AliMCEvent* const infoMC=0, AliVEvent* const infoRC=0, AliVfriendEvent* const vfriendEvent=0, const Bool_t bUseMC=kFALSE, const Bool_t bUseVfriend=kFALSE) { Exec(infoMC,infoRC,vfriendEvent,bUseMC,bUseVfriend); }
+
   // Merge output objects (needed by PROOF) 
   virtual Long64_t Merge(TCollection* list=0) = 0;
 
@@ -117,6 +127,22 @@ public :
   Bool_t IsUseTOFBunchCrossing() { return fUseTOFBunchCrossing; }
 
   virtual void ResetOutputData() { ; }
+
+  // reconnect transient pointers to the output objects (e.g. after Clone() or reading from file)
+  virtual void ConnectOutputData() { ; }
+
+  // empty copy with the same configuration, used to process part of the events
+  // in parallel and merged back with MergeWorkers() - NULL if not supported
+  virtual AliPerformanceObject* CreateWorker() const { return 0; }
+
+  // merge the workers including the THnSparse histograms
+  virtual Long64_t MergeWorkers(TCollection* list) {
+    Bool_t mergeObj = fMergeTHnSparseObj;
+    fMergeTHnSparseObj = kTRUE;
+    Long64_t count = Merge(list);
+    fMergeTHnSparseObj = mergeObj;
+    return count;
+  }
     
 protected: 
 
@@ -0,0 +1,260 @@
+/**************************************************************************
+* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+//------------------------------------------------------------------------------
+// Implementation of the AliPerformanceQAEngine class. It runs a set of
+// performance objects on the same events, sharing the per-track quantities
+// through the common event record (see AliPerformanceEventRecord).
+//------------------------------------------------------------------------------
+
+#include <vector>
+
+#include <RConfigure.h>
+#include "TMath.h"
+#include "TList.h"
+#include "TChain.h"
+#include "TH1.h"
+#include "AliLog.h"
+#include "AliESDEvent.h"
+#include "AliPerformanceObject.h"
+#include "AliPerformanceEventRecord.h"
+#include "AliPerformanceQAEngine.h"
+
+#ifdef R__USE_IMT
+#include "TROOT.h"
+#include <ROOT/TThreadExecutor.hxx>
+#endif
+
+ClassImp(AliPerformanceQAEngine)
+
+//_____________________________________________________________________________
+AliPerformanceQAEngine::AliPerformanceQAEngine(const char *name, const char *title):
+  TNamed(name,title),
+  fObjects(new TList),
+  fRecord(new AliPerformanceEventRecord),
+  fUseRecord(kTRUE),
+  fNThreads(1)
+{
+  // constructor
+}
+
+//_____________________________________________________________________________
+AliPerformanceQAEngine::~AliPerformanceQAEngine()
+{
+  // destructor (the performance objects are not deleted)
+  delete fObjects;
+  delete fRecord;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceQAEngine::AddObject(AliPerformanceObject *pObj)
+{
+  // add performance object to the list
+  if(!pObj) return;
+  fObjects->AddLast(pObj);
+}
+
+//_____________________________________________________________________________
+void AliPerformanceQAEngine::ProcessEvent(AliMCEvent* const mcEvent, AliVEvent* const vEvent, AliVfriendEvent* const vfriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
+{
+  // process one event with all objects
+  if(!fRecord) fRecord = new AliPerformanceEventRecord;
+  ProcessEvent(fObjects,fRecord,fUseRecord,mcEvent,vEvent,vfriendEvent,bUseMC,bUseVfriend);
+}
+
+//_____________________________________________________________________________
+void AliPerformanceQAEngine::ProcessEvent(TCollection *objects, AliPerformanceEventRecord *record, Bool_t useRecord, AliMCEvent* const mcEvent, AliVEvent* const vEvent, AliVfriendEvent* const vfriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
+{
+  //
+  // The record is filled once with the union of the quantities
+  // requested by the objects supporting it
+  //
+  if(!objects) return;
+  TIter next(objects);
+  AliPerformanceObject *pObj = 0;
+
+  Int_t mask = 0;
+  Bool_t fill = kFALSE;
+  if(useRecord && record && vEvent) {
+    while((pObj = (AliPerformanceObject*)next())) {
+      if(!pObj->IsRecordSupported()) continue;
+      mask |= pObj->GetRecordMask();
+      fill = kTRUE;
+    }
+    next.Reset();
+  }
+  if(fill) record->Fill(vEvent,mask);
+  else if(record) record->Reset();
+
+  while((pObj = (AliPerformanceObject*)next())) {
+    if(fill && pObj->IsRecordSupported())
+      pObj->ExecRecord(*record,mcEvent,vEvent,vfriendEvent,bUseMC,bUseVfriend);
+    else
+      pObj->Exec(mcEvent,vEvent,vfriendEvent,bUseMC,bUseVfriend);
+  }
+}
+
+//_____________________________________________________________________________
+Long64_t AliPerformanceQAEngine::ProcessRange(TChain *chain, TCollection *objects, AliPerformanceEventRecord *record, Long64_t first, Long64_t last)
+{
+  //
+  // process events [first, last) of the chain with the objects of the list
+  // chain is owned (deleted at the end)
+  //
+  AliESDEvent *esdEvent = new AliESDEvent;
+  esdEvent->ReadFromTree(chain);
+  Long64_t count = 0;
+  for(Long64_t entry = first; entry < last; entry++) {
+    if(chain->GetEntry(entry) <= 0) continue;
+    esdEvent->ConnectTracks();
+    ProcessEvent(objects,record,fUseRecord,0,esdEvent,0,kFALSE,kFALSE);
+    count++;
+  }
+  delete chain;
+  delete esdEvent;
+  return count;
+}
+
+//_____________________________________________________________________________
+Long64_t AliPerformanceQAEngine::ProcessChain(TChain *chain, Long64_t nEvents, Long64_t first)
+{
+  //
+  // process ESD events [first, first+nEvents) of the chain
+  // (all events from first for nEvents<0)
+  //
+  if(!chain || fObjects->IsEmpty()) return 0;
+  Long64_t nEntries = chain->GetEntries();
+  Long64_t last = (nEvents < 0) ? nEntries : TMath::Min(nEntries,first+nEvents);
+  if(first < 0) first = 0;
+  if(first >= last) return 0;
+  if(!fRecord) fRecord = new AliPerformanceEventRecord;
+
+  // magnetic field from the first event, before the threads are started
+  {
+    TChain *fieldChain = new TChain(chain->GetName());
+    fieldChain->Add(chain);
+    AliESDEvent *esdEvent = new AliESDEvent;
+    esdEvent->ReadFromTree(fieldChain);
+    fieldChain->GetEntry(first);
+    Bool_t fieldOK = esdEvent->InitMagneticField();
+    delete fieldChain;
+    delete esdEvent;
+    if(!fieldOK) {
+      AliError("magnetic field could not be initialised");
+      return 0;
+    }
+  }
+
+  Int_t nThreads = TMath::Max(fNThreads,1);
+  if(nThreads > last-first) nThreads = (Int_t)(last-first);
+#ifndef R__USE_IMT
+  if(nThreads > 1) AliInfo("ROOT was built without implicit multi-threading, events are processed serially");
+  nThreads = 1;
+#else
+  // thread safety is enabled by the steering (ROOT::EnableImplicitMT), not by the library
+  if(nThreads > 1 && !ROOT::IsImplicitMTEnabled()) {
+    AliInfo("implicit multi-threading is not enabled (ROOT::EnableImplicitMT), events are processed serially");
+    nThreads = 1;
+  }
+#endif
+
+  // Exec() evaluates the field without lock, threads only with the record
+  if(nThreads > 1) {
+    TIter next(fObjects);
+    AliPerformanceObject *pObj = 0;
+    while((pObj = (AliPerformanceObject*)next())) {
+      if(fUseRecord && pObj->IsRecordSupported()) continue;
+      AliInfo(Form("%s is not processed with the event record, events are processed serially",pObj->GetName()));
+      nThreads = 1;
+      break;
+    }
+  }
+
+  // thread 0 processes with the objects, the other threads with workers
+  std::vector<TList*> workers(nThreads,fObjects);
+  std::vector<AliPerformanceEventRecord*> records(nThreads,fRecord);
+  Bool_t addDirectory = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  for(Int_t t = 1; t < nThreads; t++) {
+    TList *list = new TList;
+    list->SetOwner();
+    workers[t] = list;
+    records[t] = new AliPerformanceEventRecord;
+    TIter next(fObjects);
+    AliPerformanceObject *pObj = 0;
+    while((pObj = (AliPerformanceObject*)next())) {
+      AliPerformanceObject *worker = pObj->CreateWorker();
+      if(!worker) {
+        AliInfo(Form("%s does not support workers, events are processed serially",pObj->GetName()));
+        nThreads = 1;
+        break;
+      }
+      list->Add(worker);
+    }
+    if(nThreads == 1) break;
+  }
+  TH1::AddDirectory(addDirectory);
+  if(nThreads == 1) {
+    for(size_t t = 1; t < workers.size(); t++) {
+      if(workers[t] != fObjects) delete workers[t];
+      if(records[t] != fRecord) delete records[t];
+    }
+    workers.resize(1);
+    records.resize(1);
+  }
+
+  // consecutive event ranges, one per thread
+  std::vector<Long64_t> counts(nThreads,0);
+  Long64_t rangeSize = (last-first+nThreads-1)/nThreads;
+  auto process = [&](Int_t t)
+  {
+    Long64_t rangeFirst = first+t*rangeSize;
+    Long64_t rangeLast = TMath::Min(last,rangeFirst+rangeSize);
+    if(rangeFirst >= rangeLast) return;
+    TChain *threadChain = new TChain(chain->GetName());
+    threadChain->Add(chain);
+    counts[t] = ProcessRange(threadChain,workers[t],records[t],rangeFirst,rangeLast);
+  };
+#ifdef R__USE_IMT
+  if(nThreads > 1) {
+    ROOT::TThreadExecutor executor(nThreads);
+    executor.Foreach(process,ROOT::TSeqI(nThreads));
+  }
+  else
+#endif
+  {
+    process(0);
+  }
+
+  // merge the workers into the objects
+  Long64_t count = counts[0];
+  if(nThreads > 1) {
+    Int_t index = 0;
+    TIter next(fObjects);
+    AliPerformanceObject *pObj = 0;
+    while((pObj = (AliPerformanceObject*)next())) {
+      TList list;
+      for(Int_t t = 1; t < nThreads; t++) list.Add(workers[t]->At(index));
+      pObj->MergeWorkers(&list);
+      index++;
+    }
+    for(Int_t t = 1; t < nThreads; t++) {
+      count += counts[t];
+      delete workers[t];
+      delete records[t];
+    }
+  }
+  return count;
+}
@@ -0,0 +1,77 @@
+#ifndef ALIPERFORMANCEQAENGINE_H
+#define ALIPERFORMANCEQAENGINE_H
+
+//------------------------------------------------------------------------------
+// Driver of a set of performance objects.
+//
+// ProcessEvent() fills the common event record (AliPerformanceEventRecord)
+// once per event with the union of the quantities requested by the objects
+// and calls ExecRecord() for the objects supporting it, Exec() otherwise.
+//
+// ProcessChain() runs over ESD events of a chain (data only, no MC and friends).
+// With SetNThreads(n>1) and implicit multi-threading enabled by the steering
+// (ROOT::EnableImplicitMT()) the event
+// range is split between n threads, each processing its range with workers
+// (AliPerformanceObject::CreateWorker()) merged back into the objects at the end.
+// The magnetic field is initialised from the first event before the threads
+// are started. The field map is not thread-safe: in the threads it is evaluated
+// only in the event record, serialised by a lock. The chain is processed
+// serially if the record is not used, or if one of the objects does not
+// support the record or does not provide workers.
+//
+// Usage:
+//   ROOT::EnableImplicitMT(4);
+//   AliPerformanceQAEngine engine;
+//   engine.AddObject(pTPC); engine.AddObject(pDEdx); engine.AddObject(pDCA);
+//   engine.SetNThreads(4);
+//   engine.ProcessChain(chain);
+//------------------------------------------------------------------------------
+
+#include "TNamed.h"
+
+class TList;
+class TChain;
+class AliMCEvent;
+class AliVEvent;
+class AliVfriendEvent;
+class AliPerformanceObject;
+class AliPerformanceEventRecord;
+
+class AliPerformanceQAEngine : public TNamed {
+public:
+  AliPerformanceQAEngine(const char *name="AliPerformanceQAEngine", const char *title="AliPerformanceQAEngine");
+  virtual ~AliPerformanceQAEngine();
+
+  // performance objects (not owner)
+  void   AddObject(AliPerformanceObject *pObj);
+  TList *GetObjects() const { return fObjects; }
+
+  void   SetUseRecord(Bool_t useRecord = kTRUE) { fUseRecord = useRecord; }
+  Bool_t GetUseRecord() const { return fUseRecord; }
+  void   SetNThreads(Int_t nThreads) { fNThreads = nThreads; }
+  Int_t  GetNThreads() const { return fNThreads; }
+
+  // process one event with all objects
+  void ProcessEvent(AliMCEvent* const mcEvent, AliVEvent* const vEvent, AliVfriendEvent* const vfriendEvent=0, const Bool_t bUseMC=kFALSE, const Bool_t bUseVfriend=kFALSE);
+
+  // process ESD events [first, first+nEvents) of the chain, returns number of processed events
+  Long64_t ProcessChain(TChain *chain, Long64_t nEvents=-1, Long64_t first=0);
+
+  // process one event with the objects of the list using the given record
+  static void ProcessEvent(TCollection *objects, AliPerformanceEventRecord *record, Bool_t useRecord, AliMCEvent* const mcEvent, AliVEvent* const vEvent, AliVfriendEvent* const vfriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend);
+
+private:
+  AliPerformanceQAEngine(const AliPerformanceQAEngine&); // not implemented
+  AliPerformanceQAEngine& operator=(const AliPerformanceQAEngine&); // not implemented
+
+  Long64_t ProcessRange(TChain *chain, TCollection *objects, AliPerformanceEventRecord *record, Long64_t first, Long64_t last);
+
+  TList *fObjects;                    // performance objects (not owner)
+  AliPerformanceEventRecord *fRecord; //! event record
+  Bool_t fUseRecord;                  // use the event record
+  Int_t  fNThreads;                   // number of threads in ProcessChain()
+
+  ClassDef(AliPerformanceQAEngine,1);
+};
+
+#endif
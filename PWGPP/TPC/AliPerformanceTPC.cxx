@@ -51,6 +51,7 @@
 #include "AliTPCPerformanceSummary.h"
 #include "TSystem.h"
 #include "AliPerformanceTPC.h"
+#include "AliPerformanceEventRecord.h"
 #include "AliVEvent.h" 
 #include "AliVTrack.h"
 #include "AliVVertex.h"
@@ -580,50 +581,47 @@ void AliPerformanceTPC::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
         if(!isOK) return;
     }
   // Fill TPC only resolution comparison information
-  
-    
-    Float_t q = pTrackParams->Charge();
-    Float_t pt = pInnerTPCtrackParams->Pt();
-    Float_t eta = pInnerTPCtrackParams->Eta();
-    Float_t phi = pInnerTPCtrackParams->Phi();
+  // filter out noise tracks
+  if(vTrack->GetTPCsignal() < 5) {
+    return;
+  }
+  FillTrackHisto(vTrack, pTrackParams->Charge(), pInnerTPCtrackParams->Pt(), pInnerTPCtrackParams->Eta(), pInnerTPCtrackParams->Phi(), dca, vertStatus);
+  //
+  // Fill rec vs MC information
+  //
+  if(!mcev) return;
+
+}
+
+
+//_____________________________________________________________________________
+void AliPerformanceTPC::FillTrackHisto(AliVTrack *const vTrack, Float_t q, Float_t pt, Float_t eta, Float_t phi, const Double_t dca[2], Bool_t vertStatus)
+{
+  //
+  // apply the DCA cuts and fill the track histograms
+  // nClust:chi2PerClust:nClust/nFindableClust:DCAr:DCAz:eta:phi:pt:charge:vertStatus
+  //
     UShort_t nClust = vTrack->GetTPCNcls();
     Int_t nFindableClust = vTrack->GetTPCNclsF();
 
-    Float_t chi2PerCluster = 0.;
-    if(nClust>0.) chi2PerCluster = vTrack->GetTPCchi2()/Float_t(nClust);
 
+    Float_t chi2PerCluster = 0;
+    if(nClust>0.) chi2PerCluster = vTrack->GetTPCchi2()/Float_t(nClust);
+  
     Float_t clustPerFindClust = 0.;
     if(nFindableClust>0.) clustPerFindClust = Float_t(nClust)/nFindableClust;
-  
-  Float_t qpt = 0;
-  if( fabs(pt)>0 ) qpt = q/fabs(pt);
-
-  // filter out noise tracks
-  if(vTrack->GetTPCsignal() < 5) {
-    return;
-  }
     
-  // select primaries
-  //
-  Double_t dcaToVertex = -1;
-  if( fCutsRC.GetDCAToVertex2D() ) 
-  {
-    dcaToVertex = TMath::Sqrt(dca[0]*dca[0]/fCutsRC.GetMaxDCAToVertexXY()/fCutsRC.GetMaxDCAToVertexXY() + dca[1]*dca[1]/fCutsRC.GetMaxDCAToVertexZ()/fCutsRC.GetMaxDCAToVertexZ()); 
-  }
-  if(fCutsRC.GetDCAToVertex2D() && dcaToVertex > 1) {
-    return;
-  }
-  if(!fCutsRC.GetDCAToVertex2D() && TMath::Abs(dca[0]) > fCutsRC.GetMaxDCAToVertexXY()) {
-    return;
-  }
-  if(!fCutsRC.GetDCAToVertex2D() && TMath::Abs(dca[1]) > fCutsRC.GetMaxDCAToVertexZ()) {
-    return;
-  }
+    Double_t dcaToVertex = -1;
+    if( fCutsRC.GetDCAToVertex2D() )
+    {
+        dcaToVertex = TMath::Sqrt(dca[0]*dca[0]/fCutsRC.GetMaxDCAToVertexXY()/fCutsRC.GetMaxDCAToVertexXY() + dca[1]*dca[1]/fCutsRC.GetMaxDCAToVertexZ()/fCutsRC.GetMaxDCAToVertexZ());
+    }
+  if(fCutsRC.GetDCAToVertex2D() && dcaToVertex > 1) return;
+  if(!fCutsRC.GetDCAToVertex2D() && TMath::Abs(dca[0]) > fCutsRC.GetMaxDCAToVertexXY()) return;
+  if(!fCutsRC.GetDCAToVertex2D() && TMath::Abs(dca[1]) > fCutsRC.GetMaxDCAToVertexZ()) return;
 
-  //Double_t vTPCTrackHisto[10] = {nClust,chi2PerCluster,clustPerFindClust,dca[0],dca[1],eta,phi,pt,qpt,vertStatus};
   Double_t vTPCTrackHisto[10] = {static_cast<Double_t>(nClust),static_cast<Double_t>(chi2PerCluster),static_cast<Double_t>(clustPerFindClust),static_cast<Double_t>(dca[0]),static_cast<Double_t>(dca[1]),static_cast<Double_t>(eta),static_cast<Double_t>(phi),static_cast<Double_t>(pt),static_cast<Double_t>(q),static_cast<Double_t>(vertStatus)};
-  
-  //nClust:chi2PerClust:nClust/nFindableClust:DCAr:DCAz:eta:phi:pt:charge:vertStatus
+
     fMult++;
     if(q > 0.000001) fMultP++;
     else if(q < 0.000001) fMultN++;
@@ -634,13 +632,13 @@ void AliPerformanceTPC::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
         if(h_tpc_track_all_recvertex_5_8) h_tpc_track_all_recvertex_5_8->Fill(vTPCTrackHisto[5],vTPCTrackHisto[8]);
         if(h_tpc_track_all_recvertex_1_5_7) h_tpc_track_all_recvertex_1_5_7->Fill(vTPCTrackHisto[1],vTPCTrackHisto[5],vTPCTrackHisto[7]);
         if(h_tpc_track_all_recvertex_2_5_7) h_tpc_track_all_recvertex_2_5_7->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-            
+        
         double q = vTPCTrackHisto[8];
-            
+        
         if (h_tpc_track_all_recvertex_0_5_7) h_tpc_track_all_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
         if(q > 0 && h_tpc_track_pos_recvertex_0_5_7) h_tpc_track_pos_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
         else if (h_tpc_track_neg_recvertex_0_5_7) h_tpc_track_neg_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-            
+        
         if(h_tpc_track_all_recvertex_3_5_7) h_tpc_track_all_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
         if(q > 0 && h_tpc_track_pos_recvertex_3_5_7) h_tpc_track_pos_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
         else if(h_tpc_track_neg_recvertex_3_5_7) h_tpc_track_neg_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
@@ -651,19 +649,14 @@ void AliPerformanceTPC::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
         
         if(q > 0 && h_tpc_track_pos_recvertex_3_5_6) h_tpc_track_pos_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
         else if(h_tpc_track_neg_recvertex_3_5_6) h_tpc_track_neg_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-            
+        
         if(q > 0 && h_tpc_track_pos_recvertex_4_5_6) h_tpc_track_pos_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
         else if(h_tpc_track_neg_recvertex_4_5_6) h_tpc_track_neg_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-            
+        
         if(q > 0 && h_tpc_track_pos_recvertex_2_5_6) h_tpc_track_pos_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
         else if(h_tpc_track_neg_recvertex_2_5_6) h_tpc_track_neg_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        
+    
     }
-    //
-  // Fill rec vs MC information
-  //
-  if(!mcev) return;
-
 }
 
 
@@ -699,66 +692,7 @@ void AliPerformanceTPC::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
     if ((vTrack->GetStatus()&AliVTrack::kTPCrefit)==0) return; // TPC refit
     if ((vTrack->HasPointOnITSLayer(0)==kFALSE)&&(vTrack->HasPointOnITSLayer(1)==kFALSE)) return; // at least one SPD
 
-    Float_t q = pTrackParams->Charge();
-    Float_t pt = pTrackParams->Pt();
-    Float_t eta = pTrackParams->Eta();
-    Float_t phi = pTrackParams->Phi();
-    UShort_t nClust = vTrack->GetTPCNcls();
-    Int_t nFindableClust = vTrack->GetTPCNclsF();
-
-
-    Float_t chi2PerCluster = 0;
-    if(nClust>0.) chi2PerCluster = vTrack->GetTPCchi2()/Float_t(nClust);
-  
-    Float_t clustPerFindClust = 0.;
-    if(nFindableClust>0.) clustPerFindClust = Float_t(nClust)/nFindableClust;
-    
-    Double_t dcaToVertex = -1;
-    if( fCutsRC.GetDCAToVertex2D() )
-    {
-        dcaToVertex = TMath::Sqrt(dca[0]*dca[0]/fCutsRC.GetMaxDCAToVertexXY()/fCutsRC.GetMaxDCAToVertexXY() + dca[1]*dca[1]/fCutsRC.GetMaxDCAToVertexZ()/fCutsRC.GetMaxDCAToVertexZ());
-    }
-  if(fCutsRC.GetDCAToVertex2D() && dcaToVertex > 1) return;
-  if(!fCutsRC.GetDCAToVertex2D() && TMath::Abs(dca[0]) > fCutsRC.GetMaxDCAToVertexXY()) return;
-  if(!fCutsRC.GetDCAToVertex2D() && TMath::Abs(dca[1]) > fCutsRC.GetMaxDCAToVertexZ()) return;
-
-  Double_t vTPCTrackHisto[10] = {static_cast<Double_t>(nClust),static_cast<Double_t>(chi2PerCluster),static_cast<Double_t>(clustPerFindClust),static_cast<Double_t>(dca[0]),static_cast<Double_t>(dca[1]),static_cast<Double_t>(eta),static_cast<Double_t>(phi),static_cast<Double_t>(pt),static_cast<Double_t>(q),static_cast<Double_t>(vertStatus)};
-
-    fMult++;
-    if(q > 0.000001) fMultP++;
-    else if(q < 0.000001) fMultN++;
-    
-    if(fUseSparse) {
-      fTPCTrackHisto->Fill(vTPCTrackHisto);
-    } else {
-        if(h_tpc_track_all_recvertex_5_8) h_tpc_track_all_recvertex_5_8->Fill(vTPCTrackHisto[5],vTPCTrackHisto[8]);
-        if(h_tpc_track_all_recvertex_1_5_7) h_tpc_track_all_recvertex_1_5_7->Fill(vTPCTrackHisto[1],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(h_tpc_track_all_recvertex_2_5_7) h_tpc_track_all_recvertex_2_5_7->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        
-        double q = vTPCTrackHisto[8];
-        
-        if (h_tpc_track_all_recvertex_0_5_7) h_tpc_track_all_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_0_5_7) h_tpc_track_pos_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if (h_tpc_track_neg_recvertex_0_5_7) h_tpc_track_neg_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        
-        if(h_tpc_track_all_recvertex_3_5_7) h_tpc_track_all_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_3_5_7) h_tpc_track_pos_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if(h_tpc_track_neg_recvertex_3_5_7) h_tpc_track_neg_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        
-        if(h_tpc_track_all_recvertex_4_5_7) h_tpc_track_all_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_4_5_7) h_tpc_track_pos_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if(h_tpc_track_neg_recvertex_4_5_7) h_tpc_track_neg_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        
-        if(q > 0 && h_tpc_track_pos_recvertex_3_5_6) h_tpc_track_pos_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_3_5_6) h_tpc_track_neg_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        
-        if(q > 0 && h_tpc_track_pos_recvertex_4_5_6) h_tpc_track_pos_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_4_5_6) h_tpc_track_neg_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        
-        if(q > 0 && h_tpc_track_pos_recvertex_2_5_6) h_tpc_track_pos_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_2_5_6) h_tpc_track_neg_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-    
-    }
+    FillTrackHisto(vTrack, pTrackParams->Charge(), pTrackParams->Pt(), pTrackParams->Eta(), pTrackParams->Phi(), dca, vertStatus);
   //
   // Fill rec vs MC information
   //
@@ -775,15 +709,15 @@ void AliPerformanceTPC::ProcessConstrained(AliMCEvent* const /*mcev*/, AliVTrack
 
 
 //_____________________________________________________________________________
-void AliPerformanceTPC::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vfriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
+Bool_t AliPerformanceTPC::SelectEvent(AliMCEvent* const mcEvent, AliVEvent *const vEvent, const Bool_t bUseMC)
 {
-  // Process comparison information 
   //
-
+  // check event input and trigger
+  //
     if(!vEvent)
   {
     Error("Exec","vEvent not available");
-    return;
+    return kFALSE;
   }
 
   AliHeader* header = 0;
@@ -794,19 +728,19 @@ void AliPerformanceTPC::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
   {
     if(!mcEvent) {
       Error("Exec","mcEvent not available");
-      return;
+      return kFALSE;
     }
     // get MC event header
     header = mcEvent->Header();
     if (!header) {
       Error("Exec","Header not available");
-      return;
+      return kFALSE;
     }
     // get MC vertex
     genHeader = header->GenEventHeader();
     if (!genHeader) {
       Error("Exec","Could not retrieve genHeader from Header");
-      return;
+      return kFALSE;
     }
     genHeader->PrimaryVertex(vtxMC);
   } 
@@ -817,41 +751,20 @@ void AliPerformanceTPC::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
     Bool_t isEventTriggered = vEvent->IsTriggerClassFired(GetTriggerClass());
     if(!isEventTriggered) {
       printf("ERROR: Could not determine trigger class (requested: %s)\n", GetTriggerClass());
-      return;
+      return kFALSE;
     }
   }
 
-  // get TPC event vertex
-  AliESDVertex vertex;
-  Int_t hasVertex = 0;
-  if(fUseTrackVertex) {
-    hasVertex = vEvent->GetPrimaryVertexTracks(vertex);
-  } else {
-    hasVertex = vEvent->GetPrimaryVertexTPC(vertex);
-  }
-  if (hasVertex<0) {
-    return;
-  }
-  const AliVVertex *vVertex = &vertex;
-
-  //  events with rec. vertex
-    fMult = 0; fMultP = 0; fMultN = 0;
-  
-  // store vertex status
-  Bool_t vertStatus = vVertex->GetStatus();
-  //  Process events
-  for (Int_t iTrack = 0; iTrack < vEvent->GetNumberOfTracks(); iTrack++) 
-  {
-    
-    AliVParticle *particle = vEvent->GetTrack(iTrack);
-    if(!particle) continue;
-    AliVTrack *vTrack = dynamic_cast<AliVTrack*>(particle);
-    if(!vTrack) continue;
-
-    // if not fUseKinkDaughters don't use tracks with kink index > 0
-    if(!fUseKinkDaughters && vTrack->GetKinkIndex(0) > 0) continue;
+  return kTRUE;
+}
 
-    if(bUseVfriend && vfriendEvent && vfriendEvent->TestSkipBit()==kFALSE) {
+//_____________________________________________________________________________
+void AliPerformanceTPC::FillClusters(AliVTrack *const vTrack, Int_t iTrack, AliVfriendEvent *const vfriendEvent)
+{
+  //
+  // fill cluster histograms from the friend track
+  //
+    if(vfriendEvent && vfriendEvent->TestSkipBit()==kFALSE) {
       const AliVfriendTrack *friendTrack = 0;
       if (vTrack->IsA()==AliESDtrack::Class()) {
 	friendTrack = ((AliESDtrack*)vTrack)->GetFriendTrack();
@@ -909,16 +822,14 @@ void AliPerformanceTPC::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
 	  } //end if(bUseVfriend && vfriendEvent && ...)
 	}
     }
-    if(GetAnalysisMode() == 0) ProcessTPC(mcEvent,vTrack,vEvent,vertStatus);
-    else if(GetAnalysisMode() == 1) ProcessTPCITS(mcEvent,vTrack,vEvent,vertStatus);
-    else if(GetAnalysisMode() == 2) ProcessConstrained(mcEvent,vTrack,vEvent);
-    else {
-      printf("ERROR: AnalysisMode %d \n",fAnalysisMode);
-      return;
-    }
-    // TPC only
-  } //end iTrack iteration
+}
 
+//_____________________________________________________________________________
+void AliPerformanceTPC::FillEventHisto(const AliESDVertex &vertex, Bool_t vertStatus)
+{
+  //
+  // fill event histograms Xv:Yv:Zv:mult:multP:multN:vertStatus
+  //
     Double_t vtxPosition[3]= {0.,0.,0.};
     vertex.GetXYZ(vtxPosition);
     Double_t vTPCEvent[7] = {vtxPosition[0],vtxPosition[1],vtxPosition[2],static_cast<Double_t>(fMult),static_cast<Double_t>(fMultP),static_cast<Double_t>(fMultN),static_cast<Double_t>(vertStatus)};
@@ -937,6 +848,115 @@ void AliPerformanceTPC::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
     }
 }
 
+//_____________________________________________________________________________
+void AliPerformanceTPC::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vfriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
+{
+  // Process comparison information 
+  //
+  if(!SelectEvent(mcEvent,vEvent,bUseMC)) return;
+
+  // get TPC event vertex
+  AliESDVertex vertex;
+  Int_t hasVertex = 0;
+  if(fUseTrackVertex) {
+    hasVertex = vEvent->GetPrimaryVertexTracks(vertex);
+  } else {
+    hasVertex = vEvent->GetPrimaryVertexTPC(vertex);
+  }
+  if (hasVertex<0) {
+    return;
+  }
+  const AliVVertex *vVertex = &vertex;
+
+  //  events with rec. vertex
+    fMult = 0; fMultP = 0; fMultN = 0;
+  
+  // store vertex status
+  Bool_t vertStatus = vVertex->GetStatus();
+  //  Process events
+  for (Int_t iTrack = 0; iTrack < vEvent->GetNumberOfTracks(); iTrack++) 
+  {
+    
+    AliVParticle *particle = vEvent->GetTrack(iTrack);
+    if(!particle) continue;
+    AliVTrack *vTrack = dynamic_cast<AliVTrack*>(particle);
+    if(!vTrack) continue;
+
+    // if not fUseKinkDaughters don't use tracks with kink index > 0
+    if(!fUseKinkDaughters && vTrack->GetKinkIndex(0) > 0) continue;
+
+    if(bUseVfriend) FillClusters(vTrack,iTrack,vfriendEvent);
+    if(GetAnalysisMode() == 0) ProcessTPC(mcEvent,vTrack,vEvent,vertStatus);
+    else if(GetAnalysisMode() == 1) ProcessTPCITS(mcEvent,vTrack,vEvent,vertStatus);
+    else if(GetAnalysisMode() == 2) ProcessConstrained(mcEvent,vTrack,vEvent);
+    else {
+      printf("ERROR: AnalysisMode %d \n",fAnalysisMode);
+      return;
+    }
+    // TPC only
+  } //end iTrack iteration
+
+    FillEventHisto(vertex,vertStatus);
+}
+
+//_____________________________________________________________________________
+void AliPerformanceTPC::ExecRecord(const AliPerformanceEventRecord &record, AliMCEvent* const mcEvent, AliVEvent *const vEvent, AliVfriendEvent *const vfriendEvent, const Bool_t bUseMC, const Bool_t bUseVfriend)
+{
+  //
+  // Process comparison information from the common event record (TPC mode)
+  // same selection as Exec() and ProcessTPC(), track parameters, DCA to
+  // the track vertex and TOF bunch crossing are taken from the record
+  //
+  if(!record.IsFilled(vEvent) || !IsRecordSupported() || (record.GetMask()&GetRecordMask())!=GetRecordMask()) {
+    Exec(mcEvent,vEvent,vfriendEvent,bUseMC,bUseVfriend);
+    return;
+  }
+  if(!SelectEvent(mcEvent,vEvent,bUseMC)) return;
+
+  // get TPC event vertex
+  Int_t hasVertex = fUseTrackVertex ? record.GetVertexTracksStatus() : record.GetVertexTPCStatus();
+  if (hasVertex<0) {
+    return;
+  }
+  const AliESDVertex &vertex = fUseTrackVertex ? record.GetVertexTracksCopy() : record.GetVertexTPCCopy();
+
+  fMult = 0; fMultP = 0; fMultN = 0;
+  Bool_t vertStatus = vertex.GetStatus();
+  for (Int_t iTrack = 0; iTrack < record.GetNumberOfTracks(); iTrack++)
+  {
+    const AliPerformanceTrackRecord &rec = record.GetTrack(iTrack);
+    AliVTrack *vTrack = rec.fTrack;
+    if(!vTrack) continue;
+
+    // if not fUseKinkDaughters don't use tracks with kink index > 0
+    if(!fUseKinkDaughters && rec.HasFlag(AliPerformanceTrackRecord::kKinkDaughter)) continue;
+    if(bUseVfriend) FillClusters(vTrack,iTrack,vfriendEvent);
+
+    if(IsUseTOFBunchCrossing() && rec.fTOFBunchCrossing!=0) continue;
+    // filter out noise tracks
+    if(rec.HasFlag(AliPerformanceTrackRecord::kTPCNoise)) continue;
+    Double_t dca[2] = {0.,0.};
+    const AliExternalTrackParam *pInnerTPCtrackParams = &rec.fInnerTPC;
+    if( IsUseTrackVertex() )
+    {
+      if(!rec.HasFlag(AliPerformanceTrackRecord::kDCAOK)) continue;
+      pInnerTPCtrackParams = &rec.fInnerTPCDCA;
+      dca[0] = rec.fDCA[0]; dca[1] = rec.fDCA[1];
+    }
+    FillTrackHisto(vTrack, rec.fParam.Charge(), pInnerTPCtrackParams->Pt(), pInnerTPCtrackParams->Eta(), pInnerTPCtrackParams->Phi(), dca, vertStatus);
+  }
+  FillEventHisto(vertex,vertStatus);
+}
+
+//_____________________________________________________________________________
+Int_t AliPerformanceTPC::GetRecordMask()
+{
+  // quantities needed from the event record
+  Int_t mask = 0;
+  if(IsUseTrackVertex()) mask |= AliPerformanceEventRecord::kDCA;
+  if(IsUseTOFBunchCrossing()) mask |= AliPerformanceEventRecord::kTOFBunchCrossing;
+  return mask;
+}
 
 
 //_____________________________________________________________________________
@@ -1206,6 +1226,66 @@ void AliPerformanceTPC::ResetOutputData(){
 
 }
 
+//_____________________________________________________________________________
+void AliPerformanceTPC::ConnectOutputData()
+{
+    //
+    // reconnect the histogram pointers (not streamed) to the histograms in fFolderObj
+    //
+    if(fUseSparse || !fFolderObj) return;
+    h_tpc_clust_0_1_2 = (TH3D*)fFolderObj->FindObject("h_tpc_clust_0_1_2");
+    h_tpc_event_recvertex_0 = (TH1D*)fFolderObj->FindObject("h_tpc_event_recvertex_0");
+    h_tpc_event_recvertex_1 = (TH1D*)fFolderObj->FindObject("h_tpc_event_recvertex_1");
+    h_tpc_event_recvertex_2 = (TH1D*)fFolderObj->FindObject("h_tpc_event_recvertex_2");
+    h_tpc_event_recvertex_3 = (TH1D*)fFolderObj->FindObject("h_tpc_event_recvertex_3");
+    h_tpc_event_recvertex_4 = (TH1D*)fFolderObj->FindObject("h_tpc_event_recvertex_4");
+    h_tpc_event_recvertex_5 = (TH1D*)fFolderObj->FindObject("h_tpc_event_recvertex_5");
+    h_tpc_event_6 = (TH1D*)fFolderObj->FindObject("h_tpc_event_6");
+    h_tpc_track_pos_recvertex_2_5_6 = (TH3D*)fFolderObj->FindObject("h_tpc_track_pos_recvertex_2_5_6");
+    h_tpc_track_neg_recvertex_2_5_6 = (TH3D*)fFolderObj->FindObject("h_tpc_track_neg_recvertex_2_5_6");
+    h_tpc_track_all_recvertex_5_8 = (TH2D*)fFolderObj->FindObject("h_tpc_track_all_recvertex_5_8");
+    h_tpc_track_all_recvertex_0_5_7 = (TH3D*)fFolderObj->FindObject("h_tpc_track_all_recvertex_0_5_7");
+    h_tpc_track_pos_recvertex_0_5_7 = (TH3D*)fFolderObj->FindObject("h_tpc_track_pos_recvertex_0_5_7");
+    h_tpc_track_neg_recvertex_0_5_7 = (TH3D*)fFolderObj->FindObject("h_tpc_track_neg_recvertex_0_5_7");
+    h_tpc_track_all_recvertex_1_5_7 = (TH3D*)fFolderObj->FindObject("h_tpc_track_all_recvertex_1_5_7");
+    h_tpc_track_all_recvertex_2_5_7 = (TH3D*)fFolderObj->FindObject("h_tpc_track_all_recvertex_2_5_7");
+    h_tpc_track_all_recvertex_3_5_7 = (TH3D*)fFolderObj->FindObject("h_tpc_track_all_recvertex_3_5_7");
+    h_tpc_track_pos_recvertex_3_5_7 = (TH3D*)fFolderObj->FindObject("h_tpc_track_pos_recvertex_3_5_7");
+    h_tpc_track_neg_recvertex_3_5_7 = (TH3D*)fFolderObj->FindObject("h_tpc_track_neg_recvertex_3_5_7");
+    h_tpc_track_all_recvertex_4_5_7 = (TH3D*)fFolderObj->FindObject("h_tpc_track_all_recvertex_4_5_7");
+    h_tpc_track_pos_recvertex_4_5_7 = (TH3D*)fFolderObj->FindObject("h_tpc_track_pos_recvertex_4_5_7");
+    h_tpc_track_neg_recvertex_4_5_7 = (TH3D*)fFolderObj->FindObject("h_tpc_track_neg_recvertex_4_5_7");
+    h_tpc_track_pos_recvertex_3_5_6 = (TH3D*)fFolderObj->FindObject("h_tpc_track_pos_recvertex_3_5_6");
+    h_tpc_track_pos_recvertex_4_5_6 = (TH3D*)fFolderObj->FindObject("h_tpc_track_pos_recvertex_4_5_6");
+    h_tpc_track_neg_recvertex_3_5_6 = (TH3D*)fFolderObj->FindObject("h_tpc_track_neg_recvertex_3_5_6");
+    h_tpc_track_neg_recvertex_4_5_6 = (TH3D*)fFolderObj->FindObject("h_tpc_track_neg_recvertex_4_5_6");
+}
+
+//_____________________________________________________________________________
+AliPerformanceObject* AliPerformanceTPC::CreateWorker() const
+{
+    //
+    // empty copy for parallel processing
+    //
+    AliPerformanceTPC *worker = (AliPerformanceTPC*)Clone();
+    worker->ConnectOutputData();
+    worker->ResetOutputData();
+    return worker;
+}
+
+//_____________________________________________________________________________
+Long64_t AliPerformanceTPC::MergeWorkers(TCollection* list)
+{
+    //
+    // merge the workers, the global THnSparse merging setting is ignored
+    //
+    Bool_t useMerge = fgUseMergeTHnSparse;
+    fgUseMergeTHnSparse = kFALSE;
+    Long64_t count = AliPerformanceObject::MergeWorkers(list);
+    fgUseMergeTHnSparse = useMerge;
+    return count;
+}
+
 //_____________________________________________________________________________
 TCollection* AliPerformanceTPC::GetListOfDrawableObjects() 
 {
@@ -26,6 +26,7 @@ class AliMCEvent;
 class AliVEvent;
 class AliVEvent;
 class AliVfriendEvent; 
+class AliESDVertex;
 class TRootIOCtor;
 
 #include "THnSparse.h"
@@ -43,6 +44,11 @@ public :
 
   // Execute analysis
   virtual void  Exec(AliMCEvent* const infoMC, AliVEvent* const infoRC, AliVfriendEvent* const vfriendEvent, const Bool_t bUseMC=kFALSE, const Bool_t bUseVfriend=kFALSE);
+
+  // Execute analysis from the common event record (TPC mode only)
+  virtual Bool_t IsRecordSupported() { return GetAnalysisMode() == 0; }
+  virtual Int_t  GetRecordMask();
+  virtual void   ExecRecord(const AliPerformanceEventRecord &record, AliMCEvent* const infoMC, AliVEvent* const infoRC, AliVfriendEvent* const vfriendEvent, const Bool_t bUseMC=kFALSE, const Bool_t bUseVfriend=kFALSE);
   // Merge output objects (needed by PROOF) 
   virtual Long64_t Merge(TCollection* list=0);
 
@@ -81,10 +87,18 @@ public :
   Bool_t GetUseHLT() { return fUseHLT; }
   TCollection* GetListOfDrawableObjects();
   virtual void ResetOutputData();
+  virtual void ConnectOutputData();
+  virtual AliPerformanceObject* CreateWorker() const;
+  virtual Long64_t MergeWorkers(TCollection* list);
 
     
 private:
 
+  Bool_t SelectEvent(AliMCEvent* const mcEvent, AliVEvent *const vEvent, const Bool_t bUseMC);
+  void   FillClusters(AliVTrack *const vTrack, Int_t iTrack, AliVfriendEvent *const vfriendEvent);
+  void   FillTrackHisto(AliVTrack *const vTrack, Float_t q, Float_t pt, Float_t eta, Float_t phi, const Double_t dca[2], Bool_t vertStatus);
+  void   FillEventHisto(const AliESDVertex &vertex, Bool_t vertStatus);
+
   static Bool_t fgMergeTHnSparse;
   static Bool_t fgUseMergeTHnSparse;  
 
@@ -63,6 +63,8 @@
 #include "AliPerformanceTPC.h"
 #include "AliPerformanceDEdx.h"
 #include "AliPerformanceMatch.h"
+#include "AliPerformanceEventRecord.h"
+#include "AliPerformanceQAEngine.h"
 #include "AliPerformanceTask.h"
 
 #include <AliSysInfo.h>
@@ -92,6 +94,8 @@ AliPerformanceTask::AliPerformanceTask()
   , fDebug(0)
   , fUseCentralityBin(0)
   , fEvents(0)
+  , fUseEventRecord(kFALSE)
+  , fEventRecord(0)
 {
     // Dummy Constructor
   // should not be used
@@ -116,6 +120,8 @@ AliPerformanceTask::AliPerformanceTask(const char *name, const char* title)
   , fDebug(0)
   , fUseCentralityBin(0)
   , fEvents(0)
+  , fUseEventRecord(kFALSE)
+  , fEventRecord(0)
 {
   // Constructor
 
@@ -132,6 +138,7 @@ AliPerformanceTask::~AliPerformanceTask()
     delete fOutputSummary;
     delete fCompList;
   }
+  delete fEventRecord;
 }
 
 //_____________________________________________________________________________
@@ -248,13 +255,16 @@ void AliPerformanceTask::UserExec(Option_t *)
   // Process comparison
     if(fEvents==1) fVEvent->InitMagneticField();
     if (process) {
-    AliPerformanceObject *pObj=0;
-    fPitList->Reset();
-    while(( pObj = (AliPerformanceObject *)fPitList->Next()) != NULL) {
-      //AliInfo(pObj->GetName());
-      if (showInfo) AliInfo(Form("...executing job %s",pObj->GetName()));
-      pObj->Exec(fMC,fVEvent,fVfriendEvent,fUseMCInfo,fUseVfriend);
+    if (showInfo) {
+      AliPerformanceObject *pObj=0;
+      fPitList->Reset();
+      while(( pObj = (AliPerformanceObject *)fPitList->Next()) != NULL) {
+        AliInfo(Form("...executing job %s",pObj->GetName()));
+      }
     }
+    // per-track quantities shared by the objects are evaluated once in the record
+    if (fUseEventRecord && !fEventRecord) fEventRecord = new AliPerformanceEventRecord;
+    AliPerformanceQAEngine::ProcessEvent(fOutput,fEventRecord,fUseEventRecord,fMC,fVEvent,fVfriendEvent,fUseMCInfo,fUseVfriend);
   }
 
     if(fDebug) {
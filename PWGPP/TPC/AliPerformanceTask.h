@@ -14,6 +14,7 @@ class AliVEvent;
 class AliVfriendEvent;
 class AliMCEvent;
 class AliPerformanceObject;
+class AliPerformanceEventRecord;
 class AliMagF;
 class TList;
 class TTree;
@@ -45,6 +46,10 @@ class AliPerformanceTask : public AliAnalysisTaskSE {
   void SetUseVfriend(Bool_t useVFriend = kFALSE) {fUseVfriend = useVFriend;}
   void SetUseESDfriend(Bool_t useFriend = kFALSE) {SetUseVfriend(useFriend);}
 
+  // Use common event record for the performance objects supporting it
+  void SetUseEventRecord(Bool_t useRecord = kTRUE) {fUseEventRecord = useRecord;}
+  Bool_t GetUseEventRecord() const {return fUseEventRecord;}
+
   // Use HLT ESD
   void SetUseHLT(Bool_t useHLT = kFALSE) {fUseHLT = useHLT;}
 
@@ -95,12 +100,15 @@ class AliPerformanceTask : public AliAnalysisTaskSE {
     
   Int_t fUseCentralityBin;  // centrality bin to be used 
   Int_t fEvents;
+
+  Bool_t fUseEventRecord;     // use common event record (AliPerformanceEventRecord)
+  AliPerformanceEventRecord *fEventRecord; //! common event record
     
     
   AliPerformanceTask(const AliPerformanceTask&); // not implemented
   AliPerformanceTask& operator=(const AliPerformanceTask&); // not implemented
   
-  ClassDef(AliPerformanceTask, 5); // example of analysis
+  ClassDef(AliPerformanceTask, 6); // example of analysis
 };
 
 #endif
@@ -0,0 +1,377 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TH1.h>
+#include <TList.h>
+#include <TMap.h>
+#include <TNamed.h>
+#include <TObjArray.h>
+#include <TObjString.h>
+#include <TSystem.h>
+#include "AliCDBEntry.h"
+#include "AliCDBId.h"
+#include "AliCDBManager.h"
+#include "AliCDBStorage.h"
+#include "AliLog.h"
+#include "AliTenderCache.h"
+
+ClassImp(AliTenderCache)
+
+AliTenderCache *AliTenderCache::fgInstance = NULL;
+
+//______________________________________________________________________________
+AliTenderCache::AliTenderCache()
+               :TObject(),
+                fObjects(NULL),
+                fRuns(4),
+                fNRuns(0),
+                fMaxRuns(4),
+                fNodeDir()
+{
+// Default constructor. The node-local directory is taken from the
+// ALICE_TENDER_CACHE_DIR environment variable, if defined.
+  fObjects = new TMap();
+  fObjects->SetOwnerKeyValue(kTRUE, kTRUE);
+  const char *dir = gSystem->Getenv("ALICE_TENDER_CACHE_DIR");
+  if (dir && dir[0]) SetNodeCacheDir(dir);
+}
+
+//______________________________________________________________________________
+AliTenderCache::~AliTenderCache()
+{
+// Destructor
+  delete fObjects;
+  if (fgInstance == this) fgInstance = NULL;
+}
+
+//______________________________________________________________________________
+AliTenderCache *AliTenderCache::Instance()
+{
+// Process-wide instance
+  if (!fgInstance) fgInstance = new AliTenderCache();
+  return fgInstance;
+}
+
+//______________________________________________________________________________
+TString AliTenderCache::GetKey(const char *path, Int_t run) const
+{
+// Key of the object in memory
+  return TString::Format("%d/%s", run, path);
+}
+
+//______________________________________________________________________________
+TString AliTenderCache::GetNodeName(const char *path)
+{
+// Object path with the characters not allowed in file names replaced by '_'
+  TString name(path);
+  for (Int_t i=0; i<name.Length(); i++) {
+    char c = name[i];
+    if (!isalnum(c) && c!='.' && c!='-') name[i] = '_';
+  }
+  return name;
+}
+
+//______________________________________________________________________________
+TString AliTenderCache::GetNodeFileName(const char *path, Int_t run) const
+{
+// File of the object in the node-local cache: <dir>/<run>/<path>_<hash>.root
+  TString fileName;
+  fileName.Form("%s/%d/%s_%08x.root", fNodeDir.Data(), run, GetNodeName(path).Data(), TString(path).Hash());
+  return fileName;
+}
+
+//______________________________________________________________________________
+TString AliTenderCache::GetSourceStamp(const char *sourceFile)
+{
+// Name, modification time and size of the file an object was read from,
+// empty if the file can not be checked
+  if (!sourceFile || !sourceFile[0]) return TString();
+  TString fileName(sourceFile);
+  gSystem->ExpandPathName(fileName);
+  FileStat_t stat;
+  if (gSystem->GetPathInfo(fileName, stat)) return TString();
+  return TString::Format("%s %ld %lld", fileName.Data(), stat.fMtime, stat.fSize);
+}
+
+//______________________________________________________________________________
+Bool_t AliTenderCache::MatchPath(const TString &cachePath, const char *path)
+{
+// Whether the object cachePath is covered by path: the object itself, the
+// objects below it (path/...) and, for an OCDB path, the cached OCDB objects
+// of that path ("OCDB/<storage>/<path>/v<version>_s<subversion>[/id]")
+  if (cachePath==path || cachePath.BeginsWith(TString::Format("%s/", path))) return kTRUE;
+  if (!cachePath.BeginsWith("OCDB/")) return kFALSE;
+  TObjArray *tokens = cachePath.Tokenize("/");
+  Int_t last = tokens->GetEntriesFast()-1;
+  if (last>=0 && ((TObjString*)tokens->At(last))->GetString()=="id") last--;
+  Bool_t match = kFALSE;
+  if (last>=4 && ((TObjString*)tokens->At(last))->GetString().BeginsWith("v")) {
+    TString cdbPath = TString::Format("%s/%s/%s", tokens->At(last-3)->GetName(), tokens->At(last-2)->GetName(), tokens->At(last-1)->GetName());
+    match = (cdbPath==path);
+  }
+  delete tokens;
+  return match;
+}
+
+//______________________________________________________________________________
+TObject *AliTenderCache::ReadFromNode(const char *path, Int_t run, const char *sourceStamp) const
+{
+// Read an object from the node-local cache, NULL if not there. With
+// sourceStamp, a file written from another version of the source file is
+// stale and removed.
+  if (fNodeDir.IsNull()) return NULL;
+  TString fileName = GetNodeFileName(path, run);
+  if (gSystem->AccessPathName(fileName)) return NULL;
+  TDirectory::TContext context;
+  Bool_t addStatus = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  TObject *obj = NULL;
+  Bool_t stale = kFALSE;
+  TFile *file = TFile::Open(fileName);
+  if (file && !file->IsZombie()) {
+    if (sourceStamp && sourceStamp[0]) {
+      TNamed *source = dynamic_cast<TNamed*>(file->Get("source"));
+      stale = (!source || strcmp(source->GetTitle(), sourceStamp));
+      delete source;
+    }
+    if (!stale) obj = file->Get("object");
+  }
+  delete file;
+  TH1::AddDirectory(addStatus);
+  if (stale) {
+    AliInfoF("%s for run %d in the node cache is outdated, removing it", path, run);
+    gSystem->Unlink(fileName);
+  }
+  return obj;
+}
+
+//______________________________________________________________________________
+void AliTenderCache::WriteToNode(const char *path, Int_t run, const TObject *obj, const char *sourceStamp) const
+{
+// Write an object to the node-local cache, with the stamp of its source file
+// if given. The file is written under a temporary name and then renamed, so
+// concurrent jobs never read a partial file.
+  if (fNodeDir.IsNull()) return;
+  TString fileName = GetNodeFileName(path, run);
+  if (!gSystem->AccessPathName(fileName)) return;
+  gSystem->mkdir(Form("%s/%d", fNodeDir.Data(), run), kTRUE);
+  TString tmpName = TString::Format("%s.%d.tmp", fileName.Data(), gSystem->GetPid());
+  TDirectory::TContext context;
+  TFile *file = TFile::Open(tmpName, "RECREATE");
+  if (!file || file->IsZombie()) {
+    AliWarningF("Cannot write %s to the node cache %s", path, fNodeDir.Data());
+    delete file;
+    return;
+  }
+  Int_t nbytes = file->WriteTObject(obj, "object", "SingleKey");
+  if (sourceStamp && sourceStamp[0]) {
+    TNamed source("source", sourceStamp);
+    file->WriteTObject(&source, "source");
+  }
+  file->Close();
+  delete file;
+  if (nbytes<=0 || gSystem->Rename(tmpName, fileName)) gSystem->Unlink(tmpName);
+}
+
+//______________________________________________________________________________
+void AliTenderCache::UseRun(Int_t run)
+{
+// Mark run as most recently used, drop the least recently used run
+// from memory if more than fMaxRuns runs are cached
+  Int_t pos = -1;
+  for (Int_t i=0; i<fNRuns; i++) if (fRuns[i]==run) pos = i;
+  if (pos<0) {
+    if (fNRuns==fRuns.GetSize()) fRuns.Set(2*fNRuns+1);
+    pos = fNRuns++;
+  }
+  for (Int_t i=pos; i<fNRuns-1; i++) fRuns[i] = fRuns[i+1];
+  fRuns[fNRuns-1] = run;
+  while (fNRuns>fMaxRuns) RemoveRun(fRuns[0]);
+}
+
+//______________________________________________________________________________
+void AliTenderCache::RemoveRun(Int_t run)
+{
+// Drop all objects of run from memory
+  TString prefix = TString::Format("%d/", run);
+  TList keys;
+  TIter next(fObjects);
+  TObjString *key;
+  while ((key=(TObjString*)next())) if (key->GetString().BeginsWith(prefix)) keys.Add(key);
+  TIter nextKey(&keys);
+  while ((key=(TObjString*)nextKey())) fObjects->DeleteEntry(key);
+  Int_t j = 0;
+  for (Int_t i=0; i<fNRuns; i++) if (fRuns[i]!=run) fRuns[j++] = fRuns[i];
+  fNRuns = j;
+}
+
+//______________________________________________________________________________
+TObject *AliTenderCache::Get(const char *path, Int_t run, Bool_t nodeCache, const char *sourceFile)
+{
+// Cached object for path and run, from memory or from the node-local cache.
+// NULL if the object was not cached yet. With sourceFile the node cache is
+// only used if that file can be checked and did not change.
+  TObject *obj = fObjects->GetValue(GetKey(path, run));
+  if (!obj) {
+    TString sourceStamp = GetSourceStamp(sourceFile);
+    if (sourceFile && sourceStamp.IsNull()) nodeCache = kFALSE;
+    obj = nodeCache ? ReadFromNode(path, run, sourceStamp) : NULL;
+    if (!obj) return NULL;
+    fObjects->Add(new TObjString(GetKey(path, run)), obj);
+    AliInfoF("%s for run %d read from the node cache", path, run);
+  }
+  UseRun(run);
+  return obj;
+}
+
+//______________________________________________________________________________
+TObject *AliTenderCache::Add(const char *path, Int_t run, const TObject *obj, Bool_t nodeCache, const char *sourceFile)
+{
+// Store a copy of obj for path and run, returns the cached copy. With
+// sourceFile the node cache copy carries the stamp of that file.
+  if (!obj) return NULL;
+  TString key = GetKey(path, run);
+  TObject *cached = fObjects->GetValue(key);
+  if (!cached) {
+    cached = obj->Clone();
+    fObjects->Add(new TObjString(key), cached);
+    TString sourceStamp = GetSourceStamp(sourceFile);
+    if (sourceFile && sourceStamp.IsNull()) nodeCache = kFALSE;
+    if (nodeCache) WriteToNode(path, run, cached, sourceStamp);
+  }
+  UseRun(run);
+  return cached;
+}
+
+//______________________________________________________________________________
+TObject *AliTenderCache::GetCDBObject(AliCDBManager *cdb, const char *path, Int_t run, Int_t version)
+{
+// Cached OCDB object for run, loaded through cdb if not cached yet.
+// The version and subversion valid for run are first resolved through the
+// manager (specific storage of the path, else the default one), without
+// loading the object. The storage and the resolved version are part of the
+// key, so a new version in the storage gives a new key and the object can be
+// shared through the node cache. If the id can not be resolved, the requested
+// version is used and the object is only kept in memory. The id of the loaded
+// entry is cached with the object and checked before it is reused.
+  AliCDBStorage *storage = cdb ? cdb->GetSpecificStorage(path) : NULL;
+  if (!storage && cdb) storage = cdb->GetDefaultStorage();
+  AliCDBId *resolved = cdb ? cdb->GetId(path, run, version) : NULL;
+  Int_t cacheVersion = resolved ? resolved->GetVersion() : version;
+  Int_t cacheSubVersion = resolved ? resolved->GetSubVersion() : -1;
+  Bool_t nodeCache = (resolved!=NULL && cacheVersion>=0);
+  delete resolved;
+  TString cachePath = TString::Format("OCDB/%s/%s/v%d_s%d", storage ? storage->GetURI().Data() : "", path, cacheVersion, cacheSubVersion);
+  TString idPath = cachePath + "/id";
+  TObject *obj = Get(cachePath, run, nodeCache);
+  if (obj) {
+    AliCDBId *id = dynamic_cast<AliCDBId*>(Get(idPath, run, nodeCache));
+    if (id && id->GetFirstRun()<=run && run<=id->GetLastRun() && (cacheVersion<0 || id->GetVersion()==cacheVersion)) return obj;
+    AliWarningF("Cached %s not valid for run %d, reloading it", path, run);
+    Invalidate(run, cachePath, nodeCache); // also removes idPath
+  }
+  if (!cdb) return NULL;
+  AliCDBEntry *entry = cdb->Get(path, run, cacheVersion, cacheSubVersion);
+  if (!entry || !entry->GetObject()) return NULL;
+  Add(idPath, run, &entry->GetId(), nodeCache);
+  return Add(cachePath, run, entry->GetObject(), nodeCache);
+}
+
+//______________________________________________________________________________
+void AliTenderCache::Invalidate(Int_t run, const char *path, Bool_t nodeCache)
+{
+// Remove objects from the cache: all objects of run (all runs if run<0)
+// or only the objects matching path (see MatchPath; an OCDB path such as
+// "TPC/Calib/PidResponse" removes all cached versions of it). Cached pointers
+// held by the supplies become invalid. With nodeCache the node-local files
+// are removed too.
+  TList keys;
+  TIter next(fObjects);
+  TObjString *key;
+  while ((key=(TObjString*)next())) {
+    const TString &s = key->GetString();
+    if (run>=0 && !s.BeginsWith(TString::Format("%d/", run))) continue;
+    if (path && !MatchPath(s(s.Index('/')+1, s.Length()), path)) continue;
+    keys.Add(key);
+  }
+  TIter nextKey(&keys);
+  while ((key=(TObjString*)nextKey())) fObjects->DeleteEntry(key);
+  if (!path) {
+    if (run>=0) RemoveRun(run);
+    else fNRuns = 0;
+  }
+  if (!nodeCache || fNodeDir.IsNull()) return;
+
+  // node-local files. Only the sanitised path is in the file name, so files
+  // of similar paths may be removed too: they are then simply reloaded.
+  TString nodeName = path ? GetNodeName(path) : TString();
+  TList runDirs;
+  runDirs.SetOwner();
+  if (run>=0) {
+    runDirs.Add(new TObjString(Form("%d", run)));
+  } else {
+    void *dir = gSystem->OpenDirectory(fNodeDir);
+    const char *entry;
+    while (dir && (entry=gSystem->GetDirEntry(dir))) {
+      if (TString(entry).IsDigit()) runDirs.Add(new TObjString(entry));
+    }
+    if (dir) gSystem->FreeDirectory(dir);
+  }
+  TIter nextDir(&runDirs);
+  TObjString *runDir;
+  while ((runDir=(TObjString*)nextDir())) {
+    TString dirName = TString::Format("%s/%s", fNodeDir.Data(), runDir->GetString().Data());
+    void *dir = gSystem->OpenDirectory(dirName);
+    const char *entry;
+    while (dir && (entry=gSystem->GetDirEntry(dir))) {
+      TString fileName(entry);
+      if (!fileName.EndsWith(".root") || fileName.Length()<=14) continue;
+      if (path) {
+        // <name>_<hash>.root
+        TString name = fileName(0, fileName.Length()-14);
+        if (name!=nodeName && !name.BeginsWith(nodeName+"_") &&
+            !(name.BeginsWith("OCDB_") && name.Contains("_"+nodeName+"_v"))) continue;
+      }
+      gSystem->Unlink(Form("%s/%s", dirName.Data(), entry));
+    }
+    if (dir) gSystem->FreeDirectory(dir);
+  }
+}
+
+//______________________________________________________________________________
+void AliTenderCache::SetMaxRuns(Int_t nRuns)
+{
+// Max number of runs kept in memory (at least 1)
+  fMaxRuns = nRuns>0 ? nRuns : 1;
+  while (fNRuns>fMaxRuns) RemoveRun(fRuns[0]);
+}
+
+//______________________________________________________________________________
+void AliTenderCache::SetNodeCacheDir(const char *dir)
+{
+// Node-local cache directory, empty to disable. Should be on a local disk
+// shared by the jobs running on the node (e.g. /tmp/tendercache).
+  fNodeDir = dir;
+  gSystem->ExpandPathName(fNodeDir);
+  if (fNodeDir.IsNull()) return;
+  if (gSystem->mkdir(fNodeDir, kTRUE) && gSystem->AccessPathName(fNodeDir, kWritePermission)) {
+    AliWarningF("Node cache directory %s not writable, node cache disabled", fNodeDir.Data());
+    fNodeDir = "";
+  }
+}
@@ -0,0 +1,76 @@
+#ifndef ALITENDERCACHE_H
+#define ALITENDERCACHE_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//==============================================================================
+//   AliTenderCache - Run-level cache of calibration objects used by the
+//      tender supplies, keyed by run number and object path.
+//      Objects are kept in memory for the process (shared between supplies)
+//      and optionally written to a node-local directory, so that consecutive
+//      jobs on the same node do not reload and unpack them again.
+//==============================================================================
+
+#ifndef ROOT_TObject
+#include "TObject.h"
+#endif
+#ifndef ROOT_TString
+#include "TString.h"
+#endif
+#ifndef ROOT_TArrayI
+#include "TArrayI.h"
+#endif
+
+class TMap;
+class AliCDBManager;
+
+class AliTenderCache : public TObject {
+
+private:
+  static AliTenderCache    *fgInstance;      //! Process-wide instance
+  TMap                     *fObjects;        //! Cached objects (owned), key "run/path"
+  TArrayI                   fRuns;           //! Runs in memory, most recently used last
+  Int_t                     fNRuns;          //! Number of runs in memory
+  Int_t                     fMaxRuns;        //! Max number of runs kept in memory
+  TString                   fNodeDir;        //! Node-local cache directory (empty: disabled)
+
+  AliTenderCache();
+  AliTenderCache(const AliTenderCache &other);
+  AliTenderCache& operator=(const AliTenderCache &other);
+
+  TString                   GetKey(const char *path, Int_t run) const;
+  TString                   GetNodeFileName(const char *path, Int_t run) const;
+  TObject                  *ReadFromNode(const char *path, Int_t run, const char *sourceStamp) const;
+  void                      WriteToNode(const char *path, Int_t run, const TObject *obj, const char *sourceStamp) const;
+  static TString            GetNodeName(const char *path);
+  static TString            GetSourceStamp(const char *sourceFile);
+  static Bool_t             MatchPath(const TString &cachePath, const char *path);
+  void                      UseRun(Int_t run);
+  void                      RemoveRun(Int_t run);
+
+public:
+  virtual ~AliTenderCache();
+  static AliTenderCache    *Instance();
+
+  // Cached objects are owned by the cache: do not delete or modify them.
+  // With nodeCache=kFALSE the object is only looked up / kept in memory.
+  // sourceFile is the file the object was read from (e.g. the OADB file):
+  // node cache entries are only reused while it has not changed.
+  TObject                  *Get(const char *path, Int_t run, Bool_t nodeCache=kTRUE, const char *sourceFile=0);
+  TObject                  *Add(const char *path, Int_t run, const TObject *obj, Bool_t nodeCache=kTRUE, const char *sourceFile=0);
+  TObject                  *GetCDBObject(AliCDBManager *cdb, const char *path, Int_t run, Int_t version=-1);
+  // Invalidation: run<0 for all runs, path=0 for all objects of the run(s).
+  // path also matches the objects below it and the OCDB objects of that path
+  void                      Invalidate(Int_t run=-1, const char *path=0, Bool_t nodeCache=kTRUE);
+
+  // Configuration
+  void                      SetMaxRuns(Int_t nRuns);
+  Int_t                     GetMaxRuns() const {return fMaxRuns;}
+  void                      SetNodeCacheDir(const char *dir);
+  const char               *GetNodeCacheDir() const {return fNodeDir.Data();}
+
+  ClassDef(AliTenderCache,1)  // Run-level cache of tender calibration objects
+};
+#endif
@@ -5,6 +5,7 @@
 #pragma link off all functions;
 
 #pragma link C++ class  AliTender+;
+#pragma link C++ class  AliTenderCache+;
 #pragma link C++ class  AliTenderSupply+;
 
 #endif
@@ -42,6 +42,7 @@
 #include "AliMagF.h"
 #include "AliOADBContainer.h"
 #include "AliTender.h"
+#include "AliTenderCache.h"
 #include "AliEMCALTenderSupply.h"
 
 ClassImp(AliEMCALTenderSupply)
@@ -936,41 +937,52 @@ Bool_t AliEMCALTenderSupply::InitMisalignMatrix()
   
   Int_t runGM = event->GetRunNumber();
   TObjArray *mobj = 0;
+  TString contName, objName;
+  Int_t objRun = 100;
 
   if (fMisalignSurvey == kdefault)
   { //take default alignment corresponding to run no
-    AliOADBContainer emcalgeoCont(Form("emcal"));
-    emcalgeoCont.InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),Form("AliEMCALgeo"));
-    mobj=(TObjArray*)emcalgeoCont.GetObject(runGM,"EmcalMatrices");
+    contName = "emcal";
+    objName = "EmcalMatrices";
+    objRun = runGM;
   }
   
   if (fMisalignSurvey == kSurveybyS)
   { //take alignment at sector level
     if (runGM <= 140000) { //2010 data
-      AliOADBContainer emcalgeoCont(Form("emcal2010"));
-      emcalgeoCont.InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),Form("AliEMCALgeo"));
-      mobj=(TObjArray*)emcalgeoCont.GetObject(100,"survey10");
+      contName = "emcal2010";
+      objName = "survey10";
     }
     else if (runGM>140000)
     { // 2011 LHC11a pass1 data
-      AliOADBContainer emcalgeoCont(Form("emcal2011"));
-      emcalgeoCont.InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),Form("AliEMCALgeo"));
-      mobj=(TObjArray*)emcalgeoCont.GetObject(100,"survey11byS");
+      contName = "emcal2011";
+      objName = "survey11byS";
     }
   }
 
   if (fMisalignSurvey == kSurveybyM)
   { //take alignment at module level
     if (runGM <= 140000) { //2010 data
-      AliOADBContainer emcalgeoCont(Form("emcal2010"));
-      emcalgeoCont.InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),Form("AliEMCALgeo"));
-      mobj=(TObjArray*)emcalgeoCont.GetObject(100,"survey10");
+      contName = "emcal2010";
+      objName = "survey10";
     }
     else if (runGM>140000)
     { // 2011 LHC11a pass1 data
-      AliOADBContainer emcalgeoCont(Form("emcal2011"));
-      emcalgeoCont.InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),Form("AliEMCALgeo"));
-      mobj=(TObjArray*)emcalgeoCont.GetObject(100,"survey11byM");
+      contName = "emcal2011";
+      objName = "survey11byM";
+    }
+  }
+
+  if (!objName.IsNull())
+  {
+    TString fileName = AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data();
+    TString cachePath = Form("OADB/%s/%s/%s",fileName.Data(),contName.Data(),objName.Data());
+    mobj = (TObjArray*)AliTenderCache::Instance()->Get(cachePath,runGM,kTRUE,fileName);
+    if (!mobj)
+    {
+      AliOADBContainer emcalgeoCont(contName);
+      emcalgeoCont.InitFromFile(fileName.Data(),Form("AliEMCALgeo"));
+      mobj = (TObjArray*)AliTenderCache::Instance()->Add(cachePath,runGM,emcalgeoCont.GetObject(objRun,objName),kTRUE,fileName);
     }
   }
 
@@ -1018,58 +1030,73 @@ Int_t AliEMCALTenderSupply::InitBadChannels()
   
   Int_t runBC = event->GetRunNumber();
   
-  AliOADBContainer *contBC = new AliOADBContainer("");
+  TString fileBC;
   if (fBasePath!="")
-  { //if fBasePath specified in the ->SetBasePath()
-    if (fDebugLevel>0) AliInfo(Form("Loading Bad Channels OADB from given path %s",fBasePath.Data()));
-    
-    TFile *fbad=new TFile(Form("%s/EMCALBadChannels%s.root",fBasePath.Data(), fLoad1DBadChMap ? "_1D" : ""),"read");
-    if (!fbad || fbad->IsZombie())
-    {
-      AliFatal(Form("EMCALBadChannels%s.root was not found in the path provided: %s", fLoad1DBadChMap ? "_1D" : "", fBasePath.Data()));
-      return 0;
-    }  
-    
-    if (fbad) delete fbad;
-    
-    contBC->InitFromFile(Form("%s/EMCALBadChannels%s.root",fBasePath.Data(), fLoad1DBadChMap ? "_1D" : ""),"AliEMCALBadChannels");
-  }
+    fileBC = Form("%s/EMCALBadChannels%s.root",fBasePath.Data(), fLoad1DBadChMap ? "_1D" : "");
   else if (fCustomBC!="")
-  { //if fCustomBC specified in the ->SetCustomBC()
-    if (fDebugLevel>0) AliInfo(Form("Loading Bad Channels OADB from given path %s",fCustomBC.Data()));
-    
-    TFile *fbad=new TFile(Form("%s",fCustomBC.Data()),"read");
-    if (!fbad || fbad->IsZombie())
-    {
-      AliFatal(Form("Input file was not found in the path provided: %s",fCustomBC.Data()));
-      return 0;
-    }
-    
-    if (fbad) delete fbad;
-    
-    contBC->InitFromFile(Form("%s",fCustomBC.Data()),"AliEMCALBadChannels");
-  }
+    fileBC = fCustomBC;
   else
-  { // Else choose the one in the $ALICE_PHYSICS directory
-    if (fDebugLevel>0) AliInfo("Loading Bad Channels OADB from /OADB/EMCAL");
-    
-    TFile *fbad=new TFile(AliDataFile::GetFileNameOADB(Form("EMCAL/EMCALBadChannels%s.root", fLoad1DBadChMap ? "_1D" : "")).data(),"read");
-    if (!fbad || fbad->IsZombie())
-    {
-      AliFatal(Form("OADB/EMCAL/EMCALBadChannels%s.root was not found", fLoad1DBadChMap ? "_1D" : ""));
-      return 0;
+    fileBC = AliDataFile::GetFileNameOADB(Form("EMCAL/EMCALBadChannels%s.root", fLoad1DBadChMap ? "_1D" : "")).data();
+  TString cachePathBC = Form("OADB/%s/AliEMCALBadChannels",fileBC.Data());
+
+  // the bad channel maps are shared through the run-level cache, the
+  // reco utils get their own copies of the histograms
+  TObjArray *arrayBC=(TObjArray*)AliTenderCache::Instance()->Get(cachePathBC,runBC,kTRUE,fileBC);
+  if (!arrayBC)
+  {
+    AliOADBContainer *contBC = new AliOADBContainer("");
+    if (fBasePath!="")
+    { //if fBasePath specified in the ->SetBasePath()
+      if (fDebugLevel>0) AliInfo(Form("Loading Bad Channels OADB from given path %s",fBasePath.Data()));
+      
+      TFile *fbad=new TFile(Form("%s/EMCALBadChannels%s.root",fBasePath.Data(), fLoad1DBadChMap ? "_1D" : ""),"read");
+      if (!fbad || fbad->IsZombie())
+      {
+        AliFatal(Form("EMCALBadChannels%s.root was not found in the path provided: %s", fLoad1DBadChMap ? "_1D" : "", fBasePath.Data()));
+        return 0;
+      }  
+      
+      if (fbad) delete fbad;
+      
+      contBC->InitFromFile(Form("%s/EMCALBadChannels%s.root",fBasePath.Data(), fLoad1DBadChMap ? "_1D" : ""),"AliEMCALBadChannels");
     }
+    else if (fCustomBC!="")
+    { //if fCustomBC specified in the ->SetCustomBC()
+      if (fDebugLevel>0) AliInfo(Form("Loading Bad Channels OADB from given path %s",fCustomBC.Data()));
       
-    if (fbad) delete fbad;
+      TFile *fbad=new TFile(Form("%s",fCustomBC.Data()),"read");
+      if (!fbad || fbad->IsZombie())
+      {
+        AliFatal(Form("Input file was not found in the path provided: %s",fCustomBC.Data()));
+        return 0;
+      }
+      
+      if (fbad) delete fbad;
+      
+      contBC->InitFromFile(Form("%s",fCustomBC.Data()),"AliEMCALBadChannels");
+    }
+    else
+    { // Else choose the one in the $ALICE_PHYSICS directory
+      if (fDebugLevel>0) AliInfo("Loading Bad Channels OADB from /OADB/EMCAL");
+      
+      TFile *fbad=new TFile(AliDataFile::GetFileNameOADB(Form("EMCAL/EMCALBadChannels%s.root", fLoad1DBadChMap ? "_1D" : "")).data(),"read");
+      if (!fbad || fbad->IsZombie())
+      {
+        AliFatal(Form("OADB/EMCAL/EMCALBadChannels%s.root was not found", fLoad1DBadChMap ? "_1D" : ""));
+        return 0;
+      }
+        
+      if (fbad) delete fbad;
+      
+      contBC->InitFromFile(AliDataFile::GetFileNameOADB(Form("EMCAL/EMCALBadChannels%s.root", fLoad1DBadChMap ? "_1D" : "")).data(),"AliEMCALBadChannels");
+    }
     
-    contBC->InitFromFile(AliDataFile::GetFileNameOADB(Form("EMCAL/EMCALBadChannels%s.root", fLoad1DBadChMap ? "_1D" : "")).data(),"AliEMCALBadChannels");
+    arrayBC=(TObjArray*)AliTenderCache::Instance()->Add(cachePathBC,runBC,contBC->GetObject(runBC),kTRUE,fileBC);
+    delete contBC;
   }
-  
-  TObjArray *arrayBC=(TObjArray*)contBC->GetObject(runBC);
   if (!arrayBC)
   {
     AliError(Form("No external hot channel set for run number: %d", runBC));
-    delete contBC;
     return 2;
   }
   if(fLoad1DBadChMap){
@@ -1082,6 +1109,7 @@ Int_t AliEMCALTenderSupply::InitBadChannels()
     {
       AliError("Can not get EMCALBadChannelMap");
     }
+    h=(TH1C*)h->Clone();
     h->SetDirectory(0);
     fEMCALRecoUtils->SetEMCALChannelStatusMap1D(h);
   }else{
@@ -1098,13 +1126,12 @@ Int_t AliEMCALTenderSupply::InitBadChannels()
         AliError(Form("Can not get EMCALBadChannelMap_Mod%d",i));
         continue;
       }
+      h=(TH2I*)h->Clone();
       h->SetDirectory(0);
       fEMCALRecoUtils->SetEMCALChannelStatusMap(i,h);
     }
   }
 
-  delete contBC;
-  
   return 1;
 }
 
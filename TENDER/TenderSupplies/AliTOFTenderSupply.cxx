@@ -23,6 +23,7 @@
 // Contacts: Pietro.Antonioli@bo.infn.it                                     //
 //           Francesco.Noferini@bo.infn.it                                   //
 ///////////////////////////////////////////////////////////////////////////////
+#include <vector>
 #include <TFile.h>
 #include <TChain.h>
 
@@ -35,6 +36,7 @@
 #include <AliAnalysisManager.h>
 #include <AliESDpid.h>
 #include <AliTender.h>
+#include <AliTenderCache.h>
 
 #include <AliTOFcalib.h>
 #include <AliTOFT0maker.h>
@@ -72,6 +74,7 @@ AliTOFTenderSupply::AliTOFTenderSupply() :
   fUserRecoPass(0),
   fForceCorrectTRDBug(kFALSE),
   fT0Simulate(kFALSE),
+  fRecomputePID(kTRUE),
   fTOFPIDParams(0x0),
   fTOFCalib(0x0),
   fTOFT0maker(0x0),
@@ -115,6 +118,7 @@ AliTOFTenderSupply::AliTOFTenderSupply(const char *name, const AliTender *tender
   fUserRecoPass(0),
   fForceCorrectTRDBug(kFALSE),
   fT0Simulate(kFALSE),
+  fRecomputePID(kTRUE),
   fTOFPIDParams(0x0),
   fTOFCalib(0x0),
   fTOFT0maker(0x0),
@@ -327,9 +331,8 @@ void AliTOFTenderSupply::ProcessEvent()
 	if (fT0DetectorAdjust) {
 	  AliCDBManager* ocdbMan = AliCDBManager::Instance();
 	  ocdbMan->SetRun(fTender->GetRun());    
-	  AliCDBEntry *entry = ocdbMan->Get("T0/Calib/TimeAdjust/");
-	  if(entry) {
-	    AliT0CalibSeasonTimeShift *clb = (AliT0CalibSeasonTimeShift*) entry->GetObject();
+	  AliT0CalibSeasonTimeShift *clb = (AliT0CalibSeasonTimeShift*) AliTenderCache::Instance()->GetCDBObject(ocdbMan,"T0/Calib/TimeAdjust",fTender->GetRun());
+	  if(clb) {
 	    Float_t *t0means= clb->GetT0Means();
 	    //      Float_t *t0sigmas = clb->GetT0Sigmas();
 	    fT0shift[0] = t0means[0] + fT0IntercalibrationShift;
@@ -436,6 +439,7 @@ void AliTOFTenderSupply::ProcessEvent()
 
   // recalculate PID probabilities
   // this is for safety, especially if the user doesn't attach a PID tender after TOF tender  
+  if (!fRecomputePID) return;
   Int_t ntracks=event->GetNumberOfTracks();
   //  AliESDtrack *track = NULL;
   //  Float_t tzeroTrack = 0;
@@ -455,17 +459,48 @@ void AliTOFTenderSupply::RecomputeTExp(AliESDEvent *event) const
 {
   /*
    * calibrate TExp
+   * batched version of RecomputeTExp(AliESDtrack*): momentum and length
+   * of the matched tracks are gathered first, the expected times are
+   * computed species by species and then written back to the tracks
    */
 
-  
-  /* loop over tracks */
+  /* gather track params */
+  Int_t ntracks = event->GetNumberOfTracks();
+  std::vector<Int_t> index;
+  std::vector<Float_t> mom, length;
+  index.reserve(ntracks);
+  mom.reserve(ntracks);
+  length.reserve(ntracks);
   AliESDtrack *track = NULL;
-  for (Int_t itrk = 0; itrk < event->GetNumberOfTracks(); itrk++) {
-    /* get track and calibrate */
+  for (Int_t itrk = 0; itrk < ntracks; itrk++) {
     track = event->GetTrack(itrk);
-    RecomputeTExp(track);
+    if (!track || !(track->GetStatus() & AliESDtrack::kTOFout)) continue;
+    Float_t p = track->P();
+    if (track->GetInnerParam() && track->GetOuterParam()) {
+      Float_t pin = track->GetInnerParam()->P();
+      Float_t pout = track->GetOuterParam()->P();
+      p = 0.5 * (pin + pout);
+    }
+    index.push_back(itrk);
+    mom.push_back(p);
+    length.push_back(track->GetIntegratedLength());
   }
-  
+  const Int_t nTOF = index.size();
+  if (!nTOF) return;
+
+  /* compute expected times, light nuclei are not supported (set to 0) */
+  std::vector<Double_t> texp(nTOF*AliPID::kSPECIESC, 0.);
+  for (Int_t ipart = 0; ipart < AliPID::kSPECIES; ipart++) {
+    Float_t mass = AliPID::ParticleMass(ipart);
+    Double_t *tpart = &texp[ipart];
+    for (Int_t i = 0; i < nTOF; i++)
+      tpart[i*AliPID::kSPECIESC] = GetExpTimeTh(mass, mom[i], length[i]) - 37.;
+  }
+
+  /* scatter integrated times */
+  for (Int_t i = 0; i < nTOF; i++)
+    event->GetTrack(index[i])->SetIntegratedTimes(&texp[i*AliPID::kSPECIESC]);
+
 }
 
 //_____________________________________________________
@@ -1267,19 +1302,29 @@ void AliTOFTenderSupply::LoadTOFPIDParams(Int_t runNumber)
   if (fTOFPIDParams) delete fTOFPIDParams;
   fTOFPIDParams=0x0;
   
-  //  TFile *oadbf = new TFile("$ALICE_PHYSICS/OADB/COMMON/PID/data/TOFPIDParams.root");
-  TFile *oadbf = new TFile(Form("%s/COMMON/PID/data/TOFPIDParams.root",AliAnalysisManager::GetOADBPath()));
-  if (oadbf && oadbf->IsOpen()) {
-    AliInfo(Form("Tender loading TOF OADB Params from %s/COMMON/PID/data/TOFPIDParams.root",AliAnalysisManager::GetOADBPath()));
-    AliOADBContainer *oadbc = (AliOADBContainer *)oadbf->Get("TOFoadb");
-    Int_t passNr = fRecoPass;
-    if (fIsMC) passNr=2;   // this is because tender on MC is used only for pass2 LHC10
-    TString passName = Form("pass%d",passNr);
-    if (oadbc) fTOFPIDParams = dynamic_cast<AliTOFPIDParams *>(oadbc->GetObject(runNumber,"TOFparams",passName));
-    oadbf->Close();
-    delete oadbc;
+  Int_t passNr = fRecoPass;
+  if (fIsMC) passNr=2;   // this is because tender on MC is used only for pass2 LHC10
+  TString passName = Form("pass%d",passNr);
+  TString fileName = Form("%s/COMMON/PID/data/TOFPIDParams.root",AliAnalysisManager::GetOADBPath());
+  TString cachePath = Form("OADB/%s/TOFoadb/TOFparams/%s",fileName.Data(),passName.Data());
+
+  // the cache keeps its own copy, the supply owns fTOFPIDParams
+  TObject *cached = AliTenderCache::Instance()->Get(cachePath,runNumber,kTRUE,fileName);
+  if (cached) {
+    fTOFPIDParams = dynamic_cast<AliTOFPIDParams *>(cached->Clone());
+  } else {
+    //  TFile *oadbf = new TFile("$ALICE_PHYSICS/OADB/COMMON/PID/data/TOFPIDParams.root");
+    TFile *oadbf = new TFile(fileName);
+    if (oadbf && oadbf->IsOpen()) {
+      AliInfo(Form("Tender loading TOF OADB Params from %s",fileName.Data()));
+      AliOADBContainer *oadbc = (AliOADBContainer *)oadbf->Get("TOFoadb");
+      if (oadbc) fTOFPIDParams = dynamic_cast<AliTOFPIDParams *>(oadbc->GetObject(runNumber,"TOFparams",passName));
+      if (fTOFPIDParams) AliTenderCache::Instance()->Add(cachePath,runNumber,fTOFPIDParams,kTRUE,fileName);
+      oadbf->Close();
+      delete oadbc;
+    }
+    delete oadbf;
   }
-  delete oadbf;
 
   if (!fTOFPIDParams) {
     AliError(Form("TOFPIDParams.root not found in %s/COMMON/PID/data !!",AliAnalysisManager::GetOADBPath()));
@@ -46,6 +46,7 @@ public:
   void SetAutomaticSettings(Bool_t flag=kTRUE){fAutomaticSettings=flag;}
   void SetForceCorrectTRDBug(Bool_t flag=kTRUE){fForceCorrectTRDBug=flag;}
   void SetUserRecoPass(Int_t flag=0){fUserRecoPass=flag;}
+  void SetRecomputePID(Bool_t flag=kTRUE){fRecomputePID=flag;}
   Int_t GetRecoPass(void){return fRecoPass;}
   void DetectRecoPass();
 
@@ -89,6 +90,7 @@ private:
   Int_t  fUserRecoPass;      // when reco pass is selected by user
   Bool_t fForceCorrectTRDBug; // force TRD bug correction (for some bad MC production...)
   Bool_t fT0Simulate;        // ignore existing T0 data (if any) and simulate them
+  Bool_t fRecomputePID;      // recompute the TOF PID of the tracks (not needed if a PID task follows)
 
 
   // variables for TOF calibrations and timeZero setup
@@ -117,7 +119,7 @@ private:
   AliTOFTenderSupply(const AliTOFTenderSupply&c);
   AliTOFTenderSupply& operator= (const AliTOFTenderSupply&c);
 
-  ClassDef(AliTOFTenderSupply, 12);
+  ClassDef(AliTOFTenderSupply, 13);
 };
 
 
@@ -44,6 +44,7 @@
 #include <AliCDBEntry.h>
 #include <AliCDBRunRange.h>
 #include <AliTender.h>
+#include <AliTenderCache.h>
 #include <AliTPCcalibDButil.h>
 #include <AliPID.h>
 
@@ -62,7 +63,9 @@ fGainCorrection(kTRUE),
 fAttachmentCorrection(kFALSE),
 fPcorrection(kFALSE),
 fMultiCorrection(kFALSE),
+fRecomputePID(kTRUE),
 fArrPidResponseMaster(0x0),
+fPidResponseFromCache(kFALSE),
 fMultiCorrMean(0x0),
 fMultiCorrSigma(0x0),
 fSpecificStorages(0x0),
@@ -72,7 +75,11 @@ fGRP(0x0),
 fBeamType("PP"),
 fLHCperiod(),
 fMCperiod(),
-fRecoPass(0)
+fRecoPass(0),
+fTrackIndex(),
+fTrackZ(),
+fTrackTgl(),
+fTrackGain()
 {
   //
   // default ctor
@@ -91,7 +98,9 @@ fGainCorrection(kTRUE),
 fAttachmentCorrection(kFALSE),
 fPcorrection(kFALSE),
 fMultiCorrection(kFALSE),
+fRecomputePID(kTRUE),
 fArrPidResponseMaster(0x0),
+fPidResponseFromCache(kFALSE),
 fMultiCorrMean(0x0),
 fMultiCorrSigma(0x0),
 fSpecificStorages(0x0),
@@ -101,7 +110,11 @@ fGRP(0x0),
 fBeamType("PP"),
 fLHCperiod(),
 fMCperiod(),
-fRecoPass(0)
+fRecoPass(0),
+fTrackIndex(),
+fTrackZ(),
+fTrackTgl(),
+fTrackGain()
 {
   //
   // named ctor
@@ -182,27 +195,54 @@ void AliTPCTenderSupply::ProcessEvent()
   // - correct TPC signals
   // - recalculate PID probabilities for TPC
   // - correct TPC signal multiplicity dependence
+  //
+  // The tracks are recalibrated in batches: the inputs of the tracks with
+  // TPC information are gathered into contiguous buffers, the gain is
+  // computed in one loop and the results are written back to the tracks.
+
+  // nothing to do if the gain is not changed and the PID is not requested
+  Bool_t applyGain = !(corrFactor==1. && corrAttachSlope==0. && corrGainMultiplicityPbPb==1.);
+  if (!applyGain && !fRecomputePID) return;
 
+  // gather
   Int_t ntracks=event->GetNumberOfTracks();
+  fTrackIndex.clear();
+  fTrackZ.clear();
+  fTrackTgl.clear();
+  fTrackIndex.reserve(ntracks);
+  fTrackZ.reserve(ntracks);
+  fTrackTgl.reserve(ntracks);
   for(Int_t itrack = 0; itrack < ntracks; itrack++){
-    AliESDtrack *track=event->GetTrack(itrack);
-    const AliExternalTrackParam *inner=track->GetInnerParam();
+    const AliExternalTrackParam *inner=event->GetTrack(itrack)->GetInnerParam();
     
     // skip tracks without TPC information
     if (!inner) continue;
+    fTrackIndex.push_back(itrack);
+    fTrackZ.push_back(inner->GetZ());
+    fTrackTgl.push_back(inner->GetTgl());
+  }
+  const Int_t nTPC=fTrackIndex.size();
+
+  //calculate total gain correction factor given by
+  // o gain calibration factor
+  // o attachment correction
+  // o multiplicity correction in PbPb
+  if (applyGain){
+    fTrackGain.resize(nTPC);
+    const Double_t *z=nTPC ? &fTrackZ[0] : 0x0;
+    const Double_t *tgl=nTPC ? &fTrackTgl[0] : 0x0;
+    Double_t *gain=nTPC ? &fTrackGain[0] : 0x0;
+    for (Int_t i=0; i<nTPC; i++){
+      Float_t meanDrift= 250. - 0.5*TMath::Abs(2*z[i] + (247-83)*tgl[i]);
+      gain[i]=corrFactor*(1 + corrAttachSlope*180.)/(1 + corrAttachSlope*meanDrift)/corrGainMultiplicityPbPb;
+    }
+  }
 
-    //calculate total gain correction factor given by
-    // o gain calibration factor
-    // o attachment correction
-    // o multiplicity correction in PbPb
-    Float_t meanDrift= 250. - 0.5*TMath::Abs(2*inner->GetZ() + (247-83)*inner->GetTgl());
-    Double_t corrGainTotal=corrFactor*(1 + corrAttachSlope*180.)/(1 + corrAttachSlope*meanDrift)/corrGainMultiplicityPbPb;
-
-    // apply gain correction
-    track->SetTPCsignal(track->GetTPCsignal()*corrGainTotal ,track->GetTPCsignalSigma(), track->GetTPCsignalN());
-
-    // recalculate pid probabilities
-    fESDpid->MakeTPCPID(track);
+  // scatter: apply gain correction and recalculate pid probabilities
+  for (Int_t i=0; i<nTPC; i++){
+    AliESDtrack *track=event->GetTrack(fTrackIndex[i]);
+    if (applyGain) track->SetTPCsignal(track->GetTPCsignal()*fTrackGain[i] ,track->GetTPCsignalSigma(), track->GetTPCsignalN());
+    if (fRecomputePID) fESDpid->MakeTPCPID(track);
   }
 }
 
@@ -281,13 +321,11 @@ void AliTPCTenderSupply::SetSplines()
   //
   fPcorrection=kFALSE;
   
-  AliCDBEntry *entryGRP=fTender->GetCDBManager()->Get("GRP/GRP/Data",fTender->GetRun());
-  if (!entryGRP) {
+  fGRP = (AliGRPObject*)AliTenderCache::Instance()->GetCDBObject(fTender->GetCDBManager(),"GRP/GRP/Data",fTender->GetRun());
+  if (!fGRP) {
     AliError("No new GRP entry found");
-  } else {
-    fGRP = (AliGRPObject*)entryGRP->GetObject();
   }
-  if (fDebugLevel>1) AliInfo(Form("GRP entry used: %s",entryGRP->GetId().ToString().Data()));
+  if (fDebugLevel>1 && fGRP) AliInfo(Form("GRP entry used for run %d",fTender->GetRun()));
   
   fGainNew=0x0;
   fGainOld=0x0;
@@ -521,10 +559,12 @@ void AliTPCTenderSupply::SetParametrisation()
   }
   
   //Get CDB Entry with pid response parametrisations
-  AliCDBEntry *pidCDB=fTender->GetCDBManager()->Get("TPC/Calib/PidResponse",fTender->GetRun());
-  if (!fArrPidResponseMaster && pidCDB){
-    fArrPidResponseMaster=dynamic_cast<TObjArray*>(pidCDB->GetObject());
-    AliInfo(Form("Using pid response objects: %s",pidCDB->GetId().ToString().Data()));
+  // an array set with SetResponseFunctions is kept; the one from the cache may be
+  // dropped when the cache moves to other runs, so it is refetched for every run
+  if (!fArrPidResponseMaster || fPidResponseFromCache){
+    fArrPidResponseMaster=dynamic_cast<TObjArray*>(AliTenderCache::Instance()->GetCDBObject(fTender->GetCDBManager(),"TPC/Calib/PidResponse",fTender->GetRun()));
+    fPidResponseFromCache=(fArrPidResponseMaster!=0x0);
+    if (fArrPidResponseMaster) AliInfo(Form("Using pid response objects for run %d",fTender->GetRun()));
   }
 
   if (!fArrPidResponseMaster){
@@ -10,6 +10,7 @@
 //                                                                    //
 ////////////////////////////////////////////////////////////////////////
 
+#include <vector>
 #include <TString.h>
 
 #include <AliTenderSupply.h>
@@ -34,7 +35,8 @@ public:
   void SetAttachmentCorrection(Bool_t attCorr) {fAttachmentCorrection=attCorr;}
   void SetDebugLevel(Int_t level)         {fDebugLevel=level;}
   void SetMip(Double_t mip)               {fMip=mip;}
-  void SetResponseFunctions(TObjArray *arr) {fArrPidResponseMaster=arr;}
+  void SetResponseFunctions(TObjArray *arr) {fArrPidResponseMaster=arr; fPidResponseFromCache=kFALSE;}
+  void SetRecomputePID(Bool_t recompute)  {fRecomputePID=recompute;}
   Double_t GetMultiplicityCorrectionMean(Double_t tpcMulti);
   Double_t GetMultiplicityCorrectionSigma(Double_t tpcMulti);
 
@@ -54,7 +56,9 @@ private:
   Bool_t fAttachmentCorrection;      //  Perform attachment correction
   Bool_t fPcorrection;               //!Perform pressure correction
   Bool_t fMultiCorrection;           //!Perform multiplicity correction
+  Bool_t fRecomputePID;              //  Recompute the TPC PID probabilities of the tracks
   TObjArray *fArrPidResponseMaster;  //array with gain curves
+  Bool_t fPidResponseFromCache;      //!fArrPidResponseMaster was taken from the tender cache (not user supplied)
   TF1 *fMultiCorrMean;               //!multiplicity correction for mean
   TF1 *fMultiCorrSigma;              //!multiplicity correction for resolution
   TObjArray *fSpecificStorages;      //array with specific storages
@@ -69,6 +73,12 @@ private:
   TString fMCperiod;                 //! corresponding MC period to use for the splines
   Int_t   fRecoPass;                 //! reconstruction pass
 
+  // per event track buffers of the batched recalibration
+  std::vector<Int_t>    fTrackIndex; //! index of the tracks with TPC information
+  std::vector<Double_t> fTrackZ;     //! z of the inner param
+  std::vector<Double_t> fTrackTgl;   //! tan(lambda) of the inner param
+  std::vector<Double_t> fTrackGain;  //! total gain correction
+
   void SetSplines();
   Double_t GetGainCorrection();
 
@@ -82,7 +92,7 @@ private:
   AliTPCTenderSupply(const AliTPCTenderSupply&c);
   AliTPCTenderSupply& operator= (const AliTPCTenderSupply&c);
   
-  ClassDef(AliTPCTenderSupply, 2);  // TPC tender task
+  ClassDef(AliTPCTenderSupply, 3);  // TPC tender task
 };
 
 
@@ -23,6 +23,7 @@
 #include <TSystem.h>
 #include "AliESDEvent.h"
 #include "AliTender.h"
+#include "AliTenderCache.h"
 #include "AliVParticle.h"
 #include "AliLog.h"
 #include "AliOADBContainer.h"
@@ -167,12 +168,20 @@ void AliTrackFixTenderSupply::CorrectTrackPtInv(AliExternalTrackParam* trc, Int_
 }
 
 //_____________________________________________________
-Bool_t AliTrackFixTenderSupply::LoadOADBObjects()
+TString AliTrackFixTenderSupply::GetOADBFileName() const
 {
-  // Load OADB parameters
+  // expanded name of the OADB file
   TString fileName = fOADBObjPath;
   if (fileName.BeginsWith("$OADB")) fileName.ReplaceAll("$OADB",Form("%s/",AliAnalysisManager::GetOADBPath()));
   gSystem->ExpandPathName(fileName);
+  return fileName;
+}
+
+//_____________________________________________________
+Bool_t AliTrackFixTenderSupply::LoadOADBObjects()
+{
+  // Load OADB parameters
+  TString fileName = GetOADBFileName();
   AliInfo(Form("Loading correction parameters %s from %s",fOADBObjName.Data(),fileName.Data()));
   //
   fOADBCont = new AliOADBContainer("OADB");
@@ -191,8 +200,12 @@ Bool_t AliTrackFixTenderSupply::GetRunCorrections(int run)
 {
   // extract corrections for given run
   fParams = 0;
+  TString cachePath = Form("OADB/%s/%s/default",fOADBObjPath.Data(),fOADBObjName.Data());
+  TString fileName = GetOADBFileName();
+  fParams = dynamic_cast<AliOADBTrackFix*>(AliTenderCache::Instance()->Get(cachePath,run,kTRUE,fileName));
+  if (fParams) {AliInfo(Form("Loaded cached correction parameters for run %d",run)); return kTRUE;}
   if (!fOADBCont) if (!LoadOADBObjects()) return kFALSE;
-  fParams = dynamic_cast<AliOADBTrackFix*>(fOADBCont->GetObject(run,"default"));
+  fParams = dynamic_cast<AliOADBTrackFix*>(AliTenderCache::Instance()->Add(cachePath,run,fOADBCont->GetObject(run,"default"),kTRUE,fileName));
   if (!fParams) {AliError(Form("No correction parameters for found for run %d",run)); return kFALSE;}
   AliInfo(Form("Loaded correction parameters for run %d",run));
   //
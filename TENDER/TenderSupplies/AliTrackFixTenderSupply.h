@@ -37,6 +37,7 @@ public:
   void     CorrectTrackPtInv(AliExternalTrackParam* trc, int mode, double sideAfraction, double phi) const;
   Bool_t   GetRunCorrections(int run);
   Bool_t   LoadOADBObjects();
+  TString  GetOADBFileName() const;
   //
   void     SetOADBObjPath(const char* path)        { fOADBObjPath = path; }
   void     SetOADBObjName(const char* name)        { fOADBObjName = name; }
@@ -25,6 +25,7 @@
 #include <AliESDInputHandler.h>
 #include <AliVertexerTracks.h>
 #include <AliTender.h>
+#include <AliTenderCache.h>
 #include <AliCDBId.h>
 #include <AliCDBManager.h>
 #include <AliCDBEntry.h>
@@ -74,12 +75,10 @@ void AliVtxTenderSupply::ProcessEvent()
 
   if (fTender->RunChanged()){
     fDiamond=0x0;
-    AliCDBEntry *meanVertex=fTender->GetCDBManager()->Get("GRP/Calib/MeanVertex",fTender->GetRun());
-    if (!meanVertex) {
+    fDiamond=(AliESDVertex*)AliTenderCache::Instance()->GetCDBObject(fTender->GetCDBManager(),"GRP/Calib/MeanVertex",fTender->GetRun());
+    if (!fDiamond) {
       AliError("No new MeanVertex entry found");
       return;
-    } else {
-      fDiamond=(AliESDVertex*)meanVertex->GetObject();
     }
     //printf("\nRun %d, sigmaX %f, sigmaY %f\n",fTender->GetRun(),fDiamond->GetXRes(),fDiamond->GetYRes());
   }